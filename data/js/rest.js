@@ -180,6 +180,14 @@ pixelix.rest.Client.prototype.getSensors = function() {
     });
 };
 
+pixelix.rest.Client.prototype.getProfiler = function() {
+    return utils.makeRequest({
+        method: "GET",
+        url: "/rest/api/v1/profiler",
+        isJsonResponse: true
+    });
+};
+
 pixelix.rest.Client.prototype.getSettingKeys = function() {
     return utils.makeRequest({
         method: "GET",
@@ -0,0 +1,265 @@
+"""
+MIT License
+
+Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+================================================================================
+================================================================================
+Create a streamable animation (.anim) from an animated GIF (.gif) or a sprite
+sheet texture (.bmp). The frames are stored as 8-bit palette indices with
+run-length encoding.
+
+"""
+
+import argparse
+import struct
+import sys
+from PIL import Image, ImageSequence
+
+MAGIC               = b"PXAN"
+VERSION             = 1
+FLAG_REPEAT         = 0x01
+HEADER_SIZE         = 16
+PALETTE_ENTRY_SIZE  = 3
+FRAME_ENTRY_SIZE    = 6
+MAX_PALETTE_SIZE    = 256
+MAX_PACKET_LENGTH   = 128
+MIN_RUN_LENGTH      = 3
+
+def load_gif(filename):
+    """Load all frames of an animated GIF with their delays in ms."""
+    frames = []
+
+    with Image.open(filename) as img:
+        for frame in ImageSequence.Iterator(img):
+            delay = frame.info.get("duration", 0)
+            frames.append((frame.convert("RGB"), delay))
+
+    return frames
+
+def load_texture(filename, frame_width, frame_height, frames_cnt, fps):
+    """Cut a sprite sheet texture into its frames, all with the same delay in ms."""
+    frames = []
+    delay = 1000 // fps
+
+    with Image.open(filename) as img:
+        texture = img.convert("RGB")
+
+    frames_x = texture.width // frame_width
+    frames_y = texture.height // frame_height
+
+    if frames_cnt == 0:
+        frames_cnt = frames_x * frames_y
+
+    for index in range(frames_cnt):
+        x = (index % frames_x) * frame_width
+        y = (index // frames_x) * frame_height
+        frames.append((texture.crop((x, y, x + frame_width, y + frame_height)), delay))
+
+    return frames
+
+def create_palette(frames):
+    """Create the palette and the palette indices of every frame."""
+    colors = {}
+    indexed_frames = []
+
+    for frame, _ in frames:
+        for color in frame.getdata():
+            if color not in colors:
+                colors[color] = len(colors)
+
+    if len(colors) <= MAX_PALETTE_SIZE:
+        palette = list(colors.keys())
+
+        for frame, _ in frames:
+            indexed_frames.append([colors[color] for color in frame.getdata()])
+    else:
+        # Too many colors, therefore quantize all frames together to get a common palette.
+        width = frames[0][0].width
+        height = frames[0][0].height
+        strip = Image.new("RGB", (width, height * len(frames)))
+
+        for index, (frame, _) in enumerate(frames):
+            strip.paste(frame, (0, index * height))
+
+        quantized = strip.quantize(colors=MAX_PALETTE_SIZE)
+        raw_palette = quantized.getpalette()[:MAX_PALETTE_SIZE * PALETTE_ENTRY_SIZE]
+        palette = [tuple(raw_palette[idx:idx + PALETTE_ENTRY_SIZE]) for idx in range(0, len(raw_palette), PALETTE_ENTRY_SIZE)]
+        data = list(quantized.getdata())
+        pixels_per_frame = width * height
+
+        for index in range(len(frames)):
+            indexed_frames.append(data[index * pixels_per_frame:(index + 1) * pixels_per_frame])
+
+    return palette, indexed_frames
+
+def encode_rle(indices):
+    """Run-length encode the palette indices of a frame."""
+    data = bytearray()
+    literals = []
+    idx = 0
+
+    while idx < len(indices):
+        run = 1
+
+        while (idx + run < len(indices)) and (indices[idx + run] == indices[idx]) and (run < MAX_PACKET_LENGTH):
+            run += 1
+
+        if run >= MIN_RUN_LENGTH:
+            if len(literals) > 0:
+                data.append(len(literals) - 1)
+                data.extend(literals)
+                literals = []
+
+            data.append(0x80 | (run - 1))
+            data.append(indices[idx])
+            idx += run
+        else:
+            literals.append(indices[idx])
+            idx += 1
+
+            if len(literals) == MAX_PACKET_LENGTH:
+                data.append(len(literals) - 1)
+                data.extend(literals)
+                literals = []
+
+    if len(literals) > 0:
+        data.append(len(literals) - 1)
+        data.extend(literals)
+
+    return data
+
+def create_animation(width, height, palette, indexed_frames, delays, repeat):
+    """Create the content of the animation file."""
+    flags = FLAG_REPEAT if repeat is True else 0
+    header = MAGIC + struct.pack("<BBHHHHH", VERSION, flags, width, height, len(indexed_frames), len(palette), 0)
+    palette_data = bytearray()
+    frame_table = bytearray()
+    frame_data = bytearray()
+    offset = HEADER_SIZE + len(palette) * PALETTE_ENTRY_SIZE + len(indexed_frames) * FRAME_ENTRY_SIZE
+
+    for color in palette:
+        palette_data.extend(bytes(color))
+
+    for indices, delay in zip(indexed_frames, delays):
+        encoded = encode_rle(indices)
+        frame_table.extend(struct.pack("<IH", offset + len(frame_data), min(delay, 0xFFFF)))
+        frame_data.extend(encoded)
+
+    return header + palette_data + frame_table + frame_data
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Create a streamable animation file.")
+
+    parser.add_argument(
+        "--frameWidth",
+        dest="frame_width",
+        type=int,
+        default=0,
+        help="Frame width in pixels. Only necessary for a .bmp texture."
+    )
+
+    parser.add_argument(
+        "--frameHeight",
+        dest="frame_height",
+        type=int,
+        default=0,
+        help="Frame height in pixels. Only necessary for a .bmp texture."
+    )
+
+    parser.add_argument(
+        "--framesCnt",
+        dest="frames_cnt",
+        type=int,
+        required=False,
+        default=0,
+        help="Specify number of frames in case the texture contains gaps. (Default: Derived from texture and frame size.)"
+    )
+
+    parser.add_argument(
+        "--fps",
+        dest="fps",
+        type=int,
+        default=12,
+        help="Frames per second, only used for a .bmp texture. (Default: 12)"
+    )
+
+    parser.add_argument(
+        "--repeat",
+        dest="repeat",
+        type=str,
+        required=False,
+        default="true",
+        help="Repeat animation infinite. If false it will run just once. (Default: true)"
+    )
+
+    parser.add_argument(
+        "image_filename",
+        metavar="imageFilename",
+        type=str,
+        help="Animated GIF (.gif) or sprite sheet texture (.bmp)."
+    )
+
+    parser.add_argument(
+        "animation_filename",
+        metavar="animationFilename",
+        type=str,
+        help="Animation filename, which to create (.anim)."
+    )
+
+    args = parser.parse_args()
+
+    if args.image_filename.endswith(".gif") is True:
+        frames = load_gif(args.image_filename)
+    elif args.image_filename.endswith(".bmp") is True:
+        if (args.frame_width <= 0) or (args.frame_height <= 0):
+            print('The frame size is required for a sprite sheet texture.')
+            sys.exit(1)
+
+        frames = load_texture(args.image_filename, args.frame_width, args.frame_height, args.frames_cnt, args.fps)
+    else:
+        print(f'{args.image_filename} is not supported. Only .gif and .bmp files.')
+        sys.exit(1)
+
+    if len(frames) == 0:
+        print('No frames found.')
+        sys.exit(1)
+
+    print(f'{len(frames)} frames with {frames[0][0].width} x {frames[0][0].height} pixels.')
+
+    palette, indexed_frames = create_palette(frames)
+
+    print(f'{len(palette)} colors in the palette.')
+
+    repeat = True
+    if args.repeat.lower() == "false":
+        repeat = False
+
+    animation_filename = args.animation_filename
+    if animation_filename.endswith(".anim") is False:
+        animation_filename += ".anim"
+
+    content = create_animation(frames[0][0].width, frames[0][0].height, palette, indexed_frames, [delay for _, delay in frames], repeat)
+
+    with open(animation_filename, 'wb') as outfile:
+        outfile.write(content)
+
+    print(f'"{animation_filename}" animation with {len(content)} bytes created.')
@@ -40,9 +40,21 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_PLUGIN_ARENA_SLOTS
+
+/**
+ * Number of statically reserved plugin slots. Every slot has the size of the
+ * largest compiled-in plugin type. If 0, all plugins are allocated on the heap.
+ */
+#define CONFIG_PLUGIN_ARENA_SLOTS   (0U)
+
+#endif  /* CONFIG_PLUGIN_ARENA_SLOTS */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
+#include <stddef.h>
+#include <new>
 #include "IPluginMaintenance.hpp"
 
 /** List with all compiled-in plugins. */
@@ -57,16 +69,105 @@ namespace PluginList
  * Types and Classes
  *****************************************************************************/
 
+/**
+ * Plugin creation function, which constructs the plugin in the given memory.
+ */
+typedef IPluginMaintenance* (*CreateInPlaceFunc)(void* mem, const String& name, uint16_t uid);
+
 /**
  * Plugin list element.
  */
 typedef struct
 {
-    const char*                     name;       /**< Name of plugin type. */
-    IPluginMaintenance::CreateFunc  createFunc; /**< Plugin creation function */
+    const char*                     name;               /**< Name of plugin type. */
+    IPluginMaintenance::CreateFunc  createFunc;         /**< Plugin creation function */
+    CreateInPlaceFunc               createInPlaceFunc;  /**< Plugin creation function, using given memory */
+    size_t                          size;               /**< Plugin object size in byte */
 
 } Element;
 
+/**
+ * Determines the max. size of the given types at compile time.
+ *
+ * @tparam TTypes   Types
+ */
+template < typename... TTypes >
+struct MaxSizeOf;
+
+/**
+ * Max. size of a single type.
+ *
+ * @tparam T    Type
+ */
+template < typename T >
+struct MaxSizeOf<T>
+{
+    static constexpr size_t value = sizeof(T);  /**< Max. size in byte */
+};
+
+/**
+ * Max. size of several types.
+ *
+ * @tparam T        First type
+ * @tparam TRest    Remaining types
+ */
+template < typename T, typename... TRest >
+struct MaxSizeOf<T, TRest...>
+{
+    /** Max. size in byte */
+    static constexpr size_t value = (sizeof(T) > MaxSizeOf<TRest...>::value) ? sizeof(T) : MaxSizeOf<TRest...>::value;
+};
+
+/**
+ * Determines the max. alignment of the given types at compile time.
+ *
+ * @tparam TTypes   Types
+ */
+template < typename... TTypes >
+struct MaxAlignOf;
+
+/**
+ * Max. alignment of a single type.
+ *
+ * @tparam T    Type
+ */
+template < typename T >
+struct MaxAlignOf<T>
+{
+    static constexpr size_t value = alignof(T);  /**< Max. alignment in byte */
+};
+
+/**
+ * Max. alignment of several types.
+ *
+ * @tparam T        First type
+ * @tparam TRest    Remaining types
+ */
+template < typename T, typename... TRest >
+struct MaxAlignOf<T, TRest...>
+{
+    /** Max. alignment in byte */
+    static constexpr size_t value = (alignof(T) > MaxAlignOf<TRest...>::value) ? alignof(T) : MaxAlignOf<TRest...>::value;
+};
+
+/**
+ * Construct a plugin in the given memory.
+ *
+ * @tparam TPlugin  Plugin type
+ *
+ * @param[in] mem   Memory, which is large enough for the plugin.
+ * @param[in] name  Plugin name
+ * @param[in] uid   Plugin UID
+ *
+ * @return Plugin
+ */
+template < typename TPlugin >
+IPluginMaintenance* createInPlace(void* mem, const String& name, uint16_t uid)
+{
+    /* The global placement new is used, because the plugins provide their own operator new. */
+    return ::new(mem) TPlugin(name, uid);
+}
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
@@ -80,6 +181,31 @@ typedef struct
  */
 const Element* getList(uint8_t& length);
 
+/**
+ * Allocate a free slot of the static plugin arena.
+ * Every slot is large enough for each of the compiled-in plugin types.
+ *
+ * @return If a slot is free, it will return its memory otherwise nullptr.
+ */
+void* allocateSlot();
+
+/**
+ * Destroy a plugin, which was constructed in a slot of the static plugin
+ * arena, and release the slot. A plugin outside the arena is not touched.
+ *
+ * @param[in] plugin    Plugin
+ *
+ * @return If the plugin was in the arena, it will return true otherwise false.
+ */
+bool releaseSlot(IPluginMaintenance* plugin);
+
+/**
+ * Get the slot size of the static plugin arena.
+ *
+ * @return Slot size in byte, which is the size of the largest plugin type.
+ */
+size_t getSlotSize();
+
 };
 
 #endif  /* PLUGIN_LIST_HPP */
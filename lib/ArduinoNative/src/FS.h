@@ -181,7 +181,7 @@ public:
     bool exists(const char* path)
     {
         bool    itExists    = false;
-        FILE*   fd          = fopen("path", "r");
+        FILE*   fd          = fopen(path, "r");
 
         if (nullptr != fd)
         {
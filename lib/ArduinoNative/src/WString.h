@@ -436,6 +436,64 @@ public:
         return 0 == strncmp(&m_buffer[offset], s2.m_buffer, s2.length());
     }
 
+    /**
+     * Ends string with given pattern?
+     *
+     * @param[in] suffix    Pattern
+     *
+     * @return If string ends with pattern, it will return true otherwise false.
+     */
+    unsigned char endsWith(const String &suffix) const
+    {
+        if((length() < suffix.length()) ||
+           (nullptr == m_buffer) ||
+           (nullptr == suffix.m_buffer))
+        {
+            return 0;
+        }
+
+        return 0 == strcmp(&m_buffer[length() - suffix.length()], suffix.m_buffer);
+    }
+
+    /**
+     * Reserve memory for the given number of characters.
+     *
+     * @param[in] size  Number of characters, without string termination
+     *
+     * @return If successful, it will return 1 otherwise 0.
+     */
+    unsigned char reserve(unsigned int size)
+    {
+        unsigned char isSuccessful = 1;
+
+        if (m_size <= size)
+        {
+            char* tmp = new char[size + 1U];
+
+            if (nullptr == tmp)
+            {
+                isSuccessful = 0;
+            }
+            else
+            {
+                if (nullptr == m_buffer)
+                {
+                    tmp[0] = '\0';
+                }
+                else
+                {
+                    strcpy(tmp, m_buffer);
+                    delete[] m_buffer;
+                }
+
+                m_buffer    = tmp;
+                m_size      = size + 1U;
+            }
+        }
+
+        return isSuccessful;
+    }
+
     /**
      * Clear string.
      */
@@ -0,0 +1,101 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  FreeRTOS stuff for test
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup test
+ *
+ * @{
+ */
+
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/** Wait infinite */
+#define portMAX_DELAY                   (0xFFFFFFFFU)
+
+/** Convert milliseconds to ticks. One tick is one millisecond. */
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(ms))
+
+/** Boolean true */
+#define pdTRUE                          (1)
+
+/** Boolean false */
+#define pdFALSE                         (0)
+
+/** Success */
+#define pdPASS                          (pdTRUE)
+
+/** Failed */
+#define pdFAIL                          (pdFALSE)
+
+/** Unlocked spinlock initializer */
+#define portMUX_INITIALIZER_UNLOCKED    (0)
+
+/** The test runs single threaded, therefore entering a critical section does nothing. */
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+
+/** The test runs single threaded, therefore leaving a critical section does nothing. */
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** Tick type */
+typedef uint32_t TickType_t;
+
+/** Base type */
+typedef int BaseType_t;
+
+/** Unsigned base type */
+typedef unsigned int UBaseType_t;
+
+/** Spinlock type */
+typedef int portMUX_TYPE;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* FREERTOS_H */
+
+/** @} */
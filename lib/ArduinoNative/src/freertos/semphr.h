@@ -0,0 +1,204 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  FreeRTOS semaphore stuff for test
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * The test runs single threaded. A semaphore is therefore only a counter,
+ * which is used to detect a wrong usage like giving a not taken mutex.
+ *
+ * @addtogroup test
+ *
+ * @{
+ */
+
+#ifndef SEMPHR_H
+#define SEMPHR_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "FreeRTOS.h"
+#include <new>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Semaphore for test.
+ */
+struct NativeSemaphore
+{
+    bool        isRecursive;    /**< Is it a recursive mutex? */
+    uint32_t    takenCnt;       /**< How often is the mutex taken? */
+};
+
+/** Semaphore handle */
+typedef NativeSemaphore* SemaphoreHandle_t;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Create a mutex.
+ *
+ * @return If successful, it will return the mutex handle otherwise nullptr.
+ */
+static inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    SemaphoreHandle_t handle = new(std::nothrow) NativeSemaphore;
+
+    if (nullptr != handle)
+    {
+        handle->isRecursive = false;
+        handle->takenCnt    = 0U;
+    }
+
+    return handle;
+}
+
+/**
+ * Create a recursive mutex.
+ *
+ * @return If successful, it will return the mutex handle otherwise nullptr.
+ */
+static inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+    SemaphoreHandle_t handle = xSemaphoreCreateMutex();
+
+    if (nullptr != handle)
+    {
+        handle->isRecursive = true;
+    }
+
+    return handle;
+}
+
+/**
+ * Delete a semaphore.
+ *
+ * @param[in] handle    Semaphore handle
+ */
+static inline void vSemaphoreDelete(SemaphoreHandle_t handle)
+{
+    delete handle;
+}
+
+/**
+ * Take a mutex. Because the test runs single threaded, a taken mutex can
+ * never be given by someone else and taking it fails immediately.
+ *
+ * @param[in] handle    Mutex handle
+ * @param[in] blockTime Max. time in ticks to wait (not used)
+ *
+ * @return If taken, it will return pdTRUE otherwise pdFALSE.
+ */
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t blockTime)
+{
+    BaseType_t result = pdFALSE;
+
+    (void)blockTime;
+
+    if ((nullptr != handle) &&
+        (0U == handle->takenCnt))
+    {
+        handle->takenCnt = 1U;
+        result = pdTRUE;
+    }
+
+    return result;
+}
+
+/**
+ * Give a mutex.
+ *
+ * @param[in] handle    Mutex handle
+ *
+ * @return If given, it will return pdTRUE otherwise pdFALSE.
+ */
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t handle)
+{
+    BaseType_t result = pdFALSE;
+
+    if ((nullptr != handle) &&
+        (0U < handle->takenCnt))
+    {
+        --handle->takenCnt;
+        result = pdTRUE;
+    }
+
+    return result;
+}
+
+/**
+ * Take a recursive mutex.
+ *
+ * @param[in] handle    Mutex handle
+ * @param[in] blockTime Max. time in ticks to wait (not used)
+ *
+ * @return If taken, it will return pdTRUE otherwise pdFALSE.
+ */
+static inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t handle, TickType_t blockTime)
+{
+    BaseType_t result = pdFALSE;
+
+    (void)blockTime;
+
+    if (nullptr != handle)
+    {
+        ++handle->takenCnt;
+        result = pdTRUE;
+    }
+
+    return result;
+}
+
+/**
+ * Give a recursive mutex.
+ *
+ * @param[in] handle    Mutex handle
+ *
+ * @return If given, it will return pdTRUE otherwise pdFALSE.
+ */
+static inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t handle)
+{
+    return xSemaphoreGive(handle);
+}
+
+#endif  /* SEMPHR_H */
+
+/** @} */
@@ -32,11 +32,19 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
+
+/* The HTTP client depends on the TCP/IP stack of the target. In the native
+ * test environment only the response parser is available.
+ */
+#ifndef NATIVE
+
 #include "AsyncHttpClient.h"
 
 #include <Util.h>
 #include <Logging.h>
 #include <base64.h>
+#include <Profiler.hpp>
+#include <AllocTracker.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -122,6 +130,7 @@ AsyncHttpClient::AsyncHttpClient() :
                                 memset(&evt, 0, sizeof(evt));
                                 evt.id = EVENT_ID_CONNECTED;
 
+                                evt.timestamp = micros();
                                 (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
                             });
 
@@ -135,6 +144,7 @@ AsyncHttpClient::AsyncHttpClient() :
                                     memset(&evt, 0, sizeof(evt));
                                     evt.id = EVENT_ID_DISCONNECTED;
                                     
+                                    evt.timestamp = micros();
                                     (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
                                 });
 
@@ -149,6 +159,7 @@ AsyncHttpClient::AsyncHttpClient() :
                                 evt.id      = EVENT_ID_ERROR;
                                 evt.u.error = error;
 
+                                evt.timestamp = micros();
                                 (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
                             });
 
@@ -160,7 +171,7 @@ AsyncHttpClient::AsyncHttpClient() :
 
                             memset(&evt, 0, sizeof(evt));
                             evt.id          = EVENT_ID_DATA;
-                            evt.u.data.data = new(std::nothrow) uint8_t[len];
+                            evt.u.data.data = AllocTracker::getInstance().newArray<uint8_t>(AllocTracker::TAG_HTTP, len);
 
                             if (nullptr == evt.u.data.data)
                             {
@@ -174,6 +185,7 @@ AsyncHttpClient::AsyncHttpClient() :
                                 memcpy(evt.u.data.data, data, len);
                             }
 
+                            evt.timestamp = micros();
                             (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
                         });
 
@@ -187,6 +199,7 @@ AsyncHttpClient::AsyncHttpClient() :
                                 evt.id          = EVENT_ID_TIMEOUT;
                                 evt.u.timeout   = timeout;
 
+                                evt.timestamp = micros();
                                 (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
                             });
 }
@@ -566,7 +579,7 @@ void AsyncHttpClient::clearEvtQueue()
         {
             if (nullptr != evt.u.data.data)
             {
-                delete[] evt.u.data.data;
+                AllocTracker::getInstance().deleteArray(evt.u.data.data);
                 evt.u.data.data = nullptr;
                 evt.u.data.size = 0U;
             }
@@ -641,6 +654,8 @@ void AsyncHttpClient::processEvtQueue()
 
     while(true == m_evtQueue.receive(&evt, 0U))
     {
+        Profiler::getInstance().getHttpClientQueue().record(micros() - evt.timestamp);
+
         switch(evt.id)
         {
         case EVENT_ID_CONNECTED:
@@ -660,7 +675,7 @@ void AsyncHttpClient::processEvtQueue()
 
             if (nullptr != evt.u.data.data)
             {
-                delete[] evt.u.data.data;
+                AllocTracker::getInstance().deleteArray(evt.u.data.data);
                 evt.u.data.data = nullptr;
                 evt.u.data.size = 0U;
             }
@@ -766,9 +781,12 @@ void AsyncHttpClient::onData(const uint8_t* data, size_t len)
         case RESPONSE_PART_STATUS_LINE:
             if (true == parseRspStatusLine(asciiData, len, index))
             {
-                LOG_DEBUG("Rsp. HTTP-Version: %s", m_rsp.getHttpVersion().c_str());
+                HttpStringView httpVersion  = m_rsp.getHttpVersion();
+                HttpStringView reasonPhrase = m_rsp.getReasonPhrase();
+
+                LOG_DEBUG("Rsp. HTTP-Version: %.*s", static_cast<int>(httpVersion.length()), httpVersion.data());
                 LOG_DEBUG("Rsp. Status-Code: %u", m_rsp.getStatusCode());
-                LOG_DEBUG("Rsp. Reason-Phrase: %s", m_rsp.getReasonPhrase().c_str());
+                LOG_DEBUG("Rsp. Reason-Phrase: %.*s", static_cast<int>(reasonPhrase.length()), reasonPhrase.data());
 
                 m_rspPart = RESPONSE_PART_HEADER;
             }
@@ -1177,8 +1195,8 @@ bool AsyncHttpClient::isEOL(const String& str, size_t& len)
 
 bool AsyncHttpClient::handleRspHeader()
 {
-    bool    isSuccess = true;
-    String  value;
+    bool            isSuccess = true;
+    HttpStringView  value;
 
     /* Connection = "Connection" ":" 1#(connection-token)
      * connection-token = token
@@ -1192,7 +1210,7 @@ bool AsyncHttpClient::handleRspHeader()
     if (false == value.isEmpty())
     {
         /* Server closes the connection after the response? */
-        if (0 <= value.indexOf("close"))
+        if (true == value.containsIgnoreCase("close"))
         {
             /* Client want a permanent connection? */
             if (true == m_isKeepAlive)
@@ -1207,7 +1225,10 @@ bool AsyncHttpClient::handleRspHeader()
 
     if (false == value.isEmpty())
     {
-        m_contentLength = value.toInt();
+        uint32_t contentLength = 0U;
+
+        (void)value.toUInt32(contentLength);
+        m_contentLength = contentLength;
     }
     else
     {
@@ -1219,7 +1240,7 @@ bool AsyncHttpClient::handleRspHeader()
     if (false == value.isEmpty())
     {
         /* Only IDENTITY (default) and CHUNKED transfer coding are supported. */
-        if (0U != value.equalsIgnoreCase("chunked"))
+        if (true == value.equalsIgnoreCase("chunked"))
         {
             m_transferCoding = TRANSFER_CODING_CHUNKED;
         }
@@ -1424,60 +1445,14 @@ bool AsyncHttpClient::parseChunkedResponse(const uint8_t* data, size_t len, size
 
 bool AsyncHttpClient::parseRspStatusLine(const char* data, size_t len, size_t& index)
 {
-    bool isStatusLineEOF = false;
-
-    while((len > index) && (false == isStatusLineEOF))
-    {
-        size_t terminatorLen = 0U;
-
-        m_rspLine += data[index];
-        ++index;
-
-        if (true == isEOL(m_rspLine, terminatorLen))
-        {
-            m_rspLine.remove(m_rspLine.length() - terminatorLen);
-
-            m_rsp.addStatusLine(m_rspLine);
-
-            isStatusLineEOF = true;
-            m_rspLine.clear();
-        }
-    }
-
-    return isStatusLineEOF;
+    /* The status line is parsed in place in the response header block. */
+    return m_rsp.parseStatusLine(data, len, index);
 }
 
 bool AsyncHttpClient::parseRspHeader(const char* data, size_t len, size_t& index)
 {
-    bool isHeaderEOF = false;
-
-    while((len > index) && (false == isHeaderEOF))
-    {
-        size_t terminatorLen = 0U;
-
-        m_rspLine += data[index];
-        ++index;
-
-        if (true == isEOL(m_rspLine, terminatorLen))
-        {
-            if (terminatorLen < m_rspLine.length())
-            {
-                m_rspLine.remove(m_rspLine.length() - terminatorLen);
-
-                LOG_DEBUG("Rsp. header: %s", m_rspLine.c_str());
-
-                m_rsp.addHeader(m_rspLine);
-            }
-            else
-            {
-                isHeaderEOF = true;
-            }
-
-            m_rspLine.clear();
-        }
-    }
-
-    return isHeaderEOF;
+    /* The header fields are indexed in place in the response header block. */
+    return m_rsp.parseHeader(data, len, index);
 }
 
 void AsyncHttpClient::notifyResponse()
@@ -1673,3 +1648,5 @@ void AsyncHttpClient::giveGlobalMutex()
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+#endif  /* NATIVE */
@@ -283,7 +283,8 @@ private:
      */
     struct Event
     {
-        EventId     id;     /**< Event id to identify the kind of notification. */
+        EventId     id;         /**< Event id to identify the kind of notification. */
+        uint32_t    timestamp;  /**< Timestamp in us, when the event was queued. */
 
         /**
          * The union contains the event id specific parameters.
@@ -376,7 +377,7 @@ private:
 
     ResponsePart    m_rspPart;              /**< Current parsing part of the response */
     HttpResponse    m_rsp;                  /**< Response */
-    String          m_rspLine;              /**< Single line, used for response parsing */
+    String          m_rspLine;              /**< Single line, used for chunked response parsing */
     TransferCoding  m_transferCoding;       /**< Transfer coding */
     size_t          m_contentLength;        /**< Content length in byte */
     size_t          m_contentIndex;         /**< Content index */
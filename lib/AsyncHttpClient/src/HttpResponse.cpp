@@ -34,6 +34,8 @@
  *****************************************************************************/
 #include "HttpResponse.h"
 #include <new>
+#include <AllocTracker.h>
+#include <Logging.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -51,6 +53,8 @@
  * Prototypes
  *****************************************************************************/
 
+static bool isWhitespace(char character);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -63,17 +67,47 @@ HttpResponse& HttpResponse::operator=(const HttpResponse& rsp)
 {
     if (this != &rsp)
     {
-        DLinkedListConstIterator<HttpHeader*>   it(rsp.m_headers);
+        clear();
 
-        m_httpVersion   = rsp.m_httpVersion;
-        m_statusCode    = rsp.m_statusCode;
-        m_reasonPhrase  = rsp.m_reasonPhrase;
+        if ((nullptr != rsp.m_block) &&
+            (0U < rsp.m_blockLength))
+        {
+            if (m_blockSize < rsp.m_blockLength)
+            {
+                clearBlock();
 
-        clearPayload();
+                m_block = AllocTracker::getInstance().newArray<char>(AllocTracker::TAG_HTTP, rsp.m_blockSize);
+
+                if (nullptr != m_block)
+                {
+                    m_blockSize = rsp.m_blockSize;
+                }
+            }
+
+            if (nullptr != m_block)
+            {
+                size_t idx = 0U;
+
+                memcpy(m_block, rsp.m_block, rsp.m_blockLength);
+                m_blockLength   = rsp.m_blockLength;
+                m_lineBegin     = rsp.m_lineBegin;
+                m_isLineDropped = rsp.m_isLineDropped;
+                m_httpVersion   = rsp.m_httpVersion;
+                m_reasonPhrase  = rsp.m_reasonPhrase;
+                m_headerCount   = rsp.m_headerCount;
+
+                for(idx = 0U; idx < rsp.m_headerCount; ++idx)
+                {
+                    m_headers[idx] = rsp.m_headers[idx];
+                }
+            }
+        }
+
+        m_statusCode = rsp.m_statusCode;
 
         if (nullptr != rsp.m_payload)
         {
-            m_payload = new(std::nothrow) uint8_t[rsp.m_size];
+            m_payload = AllocTracker::getInstance().newArray<uint8_t>(AllocTracker::TAG_HTTP, rsp.m_size);
 
             if (nullptr == m_payload)
             {
@@ -87,23 +121,6 @@ HttpResponse& HttpResponse::operator=(const HttpResponse& rsp)
                 m_wrIndex = rsp.m_wrIndex;
             }
         }
-
-        clearHeaders();
-
-        if (true == it.first())
-        {
-            do
-            {
-                HttpHeader* header = new(std::nothrow) HttpHeader;
-
-                if (nullptr != header)
-                {
-                    *header = **it.current();
-                    (void)m_headers.append(header);
-                }
-            }
-            while(true == it.next());
-        }
     }
 
     return *this;
@@ -111,62 +128,70 @@ HttpResponse& HttpResponse::operator=(const HttpResponse& rsp)
 
 void HttpResponse::clear()
 {
-    clearHeaders();
+    /* The header block buffer is kept for the next response. */
+    m_blockLength   = 0U;
+    m_lineBegin     = 0U;
+    m_isLineDropped = false;
+    m_httpVersion   = Span();
+    m_statusCode    = 0U;
+    m_reasonPhrase  = Span();
+    m_headerCount   = 0U;
+
     clearPayload();
     m_wrIndex = 0U;
 }
 
-void HttpResponse::addStatusLine(const String& line)
+bool HttpResponse::parseStatusLine(const char* data, size_t len, size_t& index)
 {
-    const char* SP          = " ";
-    int         idx         = 0;
-    int         begin       = 0;
-    String      statusCode;
+    bool isStatusLineEOF = false;
 
-    /* Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF */
-
-    /* HTTP-Version */
-    idx             = line.indexOf(SP);
-    m_httpVersion   = line.substring(begin, idx);
-
-    /* Overstep all spaces */
-    while(('\0' != line[idx]) && (' ' == line[idx]))
+    if (true == readLine(data, len, index))
     {
-        ++idx;
-    }
-    begin = idx;
+        indexStatusLine();
 
-    /* Status-Code */
-    idx             = line.indexOf(SP, begin);
-    statusCode      = line.substring(begin, idx);
-    m_statusCode    = statusCode.toInt();
+        /* Keep the status line in the header block. */
+        m_lineBegin = m_blockLength;
 
-    /* Overstep all spaces */
-    while(('\0' != line[idx]) && (' ' == line[idx]))
-    {
-        ++idx;
+        isStatusLineEOF = true;
     }
-    begin = idx;
 
-    /* Reason-Phrase */
-    m_reasonPhrase  = line.substring(begin);
+    return isStatusLineEOF;
 }
 
-void HttpResponse::addHeader(const String& line)
+bool HttpResponse::parseHeader(const char* data, size_t len, size_t& index)
 {
-    HttpHeader* header = new(std::nothrow) HttpHeader(line);
+    bool isHeaderEOF = false;
 
-    if (nullptr != header)
+    while((false == isHeaderEOF) && (true == readLine(data, len, index)))
     {
-        m_headers.append(header);
+        /* Empty line? */
+        if ((m_lineBegin == m_blockLength) &&
+            (false == m_isLineDropped))
+        {
+            isHeaderEOF = true;
+        }
+        else if (true == indexHeaderField())
+        {
+            /* Keep the header field in the header block. */
+            m_lineBegin = m_blockLength;
+        }
+        else
+        {
+            /* Discard the line. */
+            m_blockLength = m_lineBegin;
+        }
+
+        m_isLineDropped = false;
     }
+
+    return isHeaderEOF;
 }
 
 void HttpResponse::extendPayload(size_t size)
 {
     uint8_t* tmp = m_payload;
 
-    m_payload = new(std::nothrow) uint8_t[m_size + size];
+    m_payload = AllocTracker::getInstance().newArray<uint8_t>(AllocTracker::TAG_HTTP, m_size + size);
 
     if (nullptr != m_payload)
     {
@@ -181,7 +206,7 @@ void HttpResponse::extendPayload(size_t size)
 
     if (nullptr != tmp)
     {
-        delete[] tmp;
+        AllocTracker::getInstance().deleteArray(tmp);
     }
 }
 
@@ -201,9 +226,9 @@ void HttpResponse::addPayload(const uint8_t* payload, size_t size)
     }
 }
 
-String HttpResponse::getHttpVersion() const
+HttpStringView HttpResponse::getHttpVersion() const
 {
-    return m_httpVersion;
+    return toView(m_httpVersion);
 }
 
 uint16_t HttpResponse::getStatusCode() const
@@ -211,34 +236,26 @@ uint16_t HttpResponse::getStatusCode() const
     return m_statusCode;
 }
 
-String HttpResponse::getReasonPhrase() const
+HttpStringView HttpResponse::getReasonPhrase() const
 {
-    return m_reasonPhrase;
+    return toView(m_reasonPhrase);
 }
 
-String HttpResponse::getHeader(const String& name)
+HttpStringView HttpResponse::getHeader(const char* name) const
 {
-    String                              value;
-    DLinkedListIterator<HttpHeader*>    it(m_headers);
+    HttpStringView  value;
+    size_t          idx     = 0U;
+    bool            isFound = false;
 
-    if (true == it.first())
+    while((false == isFound) && (m_headerCount > idx))
     {
-        HttpHeader* hdr     = nullptr;
-        bool        isFound = false;
-
-        do
+        if (true == toView(m_headers[idx].name).equalsIgnoreCase(name))
         {
-            hdr = *it.current();
-
-            if ((nullptr != hdr) &&
-                (0U != hdr->getName().equalsIgnoreCase(name)))
-            {
-                value = hdr->getValue();
-                isFound = true;
-            }
+            value   = toView(m_headers[idx].value);
+            isFound = true;
         }
-        while((false == isFound) &&
-                (true == it.next()));
+
+        ++idx;
     }
 
     return value;
@@ -258,24 +275,219 @@ const uint8_t* HttpResponse::getPayload(size_t& size) const
  * Private Methods
  *****************************************************************************/
 
-void HttpResponse::clearHeaders()
+bool HttpResponse::readLine(const char* data, size_t len, size_t& index)
+{
+    bool isEOL = false;
+
+    /* RFC7230 - 3.5. Message Parsing Robustness
+     * Although the line terminator for the start-line and header fields is
+     * the sequence CRLF, a recipient MAY recognize a single LF as a line
+     * terminator and ignore any preceding CR.
+     */
+    while((len > index) && (false == isEOL))
+    {
+        char character = data[index];
+
+        ++index;
+
+        if ('\n' == character)
+        {
+            isEOL = true;
+        }
+        else if ('\r' == character)
+        {
+            ;
+        }
+        /* If the line doesn't fit into the header block, it will be dropped
+         * completely, but its end is still searched.
+         */
+        else if (true == m_isLineDropped)
+        {
+            ;
+        }
+        else if (false == appendToBlock(character))
+        {
+            LOG_WARNING("Rsp. header line too long, dropped.");
+
+            m_blockLength   = m_lineBegin;
+            m_isLineDropped = true;
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    return isEOL;
+}
+
+bool HttpResponse::appendToBlock(char character)
+{
+    bool isSuccessful = true;
+
+    if (m_blockSize <= m_blockLength)
+    {
+        char*   tmp     = m_block;
+        size_t  size    = m_blockSize + HEADER_BLOCK_STEP_SIZE;
+
+        if (MAX_HEADER_BLOCK_SIZE < size)
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            m_block = AllocTracker::getInstance().newArray<char>(AllocTracker::TAG_HTTP, size);
+
+            if (nullptr == m_block)
+            {
+                m_block         = tmp;
+                isSuccessful    = false;
+            }
+            else
+            {
+                if (nullptr != tmp)
+                {
+                    memcpy(m_block, tmp, m_blockLength);
+                    AllocTracker::getInstance().deleteArray(tmp);
+                }
+
+                m_blockSize = size;
+            }
+        }
+    }
+
+    if (true == isSuccessful)
+    {
+        m_block[m_blockLength] = character;
+        ++m_blockLength;
+    }
+
+    return isSuccessful;
+}
+
+void HttpResponse::indexStatusLine()
 {
-    DLinkedListIterator<HttpHeader*> it(m_headers);
+    size_t  idx     = m_lineBegin;
+    size_t  begin   = m_lineBegin;
+
+    /* Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF */
 
-    while(true == it.first())
+    /* HTTP-Version */
+    while((m_blockLength > idx) && (' ' != m_block[idx]))
     {
-        HttpHeader* header = *it.current();
+        ++idx;
+    }
 
-        it.remove();
-        delete header;
+    m_httpVersion.offset = static_cast<uint16_t>(begin);
+    m_httpVersion.length = static_cast<uint16_t>(idx - begin);
+
+    /* Overstep all spaces */
+    while((m_blockLength > idx) && (' ' == m_block[idx]))
+    {
+        ++idx;
+    }
+
+    /* Status-Code */
+    m_statusCode = 0U;
+
+    while((m_blockLength > idx) && ('0' <= m_block[idx]) && ('9' >= m_block[idx]))
+    {
+        m_statusCode = static_cast<uint16_t>((m_statusCode * 10U) + static_cast<uint16_t>(m_block[idx] - '0'));
+        ++idx;
+    }
+
+    /* Overstep all spaces */
+    while((m_blockLength > idx) && (' ' == m_block[idx]))
+    {
+        ++idx;
     }
+
+    /* Reason-Phrase */
+    m_reasonPhrase.offset = static_cast<uint16_t>(idx);
+    m_reasonPhrase.length = static_cast<uint16_t>(m_blockLength - idx);
+}
+
+bool HttpResponse::indexHeaderField()
+{
+    bool    isSuccessful    = false;
+    size_t  idx             = m_lineBegin;
+    size_t  end             = m_blockLength;
+
+    /* header-field = field-name ":" OWS field-value OWS */
+    while((end > idx) && (':' != m_block[idx]))
+    {
+        ++idx;
+    }
+
+    if (end <= idx)
+    {
+        LOG_WARNING("Invalid rsp. header line.");
+    }
+    else if (MAX_HEADERS <= m_headerCount)
+    {
+        LOG_WARNING("Too many rsp. header fields.");
+    }
+    else
+    {
+        HeaderField&    field   = m_headers[m_headerCount];
+        size_t          begin   = idx + 1U;
+
+        field.name.offset = static_cast<uint16_t>(m_lineBegin);
+        field.name.length = static_cast<uint16_t>(idx - m_lineBegin);
+
+        /* Skip optional whitespace around the value */
+        while((end > begin) && (true == isWhitespace(m_block[begin])))
+        {
+            ++begin;
+        }
+
+        while((end > begin) && (true == isWhitespace(m_block[end - 1U])))
+        {
+            --end;
+        }
+
+        field.value.offset = static_cast<uint16_t>(begin);
+        field.value.length = static_cast<uint16_t>(end - begin);
+
+        LOG_DEBUG("Rsp. header: %.*s", static_cast<int>(m_blockLength - m_lineBegin), &m_block[m_lineBegin]);
+
+        ++m_headerCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+HttpStringView HttpResponse::toView(const Span& span) const
+{
+    HttpStringView view;
+
+    if (nullptr != m_block)
+    {
+        view = HttpStringView(&m_block[span.offset], span.length);
+    }
+
+    return view;
+}
+
+void HttpResponse::clearBlock()
+{
+    if (nullptr != m_block)
+    {
+        AllocTracker::getInstance().deleteArray(m_block);
+        m_block = nullptr;
+    }
+
+    m_blockSize     = 0U;
+    m_blockLength   = 0U;
+    m_lineBegin     = 0U;
 }
 
 void HttpResponse::clearPayload()
 {
     if (nullptr != m_payload)
     {
-        delete[] m_payload;
+        AllocTracker::getInstance().deleteArray(m_payload);
         m_payload = nullptr;
     }
 
@@ -289,3 +501,15 @@ void HttpResponse::clearPayload()
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Is the character a whitespace (SP or HTAB)?
+ *
+ * @param[in] character Character
+ *
+ * @return If whitespace, it will return true otherwise false.
+ */
+static bool isWhitespace(char character)
+{
+    return ((' ' == character) || ('\t' == character));
+}
@@ -43,10 +43,10 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
+#include <stdint.h>
 #include <WString.h>
-#include <LinkedList.hpp>
 
-#include "HttpHeader.h"
+#include "HttpStringView.h"
 
 /******************************************************************************
  * Macros
@@ -58,6 +58,11 @@
 
 /**
  * Http response
+ *
+ * The status line and the header fields are kept raw in a single header
+ * block buffer, which is indexed during parsing. The header block buffer is
+ * kept after clearing the response, so that following responses don't need
+ * to allocate memory for the header again.
  */
 class HttpResponse
 {
@@ -67,10 +72,16 @@ public:
      * Construct a empty response.
      */
     HttpResponse() :
+        m_block(nullptr),
+        m_blockSize(0U),
+        m_blockLength(0U),
+        m_lineBegin(0U),
+        m_isLineDropped(false),
         m_httpVersion(),
         m_statusCode(0U),
         m_reasonPhrase(),
         m_headers(),
+        m_headerCount(0U),
         m_payload(nullptr),
         m_size(0U),
         m_wrIndex(0U)
@@ -83,6 +94,7 @@ public:
     ~HttpResponse()
     {
         clear();
+        clearBlock();
     }
 
     /**
@@ -91,10 +103,16 @@ public:
      * @param[in] rsp   Response
      */
     HttpResponse(const HttpResponse& rsp) :
+        m_block(nullptr),
+        m_blockSize(0U),
+        m_blockLength(0U),
+        m_lineBegin(0U),
+        m_isLineDropped(false),
         m_httpVersion(),
         m_statusCode(0U),
         m_reasonPhrase(),
         m_headers(),
+        m_headerCount(0U),
         m_payload(nullptr),
         m_size(0U),
         m_wrIndex(0U)
@@ -117,18 +135,28 @@ public:
     void clear();
 
     /**
-     * Add status line during parsing the response.
+     * Parse the status line from the received data. The status line may be
+     * received in several parts, therefore call it until it returns true.
+     *
+     * @param[in]       data    Received data
+     * @param[in]       len     Received data length in byte
+     * @param[in,out]   index   Index of the next byte to parse
      *
-     * @param[in] line  Status line
+     * @return If the status line is complete, it will return true otherwise false.
      */
-    void addStatusLine(const String& line);
+    bool parseStatusLine(const char* data, size_t len, size_t& index);
 
     /**
-     * Add header during parsing the response.
+     * Parse the header fields from the received data. The header may be
+     * received in several parts, therefore call it until it returns true.
+     *
+     * @param[in]       data    Received data
+     * @param[in]       len     Received data length in byte
+     * @param[in,out]   index   Index of the next byte to parse
      *
-     * @param[in] line  Single header line
+     * @return If the header is complete (empty line received), it will return true otherwise false.
      */
-    void addHeader(const String& line);
+    bool parseHeader(const char* data, size_t len, size_t& index);
 
     /**
      * Extend payload size in bytes.
@@ -148,9 +176,9 @@ public:
     /**
      * Get HTTP version.
      *
-     * @return HTTP version
+     * @return HTTP version, only valid until the response is cleared.
      */
-    String getHttpVersion() const;
+    HttpStringView getHttpVersion() const;
 
     /**
      * Get status code.
@@ -162,16 +190,18 @@ public:
     /**
      * Get reason phrase.
      *
-     * @return Reason phrase
+     * @return Reason phrase, only valid until the response is cleared.
      */
-    String getReasonPhrase() const;
+    HttpStringView getReasonPhrase() const;
 
     /**
-     * Get header field value.
+     * Get header field value. The field name is compared case-insensitive.
      *
      * @param[in] name  Field name
+     *
+     * @return Field value, only valid until the response is cleared. If the field doesn't exist, it will be empty.
      */
-    String getHeader(const String& name);
+    HttpStringView getHeader(const char* name) const;
 
     /**
      * Get payload.
@@ -182,20 +212,97 @@ public:
      */
     const uint8_t* getPayload(size_t& size) const;
 
+    /** Max. number of header fields, which are indexed. */
+    static const size_t MAX_HEADERS             = 24U;
+
+    /** The header block is allocated and extended in steps of this size in byte. */
+    static const size_t HEADER_BLOCK_STEP_SIZE  = 256U;
+
+    /** Max. size of the header block in byte. */
+    static const size_t MAX_HEADER_BLOCK_SIZE   = 4096U;
+
 private:
 
-    String                      m_httpVersion;  /**< HTTP version */
-    uint16_t                    m_statusCode;   /**< Status code */
-    String                      m_reasonPhrase; /**< Reason phrase */
-    DLinkedList<HttpHeader*>    m_headers;      /**< List of headers */
-    uint8_t*                    m_payload;      /**< Payload */
-    size_t                      m_size;         /**< Payload size in byte */
-    size_t                      m_wrIndex;      /**< Payload write index */
+    /**
+     * Part of the header block.
+     */
+    struct Span
+    {
+        uint16_t    offset; /**< Offset in the header block in byte */
+        uint16_t    length; /**< Length in byte */
+    };
+
+    /**
+     * Indexed header field.
+     */
+    struct HeaderField
+    {
+        Span    name;   /**< Field name */
+        Span    value;  /**< Field value */
+    };
+
+    char*           m_block;                    /**< Header block with status line and header fields, not null-terminated */
+    size_t          m_blockSize;                /**< Header block size in byte */
+    size_t          m_blockLength;              /**< Number of used bytes in the header block */
+    size_t          m_lineBegin;                /**< Header block offset of the current line */
+    bool            m_isLineDropped;            /**< Is the current line dropped, because the header block is full? */
+    Span            m_httpVersion;              /**< HTTP version */
+    uint16_t        m_statusCode;               /**< Status code */
+    Span            m_reasonPhrase;             /**< Reason phrase */
+    HeaderField     m_headers[MAX_HEADERS];     /**< Indexed header fields */
+    size_t          m_headerCount;              /**< Number of indexed header fields */
+    uint8_t*        m_payload;                  /**< Payload */
+    size_t          m_size;                     /**< Payload size in byte */
+    size_t          m_wrIndex;                  /**< Payload write index */
+
+    /**
+     * Read the next line from the received data into the header block.
+     * The line terminator is not stored. A single LF is accepted as line
+     * terminator too and any CR is ignored.
+     *
+     * @param[in]       data    Received data
+     * @param[in]       len     Received data length in byte
+     * @param[in,out]   index   Index of the next byte to parse
+     *
+     * @return If the line is complete, it will return true otherwise false.
+     */
+    bool readLine(const char* data, size_t len, size_t& index);
+
+    /**
+     * Append a single character to the current line in the header block.
+     * The header block is extended if necessary.
+     *
+     * @param[in] character Character
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool appendToBlock(char character);
+
+    /**
+     * Index the status line, which is the current line in the header block.
+     */
+    void indexStatusLine();
+
+    /**
+     * Index the header field, which is the current line in the header block.
+     *
+     * @return If successful indexed, it will return true otherwise false.
+     */
+    bool indexHeaderField();
+
+    /**
+     * Get a view of a part of the header block.
+     *
+     * @param[in] span  Part of the header block
+     *
+     * @return View
+     */
+    HttpStringView toView(const Span& span) const;
 
     /**
-     * Clear headers.
+     * Clears the header block buffer and releases its memory.
      */
-    void clearHeaders();
+    void clearBlock();
 
     /**
      * Clears the payload.
@@ -209,4 +316,4 @@ private:
 
 #endif  /* HTTP_RESPONSE_H */
 
-/** @} */
\ No newline at end of file
+/** @} */
@@ -0,0 +1,282 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  View into a part of the HTTP response
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup web
+ *
+ * @{
+ */
+
+#ifndef HTTP_STRING_VIEW_H
+#define HTTP_STRING_VIEW_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <WString.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A lightweight view into a not null-terminated string, e.g. a header field
+ * value in the header block of a HTTP response. The view doesn't own the
+ * characters, it is only valid as long as the response is not cleared or
+ * modified.
+ */
+class HttpStringView
+{
+public:
+
+    /**
+     * Constructs an empty view.
+     */
+    HttpStringView() :
+        m_data(nullptr),
+        m_length(0U)
+    {
+    }
+
+    /**
+     * Constructs a view.
+     *
+     * @param[in] data      Characters, not null-terminated
+     * @param[in] length    Number of characters
+     */
+    HttpStringView(const char* data, size_t length) :
+        m_data(data),
+        m_length((nullptr == data) ? 0U : length)
+    {
+    }
+
+    /**
+     * Constructs a view by copying another view.
+     *
+     * @param[in] view  View
+     */
+    HttpStringView(const HttpStringView& view) :
+        m_data(view.m_data),
+        m_length(view.m_length)
+    {
+    }
+
+    /**
+     * Destroys the view.
+     */
+    ~HttpStringView()
+    {
+    }
+
+    /**
+     * Assign another view.
+     *
+     * @param[in] view  View
+     *
+     * @return View
+     */
+    HttpStringView& operator=(const HttpStringView& view)
+    {
+        if (this != &view)
+        {
+            m_data      = view.m_data;
+            m_length    = view.m_length;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Get the characters. Note, they are not null-terminated!
+     *
+     * @return Characters
+     */
+    const char* data() const
+    {
+        return m_data;
+    }
+
+    /**
+     * Get the number of characters.
+     *
+     * @return Number of characters
+     */
+    size_t length() const
+    {
+        return m_length;
+    }
+
+    /**
+     * Is the view empty?
+     *
+     * @return If empty, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return (0U == m_length);
+    }
+
+    /**
+     * Compares the view with the given string, case-insensitive.
+     *
+     * @param[in] str   Null-terminated string
+     *
+     * @return If equal, it will return true otherwise false.
+     */
+    bool equalsIgnoreCase(const char* str) const
+    {
+        bool isEqual = false;
+
+        if (nullptr != str)
+        {
+            if ((strlen(str) == m_length) &&
+                ((0U == m_length) || (0 == strncasecmp(m_data, str, m_length))))
+            {
+                isEqual = true;
+            }
+        }
+
+        return isEqual;
+    }
+
+    /**
+     * Is the given string part of the view? The search is case-insensitive.
+     *
+     * @param[in] str   Null-terminated string
+     *
+     * @return If found, it will return true otherwise false.
+     */
+    bool containsIgnoreCase(const char* str) const
+    {
+        bool isFound = false;
+
+        if (nullptr != str)
+        {
+            size_t strLength    = strlen(str);
+            size_t idx          = 0U;
+
+            while((false == isFound) && (m_length >= (idx + strLength)))
+            {
+                if ((0U == strLength) ||
+                    (0 == strncasecmp(&m_data[idx], str, strLength)))
+                {
+                    isFound = true;
+                }
+
+                ++idx;
+            }
+        }
+
+        return isFound;
+    }
+
+    /**
+     * Convert the decimal number in the view to an unsigned 32-bit integer.
+     * Leading spaces are skipped. The conversion stops at the first
+     * non-digit character.
+     *
+     * @param[out] value    Converted value
+     *
+     * @return If at least one digit was converted, it will return true otherwise false.
+     */
+    bool toUInt32(uint32_t& value) const
+    {
+        const uint32_t  BASE        = 10U;
+        size_t          idx         = 0U;
+        bool            isDigit     = true;
+        bool            isSuccess   = false;
+
+        value = 0U;
+
+        while((m_length > idx) && (' ' == m_data[idx]))
+        {
+            ++idx;
+        }
+
+        while((m_length > idx) && (true == isDigit))
+        {
+            if (('0' <= m_data[idx]) && ('9' >= m_data[idx]))
+            {
+                value = (value * BASE) + static_cast<uint32_t>(m_data[idx] - '0');
+                isSuccess = true;
+                ++idx;
+            }
+            else
+            {
+                isDigit = false;
+            }
+        }
+
+        return isSuccess;
+    }
+
+    /**
+     * Copy the view into a string.
+     *
+     * @return String
+     */
+    String toString() const
+    {
+        String  str;
+        size_t  idx = 0U;
+
+        str.reserve(m_length);
+
+        for(idx = 0U; idx < m_length; ++idx)
+        {
+            str += m_data[idx];
+        }
+
+        return str;
+    }
+
+private:
+
+    const char* m_data;     /**< Characters, not null-terminated */
+    size_t      m_length;   /**< Number of characters */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* HTTP_STRING_VIEW_H */
+
+/** @} */
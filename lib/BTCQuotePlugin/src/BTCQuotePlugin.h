@@ -183,6 +183,16 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return PROCESS_PERIOD_DEFAULT;
+    }
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
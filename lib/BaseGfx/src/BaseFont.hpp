@@ -242,8 +242,23 @@ public:
             /* Is character available in the font? Note, carriage return is skipped. */
             if (nullptr != glyph)
             {
-                /* Handle character only, if it is really drawn on the screen. */
-                if (0 <= (cursorX + glyph->xAdvance))
+                int16_t clipX1  = 0;
+                int16_t clipY1  = 0;
+                int16_t clipX2  = 0;
+                int16_t clipY2  = 0;
+                int16_t glyphX  = cursorX + glyph->xOffset;
+                int16_t glyphY  = cursorY + glyph->yOffset;
+
+                gfx.getClipRect(clipX1, clipY1, clipX2, clipY2);
+
+                /* Handle character only, if it is really drawn on the screen.
+                 * This skips the whole glyph e.g. of a scrolling text, which is
+                 * outside, instead of clipping it pixel by pixel.
+                 */
+                if ((clipX1 < (glyphX + glyph->width)) &&
+                    (clipX2 > glyphX) &&
+                    (clipY1 < (glyphY + glyph->height)) &&
+                    (clipY2 > glyphY))
                 {
                     int16_t     x               = 0;
                     int16_t     y               = 0;
@@ -266,7 +281,7 @@ public:
                             /* A 1b in the bitmap row bits must be drawn as single pixel. */
                             if (0U != (bitmapRowBits & 0x80U))
                             {
-                                gfx.drawPixel(cursorX + x + glyph->xOffset, cursorY + y + glyph->yOffset, color);
+                                gfx.drawPixel(glyphX + x, glyphY + y, color);
                             }
 
                             bitmapRowBits <<= 1U;
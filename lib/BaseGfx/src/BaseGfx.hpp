@@ -121,6 +121,68 @@ public:
      */
     virtual void drawPixel(int16_t x, int16_t y, const TColor& color) = 0;
 
+    /**
+     * Get the clipping rectangle. Only pixels inside it are drawn.
+     * By default it covers the whole canvas.
+     *
+     * @param[out] x1   x-coordinate of upper left point
+     * @param[out] y1   y-coordinate of upper left point
+     * @param[out] x2   x-coordinate of lower right point + 1
+     * @param[out] y2   y-coordinate of lower right point + 1
+     */
+    virtual void getClipRect(int16_t& x1, int16_t& y1, int16_t& x2, int16_t& y2) const
+    {
+        x1 = 0;
+        y1 = 0;
+        x2 = static_cast<int16_t>(getWidth());
+        y2 = static_cast<int16_t>(getHeight());
+    }
+
+    /**
+     * Get direct access to the pixel at given position, which must be inside
+     * the clipping rectangle. The pixels right of it up to the clipping border
+     * follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * Canvases without such a pixel buffer, e.g. a display with its own pixel
+     * layout, don't provide it. They are drawn pixel by pixel.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    virtual TColor* getSpan(int16_t x, int16_t y, uint16_t& stride)
+    {
+        (void)x;
+        (void)y;
+
+        stride = 0U;
+
+        return nullptr;
+    }
+
+    /**
+     * Get direct access to the pixel at given position, which must be inside
+     * the clipping rectangle. The pixels right of it up to the clipping border
+     * follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    virtual const TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) const
+    {
+        (void)x;
+        (void)y;
+
+        stride = 0U;
+
+        return nullptr;
+    }
+
     /**
      * Copy framebuffer content.
      *
@@ -128,18 +190,7 @@ public:
      */
     void copy(const BaseGfx<TColor>& gfx)
     {
-        uint16_t    canvasWidth     = getWidth();
-        uint16_t    canvasHeight    = getHeight();
-        int16_t     x               = 0;
-        int16_t     y               = 0;
-
-        for(y = 0; y < canvasHeight; ++y)
-        {
-            for(x = 0; x < canvasWidth; ++x)
-            {
-                drawPixel(x, y, gfx.getColor(x, y));
-            }
-        }
+        blit(0, 0, gfx);
     }
 
     /**
@@ -153,12 +204,7 @@ public:
      */
     void drawVLine(int16_t x, int16_t y, uint16_t height, const TColor& color)
     {
-        uint16_t idx = 0U;
-
-        for(idx = 0U; idx < height; ++idx)
-        {
-            drawPixel(x, y + idx, color);
-        }
+        fillRect(x, y, 1U, height, color);
     }
 
     /**
@@ -172,12 +218,7 @@ public:
      */
     void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color)
     {
-        uint16_t idx = 0U;
-
-        for(idx = 0U; idx < width; ++idx)
-        {
-            drawPixel(x + idx, y, color);
-        }
+        fillRect(x, y, width, 1U, color);
     }
 
     /**
@@ -301,14 +342,32 @@ public:
      */
     void fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height, const TColor& color)
     {
-        int16_t xIndex = 0;
-        int16_t yIndex = 0;
-
-        for(yIndex = 0; yIndex < height; ++yIndex)
+        /* Clip the whole rectangle once, instead of every single pixel. */
+        if (true == clipRect(x, y, width, height))
         {
-            for(xIndex = 0; xIndex < width; ++xIndex)
+            uint16_t    stride  = 0U;
+            TColor*     span    = getSpan(x, y, stride);
+            uint16_t    xIndex  = 0U;
+            uint16_t    yIndex  = 0U;
+
+            for(yIndex = 0U; yIndex < height; ++yIndex)
             {
-                drawPixel(x + xIndex, y + yIndex, color);
+                if (nullptr != span)
+                {
+                    TColor* row = &span[static_cast<size_t>(yIndex) * stride];
+
+                    for(xIndex = 0U; xIndex < width; ++xIndex)
+                    {
+                        row[xIndex] = color;
+                    }
+                }
+                else
+                {
+                    for(xIndex = 0U; xIndex < width; ++xIndex)
+                    {
+                        drawPixel(x + xIndex, y + yIndex, color);
+                    }
+                }
             }
         }
     }
@@ -371,18 +430,7 @@ public:
      */
     void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap)
     {
-        uint16_t    canvasWidth     = bitmap.getWidth();
-        uint16_t    canvasHeight    = bitmap.getHeight();
-        int16_t     xIndex          = 0;
-        int16_t     yIndex          = 0;
-
-        for(yIndex = 0; yIndex < canvasHeight; ++yIndex)
-        {
-            for(xIndex = 0; xIndex < canvasWidth; ++xIndex)
-            {
-                drawPixel(x + xIndex, y + yIndex, bitmap.getColor(xIndex, yIndex));
-            }
-        }
+        blit(x, y, bitmap);
     }
 
 protected:
@@ -392,6 +440,128 @@ protected:
     {
     }
 
+    /**
+     * Clip a rectangle by the clipping rectangle.
+     *
+     * @param[in,out] x         x-coordinate of upper left point
+     * @param[in,out] y         y-coordinate of upper left point
+     * @param[in,out] width     Rectangle width in pixel
+     * @param[in,out] height    Rectangle height in pixel
+     *
+     * @return If something of the rectangle is left, it will return true otherwise false.
+     */
+    bool clipRect(int16_t& x, int16_t& y, uint16_t& width, uint16_t& height) const
+    {
+        bool    isVisible   = false;
+        int16_t clipX1      = 0;
+        int16_t clipY1      = 0;
+        int16_t clipX2      = 0;
+        int16_t clipY2      = 0;
+        int32_t x1          = x;
+        int32_t y1          = y;
+        int32_t x2          = static_cast<int32_t>(x) + width;
+        int32_t y2          = static_cast<int32_t>(y) + height;
+
+        getClipRect(clipX1, clipY1, clipX2, clipY2);
+
+        if (clipX1 > x1)
+        {
+            x1 = clipX1;
+        }
+
+        if (clipY1 > y1)
+        {
+            y1 = clipY1;
+        }
+
+        if (clipX2 < x2)
+        {
+            x2 = clipX2;
+        }
+
+        if (clipY2 < y2)
+        {
+            y2 = clipY2;
+        }
+
+        if ((x1 < x2) &&
+            (y1 < y2))
+        {
+            x           = static_cast<int16_t>(x1);
+            y           = static_cast<int16_t>(y1);
+            width       = static_cast<uint16_t>(x2 - x1);
+            height      = static_cast<uint16_t>(y2 - y1);
+            isVisible   = true;
+        }
+
+        return isVisible;
+    }
+
+    /**
+     * Draw the visible part of another canvas at specified location.
+     * Rows are copied directly, if both canvases provide their pixel buffer.
+     *
+     * @param[in] x     x-coordinate of upper left point
+     * @param[in] y     y-coordinate of upper left point
+     * @param[in] src   Source canvas
+     */
+    void blit(int16_t x, int16_t y, const BaseGfx<TColor>& src)
+    {
+        int16_t     srcX1   = 0;
+        int16_t     srcY1   = 0;
+        int16_t     srcX2   = 0;
+        int16_t     srcY2   = 0;
+        int16_t     dstX    = 0;
+        int16_t     dstY    = 0;
+        uint16_t    width   = 0U;
+        uint16_t    height  = 0U;
+
+        src.getClipRect(srcX1, srcY1, srcX2, srcY2);
+
+        if ((srcX1 < srcX2) &&
+            (srcY1 < srcY2))
+        {
+            dstX    = x + srcX1;
+            dstY    = y + srcY1;
+            width   = static_cast<uint16_t>(srcX2 - srcX1);
+            height  = static_cast<uint16_t>(srcY2 - srcY1);
+
+            if (true == clipRect(dstX, dstY, width, height))
+            {
+                int16_t         srcX        = dstX - x;
+                int16_t         srcY        = dstY - y;
+                uint16_t        dstStride   = 0U;
+                uint16_t        srcStride   = 0U;
+                TColor*         dstSpan     = getSpan(dstX, dstY, dstStride);
+                const TColor*   srcSpan     = src.getSpan(srcX, srcY, srcStride);
+                uint16_t        xIndex      = 0U;
+                uint16_t        yIndex      = 0U;
+
+                for(yIndex = 0U; yIndex < height; ++yIndex)
+                {
+                    if ((nullptr != dstSpan) &&
+                        (nullptr != srcSpan))
+                    {
+                        TColor*         dstRow  = &dstSpan[static_cast<size_t>(yIndex) * dstStride];
+                        const TColor*   srcRow  = &srcSpan[static_cast<size_t>(yIndex) * srcStride];
+
+                        for(xIndex = 0U; xIndex < width; ++xIndex)
+                        {
+                            dstRow[xIndex] = srcRow[xIndex];
+                        }
+                    }
+                    else
+                    {
+                        for(xIndex = 0U; xIndex < width; ++xIndex)
+                        {
+                            drawPixel(dstX + xIndex, dstY + yIndex, src.getColor(srcX + xIndex, srcY + yIndex));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
 private:
 
 };
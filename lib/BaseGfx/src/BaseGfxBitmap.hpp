@@ -47,6 +47,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <BaseGfx.hpp>
+#include <AllocTracker.h>
 #include <new>
 
 /******************************************************************************
@@ -248,6 +249,60 @@ public:
         }
     }
 
+    /**
+     * Get direct access to the pixel at given position. The pixels of the
+     * row follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If inside the bitmap, it will return the pixel otherwise nullptr.
+     */
+    TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) override
+    {
+        TColor* pixel = nullptr;
+
+        stride = width;
+
+        if ((0 <= x) &&
+            (0 <= y) &&
+            (width > x) &&
+            (height > y))
+        {
+            pixel = &m_pixels[pixelMap(x, y)];
+        }
+
+        return pixel;
+    }
+
+    /**
+     * Get direct access to the pixel at given position. The pixels of the
+     * row follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If inside the bitmap, it will return the pixel otherwise nullptr.
+     */
+    const TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) const override
+    {
+        const TColor* pixel = nullptr;
+
+        stride = width;
+
+        if ((0 <= x) &&
+            (0 <= y) &&
+            (width > x) &&
+            (height > y))
+        {
+            pixel = &m_pixels[pixelMap(x, y)];
+        }
+
+        return pixel;
+    }
+
 private:
 
     /** Number of pixels in the pixel buffer. */
@@ -362,7 +417,11 @@ public:
                     m_height    = 0U;
                 }
 
-                m_pixels = allocatePixels(bitmap.m_width, bitmap.m_height);
+                /* Reuse the pixel buffer, if it has already the right size. */
+                if (nullptr == m_pixels)
+                {
+                    m_pixels = allocatePixels(bitmap.m_width, bitmap.m_height);
+                }
 
                 if (nullptr != m_pixels)
                 {
@@ -514,6 +573,62 @@ public:
         }
     }
 
+    /**
+     * Get direct access to the pixel at given position. The pixels of the
+     * row follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If inside the bitmap, it will return the pixel otherwise nullptr.
+     */
+    TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) override
+    {
+        TColor* pixel = nullptr;
+
+        stride = m_width;
+
+        if ((nullptr != m_pixels) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            pixel = &m_pixels[pixelMap(x, y)];
+        }
+
+        return pixel;
+    }
+
+    /**
+     * Get direct access to the pixel at given position. The pixels of the
+     * row follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If inside the bitmap, it will return the pixel otherwise nullptr.
+     */
+    const TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) const override
+    {
+        const TColor* pixel = nullptr;
+
+        stride = m_width;
+
+        if ((nullptr != m_pixels) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            pixel = &m_pixels[pixelMap(x, y)];
+        }
+
+        return pixel;
+    }
+
     /**
      * Use this function to determine whether a internal bitmap buffer is allocated or not.
      * 
@@ -553,7 +668,7 @@ private:
     {
         if (nullptr != pixels)
         {
-            delete[] pixels;
+            AllocTracker::getInstance().deleteArray(pixels);
             pixels = nullptr;
         }
     }
@@ -573,7 +688,7 @@ private:
         if ((0U < width) &&
             (0U < height))
         {
-            buffer = new(std::nothrow) TColor[width * height];
+            buffer = AllocTracker::getInstance().newArray<TColor>(AllocTracker::TAG_GFX, width * height);
         }
 
         return buffer;
@@ -697,6 +812,51 @@ public:
         m_gfx.drawPixel(x, y, color);
     }
 
+    /**
+     * Get the clipping rectangle of the underlying graphic operations.
+     *
+     * @param[out] x1   x-coordinate of upper left point
+     * @param[out] y1   y-coordinate of upper left point
+     * @param[out] x2   x-coordinate of lower right point + 1
+     * @param[out] y2   y-coordinate of lower right point + 1
+     */
+    void getClipRect(int16_t& x1, int16_t& y1, int16_t& x2, int16_t& y2) const override
+    {
+        m_gfx.getClipRect(x1, y1, x2, y2);
+    }
+
+    /**
+     * Get direct access to the pixel at given position of the underlying
+     * graphic operations.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) override
+    {
+        return m_gfx.getSpan(x, y, stride);
+    }
+
+    /**
+     * Get direct access to the pixel at given position of the underlying
+     * graphic operations.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    const TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) const override
+    {
+        const BaseGfx<TColor>& gfx = m_gfx;
+
+        return gfx.getSpan(x, y, stride);
+    }
+
 private:
 
     BaseGfx<TColor>&    m_gfx;  /**< Graphic operations, hidden behind bitmap facade. */
@@ -0,0 +1,436 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Basic graphics drawing context
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef BASE_GFX_CONTEXT_HPP
+#define BASE_GFX_CONTEXT_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <BaseGfx.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A drawing context is a translated and clipped window over a canvas.
+ * Its origin is the upper left point of the window and nothing is drawn
+ * outside of the window and the clipping rectangle of the canvas.
+ *
+ * The clipping rectangle and the direct access to the pixel buffer of the
+ * canvas are determined once at construction. A pixel is therefore written
+ * directly into the pixel buffer, without calling the canvas. Contexts can
+ * be nested, because every context provides the pixel buffer of its canvas.
+ *
+ * A context is lightweight and intended to be created on the stack during
+ * painting. It must not outlive a change of the canvas pixel buffer.
+ *
+ * @tparam TColor The color representation.
+ */
+template < typename TColor >
+class BaseGfxContext : public BaseGfx<TColor>
+{
+public:
+
+    /**
+     * Constructs a drawing context.
+     *
+     * @param[in] gfx       The graphic operations of the underlying canvas.
+     * @param[in] x         x-coordinate of the window in the underlying canvas.
+     * @param[in] y         y-coordinate of the window in the underlying canvas.
+     * @param[in] width     Window width in pixels.
+     * @param[in] height    Window height in pixels.
+     */
+    BaseGfxContext(BaseGfx<TColor>& gfx, int16_t x, int16_t y, uint16_t width, uint16_t height) :
+        BaseGfx<TColor>(),
+        m_gfx(gfx),
+        m_originX(x),
+        m_originY(y),
+        m_width(width),
+        m_height(height),
+        m_clipX1(0),
+        m_clipY1(0),
+        m_clipX2(0),
+        m_clipY2(0),
+        m_buffer(nullptr),
+        m_stride(0U)
+    {
+        int32_t x2 = static_cast<int32_t>(x) + width;
+        int32_t y2 = static_cast<int32_t>(y) + height;
+
+        /* The clipping rectangle is kept in coordinates of the underlying canvas. */
+        gfx.getClipRect(m_clipX1, m_clipY1, m_clipX2, m_clipY2);
+
+        if (x > m_clipX1)
+        {
+            m_clipX1 = x;
+        }
+
+        if (y > m_clipY1)
+        {
+            m_clipY1 = y;
+        }
+
+        if (x2 < m_clipX2)
+        {
+            m_clipX2 = static_cast<int16_t>(x2);
+        }
+
+        if (y2 < m_clipY2)
+        {
+            m_clipY2 = static_cast<int16_t>(y2);
+        }
+
+        if ((m_clipX1 < m_clipX2) &&
+            (m_clipY1 < m_clipY2))
+        {
+            m_buffer = gfx.getSpan(m_clipX1, m_clipY1, m_stride);
+        }
+        else
+        {
+            /* Nothing visible. */
+            m_clipX2 = m_clipX1;
+            m_clipY2 = m_clipY1;
+        }
+    }
+
+    /**
+     * Destroys the drawing context.
+     */
+    virtual ~BaseGfxContext()
+    {
+    }
+
+    /**
+     * Get window width in pixel.
+     *
+     * @return Window width in pixel
+     */
+    uint16_t getWidth() const final
+    {
+        return m_width;
+    }
+
+    /**
+     * Get window height in pixel.
+     *
+     * @return Window height in pixel
+     */
+    uint16_t getHeight() const final
+    {
+        return m_height;
+    }
+
+    /**
+     * Get pixel color at given position.
+     * This is used for color manipulation in higher layers.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    TColor& getColor(int16_t x, int16_t y) final
+    {
+        static TColor   trash;
+        TColor*         pixel   = &trash;
+        int16_t         gfxX    = x + m_originX;
+        int16_t         gfxY    = y + m_originY;
+
+        if (true == isInside(gfxX, gfxY))
+        {
+            if (nullptr != m_buffer)
+            {
+                pixel = &m_buffer[getIndex(gfxX, gfxY)];
+            }
+            else
+            {
+                pixel = &m_gfx.getColor(gfxX, gfxY);
+            }
+        }
+
+        return *pixel;
+    }
+
+    /**
+     * Get pixel color at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    const TColor& getColor(int16_t x, int16_t y) const final
+    {
+        static TColor   trash;
+        const TColor*   pixel   = &trash;
+        int16_t         gfxX    = x + m_originX;
+        int16_t         gfxY    = y + m_originY;
+
+        if (true == isInside(gfxX, gfxY))
+        {
+            if (nullptr != m_buffer)
+            {
+                pixel = &m_buffer[getIndex(gfxX, gfxY)];
+            }
+            else
+            {
+                const BaseGfx<TColor>& gfx = m_gfx;
+
+                pixel = &gfx.getColor(gfxX, gfxY);
+            }
+        }
+
+        return *pixel;
+    }
+
+    /**
+     * Draw a single pixel at given position.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     */
+    void drawPixel(int16_t x, int16_t y, const TColor& color) final
+    {
+        int16_t gfxX = x + m_originX;
+        int16_t gfxY = y + m_originY;
+
+        if (true == isInside(gfxX, gfxY))
+        {
+            if (nullptr != m_buffer)
+            {
+                m_buffer[getIndex(gfxX, gfxY)] = color;
+            }
+            else
+            {
+                m_gfx.drawPixel(gfxX, gfxY, color);
+            }
+        }
+    }
+
+    /**
+     * Get the clipping rectangle in window coordinates.
+     *
+     * @param[out] x1   x-coordinate of upper left point
+     * @param[out] y1   y-coordinate of upper left point
+     * @param[out] x2   x-coordinate of lower right point + 1
+     * @param[out] y2   y-coordinate of lower right point + 1
+     */
+    void getClipRect(int16_t& x1, int16_t& y1, int16_t& x2, int16_t& y2) const final
+    {
+        x1 = m_clipX1 - m_originX;
+        y1 = m_clipY1 - m_originY;
+        x2 = m_clipX2 - m_originX;
+        y2 = m_clipY2 - m_originY;
+    }
+
+    /**
+     * Narrow the clipping rectangle, e.g. to repaint only a damaged region.
+     * The window origin and size are kept.
+     *
+     * @param[in] x         x-coordinate of the clipping rectangle in window coordinates.
+     * @param[in] y         y-coordinate of the clipping rectangle in window coordinates.
+     * @param[in] width     Clipping rectangle width in pixels.
+     * @param[in] height    Clipping rectangle height in pixels.
+     */
+    void clip(int16_t x, int16_t y, uint16_t width, uint16_t height)
+    {
+        int32_t x1      = static_cast<int32_t>(x) + m_originX;
+        int32_t y1      = static_cast<int32_t>(y) + m_originY;
+        int32_t x2      = x1 + width;
+        int32_t y2      = y1 + height;
+        int16_t prevX1  = m_clipX1;
+        int16_t prevY1  = m_clipY1;
+
+        if (x1 > m_clipX1)
+        {
+            m_clipX1 = static_cast<int16_t>(x1);
+        }
+
+        if (y1 > m_clipY1)
+        {
+            m_clipY1 = static_cast<int16_t>(y1);
+        }
+
+        if (x2 < m_clipX2)
+        {
+            m_clipX2 = static_cast<int16_t>(x2);
+        }
+
+        if (y2 < m_clipY2)
+        {
+            m_clipY2 = static_cast<int16_t>(y2);
+        }
+
+        if ((m_clipX1 < m_clipX2) &&
+            (m_clipY1 < m_clipY2))
+        {
+            /* The pixel buffer points always to the upper left point of the clipping rectangle. */
+            if (nullptr != m_buffer)
+            {
+                m_buffer = &m_buffer[static_cast<size_t>(m_clipY1 - prevY1) * m_stride + static_cast<size_t>(m_clipX1 - prevX1)];
+            }
+        }
+        else
+        {
+            /* Nothing visible. */
+            m_clipX2 = m_clipX1;
+            m_clipY2 = m_clipY1;
+            m_buffer = nullptr;
+        }
+    }
+
+    /**
+     * Get direct access to the pixel at given position, which must be inside
+     * the clipping rectangle.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) final
+    {
+        TColor* pixel   = nullptr;
+        int16_t gfxX    = x + m_originX;
+        int16_t gfxY    = y + m_originY;
+
+        stride = m_stride;
+
+        if ((nullptr != m_buffer) &&
+            (true == isInside(gfxX, gfxY)))
+        {
+            pixel = &m_buffer[getIndex(gfxX, gfxY)];
+        }
+
+        return pixel;
+    }
+
+    /**
+     * Get direct access to the pixel at given position, which must be inside
+     * the clipping rectangle.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    const TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) const final
+    {
+        const TColor*   pixel   = nullptr;
+        int16_t         gfxX    = x + m_originX;
+        int16_t         gfxY    = y + m_originY;
+
+        stride = m_stride;
+
+        if ((nullptr != m_buffer) &&
+            (true == isInside(gfxX, gfxY)))
+        {
+            pixel = &m_buffer[getIndex(gfxX, gfxY)];
+        }
+
+        return pixel;
+    }
+
+private:
+
+    BaseGfx<TColor>&    m_gfx;      /**< The underlying graphic operations. */
+    int16_t             m_originX;  /**< x-coordinate of the window origin in the underlying canvas. */
+    int16_t             m_originY;  /**< y-coordinate of the window origin in the underlying canvas. */
+    uint16_t            m_width;    /**< Window width in pixels. */
+    uint16_t            m_height;   /**< Window height in pixels. */
+    int16_t             m_clipX1;   /**< x-coordinate of clipping rectangle upper left point in the underlying canvas. */
+    int16_t             m_clipY1;   /**< y-coordinate of clipping rectangle upper left point in the underlying canvas. */
+    int16_t             m_clipX2;   /**< x-coordinate of clipping rectangle lower right point + 1 in the underlying canvas. */
+    int16_t             m_clipY2;   /**< y-coordinate of clipping rectangle lower right point + 1 in the underlying canvas. */
+    TColor*             m_buffer;   /**< Pixel at the upper left point of the clipping rectangle or nullptr if not available. */
+    uint16_t            m_stride;   /**< Number of pixels from one row to the next one in the pixel buffer. */
+
+    BaseGfxContext();
+    BaseGfxContext(const BaseGfxContext& context);
+    BaseGfxContext& operator=(const BaseGfxContext& context);
+
+    /**
+     * Is the position inside the clipping rectangle?
+     *
+     * @param[in] gfxX  x-coordinate in the underlying canvas
+     * @param[in] gfxY  y-coordinate in the underlying canvas
+     *
+     * @return If inside, it will return true otherwise false.
+     */
+    bool isInside(int16_t gfxX, int16_t gfxY) const
+    {
+        return ((m_clipX1 <= gfxX) &&
+                (m_clipY1 <= gfxY) &&
+                (m_clipX2 > gfxX) &&
+                (m_clipY2 > gfxY));
+    }
+
+    /**
+     * Get the pixel buffer index of a position inside the clipping rectangle.
+     * No out of bounds check!
+     *
+     * @param[in] gfxX  x-coordinate in the underlying canvas
+     * @param[in] gfxY  y-coordinate in the underlying canvas
+     *
+     * @return Pixel buffer index
+     */
+    size_t getIndex(int16_t gfxX, int16_t gfxY) const
+    {
+        return static_cast<size_t>(gfxY - m_clipY1) * m_stride + static_cast<size_t>(gfxX - m_clipX1);
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* BASE_GFX_CONTEXT_HPP */
+
+/** @} */
@@ -303,6 +303,94 @@ public:
         }
     }
 
+    /**
+     * Get the clipping rectangle, which is the map canvas limited by the
+     * clipping rectangle of the underlying canvas.
+     *
+     * @param[out] x1   x-coordinate of upper left point
+     * @param[out] y1   y-coordinate of upper left point
+     * @param[out] x2   x-coordinate of lower right point + 1
+     * @param[out] y2   y-coordinate of lower right point + 1
+     */
+    void getClipRect(int16_t& x1, int16_t& y1, int16_t& x2, int16_t& y2) const final
+    {
+        x1 = 0;
+        y1 = 0;
+        x2 = 0;
+        y2 = 0;
+
+        if (nullptr != m_gfx)
+        {
+            int16_t gfxX1 = 0;
+            int16_t gfxY1 = 0;
+            int16_t gfxX2 = 0;
+            int16_t gfxY2 = 0;
+
+            m_gfx->getClipRect(gfxX1, gfxY1, gfxX2, gfxY2);
+
+            x1 = (0 > (gfxX1 - m_offsX)) ? 0 : (gfxX1 - m_offsX);
+            y1 = (0 > (gfxY1 - m_offsY)) ? 0 : (gfxY1 - m_offsY);
+            x2 = (m_width < (gfxX2 - m_offsX)) ? m_width : (gfxX2 - m_offsX);
+            y2 = (m_height < (gfxY2 - m_offsY)) ? m_height : (gfxY2 - m_offsY);
+        }
+    }
+
+    /**
+     * Get direct access to the pixel at given position of the underlying canvas.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) final
+    {
+        TColor* pixel = nullptr;
+
+        stride = 0U;
+
+        if ((nullptr != m_gfx) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            pixel = m_gfx->getSpan(x + m_offsX, y + m_offsY, stride);
+        }
+
+        return pixel;
+    }
+
+    /**
+     * Get direct access to the pixel at given position of the underlying canvas.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If available, it will return the pixel otherwise nullptr.
+     */
+    const TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) const final
+    {
+        const TColor* pixel = nullptr;
+
+        stride = 0U;
+
+        if ((nullptr != m_gfx) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            const BaseGfx<TColor>* gfx = m_gfx;
+
+            pixel = gfx->getSpan(x + m_offsX, y + m_offsY, stride);
+        }
+
+        return pixel;
+    }
+
 private:
 
     BaseGfx<TColor>*    m_gfx;      /**< The underlying graphic operations. */
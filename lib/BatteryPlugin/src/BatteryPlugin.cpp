@@ -69,24 +69,14 @@ void BatteryPlugin::start(uint16_t width, uint16_t height)
 {
     uint8_t                     sensorIdx           = 0U;
     uint8_t                     channelIdx          = 0U;
-    uint16_t                    spaceLeftRight      = divideAndRound(width, 8U); /* 12.5 % */
-    uint16_t                    spaceTopBottom      = divideAndRound(height, 8U); /* 12.5 % */
-    uint16_t                    batteryBorder       = 1U;
-    uint16_t                    batteryPoleWidth    = divideAndRound(width, 20U); /*  5 % */
-    uint16_t                    batteryPoleHeight   = height - 2U * (spaceTopBottom + 2U * batteryBorder);
-    uint16_t                    batteryWdith        = width - 2U * spaceLeftRight - batteryPoleWidth;
-    uint16_t                    batteryHeight       = height - 2U * spaceTopBottom;
     MutexGuard<MutexRecursive>  guard(m_mutex);
     SensorDataProvider&         sensorDataProv      = SensorDataProvider::getInstance();
 
-    m_batterySymbol.create(width, height);
-    m_batterySymbol.drawRectangle(spaceLeftRight + batteryPoleWidth, spaceTopBottom, batteryWdith, batteryHeight, ColorDef::WHITE);
-    m_batterySymbol.fillRect(spaceLeftRight, spaceTopBottom + 2U * batteryBorder, batteryPoleWidth, batteryPoleHeight, ColorDef::WHITE);
-
-    m_socBarX       = spaceLeftRight + batteryPoleWidth + batteryBorder;
-    m_socBarY       = spaceTopBottom + batteryBorder;
-    m_socBarWidth   = batteryWdith - 2U * batteryBorder;
-    m_socBarHeight  = batteryHeight - 2U * batteryBorder;
+    /* The battery symbol canvas is borrowed from the canvas pool only while
+     * the plugin is active.
+     */
+    m_width     = width;
+    m_height    = height;
 
     /* Use just the first found sensor for battery state of charge. */
     if (true == sensorDataProv.find(sensorIdx, channelIdx, ISensorChannel::TYPE_STATE_OF_CHARGE_PERCENT, ISensorChannel::DATA_TYPE_UINT32))
@@ -99,7 +89,7 @@ void BatteryPlugin::stop()
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_batterySymbol.release();
+    m_batterySymbol.giveBack();
     m_sensorUpdateTimer.stop();
 }
 
@@ -127,6 +117,31 @@ void BatteryPlugin::process(bool isConnected)
     }
 }
 
+void BatteryPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    PLUGIN_NOT_USED(gfx);
+
+    if (false == m_batterySymbol.borrow(m_width, m_height))
+    {
+        LOG_WARNING("Failed to borrow battery symbol canvas (%u x %u).", m_width, m_height);
+    }
+
+    /* Draw the battery symbol only again, if its content got lost meanwhile. */
+    if (false == m_batterySymbol.isContentPreserved())
+    {
+        drawBatterySymbol();
+    }
+}
+
+void BatteryPlugin::inactive()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    m_batterySymbol.giveBack(true);
+}
+
 void BatteryPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -156,6 +171,28 @@ uint16_t BatteryPlugin::divideAndRound(uint16_t dividend, uint16_t divisor)
     return result;
 }
 
+void BatteryPlugin::drawBatterySymbol()
+{
+    uint16_t    spaceLeftRight      = divideAndRound(m_width, 8U); /* 12.5 % */
+    uint16_t    spaceTopBottom      = divideAndRound(m_height, 8U); /* 12.5 % */
+    uint16_t    batteryBorder       = 1U;
+    uint16_t    batteryPoleWidth    = divideAndRound(m_width, 20U); /*  5 % */
+    uint16_t    batteryPoleHeight   = m_height - 2U * (spaceTopBottom + 2U * batteryBorder);
+    uint16_t    batteryWdith        = m_width - 2U * spaceLeftRight - batteryPoleWidth;
+    uint16_t    batteryHeight       = m_height - 2U * spaceTopBottom;
+
+    if (true == m_batterySymbol.isBorrowed())
+    {
+        m_batterySymbol.drawRectangle(spaceLeftRight + batteryPoleWidth, spaceTopBottom, batteryWdith, batteryHeight, ColorDef::WHITE);
+        m_batterySymbol.fillRect(spaceLeftRight, spaceTopBottom + 2U * batteryBorder, batteryPoleWidth, batteryPoleHeight, ColorDef::WHITE);
+    }
+
+    m_socBarX       = spaceLeftRight + batteryPoleWidth + batteryBorder;
+    m_socBarY       = spaceTopBottom + batteryBorder;
+    m_socBarWidth   = batteryWdith - 2U * batteryBorder;
+    m_socBarHeight  = batteryHeight - 2U * batteryBorder;
+}
+
 void BatteryPlugin::drawStateOfCharge(YAGfx& gfx)
 {
     uint16_t    widthDependedOnSOC  = (m_socBarWidth * m_stateOfCharge) / 100U;
@@ -48,7 +48,7 @@
 #include <SimpleTimer.hpp>
 #include <ISensorChannel.hpp>
 #include <Mutex.hpp>
-#include <YAGfxBitmap.h>
+#include <CanvasPool.h>
 
 /******************************************************************************
  * Macros
@@ -74,6 +74,8 @@ public:
     BatteryPlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
         m_batterySymbol(),
+        m_width(0U),
+        m_height(0U),
         m_mutex(),
         m_sensorUpdateTimer(),
         m_socSensorCh(nullptr),
@@ -101,7 +103,6 @@ public:
      */
     ~BatteryPlugin()
     {
-        m_batterySymbol.release();
         m_mutex.destroy();
     }
 
@@ -150,6 +151,31 @@ public:
      *                          connection is established, it will be true otherwise false.
      */
     void process(bool isConnected) final; 
+
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * The sensor values change slowly, therefore a lower rate is sufficient.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return SIMPLE_TIMER_SECONDS(1U);
+    }
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
+    /**
+     * This method will be called in case the plugin is set inactive, which means
+     * it won't be shown on the display anymore.
+     */
+    void inactive() final;
     
     /**
      * Update the display.
@@ -166,7 +192,9 @@ private:
      */
     static const uint32_t   SENSOR_UPDATE_PERIOD = SIMPLE_TIMER_SECONDS(10U);
 
-    YAGfxDynamicBitmap      m_batterySymbol;        /**< The battery symbol. */
+    PooledCanvas            m_batterySymbol;        /**< The battery symbol, only borrowed while the plugin is active. */
+    uint16_t                m_width;                /**< Display width in pixel. */
+    uint16_t                m_height;               /**< Display height in pixel. */
     MutexRecursive          m_mutex;                /**< Mutex to protect against concurrent access. */
     SimpleTimer             m_sensorUpdateTimer;    /**< Time used for cyclic sensor reading. */
     ISensorChannel*         m_socSensorCh;          /**< Battery sensor SOC channel. */
@@ -186,6 +214,12 @@ private:
      */
     uint16_t divideAndRound(uint16_t dividend, uint16_t divisor);
 
+    /**
+     * Calculate the battery symbol layout and draw the battery symbol into
+     * the canvas, if it is borrowed.
+     */
+    void drawBatterySymbol();
+
     /**
      * Draw the state of charge on the display.
      *
@@ -0,0 +1,326 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Boot snapshot file format
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "BootSnapshotFormat.h"
+
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+using namespace BootSnapshotFormat;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint32_t updateChecksum(uint32_t checksum, const uint8_t* data, size_t size);
+static uint16_t getUInt16(const uint8_t* data);
+static uint32_t getUInt32(const uint8_t* data);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Magic number to identify the snapshot. */
+static const uint8_t    MAGIC[4U]               = { 'P', 'X', 'B', 'S' };
+
+/** FNV-1a offset basis, used as initial checksum. */
+static const uint32_t   FNV_OFFSET_BASIS        = 2166136261U;
+
+/** FNV-1a prime */
+static const uint32_t   FNV_PRIME               = 16777619U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+Writer::Writer(Print& output) :
+    Print(),
+    m_output(output),
+    m_checksum(FNV_OFFSET_BASIS),
+    m_isError(false)
+{
+}
+
+size_t Writer::write(const uint8_t* buffer, size_t size)
+{
+    size_t written = m_output.write(buffer, size);
+
+    if (size != written)
+    {
+        m_isError = true;
+    }
+
+    m_checksum = updateChecksum(m_checksum, buffer, written);
+
+    return written;
+}
+
+void Writer::writeHeader(uint16_t recordCnt)
+{
+    (void)write(MAGIC, sizeof(MAGIC));
+    writeUInt16(VERSION);
+    writeUInt16(recordCnt);
+}
+
+void Writer::writeRecordHeader(RecordType type, uint16_t uid, uint16_t size)
+{
+    (void)write(static_cast<uint8_t>(type));
+    (void)write(static_cast<uint8_t>(0U));
+    writeUInt16(uid);
+    writeUInt16(size);
+}
+
+void Writer::writeTrailer()
+{
+    writeUInt32(m_checksum);
+}
+
+Reader::Result Reader::verify() const
+{
+    Result result = RESULT_INVALID;
+
+    if ((nullptr != m_buffer) &&
+        ((HEADER_SIZE + TRAILER_SIZE) <= m_size))
+    {
+        size_t dataSize = m_size - TRAILER_SIZE;
+
+        if (0 != memcmp(m_buffer, MAGIC, sizeof(MAGIC)))
+        {
+            result = RESULT_INVALID;
+        }
+        else if (VERSION != getUInt16(&m_buffer[4U]))
+        {
+            result = RESULT_OUTDATED;
+        }
+        else if (updateChecksum(FNV_OFFSET_BASIS, m_buffer, dataSize) != getUInt32(&m_buffer[dataSize]))
+        {
+            result = RESULT_CORRUPT;
+        }
+        else
+        {
+            result = RESULT_OK;
+        }
+    }
+
+    return result;
+}
+
+uint16_t Reader::getRecordCount() const
+{
+    uint16_t recordCnt = 0U;
+
+    if ((nullptr != m_buffer) &&
+        (HEADER_SIZE <= m_size))
+    {
+        recordCnt = getUInt16(&m_buffer[6U]);
+    }
+
+    return recordCnt;
+}
+
+bool Reader::findRecord(RecordType type, uint16_t uid, size_t& payloadIdx, size_t& size) const
+{
+    bool isFound = false;
+
+    if ((nullptr != m_buffer) &&
+        ((HEADER_SIZE + TRAILER_SIZE) <= m_size))
+    {
+        uint16_t    recordCnt   = getRecordCount();
+        size_t      dataSize    = m_size - TRAILER_SIZE;
+        size_t      idx         = HEADER_SIZE;
+
+        while((0U < recordCnt) &&
+              (dataSize >= (idx + RECORD_HEADER_SIZE)) &&
+              (false == isFound))
+        {
+            uint8_t     recordType  = m_buffer[idx];
+            uint16_t    recordUid   = getUInt16(&m_buffer[idx + 2U]);
+            size_t      recordSize  = getUInt16(&m_buffer[idx + 4U]);
+
+            idx += RECORD_HEADER_SIZE;
+
+            /* Record exceeds the snapshot? */
+            if (dataSize < (idx + recordSize))
+            {
+                break;
+            }
+
+            if ((static_cast<uint8_t>(type) == recordType) &&
+                ((RECORD_TYPE_SLOTS == type) || (uid == recordUid)))
+            {
+                payloadIdx  = idx;
+                size        = recordSize;
+                isFound     = true;
+            }
+
+            idx += recordSize;
+            --recordCnt;
+        }
+    }
+
+    return isFound;
+}
+
+bool Reader::deserialize(size_t payloadIdx, size_t size, JsonDocument& jsonDoc) const
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != m_buffer) &&
+        (m_size >= (payloadIdx + size)))
+    {
+        /* A const input forces ArduinoJson to copy the strings into the
+         * document. Otherwise it would link them into the snapshot memory,
+         * which is released before the document is used.
+         */
+        const uint8_t* payload = &m_buffer[payloadIdx];
+
+        if (DeserializationError::Ok == deserializeMsgPack(jsonDoc, payload, size).code())
+        {
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void Reader::markConsumed(size_t payloadIdx)
+{
+    if ((nullptr != m_buffer) &&
+        ((HEADER_SIZE + RECORD_HEADER_SIZE) <= payloadIdx) &&
+        (m_size > payloadIdx))
+    {
+        m_buffer[payloadIdx - RECORD_HEADER_SIZE] = static_cast<uint8_t>(RECORD_TYPE_CONSUMED);
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void Writer::writeUInt16(uint16_t value)
+{
+    uint8_t data[2U] =
+    {
+        static_cast<uint8_t>((value >> 0U) & 0xffU),
+        static_cast<uint8_t>((value >> 8U) & 0xffU)
+    };
+
+    (void)write(data, sizeof(data));
+}
+
+void Writer::writeUInt32(uint32_t value)
+{
+    uint8_t data[4U] =
+    {
+        static_cast<uint8_t>((value >>  0U) & 0xffU),
+        static_cast<uint8_t>((value >>  8U) & 0xffU),
+        static_cast<uint8_t>((value >> 16U) & 0xffU),
+        static_cast<uint8_t>((value >> 24U) & 0xffU)
+    };
+
+    (void)write(data, sizeof(data));
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Update the FNV-1a checksum with the given data.
+ *
+ * @param[in] checksum  Current checksum
+ * @param[in] data      Data
+ * @param[in] size      Data size in byte
+ *
+ * @return Updated checksum
+ */
+static uint32_t updateChecksum(uint32_t checksum, const uint8_t* data, size_t size)
+{
+    size_t idx = 0U;
+
+    for(idx = 0U; idx < size; ++idx)
+    {
+        checksum ^= data[idx];
+        checksum *= FNV_PRIME;
+    }
+
+    return checksum;
+}
+
+/**
+ * Get a 16-bit value in little endian.
+ *
+ * @param[in] data  Data
+ *
+ * @return Value
+ */
+static uint16_t getUInt16(const uint8_t* data)
+{
+    return static_cast<uint16_t>(data[0U]) |
+           (static_cast<uint16_t>(data[1U]) << 8U);
+}
+
+/**
+ * Get a 32-bit value in little endian.
+ *
+ * @param[in] data  Data
+ *
+ * @return Value
+ */
+static uint32_t getUInt32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0U]) |
+           (static_cast<uint32_t>(data[1U]) << 8U) |
+           (static_cast<uint32_t>(data[2U]) << 16U) |
+           (static_cast<uint32_t>(data[3U]) << 24U);
+}
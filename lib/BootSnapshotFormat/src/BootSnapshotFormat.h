@@ -0,0 +1,290 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Boot snapshot file format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup plugin
+ *
+ * @{
+ */
+
+#ifndef BOOT_SNAPSHOT_FORMAT_H
+#define BOOT_SNAPSHOT_FORMAT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Print.h>
+#include <ArduinoJson.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Boot snapshot file format (little endian):
+ * - Header: Magic (4 byte), version (2 byte), number of records (2 byte)
+ * - Records: Type (1 byte), reserved (1 byte), plugin UID (2 byte),
+ *   payload size (2 byte), payload (MessagePack)
+ * - Trailer: FNV-1a checksum over header and records (4 byte)
+ */
+namespace BootSnapshotFormat
+{
+
+/** Record types */
+enum RecordType
+{
+    RECORD_TYPE_SLOTS = 0,  /**< Slot configuration */
+    RECORD_TYPE_PLUGIN,     /**< Plugin configuration */
+    RECORD_TYPE_CONSUMED    /**< Plugin configuration, which was already provided. */
+};
+
+/** Snapshot format version. Increase it with every format change. */
+static const uint16_t   VERSION             = 1U;
+
+/** Header size in byte */
+static const size_t     HEADER_SIZE         = 8U;
+
+/** Record header size in byte */
+static const size_t     RECORD_HEADER_SIZE  = 6U;
+
+/** Trailer size in byte */
+static const size_t     TRAILER_SIZE        = 4U;
+
+/**
+ * Writes the snapshot and calculates the checksum on the fly.
+ */
+class Writer : public Print
+{
+public:
+
+    /**
+     * Constructs the snapshot writer.
+     *
+     * @param[in] output    Output, where to write to, e.g. a file.
+     */
+    explicit Writer(Print& output);
+
+    /**
+     * Destroys the snapshot writer.
+     */
+    ~Writer()
+    {
+    }
+
+    /**
+     * Write a single byte.
+     *
+     * @param[in] data  Byte to write
+     *
+     * @return Number of written bytes.
+     */
+    size_t write(uint8_t data) final
+    {
+        return write(&data, 1U);
+    }
+
+    /**
+     * Write a buffer.
+     *
+     * @param[in] buffer    Buffer to write
+     * @param[in] size      Buffer size in byte
+     *
+     * @return Number of written bytes.
+     */
+    size_t write(const uint8_t* buffer, size_t size) final;
+
+    /**
+     * Write the header.
+     *
+     * @param[in] recordCnt Number of records, which will follow.
+     */
+    void writeHeader(uint16_t recordCnt);
+
+    /**
+     * Write a record header. The payload shall follow directly.
+     *
+     * @param[in] type  Record type
+     * @param[in] uid   Plugin UID, 0 for the slot configuration.
+     * @param[in] size  Payload size in byte
+     */
+    void writeRecordHeader(RecordType type, uint16_t uid, uint16_t size);
+
+    /**
+     * Write the trailer with the checksum over all written bytes.
+     */
+    void writeTrailer();
+
+    /**
+     * Is any write failed?
+     *
+     * @return If a write failed, it will return true otherwise false.
+     */
+    bool isError() const
+    {
+        return m_isError;
+    }
+
+private:
+
+    Print&      m_output;   /**< Output, where to write to. */
+    uint32_t    m_checksum; /**< Checksum over all written bytes */
+    bool        m_isError;  /**< Is any write failed? */
+
+    Writer();
+    Writer(const Writer& writer);
+    Writer& operator=(const Writer& writer);
+
+    /**
+     * Write a 16-bit value in little endian.
+     *
+     * @param[in] value Value
+     */
+    void writeUInt16(uint16_t value);
+
+    /**
+     * Write a 32-bit value in little endian.
+     *
+     * @param[in] value Value
+     */
+    void writeUInt32(uint32_t value);
+};
+
+/**
+ * Reads a snapshot, which is completely in memory. The reader doesn't own
+ * the memory.
+ */
+class Reader
+{
+public:
+
+    /**
+     * Result of the snapshot verification.
+     */
+    enum Result
+    {
+        RESULT_OK = 0,      /**< Snapshot is valid. */
+        RESULT_INVALID,     /**< No snapshot or too small. */
+        RESULT_OUTDATED,    /**< Snapshot has an other format version. */
+        RESULT_CORRUPT      /**< Checksum mismatch */
+    };
+
+    /**
+     * Constructs the snapshot reader.
+     *
+     * @param[in] buffer    Snapshot content
+     * @param[in] size      Snapshot content size in byte
+     */
+    Reader(uint8_t* buffer, size_t size) :
+        m_buffer(buffer),
+        m_size(size)
+    {
+    }
+
+    /**
+     * Destroys the snapshot reader.
+     */
+    ~Reader()
+    {
+    }
+
+    /**
+     * Verify the snapshot header and checksum.
+     *
+     * @return Verification result
+     */
+    Result verify() const;
+
+    /**
+     * Get the number of records, according to the header.
+     * Call it only after a successful verification.
+     *
+     * @return Number of records
+     */
+    uint16_t getRecordCount() const;
+
+    /**
+     * Find a record.
+     *
+     * @param[in]   type        Record type
+     * @param[in]   uid         Plugin UID, only considered for plugin records.
+     * @param[out]  payloadIdx  Index of the record payload in the snapshot
+     * @param[out]  size        Record payload size in byte
+     *
+     * @return If found, it will return true otherwise false.
+     */
+    bool findRecord(RecordType type, uint16_t uid, size_t& payloadIdx, size_t& size) const;
+
+    /**
+     * Deserialize a record payload into a JSON document.
+     * All strings are copied into the JSON document, therefore the document
+     * stays valid after the snapshot memory is released.
+     *
+     * @param[in]   payloadIdx  Index of the record payload in the snapshot
+     * @param[in]   size        Record payload size in byte
+     * @param[out]  jsonDoc     JSON document
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool deserialize(size_t payloadIdx, size_t size, JsonDocument& jsonDoc) const;
+
+    /**
+     * Mark a plugin record as consumed, so it will not be found anymore.
+     *
+     * @param[in] payloadIdx    Index of the record payload in the snapshot
+     */
+    void markConsumed(size_t payloadIdx);
+
+private:
+
+    uint8_t*    m_buffer;   /**< Snapshot content */
+    size_t      m_size;     /**< Snapshot content size in byte */
+
+    Reader();
+    Reader(const Reader& reader);
+    Reader& operator=(const Reader& reader);
+};
+
+}
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* BOOT_SNAPSHOT_FORMAT_H */
+
+/** @} */
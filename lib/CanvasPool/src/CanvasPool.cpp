@@ -0,0 +1,463 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pool of reusable off-screen canvases
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "CanvasPool.h"
+#include <Logging.h>
+#include <AllocTracker.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Canvas capacity in byte of the size classes below the display size. */
+static const uint32_t   gSizeClasses[CanvasPool::BUCKET_COUNT - 1U] =
+{
+    64U * sizeof(Color),    /* e.g. 8x8 icons */
+    256U * sizeof(Color),   /* e.g. 16x16 icons */
+    1024U * sizeof(Color)   /* e.g. 32x32 icons */
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool CanvasPool::begin(uint16_t width, uint16_t height)
+{
+    bool        isSuccessful    = true;
+    uint32_t    displaySize     = static_cast<uint32_t>(width) * static_cast<uint32_t>(height) * sizeof(Color);
+    uint8_t     idx             = 0U;
+
+    if (false == m_mutex.isAllocated())
+    {
+        isSuccessful = m_mutex.create();
+    }
+
+    if (true == isSuccessful)
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        for(idx = 0U; idx < (BUCKET_COUNT - 1U); ++idx)
+        {
+            m_capacities[idx] = gSizeClasses[idx];
+        }
+
+        /* The largest size class covers the whole display. */
+        if (gSizeClasses[BUCKET_COUNT - 2U] > displaySize)
+        {
+            displaySize = gSizeClasses[BUCKET_COUNT - 2U];
+        }
+
+        m_capacities[BUCKET_COUNT - 1U] = displaySize;
+    }
+    else
+    {
+        LOG_ERROR("Canvas pool not available.");
+    }
+
+    return isSuccessful;
+}
+
+void CanvasPool::end()
+{
+    uint8_t idx     = 0U;
+    uint8_t used    = 0U;
+
+    if (true == m_mutex.isAllocated())
+    {
+        {
+            MutexGuard<Mutex> guard(m_mutex);
+
+            for(idx = 0U; idx < MAX_CANVASES; ++idx)
+            {
+                Canvas& canvas = m_canvases[idx];
+
+                if (nullptr != canvas.pixels)
+                {
+                    if (true == canvas.isUsed)
+                    {
+                        ++used;
+                    }
+                    else
+                    {
+                        AllocTracker::getInstance().deleteArray(canvas.pixels);
+                        canvas = Canvas();
+                    }
+                }
+            }
+        }
+
+        /* Borrowed canvases must be given back to the pool later,
+         * therefore the pool keeps alive in this case.
+         */
+        if (0U == used)
+        {
+            m_mutex.destroy();
+        }
+        else
+        {
+            LOG_WARNING("%u canvases still borrowed.", used);
+        }
+    }
+}
+
+uint8_t* CanvasPool::acquire(const void* owner, size_t size, bool& isPreserved)
+{
+    uint8_t* pixels = nullptr;
+
+    isPreserved = false;
+
+    if ((true == m_mutex.isAllocated()) &&
+        (0U < size))
+    {
+        MutexGuard<Mutex>   guard(m_mutex);
+        uint8_t             bucket  = getBucket(size);
+        uint8_t             idx     = MAX_CANVASES;
+
+        if (BUCKET_COUNT > bucket)
+        {
+            /* Prefer the canvas with the preserved content of the owner,
+             * then a spare one and only at last steal the preserved content
+             * of another owner.
+             */
+            idx = findFree(bucket, owner, true);
+
+            if (MAX_CANVASES > idx)
+            {
+                isPreserved = true;
+            }
+            else
+            {
+                idx = findFree(bucket, nullptr, false);
+
+                if (MAX_CANVASES <= idx)
+                {
+                    idx = findFree(bucket, nullptr, true);
+                }
+            }
+
+            /* No free canvas in the bucket, create a new one. */
+            if (MAX_CANVASES <= idx)
+            {
+                idx = 0U;
+                while((MAX_CANVASES > idx) && (nullptr != m_canvases[idx].pixels))
+                {
+                    ++idx;
+                }
+
+                if (MAX_CANVASES > idx)
+                {
+                    m_canvases[idx].pixels = AllocTracker::getInstance().newArray<uint8_t>(AllocTracker::TAG_GFX, m_capacities[bucket]);
+
+                    if (nullptr == m_canvases[idx].pixels)
+                    {
+                        idx = MAX_CANVASES;
+                    }
+                    else
+                    {
+                        m_canvases[idx].bucket = bucket;
+                    }
+                }
+            }
+
+            if (MAX_CANVASES > idx)
+            {
+                uint8_t used    = 0U;
+                uint8_t canvIdx = 0U;
+
+                m_canvases[idx].owner       = owner;
+                m_canvases[idx].isUsed      = true;
+                m_canvases[idx].isPreserved = false;
+                pixels                      = m_canvases[idx].pixels;
+
+                for(canvIdx = 0U; canvIdx < MAX_CANVASES; ++canvIdx)
+                {
+                    if ((bucket == m_canvases[canvIdx].bucket) &&
+                        (true == m_canvases[canvIdx].isUsed))
+                    {
+                        ++used;
+                    }
+                }
+
+                if (m_peakUsed[bucket] < used)
+                {
+                    m_peakUsed[bucket] = used;
+                }
+            }
+        }
+    }
+
+    /* Pool exhausted, request too large or pool not available, use the heap as fallback. */
+    if ((nullptr == pixels) &&
+        (0U < size))
+    {
+        pixels = AllocTracker::getInstance().newArray<uint8_t>(AllocTracker::TAG_GFX, size);
+
+        if (nullptr == pixels)
+        {
+            LOG_WARNING("No canvas with %u byte available.", static_cast<uint32_t>(size));
+        }
+        else
+        {
+            ++m_fallbacks;
+        }
+    }
+
+    return pixels;
+}
+
+void CanvasPool::release(const void* owner, uint8_t* pixels, bool preserve)
+{
+    bool isPooled = false;
+
+    if (nullptr != pixels)
+    {
+        if (true == m_mutex.isAllocated())
+        {
+            MutexGuard<Mutex>   guard(m_mutex);
+            uint8_t             idx     = 0U;
+
+            while((MAX_CANVASES > idx) && (false == isPooled))
+            {
+                if (pixels == m_canvases[idx].pixels)
+                {
+                    isPooled = true;
+                }
+                else
+                {
+                    ++idx;
+                }
+            }
+
+            if (true == isPooled)
+            {
+                Canvas&         canvas  = m_canvases[idx];
+                const uint8_t   SPARE   = countSpare(canvas.bucket); /* Without the given back canvas itself */
+
+                canvas.isUsed = false;
+
+                if (true == preserve)
+                {
+                    canvas.owner        = owner;
+                    canvas.isPreserved  = true;
+                }
+                /* Keep only one spare canvas per bucket to give the memory
+                 * back to the other buckets.
+                 */
+                else if (0U < SPARE)
+                {
+                    AllocTracker::getInstance().deleteArray(canvas.pixels);
+                    canvas = Canvas();
+                }
+                else
+                {
+                    canvas.owner        = nullptr;
+                    canvas.isPreserved  = false;
+                }
+            }
+        }
+
+        if (false == isPooled)
+        {
+            AllocTracker::getInstance().deleteArray(pixels);
+        }
+    }
+}
+
+void CanvasPool::forget(const void* owner)
+{
+    uint8_t idx = 0U;
+
+    if ((true == m_mutex.isAllocated()) &&
+        (nullptr != owner))
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        for(idx = 0U; idx < MAX_CANVASES; ++idx)
+        {
+            Canvas& canvas = m_canvases[idx];
+
+            if ((false == canvas.isUsed) &&
+                (owner == canvas.owner))
+            {
+                canvas.owner        = nullptr;
+                canvas.isPreserved  = false;
+            }
+        }
+    }
+}
+
+bool CanvasPool::getBucketStatistics(uint8_t idx, BucketStatistics& stats)
+{
+    bool isSuccessful = false;
+
+    if ((true == m_mutex.isAllocated()) &&
+        (BUCKET_COUNT > idx))
+    {
+        MutexGuard<Mutex>   guard(m_mutex);
+        uint8_t             canvIdx = 0U;
+
+        stats           = BucketStatistics();
+        stats.capacity  = m_capacities[idx];
+        stats.peakUsed  = m_peakUsed[idx];
+
+        for(canvIdx = 0U; canvIdx < MAX_CANVASES; ++canvIdx)
+        {
+            const Canvas& canvas = m_canvases[canvIdx];
+
+            if ((nullptr != canvas.pixels) &&
+                (idx == canvas.bucket))
+            {
+                ++stats.canvases;
+
+                if (true == canvas.isUsed)
+                {
+                    ++stats.used;
+                }
+                else if (true == canvas.isPreserved)
+                {
+                    ++stats.preserved;
+                }
+                else
+                {
+                    ;
+                }
+            }
+        }
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+CanvasPool::CanvasPool() :
+    m_mutex(),
+    m_capacities(),
+    m_peakUsed(),
+    m_canvases(),
+    m_fallbacks(0U)
+{
+}
+
+uint8_t CanvasPool::getBucket(size_t size) const
+{
+    uint8_t bucket = 0U;
+
+    /* The capacities are sorted ascending, so the first one which is big
+     * enough, fits best.
+     */
+    while((BUCKET_COUNT > bucket) && (size > m_capacities[bucket]))
+    {
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+uint8_t CanvasPool::findFree(uint8_t bucket, const void* owner, bool isPreserved) const
+{
+    uint8_t idx     = 0U;
+    uint8_t found   = MAX_CANVASES;
+
+    while((MAX_CANVASES > idx) && (MAX_CANVASES <= found))
+    {
+        const Canvas& canvas = m_canvases[idx];
+
+        if ((nullptr != canvas.pixels) &&
+            (bucket == canvas.bucket) &&
+            (false == canvas.isUsed) &&
+            (isPreserved == canvas.isPreserved) &&
+            ((nullptr == owner) || (owner == canvas.owner)))
+        {
+            found = idx;
+        }
+
+        ++idx;
+    }
+
+    return found;
+}
+
+uint8_t CanvasPool::countSpare(uint8_t bucket) const
+{
+    uint8_t idx     = 0U;
+    uint8_t spare   = 0U;
+
+    for(idx = 0U; idx < MAX_CANVASES; ++idx)
+    {
+        const Canvas& canvas = m_canvases[idx];
+
+        if ((nullptr != canvas.pixels) &&
+            (bucket == canvas.bucket) &&
+            (false == canvas.isUsed) &&
+            (false == canvas.isPreserved))
+        {
+            ++spare;
+        }
+    }
+
+    return spare;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,547 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pool of reusable off-screen canvases
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef CANVAS_POOL_H
+#define CANVAS_POOL_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <YAGfxBitmap.h>
+#include <ColorDef.hpp>
+#include <Mutex.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The canvas pool holds the pixel buffers of off-screen canvases. It is set
+ * up by the display manager. The canvases are sorted into buckets by size
+ * class, the largest size class is the display size. The size classes are
+ * in byte, therefore canvases with different color formats share them.
+ *
+ * Users borrow a canvas with the PooledCanvas while they need it, e.g. when
+ * their slot is active, and give it back afterwards. This way the pixel
+ * buffers are shared between the users instead of every user holding its own.
+ *
+ * A canvas can be given back with content preservation. As long as no other
+ * user needs it, the same user gets it back with the old content.
+ *
+ * If the request is bigger than the largest size class or the pool has no
+ * free place, the pixel buffer is allocated on the heap as fallback. Every
+ * fallback is counted.
+ */
+class CanvasPool
+{
+public:
+
+    /**
+     * Statistics per bucket.
+     */
+    struct BucketStatistics
+    {
+        uint32_t    capacity;   /**< Canvas capacity in byte */
+        uint8_t     canvases;   /**< Number of allocated canvases */
+        uint8_t     used;       /**< Number of currently borrowed canvases */
+        uint8_t     preserved;  /**< Number of given back canvases with preserved content */
+        uint8_t     peakUsed;   /**< Max. number of concurrently borrowed canvases */
+
+        /**
+         * Initializes empty bucket statistics.
+         */
+        BucketStatistics() :
+            capacity(0U),
+            canvases(0U),
+            used(0U),
+            preserved(0U),
+            peakUsed(0U)
+        {
+        }
+    };
+
+    /**
+     * Get canvas pool instance.
+     *
+     * @return Canvas pool instance
+     */
+    static CanvasPool& getInstance()
+    {
+        static CanvasPool instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Start the canvas pool. The display size is the largest size class.
+     *
+     * @param[in] width     Display width in pixels
+     * @param[in] height    Display height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool begin(uint16_t width, uint16_t height);
+
+    /**
+     * Release all canvases, which are not borrowed.
+     * As long as canvases are borrowed, the pool stays available.
+     */
+    void end();
+
+    /**
+     * Acquire a pixel buffer with at least the requested size.
+     * Use the PooledCanvas instead of calling it directly.
+     *
+     * @param[in]   owner       The canvas, which borrows the pixel buffer.
+     * @param[in]   size        Requested size in byte.
+     * @param[out]  isPreserved Shows whether the pixel buffer contains the content, the owner gave back.
+     *
+     * @return If successful, it will return the pixel buffer otherwise nullptr.
+     */
+    uint8_t* acquire(const void* owner, size_t size, bool& isPreserved);
+
+    /**
+     * Release a pixel buffer, which was acquired before.
+     * Use the PooledCanvas instead of calling it directly.
+     *
+     * @param[in] owner     The canvas, which borrowed the pixel buffer.
+     * @param[in] pixels    The pixel buffer.
+     * @param[in] preserve  Preserve the content for the owner as long as possible.
+     */
+    void release(const void* owner, uint8_t* pixels, bool preserve);
+
+    /**
+     * Forget all preserved content of a owner, e.g. because it is destroyed.
+     *
+     * @param[in] owner The canvas, which borrowed pixel buffers.
+     */
+    void forget(const void* owner);
+
+    /**
+     * Get statistics of a bucket.
+     *
+     * @param[in]   idx     Bucket index [0; BUCKET_COUNT - 1]
+     * @param[out]  stats   Bucket statistics
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool getBucketStatistics(uint8_t idx, BucketStatistics& stats);
+
+    /**
+     * Get number of pixel buffers, which were served by the heap.
+     *
+     * @return Number of fallbacks
+     */
+    uint32_t getFallbacks() const
+    {
+        return m_fallbacks;
+    }
+
+    /**
+     * Number of buckets (size classes).
+     */
+    static const uint8_t    BUCKET_COUNT    = 4U;
+
+    /**
+     * Max. number of canvases over all buckets. Every shown bitmap widget
+     * borrows one, therefore it considers several installed icon plugins.
+     */
+    static const uint8_t    MAX_CANVASES    = 32U;
+
+private:
+
+    /**
+     * A pooled canvas pixel buffer.
+     */
+    struct Canvas
+    {
+        uint8_t*            pixels;         /**< Pixel buffer */
+        uint8_t             bucket;         /**< Bucket index */
+        const void*         owner;          /**< Current owner or the owner of the preserved content */
+        bool                isUsed;         /**< Is the canvas borrowed? */
+        bool                isPreserved;    /**< Is the content preserved for the owner? */
+
+        /**
+         * Initializes a empty canvas.
+         */
+        Canvas() :
+            pixels(nullptr),
+            bucket(0U),
+            owner(nullptr),
+            isUsed(false),
+            isPreserved(false)
+        {
+        }
+    };
+
+    Mutex       m_mutex;                        /**< Protects the pool against concurrent access. */
+    uint32_t    m_capacities[BUCKET_COUNT];     /**< Canvas capacity in byte per bucket, sorted ascending */
+    uint8_t     m_peakUsed[BUCKET_COUNT];       /**< Max. number of concurrently borrowed canvases per bucket */
+    Canvas      m_canvases[MAX_CANVASES];       /**< Pooled canvases */
+    uint32_t    m_fallbacks;                    /**< Number of pixel buffers, which were served by the heap */
+
+    /**
+     * Constructs the canvas pool.
+     */
+    CanvasPool();
+
+    /**
+     * Destroys the canvas pool.
+     */
+    ~CanvasPool()
+    {
+        /* Will never be called. */
+    }
+
+    CanvasPool(const CanvasPool& pool);
+    CanvasPool& operator=(const CanvasPool& pool);
+
+    /**
+     * Get the bucket with the smallest size class, which fits.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return Bucket index. If no size class fits, it will return BUCKET_COUNT.
+     */
+    uint8_t getBucket(size_t size) const;
+
+    /**
+     * Find a canvas, which is not borrowed. The mutex must be taken!
+     *
+     * @param[in] bucket        Bucket index
+     * @param[in] owner         Owner of the preserved content, only considered if preserved.
+     * @param[in] isPreserved   Shall the content be preserved?
+     *
+     * @return If found, it will return the canvas index otherwise MAX_CANVASES.
+     */
+    uint8_t findFree(uint8_t bucket, const void* owner, bool isPreserved) const;
+
+    /**
+     * Count the canvases of a bucket, which are not borrowed and whose
+     * content is not preserved. The mutex must be taken!
+     *
+     * @param[in] bucket    Bucket index
+     *
+     * @return Number of spare canvases
+     */
+    uint8_t countSpare(uint8_t bucket) const;
+};
+
+/**
+ * A off-screen canvas, which borrows its pixel buffer from the canvas pool.
+ * As long as no pixel buffer is borrowed, the canvas has no size.
+ *
+ * @tparam TColor The color representation.
+ */
+template < typename TColor >
+class BasePooledCanvas : public BaseGfxBitmap<TColor>
+{
+public:
+
+    /**
+     * Constructs the canvas, but without pixel buffer.
+     */
+    BasePooledCanvas() :
+        BaseGfxBitmap<TColor>(),
+        m_pixels(nullptr),
+        m_width(0U),
+        m_height(0U),
+        m_isPreserved(false)
+    {
+    }
+
+    /**
+     * Destroys the canvas and gives the pixel buffer back.
+     */
+    ~BasePooledCanvas()
+    {
+        giveBack(false);
+        CanvasPool::getInstance().forget(this);
+    }
+
+    /**
+     * Borrow a pixel buffer from the canvas pool.
+     * If the content was preserved, the canvas will contain it again,
+     * otherwise it will be black. Check it with isContentPreserved().
+     * If a pixel buffer with a different size is already borrowed, it will
+     * be given back before.
+     *
+     * @param[in] width     Canvas width in pixels
+     * @param[in] height    Canvas height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool borrow(uint16_t width, uint16_t height)
+    {
+        const size_t SIZE = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(TColor);
+
+        if ((nullptr != m_pixels) &&
+            ((width != m_width) || (height != m_height)))
+        {
+            giveBack(false);
+        }
+
+        if (nullptr == m_pixels)
+        {
+            m_pixels = reinterpret_cast<TColor*>(CanvasPool::getInstance().acquire(this, SIZE, m_isPreserved));
+
+            if (nullptr != m_pixels)
+            {
+                m_width     = width;
+                m_height    = height;
+
+                if (false == m_isPreserved)
+                {
+                    this->fillScreen(TColor(ColorDef::BLACK));
+                }
+            }
+        }
+
+        return (nullptr != m_pixels);
+    }
+
+    /**
+     * Give the pixel buffer back to the canvas pool.
+     *
+     * @param[in] preserve  Preserve the content for the next borrow() as long as possible.
+     */
+    void giveBack(bool preserve = false)
+    {
+        if (nullptr != m_pixels)
+        {
+            CanvasPool::getInstance().release(this, reinterpret_cast<uint8_t*>(m_pixels), preserve);
+
+            m_pixels        = nullptr;
+            m_width         = 0U;
+            m_height        = 0U;
+            m_isPreserved   = false;
+        }
+    }
+
+    /**
+     * Is a pixel buffer borrowed?
+     *
+     * @return If borrowed, it will return true otherwise false.
+     */
+    bool isBorrowed() const
+    {
+        return (nullptr != m_pixels);
+    }
+
+    /**
+     * Does the canvas contain the preserved content after borrow()?
+     *
+     * @return If the content is preserved, it will return true otherwise false.
+     */
+    bool isContentPreserved() const
+    {
+        return m_isPreserved;
+    }
+
+    /**
+     * Get the width of the canvas in pixels.
+     *
+     * @return Width in pixels
+     */
+    uint16_t getWidth() const override
+    {
+        return m_width;
+    }
+
+    /**
+     * Get the height of the canvas in pixels.
+     *
+     * @return Height in pixels
+     */
+    uint16_t getHeight() const override
+    {
+        return m_height;
+    }
+
+    /**
+     * Get pixel color at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    TColor& getColor(int16_t x, int16_t y) override
+    {
+        static TColor   trash;
+        TColor*         pixel   = &trash;
+
+        if ((0 <= x) &&
+            (m_width > x) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            pixel = &m_pixels[x + y * m_width];
+        }
+
+        return *pixel;
+    }
+
+    /**
+     * Get pixel color at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    const TColor& getColor(int16_t x, int16_t y) const override
+    {
+        static TColor   trash;
+        const TColor*   pixel   = &trash;
+
+        if ((0 <= x) &&
+            (m_width > x) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            pixel = &m_pixels[x + y * m_width];
+        }
+
+        return *pixel;
+    }
+
+    /**
+     * Draw a single pixel at given position.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     */
+    void drawPixel(int16_t x, int16_t y, const TColor& color) override
+    {
+        if ((0 <= x) &&
+            (m_width > x) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            m_pixels[x + y * m_width] = color;
+        }
+    }
+
+    /**
+     * Get direct access to the pixel at given position. The pixels of the
+     * row follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If inside the canvas, it will return the pixel otherwise nullptr.
+     */
+    TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) override
+    {
+        TColor* pixel = nullptr;
+
+        stride = m_width;
+
+        if ((0 <= x) &&
+            (m_width > x) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            pixel = &m_pixels[x + y * m_width];
+        }
+
+        return pixel;
+    }
+
+    /**
+     * Get direct access to the pixel at given position. The pixels of the
+     * row follow directly in memory, the pixel below is stride pixels ahead.
+     *
+     * @param[in]   x       x-coordinate
+     * @param[in]   y       y-coordinate
+     * @param[out]  stride  Number of pixels from one row to the next one
+     *
+     * @return If inside the canvas, it will return the pixel otherwise nullptr.
+     */
+    const TColor* getSpan(int16_t x, int16_t y, uint16_t& stride) const override
+    {
+        const TColor* pixel = nullptr;
+
+        stride = m_width;
+
+        if ((0 <= x) &&
+            (m_width > x) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            pixel = &m_pixels[x + y * m_width];
+        }
+
+        return pixel;
+    }
+
+private:
+
+    TColor*     m_pixels;       /**< Borrowed pixel buffer */
+    uint16_t    m_width;        /**< Canvas width in pixels */
+    uint16_t    m_height;       /**< Canvas height in pixels */
+    bool        m_isPreserved;  /**< Was the content preserved at the last borrow? */
+
+    BasePooledCanvas(const BasePooledCanvas& canvas);
+    BasePooledCanvas& operator=(const BasePooledCanvas& canvas);
+};
+
+/** Pooled off-screen canvas with concrete color. */
+using PooledCanvas = BasePooledCanvas<Color>;
+
+/** Pooled off-screen canvas with compact RGB565 color (2 byte per pixel). */
+using PooledCanvasRgb565 = BasePooledCanvas<Rgb565>;
+
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* CANVAS_POOL_H */
+
+/** @} */
@@ -118,6 +118,13 @@ public:
      */
     virtual bool isOn() const = 0;
 
+    /**
+     * Get the estimated current, which the display draws.
+     *
+     * @return Current in mA. If the display doesn't estimate it, it will return 0.
+     */
+    virtual uint32_t getCurrent() const = 0;
+
 protected:
 
     /**
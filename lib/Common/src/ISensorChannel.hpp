@@ -82,7 +82,8 @@ public:
         TYPE_TEMPERATURE_DEGREE_CELSIUS,    /**< Temperature in [°C] */
         TYPE_HUMIDITY_PERCENT,              /**< Humidity in [%] */
         TYPE_ILLUMINANCE_LUX,               /**< Illuminance in [lux] */
-        TYPE_STATE_OF_CHARGE_PERCENT        /**< State of Charge in [%] */
+        TYPE_STATE_OF_CHARGE_PERCENT,       /**< State of Charge in [%] */
+        TYPE_CURRENT_MILLIAMPERE            /**< Current in [mA] */
     };
 
     /**
@@ -148,6 +149,10 @@ public:
             name = "soc";
             break;
 
+        case ISensorChannel::TYPE_CURRENT_MILLIAMPERE:
+            name = "current";
+            break;
+
         default:
             break;
         }
@@ -189,6 +194,10 @@ public:
             unit = "%";
             break;
 
+        case ISensorChannel::TYPE_CURRENT_MILLIAMPERE:
+            unit = "mA";
+            break;
+
         default:
             break;
         }
@@ -51,7 +51,6 @@
 #include <BitmapWidget.h>
 #include <stdint.h>
 #include <TextWidget.h>
-#include <SimpleTimer.hpp>
 #include <Mutex.hpp>
 #include <FileSystem.h>
 
@@ -189,7 +188,6 @@ public:
         m_targetDateInformation(),
         m_remainingDays(""),
         m_mutex(),
-        m_cfgReloadTimer(),
         m_storeConfigReq(false),
         m_reloadConfigReq(false),
         m_hasTopicChanged(false)
@@ -346,6 +344,16 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return PROCESS_PERIOD_DEFAULT;
+    }
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -388,13 +396,6 @@ private:
     */
     static const int16_t    TM_OFFSET_YEAR  = 1900;
 
-    /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
-     */
-    static const uint32_t   CFG_RELOAD_PERIOD   = SIMPLE_TIMER_SECONDS(30U);
-
     Fonts::FontType         m_fontType;                 /**< Font type which shall be used if there is no conflict with the layout. */
     WidgetGroup             m_textCanvas;               /**< Canvas used for the text widget. */
     WidgetGroup             m_iconCanvas;               /**< Canvas used for the bitmap widget. */
@@ -405,7 +406,6 @@ private:
     TargetDayDescription    m_targetDateInformation;    /**< String used for configured additional target date information. */
     String                  m_remainingDays;            /**< String used for displaying the remaining days untril the target date. */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
-    SimpleTimer             m_cfgReloadTimer;           /**< Timer is used to cyclic reload the configuration from persistent memory. */
     bool                    m_storeConfigReq;           /**< Is requested to store the configuration in persistent memory? */
     bool                    m_reloadConfigReq;          /**< Is requested to reload the configuration from persistent memory? */
     bool                    m_hasTopicChanged;          /**< Has the topic content changed? */
@@ -69,11 +69,11 @@ void DDPPlugin::start(uint16_t width, uint16_t height)
     String  version         = "0.1.0";              /* From library.json */
     String  mac             = WiFi.macAddress();
 
-    if (false == m_framebuffer.create(width, height))
-    {
-        LOG_ERROR("Failed to create framebuffer (%u x %u).", width, height);
-    }
-    else if (false == m_server.begin(manufacturer, model, version, mac))
+    /* The framebuffer is borrowed from the canvas pool only while the plugin is active. */
+    m_width     = width;
+    m_height    = height;
+
+    if (false == m_server.begin(manufacturer, model, version, mac))
     {
         LOG_ERROR("Failed to start DDP server.");
     }
@@ -97,7 +97,6 @@ void DDPPlugin::stop()
 
     m_server.registerDDPCallback(nullptr);
     m_server.end();
-    m_framebuffer.release();
 }
 
 void DDPPlugin::active(YAGfx& gfx)
@@ -105,12 +104,31 @@ void DDPPlugin::active(YAGfx& gfx)
     /* Clear display */
     gfx.fillScreen(ColorDef::BLACK);
 
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        if (false == m_framebuffer.borrow(m_width, m_height))
+        {
+            LOG_ERROR("Failed to borrow framebuffer (%u x %u).", m_width, m_height);
+        }
+
+        m_isUpdated = false;
+    }
+
     m_server.resume();
 }
 
 void DDPPlugin::inactive()
 {
     m_server.pause();
+
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        /* The DDP client sends the whole frame again, no need to preserve it. */
+        m_framebuffer.giveBack();
+        m_isUpdated = false;
+    }
 }
 
 void DDPPlugin::update(YAGfx& gfx)
@@ -159,9 +177,14 @@ void DDPPlugin::onData(DDPServer::Format format, uint32_t offset, uint8_t bitsPe
         ;
     }
 
-    if ((nullptr != payload) &&
-        (DDPServer::FORMAT_RGB == format) &&
-        (8U == bitsPerPixelElement))
+    /* Frames which are received while the plugin is inactive, are skipped. */
+    if (false == m_framebuffer.isBorrowed())
+    {
+        ;
+    }
+    else if ((nullptr != payload) &&
+             (DDPServer::FORMAT_RGB == format) &&
+             (8U == bitsPerPixelElement))
     {
         uint16_t    srcIdx          = 0U;
         int16_t     x               = (offset % m_framebuffer.getWidth());
@@ -45,7 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <Plugin.hpp>
-#include <YAGfxBitmap.h>
+#include <CanvasPool.h>
 #include "DDPServer.h"
 
 /******************************************************************************
@@ -75,6 +75,8 @@ public:
         m_server(),
         m_mutex(),
         m_framebuffer(),
+        m_width(0U),
+        m_height(0U),
         m_isUpdated(false)
     {
         (void)m_mutex.create();
@@ -150,7 +152,9 @@ private:
 
     DDPServer           m_server;       /**< DDP server */
     Mutex               m_mutex;        /**< Mutex to protect against concurrent access */
-    YAGfxDynamicBitmap  m_framebuffer;  /**< Framebuffer used for synchronization */
+    PooledCanvas        m_framebuffer;  /**< Framebuffer used for synchronization, only borrowed while the plugin is active. */
+    uint16_t            m_width;        /**< Framebuffer width in pixel */
+    uint16_t            m_height;       /**< Framebuffer height in pixel */
     bool                m_isUpdated;    /**< Is framebuffer updated and ready to show? */
 
     /**
@@ -95,7 +95,6 @@ public:
         m_dayOffColor(DAY_OFF_COLOR),
         m_slotInterf(nullptr),
         m_mutex(),
-        m_cfgReloadTimer(),
         m_storeConfigReq(false),
         m_reloadConfigReq(false),
         m_hasTopicChanged(false)
@@ -228,6 +227,16 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return PROCESS_PERIOD_DEFAULT;
+    }
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -298,13 +307,6 @@ private:
      */
     static const uint32_t   DURATION_DEFAULT        = SIMPLE_TIMER_SECONDS(30U);
 
-    /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
-     */
-    static const uint32_t   CFG_RELOAD_PERIOD       = SIMPLE_TIMER_SECONDS(30U);
-
     TextWidget              m_textWidget;               /**< Text widget, used for showing the text. */
     WidgetGroup             m_textCanvas;               /**< Canvas used for the text widget. */
     WidgetGroup             m_lampCanvas;               /**< Canvas used for the lamp widget. */
@@ -322,7 +324,6 @@ private:
     Color                   m_dayOffColor;              /**< Color of the other days in the day of the week bar. */
     const ISlotPlugin*      m_slotInterf;               /**< Slot interface */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
-    SimpleTimer             m_cfgReloadTimer;           /**< Timer is used to cyclic reload the configuration from persistent memory. */
     bool                    m_storeConfigReq;           /**< Is requested to store the configuration in persistent memory? */
     bool                    m_reloadConfigReq;          /**< Is requested to reload the configuration from persistent memory? */
     bool                    m_hasTopicChanged;          /**< Has the topic content changed? */
@@ -34,6 +34,8 @@
  *****************************************************************************/
 #include "FadeLinear.h"
 
+#include <YAGfxBlit.h>
+
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
@@ -78,18 +80,16 @@ bool FadeLinear::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MAX_BRIGHT - FADING_STEP) <= m_intensity)
     {
-        dimBitmap(next, Color::MAX_BRIGHT);
+        YAGfxBlit::blitDimmed(gfx, 0, 0, next, Color::MAX_BRIGHT);
         m_state     = FADE_STATE_INIT;
         isFinished  = true;
     }
     else
     {
-        dimBitmap(next, m_intensity);
+        YAGfxBlit::blitDimmed(gfx, 0, 0, next, m_intensity);
         m_intensity += FADING_STEP;
     }
 
-    gfx.copy(next);
-
     return isFinished;
 }
 
@@ -108,18 +108,16 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MIN_BRIGHT + FADING_STEP) >= m_intensity)
     {
-        dimBitmap(prev, Color::MIN_BRIGHT);
+        YAGfxBlit::blitDimmed(gfx, 0, 0, prev, Color::MIN_BRIGHT);
         m_state     = FADE_STATE_INIT;
         isFinished  = true;
     }
     else
     {
-        dimBitmap(prev, m_intensity);
+        YAGfxBlit::blitDimmed(gfx, 0, 0, prev, m_intensity);
         m_intensity -= FADING_STEP;
     }
 
-    gfx.copy(prev);
-
     return isFinished;
 }
 
@@ -131,22 +129,6 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
  * Private Methods
  *****************************************************************************/
 
-void FadeLinear::dimBitmap(YAGfxBitmap& bitmap, uint8_t intensity)
-{
-    uint16_t    width   = bitmap.getWidth();
-    uint16_t    height  = bitmap.getHeight();
-    int16_t     x       = 0;
-    int16_t     y       = 0;
-
-    for(y = 0; y < height; ++y)
-    {
-        for(x = 0; x < width; ++x)
-        {
-            bitmap.getColor(x, y).setIntensity(intensity);
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -80,10 +80,12 @@ bool FadeMoveX::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if (FADE_STATE_OUT != m_state)
     {
-        m_state     = FADE_STATE_OUT;
-        m_xOffset   = 0;
+        m_state = FADE_STATE_OUT;
+        m_tween.start(0, gfx.getWidth(), gfx.getWidth() * PIXEL_DURATION, Easing::CURVE_IN_OUT_QUAD);
     }
 
+    m_xOffset = static_cast<int16_t>(m_tween.getValue());
+
     for(x = 0; x < (gfx.getWidth() - m_xOffset); ++x)
     {
         for(y = 0; y < gfx.getHeight(); ++y)
@@ -100,9 +102,7 @@ bool FadeMoveX::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
         }
     }
 
-    ++m_xOffset;
-
-    if (gfx.getWidth() <= m_xOffset)
+    if (false == m_tween.isRunning())
     {
         m_state     = FADE_STATE_INIT;
         isFinished  = true;
@@ -45,6 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <IFadeEffect.hpp>
+#include <Tween.h>
 
 /******************************************************************************
  * Macros
@@ -58,6 +59,9 @@
  * A simple fade in/out effect, which moves the old content and out and the
  * new content in. The movement is along the x-axis into the direction of
  * the negative x-coordinates.
+ *
+ * The movement is driven by the frame clock and eased, therefore its duration
+ * is independent of the frame rate.
  */
 class FadeMoveX : public IFadeEffect
 {
@@ -68,7 +72,8 @@ public:
      */
     FadeMoveX() :
         m_state(FADE_STATE_INIT),
-        m_xOffset(0)
+        m_xOffset(0),
+        m_tween()
     {
     }
 
@@ -106,6 +111,9 @@ public:
      */
     bool fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next) final;
 
+    /** Duration in ms, to move the content by one pixel in average. */
+    static const uint32_t   PIXEL_DURATION  = 20U;
+
 private:
 
     /** Fading states. */
@@ -117,6 +125,7 @@ private:
 
     FadeState   m_state;        /**< Current fading state */
     int16_t     m_xOffset;      /**< Current x-offset regarding movement */
+    Tween       m_tween;        /**< Tween, which moves the x-offset. */
 
 };
 
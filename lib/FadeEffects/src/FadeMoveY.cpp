@@ -80,10 +80,12 @@ bool FadeMoveY::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if (FADE_STATE_OUT != m_state)
     {
-        m_state     = FADE_STATE_OUT;
-        m_yOffset   = 0;
+        m_state = FADE_STATE_OUT;
+        m_tween.start(0, gfx.getHeight(), gfx.getHeight() * PIXEL_DURATION, Easing::CURVE_IN_OUT_QUAD);
     }
 
+    m_yOffset = static_cast<int16_t>(m_tween.getValue());
+
     for(y = 0; y < (gfx.getHeight() - m_yOffset); ++y)
     {
         for(x = 0; x < gfx.getWidth(); ++x)
@@ -100,9 +102,7 @@ bool FadeMoveY::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
         }
     }
 
-    ++m_yOffset;
-
-    if (gfx.getHeight() <= m_yOffset)
+    if (false == m_tween.isRunning())
     {
         m_state     = FADE_STATE_INIT;
         isFinished  = true;
@@ -237,21 +237,12 @@ void GrabViaMqttPlugin::start(uint16_t width, uint16_t height)
             LOG_WARNING("Failed to create initial configuration file %s.", getFullPathToConfiguration().c_str());
         }
     }
-    else
-    {
-        /* Remember current timestamp to detect updates of the configuration in the
-         * filesystem without using the plugin API.
-         */
-        updateTimestampLastUpdate();
-    }
 
     if (false == m_iconPath.isEmpty())
     {
         (void)m_iconWidget.load(FILESYSTEM, m_iconPath);
     }
 
-    m_cfgReloadTimer.start(CFG_RELOAD_PERIOD);
-
     subscribe();
 }
 
@@ -260,7 +251,6 @@ void GrabViaMqttPlugin::stop()
     String                      configurationFilename = getFullPathToConfiguration();
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    m_cfgReloadTimer.stop();
     unsubscribe();
 
     if (false != FILESYSTEM.remove(configurationFilename))
@@ -274,15 +264,10 @@ void GrabViaMqttPlugin::process(bool isConnected)
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
     /* Configuration in persistent memory updated? */
-    if ((true == m_cfgReloadTimer.isTimerRunning()) &&
-        (true == m_cfgReloadTimer.isTimeout()))
+    if (true == isConfigurationUpdated())
     {
-        if (true == isConfigurationUpdated())
-        {
-            m_reloadConfigReq = true;
-        }
-
-        m_cfgReloadTimer.restart();
+        m_reloadConfigReq = true;
+        clearConfigurationUpdated();
     }
 
     if (true == m_storeConfigReq)
@@ -298,10 +283,7 @@ void GrabViaMqttPlugin::process(bool isConnected)
     {
         LOG_INFO("Reload configuration: %s", getFullPathToConfiguration().c_str());
 
-        if (true == loadConfiguration())
-        {
-            updateTimestampLastUpdate();
-        }
+        (void)loadConfiguration();
 
         m_reloadConfigReq = false;
     }
@@ -309,6 +291,9 @@ void GrabViaMqttPlugin::process(bool isConnected)
     {
         ;
     }
+
+    /* Prefetch the next frame of an animated icon. */
+    m_iconWidget.process();
 }
 
 void GrabViaMqttPlugin::update(YAGfx& gfx)
@@ -90,7 +90,6 @@ public:
         m_multiplier(1.0f),
         m_offset(0.0f),
         m_mutex(),
-        m_cfgReloadTimer(),
         m_storeConfigReq(false),
         m_reloadConfigReq(false),
         m_hasTopicChanged(false)
@@ -240,6 +239,17 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        /* Fast enough to prefetch the frames of an animated icon. */
+        return BitmapWidget::PROCESS_PERIOD;
+    }
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -265,13 +275,6 @@ private:
      */
     static const char*      TOPIC_CONFIG;
 
-    /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
-     */
-    static const uint32_t   CFG_RELOAD_PERIOD   = SIMPLE_TIMER_SECONDS(30U);
-
     Fonts::FontType         m_fontType;             /**< Font type which shall be used if there is no conflict with the layout. */
     WidgetGroup             m_layoutRight;          /**< Canvas used for the text widget in a layout with icon on the left side. */
     WidgetGroup             m_layoutLeft;           /**< Canvas used for the bitmap widget in a layout with text on the right side. */
@@ -286,7 +289,6 @@ private:
     float                   m_multiplier;           /**< If grabbed value is a number, it will be multiplied with the multiplier. */
     float                   m_offset;               /**< If grabbed value is a number, the offset will be added after the multiplication with the multiplier. */
     mutable MutexRecursive  m_mutex;                /**< Mutex to protect against concurrent access. */
-    SimpleTimer             m_cfgReloadTimer;       /**< Timer is used to cyclic reload the configuration from persistent memory. */
     bool                    m_storeConfigReq;       /**< Is requested to store the configuration in persistent memory? */
     bool                    m_reloadConfigReq;      /**< Is requested to reload the configuration from persistent memory? */
     bool                    m_hasTopicChanged;      /**< Has the topic content changed? */
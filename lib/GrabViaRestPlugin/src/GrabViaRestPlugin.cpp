@@ -244,21 +244,12 @@ void GrabViaRestPlugin::start(uint16_t width, uint16_t height)
             LOG_WARNING("Failed to create initial configuration file %s.", getFullPathToConfiguration().c_str());
         }
     }
-    else
-    {
-        /* Remember current timestamp to detect updates of the configuration in the
-         * filesystem without using the plugin API.
-         */
-        updateTimestampLastUpdate();
-    }
 
     if (false == m_iconPath.isEmpty())
     {
         (void)m_iconWidget.load(FILESYSTEM, m_iconPath);
     }
 
-    m_cfgReloadTimer.start(CFG_RELOAD_PERIOD);
-
     initHttpClient();
 }
 
@@ -267,7 +258,6 @@ void GrabViaRestPlugin::stop()
     String                      configurationFilename = getFullPathToConfiguration();
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    m_cfgReloadTimer.stop();
     m_requestTimer.stop();
 
     if (false != FILESYSTEM.remove(configurationFilename))
@@ -282,15 +272,10 @@ void GrabViaRestPlugin::process(bool isConnected)
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
     /* Configuration in persistent memory updated? */
-    if ((true == m_cfgReloadTimer.isTimerRunning()) &&
-        (true == m_cfgReloadTimer.isTimeout()))
+    if (true == isConfigurationUpdated())
     {
-        if (true == isConfigurationUpdated())
-        {
-            m_reloadConfigReq = true;
-        }
-
-        m_cfgReloadTimer.restart();
+        m_reloadConfigReq = true;
+        clearConfigurationUpdated();
     }
 
     if (true == m_storeConfigReq)
@@ -306,10 +291,7 @@ void GrabViaRestPlugin::process(bool isConnected)
     {
         LOG_INFO("Reload configuration: %s", getFullPathToConfiguration().c_str());
 
-        if (true == loadConfiguration())
-        {
-            updateTimestampLastUpdate();
-        }
+        (void)loadConfiguration();
 
         m_reloadConfigReq = false;
     }
@@ -409,6 +391,9 @@ void GrabViaRestPlugin::process(bool isConnected)
             break;
         }
     }
+
+    /* Prefetch the next frame of an animated icon. */
+    m_iconWidget.process();
 }
 
 void GrabViaRestPlugin::update(YAGfx& gfx)
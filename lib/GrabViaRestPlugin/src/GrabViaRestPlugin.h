@@ -96,7 +96,6 @@ public:
         m_requestTimer(),
         m_mutex(),
         m_isConnectionError(false),
-        m_cfgReloadTimer(),
         m_storeConfigReq(false),
         m_reloadConfigReq(false),
         m_hasTopicChanged(false),
@@ -258,6 +257,17 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        /* Fast enough to prefetch the frames of an animated icon. */
+        return BitmapWidget::PROCESS_PERIOD;
+    }
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -295,13 +305,6 @@ private:
      */
     static const uint32_t   UPDATE_PERIOD_SHORT = SIMPLE_TIMER_SECONDS(10U);
 
-    /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
-     */
-    static const uint32_t   CFG_RELOAD_PERIOD   = SIMPLE_TIMER_SECONDS(30U);
-
     Fonts::FontType         m_fontType;             /**< Font type which shall be used if there is no conflict with the layout. */
     WidgetGroup             m_layoutRight;          /**< Canvas used for the text widget in a layout with icon on the left side. */
     WidgetGroup             m_layoutLeft;           /**< Canvas used for the bitmap widget in a layout with text on the right side. */
@@ -320,7 +323,6 @@ private:
     SimpleTimer             m_requestTimer;         /**< Timer used for cyclic request of new data. */
     mutable MutexRecursive  m_mutex;                /**< Mutex to protect against concurrent access. */
     bool                    m_isConnectionError;    /**< Is connection error happened? */
-    SimpleTimer             m_cfgReloadTimer;       /**< Timer is used to cyclic reload the configuration from persistent memory. */
     bool                    m_storeConfigReq;       /**< Is requested to store the configuration in persistent memory? */
     bool                    m_reloadConfigReq;      /**< Is requested to reload the configuration from persistent memory? */
     bool                    m_hasTopicChanged;      /**< Has the topic content changed? */
@@ -165,6 +165,21 @@ namespace LedMatrix
     /** Max. current in mA per LED */
     constexpr uint32_t  maxCurrentPerLed    = 60U;
 
+    /** Current in mA of a LED, which is off */
+    constexpr uint32_t  idleCurrentPerLed   = 1U;
+
+    /** Gamma value of the LEDs, 1 disables the gamma correction */
+    constexpr float     gamma               = CONFIG_LED_GAMMA;
+
+    /** White balance factor of the red LEDs [0; 255] */
+    constexpr uint8_t   whiteBalanceRed     = CONFIG_LED_WHITE_BALANCE_RED;
+
+    /** White balance factor of the green LEDs [0; 255] */
+    constexpr uint8_t   whiteBalanceGreen   = CONFIG_LED_WHITE_BALANCE_GREEN;
+
+    /** White balance factor of the blue LEDs [0; 255] */
+    constexpr uint8_t   whiteBalanceBlue    = CONFIG_LED_WHITE_BALANCE_BLUE;
+
 };
 
 /******************************************************************************
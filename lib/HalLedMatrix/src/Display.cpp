@@ -71,8 +71,19 @@ Display::Display() :
     m_strip(Board::LedMatrix::width * Board::LedMatrix::height, Board::Pin::ledMatrixDataOutPinNo),
     m_topo(Board::LedMatrix::width, Board::LedMatrix::height),
     m_ledMatrix(),
-    m_isOn(true)
+    m_isOn(true),
+    m_powerLimiter(
+        Board::LedMatrix::supplyCurrentMax,
+        Board::LedMatrix::width * Board::LedMatrix::height,
+        Board::LedMatrix::maxCurrentPerLed / 3U,
+        Board::LedMatrix::idleCurrentPerLed),
+    m_colorPipeline()
 {
+    m_colorPipeline.setCalibration(
+        Board::LedMatrix::gamma,
+        Board::LedMatrix::whiteBalanceRed,
+        Board::LedMatrix::whiteBalanceGreen,
+        Board::LedMatrix::whiteBalanceBlue);
 }
 
 Display::~Display()
@@ -86,16 +97,45 @@ void Display::show()
         const int16_t height = m_ledMatrix.getHeight();
         const int16_t width = m_ledMatrix.getWidth();
 
+        /* The current is estimated first, so that the luminance limits
+         * the frame, which is sent now and not only the next one. The LED
+         * current depends on the gamma corrected and white balanced values.
+         */
+        m_powerLimiter.beginFrame();
+
+        for (int16_t y = 0; y < height; ++y)
+        {
+            for (int16_t x = 0; x < width; ++x)
+            {
+                const Color& color = m_ledMatrix.getColor(x, y);
+
+                m_powerLimiter.addPixel(
+                    m_colorPipeline.getPreciseValue(ColorPipeline::CHANNEL_RED, color.getRed()),
+                    m_colorPipeline.getPreciseValue(ColorPipeline::CHANNEL_GREEN, color.getGreen()),
+                    m_colorPipeline.getPreciseValue(ColorPipeline::CHANNEL_BLUE, color.getBlue()));
+            }
+        }
+
+        m_powerLimiter.endFrame();
+        m_colorPipeline.setLuminance(m_powerLimiter.getLuminance());
+        m_colorPipeline.beginFrame();
+
         for (int16_t y = 0; y < height; ++y)
         {
             for (int16_t x = 0; x < width; ++x)
             {
-                HtmlColor htmlColor = static_cast<uint32_t>(m_ledMatrix.getColor(x, y));
+                const Color&    color   = m_ledMatrix.getColor(x, y);
+                uint8_t         red     = color.getRed();
+                uint8_t         green   = color.getGreen();
+                uint8_t         blue    = color.getBlue();
 #if CONFIG_DISPLAY_ROTATE180 != 0
-                m_strip.SetPixelColor(m_topo.Map(width - x - 1, height - y - 1), htmlColor);
+                uint16_t        index   = m_topo.Map(width - x - 1, height - y - 1);
 #else
-                m_strip.SetPixelColor(m_topo.Map(x, y), htmlColor);
+                uint16_t        index   = m_topo.Map(x, y);
 #endif
+
+                m_colorPipeline.apply(index, red, green, blue);
+                m_strip.SetPixelColor(index, RgbColor(red, green, blue));
             }
         }
 
@@ -110,6 +150,10 @@ void Display::off()
     /* Simulate powered off display. */
     m_strip.ClearTo(ColorDef::BLACK);
     m_strip.Show();
+
+    /* Only the idle current is left. */
+    m_powerLimiter.beginFrame();
+    m_powerLimiter.endFrame();
 }
 
 void Display::on()
@@ -45,9 +45,11 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <IDisplay.hpp>
-#include <NeoPixelBusLg.h>
+#include <NeoPixelBus.h>
 #include <ColorDef.hpp>
 #include <YAGfxBitmap.h>
+#include <PowerLimiter.h>
+#include <ColorPipeline.h>
 
 #include "Board.h"
 
@@ -116,13 +118,10 @@ public:
     void setBrightness(uint8_t brightness) final
     {
         /* To protect the electronic parts, the luminance will be scaled down
-         * according to the max. supply current.
+         * by the power limiter, if the content would exceed the max. supply current.
          */
-        const uint8_t SAFE_LUMINANCE =
-            (Board::LedMatrix::supplyCurrentMax * brightness) /
-            (Board::LedMatrix::maxCurrentPerLed * Board::LedMatrix::width *Board::LedMatrix::height);
-
-        m_strip.SetLuminance(SAFE_LUMINANCE);
+        m_powerLimiter.setBrightness(brightness);
+        m_colorPipeline.setLuminance(m_powerLimiter.getLuminance());
     }
 
     /**
@@ -197,12 +196,24 @@ public:
      */
     bool isOn() const final;
 
+    /**
+     * Get the estimated current, which the display draws.
+     * It is estimated from the content of the last shown frame.
+     *
+     * @return Current in mA
+     */
+    uint32_t getCurrent() const final
+    {
+        return m_powerLimiter.getCurrent();
+    }
+
 private:
 
     /**
-     * Pixel representation of the LED matrix. Gamma correction disabled.
+     * Pixel representation of the LED matrix. Gamma correction and luminance
+     * are applied by the color pipeline.
      */
-    NeoPixelBusLg<NeoGrbFeature, Neo800KbpsMethod, NeoGammaNullMethod>      m_strip;
+    NeoPixelBus<NeoGrbFeature, Neo800KbpsMethod>                            m_strip;
 
     /** Panel topology, used to map coordinates to the framebuffer. */
     NeoTopology<CONFIG_LED_TOPO>                                            m_topo;
@@ -218,6 +229,18 @@ private:
      */
     bool                                                                    m_isOn;
 
+    /**
+     * Limits the luminance according to the estimated current of the
+     * content and the max. supply current.
+     */
+    PowerLimiter                                                            m_powerLimiter;
+
+    /**
+     * Applies gamma correction, white balance and luminance with temporal
+     * dithering on the way to the LEDs.
+     */
+    ColorPipeline                                                           m_colorPipeline;
+
     /**
      * Construct display.
      */
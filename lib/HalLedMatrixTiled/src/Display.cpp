@@ -0,0 +1,217 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  LED matrix display
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Display.h"
+
+#include <Util.h>
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/* Every segment requires its own RMT channel. */
+static_assert(TiledLedMatrix::MAX_SEGMENTS >= Board::LedMatrix::segmentCount, "Too many LED segments.");
+
+/* Every segment requires its layout and rotation. */
+static_assert(Board::LedMatrix::segmentCount == UTIL_ARRAY_NUM(Board::LedMatrix::segmentLayout), "Layout of LED segment missing.");
+static_assert(Board::LedMatrix::segmentCount == UTIL_ARRAY_NUM(Board::LedMatrix::segmentRotation), "Rotation of LED segment missing.");
+
+/* The panels shall cover the whole LED matrix. */
+static_assert(0U == (Board::LedMatrix::width % Board::LedMatrix::tileWidth), "LED matrix width is no multiple of the tile width.");
+static_assert(0U == (Board::LedMatrix::height % Board::LedMatrix::tileHeight), "LED matrix height is no multiple of the tile height.");
+static_assert(Board::LedMatrix::segmentCount ==
+    ((Board::LedMatrix::width / Board::LedMatrix::tileWidth) * (Board::LedMatrix::height / Board::LedMatrix::tileHeight)),
+    "Number of LED segments doesn't cover the LED matrix.");
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool Display::begin()
+{
+    const uint16_t  TILES_PER_ROW   = Board::LedMatrix::width / Board::LedMatrix::tileWidth;
+    bool            isSuccessful    = true;
+    uint8_t         idx             = 0U;
+
+    /* The segments are created only once. */
+    for(idx = m_tiledMatrix.getSegmentCount(); (idx < Board::LedMatrix::segmentCount) && (true == isSuccessful); ++idx)
+    {
+        LedTile::Rotation   rotation        = Board::LedMatrix::segmentRotation[idx];
+        bool                isTransposed    = (LedTile::ROTATE_90 == rotation) || (LedTile::ROTATE_270 == rotation);
+        uint16_t            panelWidth      = (true == isTransposed) ? Board::LedMatrix::tileHeight : Board::LedMatrix::tileWidth;
+        uint16_t            panelHeight     = (true == isTransposed) ? Board::LedMatrix::tileWidth : Board::LedMatrix::tileHeight;
+        LedTile             tile(
+                                (idx % TILES_PER_ROW) * Board::LedMatrix::tileWidth,
+                                (idx / TILES_PER_ROW) * Board::LedMatrix::tileHeight,
+                                panelWidth,
+                                panelHeight,
+                                Board::LedMatrix::segmentLayout[idx],
+                                rotation);
+
+        if (nullptr == m_segments[idx])
+        {
+            m_segments[idx] = new(std::nothrow) NeoPixelSegment(
+                                                    tile.getLength(),
+                                                    Board::Pin::ledSegmentDataOutPinNo[idx],
+                                                    static_cast<NeoBusChannel>(idx));
+        }
+
+        if (nullptr == m_segments[idx])
+        {
+            isSuccessful = false;
+        }
+        else if (false == m_tiledMatrix.addSegment(*m_segments[idx], tile))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    if (true == isSuccessful)
+    {
+        isSuccessful = m_tiledMatrix.begin();
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+Display::Display() :
+    IDisplay(),
+    m_ledMatrix(),
+    m_tiledMatrix(m_ledMatrix),
+    m_segments(),
+    m_isOn(true),
+    m_powerLimiter(
+        Board::LedMatrix::supplyCurrentMax,
+        Board::LedMatrix::width * Board::LedMatrix::height,
+        Board::LedMatrix::maxCurrentPerLed / 3U,
+        Board::LedMatrix::idleCurrentPerLed),
+    m_colorPipeline()
+{
+    m_colorPipeline.setCalibration(
+        Board::LedMatrix::gamma,
+        Board::LedMatrix::whiteBalanceRed,
+        Board::LedMatrix::whiteBalanceGreen,
+        Board::LedMatrix::whiteBalanceBlue);
+
+    m_tiledMatrix.setPowerLimiter(&m_powerLimiter);
+    m_tiledMatrix.setColorPipeline(&m_colorPipeline);
+
+#if CONFIG_DISPLAY_ROTATE180 != 0
+    m_tiledMatrix.setRotate180(true);
+#endif
+}
+
+Display::~Display()
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < Board::LedMatrix::segmentCount; ++idx)
+    {
+        if (nullptr != m_segments[idx])
+        {
+            delete m_segments[idx];
+            m_segments[idx] = nullptr;
+        }
+    }
+}
+
+void Display::show()
+{
+    if (true == m_isOn)
+    {
+        /* First all segments are written, afterwards they are clocked out in parallel. */
+        m_tiledMatrix.write();
+        m_tiledMatrix.show();
+    }
+}
+
+void Display::off()
+{
+    m_isOn = false;
+
+    /* Simulate powered off display. */
+    m_tiledMatrix.clear();
+    m_tiledMatrix.show();
+
+    /* Only the idle current is left. */
+    m_powerLimiter.beginFrame();
+    m_powerLimiter.endFrame();
+}
+
+void Display::on()
+{
+    m_isOn = true;
+}
+
+bool Display::isOn() const
+{
+    return m_isOn;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,178 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  NeoPixel LED segment
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup hal
+ *
+ * @{
+ */
+
+#ifndef NEO_PIXEL_SEGMENT_H
+#define NEO_PIXEL_SEGMENT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <ILedSegment.hpp>
+#include <NeoPixelBusLg.h>
+#include <ColorDef.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A LED segment of NeoPixels (WS2812B), driven by its own RMT channel.
+ * Every RMT channel transfers independent of the others, therefore all
+ * segments are clocked out in parallel.
+ */
+class NeoPixelSegment : public ILedSegment
+{
+public:
+
+    /**
+     * Constructs the LED segment.
+     *
+     * @param[in] length    Number of LEDs
+     * @param[in] pinNo     Data output pin number
+     * @param[in] channel   RMT channel, which shall be used exclusive.
+     */
+    NeoPixelSegment(uint16_t length, uint8_t pinNo, NeoBusChannel channel) :
+        ILedSegment(),
+        m_strip(length, pinNo, channel)
+    {
+    }
+
+    /**
+     * Destroys the LED segment.
+     */
+    ~NeoPixelSegment()
+    {
+    }
+
+    /**
+     * Initialize the LED segment.
+     *
+     * @return If successful, returns true otherwise false.
+     */
+    bool begin() final
+    {
+        m_strip.Begin();
+        m_strip.Show();
+
+        return true;
+    }
+
+    /**
+     * Get number of LEDs in the segment.
+     *
+     * @return Number of LEDs
+     */
+    uint16_t getLength() const final
+    {
+        return m_strip.PixelCount();
+    }
+
+    /**
+     * Set color of a single LED.
+     *
+     * @param[in] index Index of the LED in the segment
+     * @param[in] color Color in RGB888 format
+     */
+    void setPixel(uint16_t index, const Color& color) final
+    {
+        HtmlColor htmlColor = static_cast<uint32_t>(color);
+
+        m_strip.SetPixelColor(index, htmlColor);
+    }
+
+    /**
+     * Set all LEDs to black.
+     */
+    void clear() final
+    {
+        m_strip.ClearTo(ColorDef::BLACK);
+    }
+
+    /**
+     * Start clocking out the LED colors, without waiting for the end.
+     */
+    void show() final
+    {
+        m_strip.Show();
+    }
+
+    /**
+     * The segment is ready, when the last transfer is finished.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    bool isReady() const final
+    {
+        return m_strip.CanShow();
+    }
+
+    /**
+     * Set luminance of all LEDs in the segment.
+     *
+     * @param[in] luminance Luminance [0; 255]
+     */
+    void setLuminance(uint8_t luminance) final
+    {
+        m_strip.SetLuminance(luminance);
+    }
+
+private:
+
+    /**
+     * Pixel representation of the LED segment. Gamma correction disabled.
+     */
+    NeoPixelBusLg<NeoGrbFeature, NeoEsp32RmtNWs2812xMethod, NeoGammaNullMethod> m_strip;
+
+    NeoPixelSegment();
+    NeoPixelSegment(const NeoPixelSegment& segment);
+    NeoPixelSegment& operator=(const NeoPixelSegment& segment);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* NEO_PIXEL_SEGMENT_H */
+
+/** @} */
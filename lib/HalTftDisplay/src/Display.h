@@ -192,6 +192,17 @@ public:
      */
     bool isOn() const final;
 
+    /**
+     * Get the estimated current, which the display draws.
+     * The TFT display doesn't estimate it.
+     *
+     * @return Current in mA
+     */
+    uint32_t getCurrent() const final
+    {
+        return 0U;
+    }
+
 private:
 
     /* The below TFT_* definitions are set in platform.ini build_flags */
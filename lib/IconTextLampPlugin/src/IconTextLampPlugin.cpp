@@ -406,6 +406,9 @@ void IconTextLampPlugin::start(uint16_t width, uint16_t height)
         m_spriteSheetPath   = spriteSheetFullPath;
     }
 
+    /* The plugin starts inactive, therefore the icon is not needed yet. */
+    m_bitmapWidget.giveBack();
+
     /* The text canvas is left aligned to the icon canvas and aligned to the
      * top. Consider that below the text canvas the lamps are shown.
      */
@@ -464,6 +467,35 @@ void IconTextLampPlugin::stop()
     }
 }
 
+void IconTextLampPlugin::process(bool isConnected)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(isConnected);
+
+    m_bitmapWidget.process();
+}
+
+void IconTextLampPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    m_bitmapWidget.borrow();
+
+    /* The framebuffer may contain the content of another plugin. */
+    m_isFullRepaintRequired = true;
+}
+
+void IconTextLampPlugin::inactive()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* The icon is not needed until the plugin gets active again. */
+    m_bitmapWidget.giveBack();
+}
+
 void IconTextLampPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -474,6 +506,25 @@ void IconTextLampPlugin::update(YAGfx& gfx)
     m_lampCanvas.update(gfx);
 }
 
+void IconTextLampPlugin::updateDamaged(YAGfx& gfx, YAGfxDamage& damage)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if (true == m_isFullRepaintRequired)
+    {
+        update(gfx);
+        damage.add(0, 0, gfx.getWidth(), gfx.getHeight());
+
+        m_isFullRepaintRequired = false;
+    }
+    else
+    {
+        m_iconCanvas.repaintDamaged(gfx, ColorDef::BLACK, damage);
+        m_textCanvas.repaintDamaged(gfx, ColorDef::BLACK, damage);
+        m_lampCanvas.repaintDamaged(gfx, ColorDef::BLACK, damage);
+    }
+}
+
 String IconTextLampPlugin::getText() const
 {
     String                      formattedText;
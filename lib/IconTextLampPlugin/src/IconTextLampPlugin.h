@@ -89,7 +89,8 @@ public:
         m_mutex(),
         m_hasTopicTextChanged(false),
         m_hasTopicLampsChanged(false),
-        m_hasTopicLampChanged{false, false, false, false}
+        m_hasTopicLampChanged{false, false, false, false},
+        m_isFullRepaintRequired(true)
     {
         (void)m_mutex.create();
     }
@@ -209,6 +210,39 @@ public:
      */
     void stop() final;
 
+    /**
+     * Process the plugin.
+     * It prefetches the next frame of an animated icon.
+     * 
+     * @param[in] isConnected   The network connection status. If network
+     *                          connection is established, it will be true otherwise false.
+     */
+    void process(bool isConnected) final;
+
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return BitmapWidget::PROCESS_PERIOD;
+    }
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
+    /**
+     * This method will be called in case the plugin is set inactive, which means
+     * it won't be shown on the display anymore.
+     */
+    void inactive() final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -217,6 +251,17 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Update the display and report the changed regions.
+     * After activation the framebuffer may contain the content of another
+     * plugin, therefore the first update repaints the whole display. After
+     * that only the damaged regions of the canvases are repainted.
+     *
+     * @param[in]       gfx     Display graphics interface
+     * @param[in,out]   damage  Regions of the display, which were changed.
+     */
+    void updateDamaged(YAGfx& gfx, YAGfxDamage& damage) final;
+
     /**
      * Get text.
      * 
@@ -356,6 +401,7 @@ private:
     bool                    m_hasTopicTextChanged;              /**< Has the topic text content changed? */
     bool                    m_hasTopicLampsChanged;             /**< Has the topic lamps content changed? */
     bool                    m_hasTopicLampChanged[MAX_LAMPS];   /**< Has the topic lamp content changed? */
+    bool                    m_isFullRepaintRequired;            /**< Shall the whole display be repainted with the next update? */
 
     /**
      * Get filename with path.
@@ -37,6 +37,7 @@
 
 #include <Logging.h>
 #include <ArduinoJson.h>
+#include <Util.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -341,6 +342,15 @@ void IconTextPlugin::stop()
     }
 }
 
+void IconTextPlugin::process(bool isConnected)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(isConnected);
+
+    m_bitmapWidget.process();
+}
+
 void IconTextPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -237,6 +237,25 @@ public:
      */
     void stop() final;
 
+    /**
+     * Process the plugin.
+     * It prefetches the next frame of an animated icon.
+     * 
+     * @param[in] isConnected   The network connection status. If network
+     *                          connection is established, it will be true otherwise false.
+     */
+    void process(bool isConnected) final;
+
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return BitmapWidget::PROCESS_PERIOD;
+    }
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -0,0 +1,366 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pool of pre-allocated JSON documents
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "JsonDocPool.h"
+#include <Logging.h>
+#include <AllocTracker.h>
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static size_t getHeapUsage(const DynamicJsonDocument& doc);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize static members */
+const size_t JsonDocPool::DOC_SIZES[JsonDocPool::POOL_SIZE] =
+{
+    1024U,
+    1024U,
+    2048U,
+    4096U
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool JsonDocPool::begin()
+{
+    bool    isSuccessful    = true;
+    uint8_t idx             = 0U;
+
+    if (false == m_mutex.create())
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        while((POOL_SIZE > idx) && (true == isSuccessful))
+        {
+            if (nullptr == m_docs[idx])
+            {
+                m_docs[idx] = new(std::nothrow) DynamicJsonDocument(DOC_SIZES[idx]);
+
+                if (nullptr == m_docs[idx])
+                {
+                    isSuccessful = false;
+                }
+                /* Document memory pool allocation failed? */
+                else if (0U == m_docs[idx]->capacity())
+                {
+                    delete m_docs[idx];
+                    m_docs[idx] = nullptr;
+
+                    isSuccessful = false;
+                }
+                else
+                {
+                    m_isLeased[idx] = false;
+
+                    AllocTracker::getInstance().notifyAllocation(AllocTracker::TAG_JSON, getHeapUsage(*m_docs[idx]));
+                }
+
+                if (false == isSuccessful)
+                {
+                    AllocTracker::getInstance().notifyFailure(AllocTracker::TAG_JSON);
+                }
+            }
+
+            ++idx;
+        }
+    }
+
+    if (false == isSuccessful)
+    {
+        LOG_ERROR("JSON document pool incomplete.");
+    }
+
+    return isSuccessful;
+}
+
+void JsonDocPool::end()
+{
+    uint8_t idx = 0U;
+
+    if (true == m_mutex.isAllocated())
+    {
+        {
+            MutexGuard<Mutex> guard(m_mutex);
+
+            for(idx = 0U; idx < POOL_SIZE; ++idx)
+            {
+                if ((nullptr != m_docs[idx]) &&
+                    (false == m_isLeased[idx]))
+                {
+                    AllocTracker::getInstance().notifyRelease(AllocTracker::TAG_JSON, getHeapUsage(*m_docs[idx]));
+                    delete m_docs[idx];
+                    m_docs[idx] = nullptr;
+                }
+            }
+        }
+
+        m_mutex.destroy();
+    }
+}
+
+DynamicJsonDocument* JsonDocPool::acquire(const char* site, size_t size, bool& isPooled)
+{
+    DynamicJsonDocument* doc = nullptr;
+
+    isPooled = false;
+
+    if (true == m_mutex.isAllocated())
+    {
+        MutexGuard<Mutex>   guard(m_mutex);
+        SiteStatistics*     siteStats   = getSite(site);
+        uint8_t             idx         = 0U;
+
+        /* The document sizes are sorted ascending, so the first free one
+         * which is big enough, fits best.
+         */
+        while((POOL_SIZE > idx) && (nullptr == doc))
+        {
+            if ((nullptr != m_docs[idx]) &&
+                (false == m_isLeased[idx]) &&
+                (size <= DOC_SIZES[idx]))
+            {
+                doc             = m_docs[idx];
+                m_isLeased[idx] = true;
+                isPooled        = true;
+
+                ++m_leasedCount;
+
+                if (m_leasedMax < m_leasedCount)
+                {
+                    m_leasedMax = m_leasedCount;
+                }
+            }
+            else
+            {
+                ++idx;
+            }
+        }
+
+        if (nullptr != siteStats)
+        {
+            ++siteStats->leases;
+
+            if (nullptr == doc)
+            {
+                ++siteStats->fallbacks;
+            }
+        }
+    }
+
+    /* Pool exhausted or not available, use the heap as fallback. */
+    if (nullptr == doc)
+    {
+        doc = new(std::nothrow) DynamicJsonDocument(size);
+
+        if (nullptr != doc)
+        {
+            /* Document memory pool allocation failed? */
+            if (0U == doc->capacity())
+            {
+                delete doc;
+                doc = nullptr;
+            }
+        }
+
+        if (nullptr == doc)
+        {
+            AllocTracker::getInstance().notifyFailure(AllocTracker::TAG_JSON);
+            LOG_WARNING("No JSON document for %s available.", (nullptr != site) ? site : "?");
+        }
+        else
+        {
+            AllocTracker::getInstance().notifyAllocation(AllocTracker::TAG_JSON, getHeapUsage(*doc));
+        }
+    }
+
+    if (nullptr != doc)
+    {
+        doc->clear();
+    }
+
+    return doc;
+}
+
+void JsonDocPool::release(const char* site, DynamicJsonDocument* doc, bool isPooled)
+{
+    if (nullptr != doc)
+    {
+        size_t memoryUsage = doc->memoryUsage();
+
+        if (true == m_mutex.isAllocated())
+        {
+            MutexGuard<Mutex>   guard(m_mutex);
+            SiteStatistics*     siteStats   = getSite(site);
+
+            if (nullptr != siteStats)
+            {
+                if (siteStats->highWaterMark < memoryUsage)
+                {
+                    siteStats->highWaterMark = memoryUsage;
+                }
+            }
+
+            if (true == isPooled)
+            {
+                uint8_t idx = 0U;
+
+                while(POOL_SIZE > idx)
+                {
+                    if (doc == m_docs[idx])
+                    {
+                        /* Release the document memory pool content early. */
+                        doc->clear();
+
+                        m_isLeased[idx] = false;
+                        --m_leasedCount;
+                        break;
+                    }
+
+                    ++idx;
+                }
+            }
+        }
+
+        if (false == isPooled)
+        {
+            AllocTracker::getInstance().notifyRelease(AllocTracker::TAG_JSON, getHeapUsage(*doc));
+            delete doc;
+        }
+    }
+}
+
+bool JsonDocPool::getSiteStatistics(uint8_t idx, SiteStatistics& stats)
+{
+    bool isSuccessful = false;
+
+    if (true == m_mutex.isAllocated())
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        if (m_siteCount > idx)
+        {
+            stats           = m_sites[idx];
+            isSuccessful    = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+JsonDocPool::SiteStatistics* JsonDocPool::getSite(const char* site)
+{
+    SiteStatistics* siteStats   = nullptr;
+    uint8_t         idx         = 0U;
+
+    if (nullptr != site)
+    {
+        while((m_siteCount > idx) && (nullptr == siteStats))
+        {
+            /* Sites are string literals, therefore compare the pointer first. */
+            if ((site == m_sites[idx].name) ||
+                (0 == strcmp(site, m_sites[idx].name)))
+            {
+                siteStats = &m_sites[idx];
+            }
+            else
+            {
+                ++idx;
+            }
+        }
+
+        if ((nullptr == siteStats) &&
+            (MAX_SITES > m_siteCount))
+        {
+            siteStats       = &m_sites[m_siteCount];
+            siteStats->name = site;
+
+            ++m_siteCount;
+        }
+    }
+
+    return siteStats;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get the heap memory, which is used by a JSON document.
+ *
+ * @param[in] doc   JSON document
+ *
+ * @return Used heap memory in byte
+ */
+static size_t getHeapUsage(const DynamicJsonDocument& doc)
+{
+    return sizeof(DynamicJsonDocument) + doc.capacity();
+}
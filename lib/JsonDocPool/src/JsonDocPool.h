@@ -0,0 +1,333 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pool of pre-allocated JSON documents
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef JSON_DOC_POOL_H
+#define JSON_DOC_POOL_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include <Mutex.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The JSON document pool holds a small number of JSON documents, which are
+ * allocated once at startup. Instead of allocating and releasing a several
+ * kilobyte big document on every request, the users lease a document from
+ * the pool and give it back afterwards. This avoids heap fragmentation over
+ * a long uptime.
+ *
+ * If the pool is exhausted or not started yet, the document is allocated on
+ * the heap as fallback. Every fallback is counted.
+ *
+ * Use the JsonDocLease to lease a document.
+ */
+class JsonDocPool
+{
+public:
+
+    /**
+     * Statistics per lease site.
+     */
+    struct SiteStatistics
+    {
+        const char* name;           /**< Name of the site */
+        size_t      highWaterMark;  /**< Max. used document memory in byte */
+        uint32_t    leases;         /**< Number of leases */
+        uint32_t    fallbacks;      /**< Number of leases, which were served by the heap */
+
+        /**
+         * Initializes empty site statistics.
+         */
+        SiteStatistics() :
+            name(nullptr),
+            highWaterMark(0U),
+            leases(0U),
+            fallbacks(0U)
+        {
+        }
+    };
+
+    /**
+     * Get JSON document pool instance.
+     *
+     * @return JSON document pool instance
+     */
+    static JsonDocPool& getInstance()
+    {
+        static JsonDocPool instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Allocate all pooled JSON documents.
+     * Call this once as early as possible to get the documents in a not
+     * fragmented heap.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool begin();
+
+    /**
+     * Release all pooled JSON documents.
+     * All leases must be returned before!
+     */
+    void end();
+
+    /**
+     * Acquire a JSON document with at least the requested capacity.
+     * If no pooled document is available, it will be allocated on the heap.
+     * The document is empty.
+     *
+     * @param[in]   site        Name of the lease site, used for statistics.
+     * @param[in]   size        Requested document capacity in byte.
+     * @param[out]  isPooled    Shows whether the document is from the pool or from the heap.
+     *
+     * @return If successful, it will return the JSON document otherwise nullptr.
+     */
+    DynamicJsonDocument* acquire(const char* site, size_t size, bool& isPooled);
+
+    /**
+     * Release a JSON document, which was acquired before.
+     *
+     * @param[in] site      Name of the lease site, used for statistics.
+     * @param[in] doc       The JSON document.
+     * @param[in] isPooled  Whether the document is from the pool or from the heap.
+     */
+    void release(const char* site, DynamicJsonDocument* doc, bool isPooled);
+
+    /**
+     * Get number of known lease sites.
+     *
+     * @return Number of lease sites
+     */
+    uint8_t getSiteCount() const
+    {
+        return m_siteCount;
+    }
+
+    /**
+     * Get statistics of a lease site.
+     *
+     * @param[in]   idx     Site index [0; getSiteCount() - 1]
+     * @param[out]  stats   Site statistics
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool getSiteStatistics(uint8_t idx, SiteStatistics& stats);
+
+    /**
+     * Get number of pooled documents, which are currently leased.
+     *
+     * @return Number of leased documents
+     */
+    uint8_t getLeasedCount() const
+    {
+        return m_leasedCount;
+    }
+
+    /**
+     * Get max. number of pooled documents, which were leased at the same time.
+     *
+     * @return Max. number of concurrently leased documents
+     */
+    uint8_t getLeasedMax() const
+    {
+        return m_leasedMax;
+    }
+
+    /**
+     * Number of pooled documents.
+     */
+    static const uint8_t    POOL_SIZE   = 4U;
+
+    /**
+     * Capacity in byte per pooled document. Sorted in ascending order, to find
+     * the best fit by a linear search.
+     */
+    static const size_t     DOC_SIZES[POOL_SIZE];
+
+    /**
+     * Max. number of lease sites, which can be tracked.
+     */
+    static const uint8_t    MAX_SITES   = 24U;
+
+private:
+
+    Mutex                   m_mutex;                /**< Protects the pool against concurrent access. */
+    DynamicJsonDocument*    m_docs[POOL_SIZE];      /**< Pooled JSON documents */
+    bool                    m_isLeased[POOL_SIZE];  /**< Lease state per pooled document */
+    uint8_t                 m_leasedCount;          /**< Number of currently leased documents */
+    uint8_t                 m_leasedMax;            /**< Max. number of concurrently leased documents */
+    SiteStatistics          m_sites[MAX_SITES];     /**< Statistics per lease site */
+    uint8_t                 m_siteCount;            /**< Number of known lease sites */
+
+    /**
+     * Constructs the JSON document pool.
+     */
+    JsonDocPool() :
+        m_mutex(),
+        m_docs(),
+        m_isLeased(),
+        m_leasedCount(0U),
+        m_leasedMax(0U),
+        m_sites(),
+        m_siteCount(0U)
+    {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < POOL_SIZE; ++idx)
+        {
+            m_docs[idx]     = nullptr;
+            m_isLeased[idx] = false;
+        }
+    }
+
+    /**
+     * Destroys the JSON document pool.
+     */
+    ~JsonDocPool()
+    {
+        /* Will never be called. */
+    }
+
+    JsonDocPool(const JsonDocPool& pool);
+    JsonDocPool& operator=(const JsonDocPool& pool);
+
+    /**
+     * Get statistics of a lease site. If the site is unknown, it will be
+     * added. The mutex must be taken!
+     *
+     * @param[in] site  Name of the lease site.
+     *
+     * @return If available, it will return the site statistics otherwise nullptr.
+     */
+    SiteStatistics* getSite(const char* site);
+};
+
+/**
+ * A scoped JSON document lease. It acquires a JSON document from the pool at
+ * construction and gives it back at destruction.
+ *
+ * Always check with isValid() whether a document is available, before using it.
+ */
+class JsonDocLease
+{
+public:
+
+    /**
+     * Lease a JSON document.
+     *
+     * @param[in] site  Name of the lease site, used for statistics. Must be a string literal.
+     * @param[in] size  Requested document capacity in byte.
+     */
+    JsonDocLease(const char* site, size_t size) :
+        m_site(site),
+        m_doc(nullptr),
+        m_isPooled(false)
+    {
+        m_doc = JsonDocPool::getInstance().acquire(m_site, size, m_isPooled);
+    }
+
+    /**
+     * Give the JSON document back.
+     */
+    ~JsonDocLease()
+    {
+        JsonDocPool::getInstance().release(m_site, m_doc, m_isPooled);
+    }
+
+    /**
+     * Is a JSON document available?
+     *
+     * @return If available, it will return true otherwise false.
+     */
+    bool isValid() const
+    {
+        return (nullptr != m_doc);
+    }
+
+    /**
+     * Get the leased JSON document.
+     *
+     * @return JSON document
+     */
+    DynamicJsonDocument& operator*()
+    {
+        return *m_doc;
+    }
+
+    /**
+     * Access the leased JSON document.
+     *
+     * @return JSON document
+     */
+    DynamicJsonDocument* operator->()
+    {
+        return m_doc;
+    }
+
+private:
+
+    const char*             m_site;     /**< Name of the lease site */
+    DynamicJsonDocument*    m_doc;      /**< Leased JSON document */
+    bool                    m_isPooled; /**< Is document from pool or heap? */
+
+    JsonDocLease();
+    JsonDocLease(const JsonDocLease& lease);
+    JsonDocLease& operator=(const JsonDocLease& lease);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* JSON_DOC_POOL_H */
+
+/** @} */
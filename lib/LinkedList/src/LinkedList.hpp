@@ -177,13 +177,52 @@ private:
 
 };
 
+/**
+ * Default allocator of the list elements, which allocates every list element
+ * on the heap.
+ *
+ * A different allocator, e.g. one which takes the list elements from an
+ * ObjectPool, shall provide the same static methods.
+ *
+ * @param[in] T Type of element
+ */
 template < typename T >
+class ListHeapAllocator
+{
+public:
+
+    /**
+     * Create a list element.
+     *
+     * @param[in] element   Element
+     * @param[in] prev      Previous list element
+     * @param[in] next      Next list element
+     *
+     * @return If successful, it will return the list element otherwise nullptr.
+     */
+    static ListElement<T>* create(T& element, ListElement<T>* prev, ListElement<T>* next)
+    {
+        return new(std::nothrow) ListElement<T>(element, prev, next);
+    }
+
+    /**
+     * Destroy a list element.
+     *
+     * @param[in] listElement   List element
+     */
+    static void destroy(ListElement<T>* listElement)
+    {
+        delete listElement;
+    }
+};
+
+template < typename T, typename TAllocator = ListHeapAllocator<T> >
 class DLinkedList;
 
 /**
  * Doubly linked list iterator.
  */
-template < typename T >
+template < typename T, typename TAllocator = ListHeapAllocator<T> >
 class DLinkedListIterator
 {
 public:
@@ -193,7 +232,7 @@ public:
      *
      * @param[in] list  Doubly linked list
      */
-    DLinkedListIterator(DLinkedList<T>& list) :
+    DLinkedListIterator(DLinkedList<T, TAllocator>& list) :
         m_list(list),
         m_curr(list.m_head)
     {
@@ -387,7 +426,7 @@ public:
 
 private:
 
-    DLinkedList<T>& m_list;     /**< Doubly linked list */
+    DLinkedList<T, TAllocator>& m_list; /**< Doubly linked list */
     ListElement<T>* m_curr;     /**< Current selected list element */
 
     DLinkedListIterator();
@@ -396,7 +435,7 @@ private:
 /**
  * Doubly linked list const iterator.
  */
-template < typename T >
+template < typename T, typename TAllocator = ListHeapAllocator<T> >
 class DLinkedListConstIterator
 {
 public:
@@ -406,7 +445,7 @@ public:
      *
      * @param[in] list  Doubly linked list
      */
-    DLinkedListConstIterator(const DLinkedList<T>& list) :
+    DLinkedListConstIterator(const DLinkedList<T, TAllocator>& list) :
         m_list(list),
         m_curr(list.m_head)
     {
@@ -582,8 +621,8 @@ public:
 
 private:
 
-    const DLinkedList<T>&   m_list; /**< Doubly linked list */
-    const ListElement<T>*   m_curr; /**< Current selected list element */
+    const DLinkedList<T, TAllocator>&   m_list; /**< Doubly linked list */
+    const ListElement<T>*               m_curr; /**< Current selected list element */
 
     DLinkedListConstIterator();
 };
@@ -591,9 +630,10 @@ private:
 /**
  * Doubly linked list.
  *
- * @param[in] T Type of element
+ * @param[in] T             Type of element
+ * @param[in] TAllocator    Allocator of the list elements
  */
-template < typename T >
+template < typename T, typename TAllocator >
 class DLinkedList
 {
 public:
@@ -671,7 +711,7 @@ public:
 
         if (UINT32_MAX > m_count)
         {
-            ListElement<T>* listElement = new(std::nothrow) ListElement<T>(element, m_tail, nullptr);
+            ListElement<T>* listElement = TAllocator::create(element, m_tail, nullptr);
 
             if (nullptr != listElement)
             {
@@ -708,13 +748,13 @@ public:
             /* Last element in the list? */
             if (nullptr == curr->getNext())
             {
-                delete curr;
+                TAllocator::destroy(curr);
                 curr = nullptr;
             }
             else
             {
                 curr = curr->getNext();
-                delete curr->getPrev();
+                TAllocator::destroy(curr->getPrev());
                 curr->setPrev(nullptr);
             }
         }
@@ -755,7 +795,7 @@ private:
                 /* Last element in the list */
                 if (nullptr == listElement->getNext())
                 {
-                    delete listElement;
+                    TAllocator::destroy(listElement);
                     m_head = nullptr;
                     m_tail = nullptr;
                     listElement = nullptr;
@@ -765,7 +805,7 @@ private:
                 {
                     m_head = listElement->getNext();
                     m_head->setPrev(nullptr);
-                    delete listElement;
+                    TAllocator::destroy(listElement);
                     listElement = m_head;
                 }
             }
@@ -775,7 +815,7 @@ private:
                 /* Here it is sure, that the list contains more than 1 element. */
                 m_tail = listElement->getPrev();
                 m_tail->setNext(nullptr);
-                delete listElement;
+                TAllocator::destroy(listElement);
                 listElement = m_tail;
             }
             /* Somewhere between */
@@ -783,7 +823,7 @@ private:
             {
                 listElement->getPrev()->setNext(listElement->getNext());
                 listElement->getNext()->setPrev(listElement->getPrev());
-                delete listElement;
+                TAllocator::destroy(listElement);
             }
 
             if (0 < m_count)
@@ -793,10 +833,10 @@ private:
         }
     }
 
-    template < typename T0 >
+    template < typename T0, typename TAllocator0 >
     friend class DLinkedListIterator;
 
-    template < typename T1 >
+    template < typename T1, typename TAllocator1 >
     friend class DLinkedListConstIterator;
 };
 
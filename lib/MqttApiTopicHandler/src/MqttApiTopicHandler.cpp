@@ -37,6 +37,7 @@
 
 #include <Logging.h>
 #include <MqttService.h>
+#include <JsonDocPool.h>
 #include <mbedtls/base64.h>
 
 /******************************************************************************
@@ -336,90 +337,99 @@ void MqttApiTopicHandler::publishTopicStatesOnDemand()
 
 void MqttApiTopicHandler::write(const String& deviceId, const String& entityId, const String& topic, const uint8_t* payload, size_t size, SetTopicFunc setTopicFunc, UploadReqFunc uploadReqFunc)
 {
-    const size_t            JSON_DOC_SIZE   = 1024U;
-    DynamicJsonDocument     jsonDoc(JSON_DOC_SIZE);
-    DeserializationError    error           = deserializeJson(jsonDoc, payload, size);
+    const size_t    JSON_DOC_SIZE   = 1024U;
+    JsonDocLease    jsonDocLease("MqttApiTopicHandler::write", JSON_DOC_SIZE);
 
-    if (DeserializationError::Ok != error)
+    if (false == jsonDocLease.isValid())
     {
-        LOG_WARNING("Received invalid payload.");
+        LOG_WARNING("Payload for %s dropped, no JSON document available.", entityId.c_str());
     }
     else
     {
-        JsonVariantConst    jsonFileName   = jsonDoc["fileName"];
-        JsonVariantConst    jsonFileBase64 = jsonDoc["file"];
+        DynamicJsonDocument&    jsonDoc = *jsonDocLease;
+        DeserializationError    error   = deserializeJson(jsonDoc, payload, size);
 
-        /* File transfer? */
-        if ((true == jsonFileName.is<String>()) &&
-            (true == jsonFileBase64.is<String>()))
+        if (DeserializationError::Ok != error)
         {
-            String dstFullPath;
+            LOG_WARNING("Received invalid payload.");
+        }
+        else
+        {
+            JsonVariantConst    jsonFileName   = jsonDoc["fileName"];
+            JsonVariantConst    jsonFileBase64 = jsonDoc["file"];
 
-            /* Ask plugin, whether the upload is allowed or not. */
-            if ((nullptr == uploadReqFunc) ||
-                (false == uploadReqFunc(topic, jsonFileName.as<String>(), dstFullPath)))
-            {
-                LOG_WARNING("Upload not supported  by %s.", entityId.c_str());
-            }
-            else
+            /* File transfer? */
+            if ((true == jsonFileName.is<String>()) &&
+                (true == jsonFileBase64.is<String>()))
             {
-                String  fileBase64  = jsonFileBase64.as<String>();
-                size_t  fileSize    = 0U;
-                int32_t decodeRet   = mbedtls_base64_decode(nullptr, 0U, &fileSize, reinterpret_cast<const unsigned char*>(fileBase64.c_str()), fileBase64.length());
+                String dstFullPath;
 
-                if (MBEDTLS_ERR_BASE64_INVALID_CHARACTER == decodeRet)
-                {
-                    LOG_WARNING("File encoding contains invalid character.");
-                }
-                else if ((MAX_FILE_SIZE < fileSize) ||
-                         (0U == fileSize))
+                /* Ask plugin, whether the upload is allowed or not. */
+                if ((nullptr == uploadReqFunc) ||
+                    (false == uploadReqFunc(topic, jsonFileName.as<String>(), dstFullPath)))
                 {
-                    LOG_WARNING("File size %u not supported.", fileSize);
+                    LOG_WARNING("Upload not supported  by %s.", entityId.c_str());
                 }
                 else
                 {
-                    uint8_t* buffer = new(std::nothrow) uint8_t[fileSize];
+                    String  fileBase64  = jsonFileBase64.as<String>();
+                    size_t  fileSize    = 0U;
+                    int32_t decodeRet   = mbedtls_base64_decode(nullptr, 0U, &fileSize, reinterpret_cast<const unsigned char*>(fileBase64.c_str()), fileBase64.length());
 
-                    if (nullptr != buffer)
+                    if (MBEDTLS_ERR_BASE64_INVALID_CHARACTER == decodeRet)
                     {
-                        File fd;
-
-                        decodeRet = mbedtls_base64_decode(buffer, fileSize, &fileSize, reinterpret_cast<const unsigned char*>(fileBase64.c_str()), fileBase64.length());
+                        LOG_WARNING("File encoding contains invalid character.");
+                    }
+                    else if ((MAX_FILE_SIZE < fileSize) ||
+                             (0U == fileSize))
+                    {
+                        LOG_WARNING("File size %u not supported.", fileSize);
+                    }
+                    else
+                    {
+                        uint8_t* buffer = new(std::nothrow) uint8_t[fileSize];
 
-                        if (0U != decodeRet)
+                        if (nullptr != buffer)
                         {
-                            LOG_WARNING("File decode error: %d", decodeRet);
-                        }
-                        else
-                        {
-                            /* Create a new file and overwrite a existing one. */
-                            fd = FILESYSTEM.open(dstFullPath, "w");
+                            File fd;
+
+                            decodeRet = mbedtls_base64_decode(buffer, fileSize, &fileSize, reinterpret_cast<const unsigned char*>(fileBase64.c_str()), fileBase64.length());
 
-                            if (false == fd)
+                            if (0U != decodeRet)
                             {
-                                LOG_ERROR("Couldn't create file: %s", dstFullPath.c_str());
+                                LOG_WARNING("File decode error: %d", decodeRet);
                             }
                             else
                             {
-                                (void)fd.write(buffer, fileSize);
-                                fd.close();
-
-                                jsonDoc["fullPath"] = dstFullPath;
+                                /* Create a new file and overwrite a existing one. */
+                                fd = FILESYSTEM.open(dstFullPath, "w");
+
+                                if (false == fd)
+                                {
+                                    LOG_ERROR("Couldn't create file: %s", dstFullPath.c_str());
+                                }
+                                else
+                                {
+                                    (void)fd.write(buffer, fileSize);
+                                    fd.close();
+
+                                    jsonDoc["fullPath"] = dstFullPath;
+                                }
                             }
-                        }
 
-                        delete[] buffer;
+                            delete[] buffer;
+                        }
                     }
-                }
 
-                jsonDoc.remove("fileName");
-                jsonDoc.remove("file");
+                    jsonDoc.remove("fileName");
+                    jsonDoc.remove("file");
+                }
             }
-        }
 
-        if (false == setTopicFunc(topic, jsonDoc.as<JsonObjectConst>()))
-        {
-            LOG_WARNING("Payload rejected by %s.", entityId.c_str());
+            if (false == setTopicFunc(topic, jsonDoc.as<JsonObjectConst>()))
+            {
+                LOG_WARNING("Payload rejected by %s.", entityId.c_str());
+            }
         }
     }
 }
@@ -429,26 +439,35 @@ void MqttApiTopicHandler::publish(const String& deviceId, const String& entityId
     if (nullptr != getTopicFunc)
     {
         const size_t        JSON_DOC_SIZE       = 1024U;
-        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-        JsonObject          jsonObj             = jsonDoc.createNestedObject("data");
-        String              mqttTopicNameBase   = deviceId + "/" + entityId + topic;
+        JsonDocLease        jsonDocLease("MqttApiTopicHandler::publish", JSON_DOC_SIZE);
 
-        if (true == getTopicFunc(topic, jsonObj))
+        if (false == jsonDocLease.isValid())
+        {
+            LOG_WARNING("Publish of %s skipped, no JSON document available.", entityId.c_str());
+        }
+        else
         {
-            String topicContent;
+            DynamicJsonDocument&    jsonDoc             = *jsonDocLease;
+            JsonObject              jsonObj             = jsonDoc.createNestedObject("data");
+            String                  mqttTopicNameBase   = deviceId + "/" + entityId + topic;
 
-            if (0U < serializeJson(jsonDoc["data"], topicContent))
+            if (true == getTopicFunc(topic, jsonObj))
             {
-                MqttService&    mqttService     = MqttService::getInstance();
-                String          topicStateUri   = mqttTopicNameBase + MQTT_ENDPOINT_READ_ACCESS;
+                String topicContent;
 
-                if (false == mqttService.publish(topicStateUri, topicContent))
+                if (0U < serializeJson(jsonDoc["data"], topicContent))
                 {
-                    LOG_WARNING("Couldn't publish %s.", topicStateUri.c_str());
-                }
-                else
-                {
-                    LOG_INFO("Published: %s", topicStateUri.c_str());
+                    MqttService&    mqttService     = MqttService::getInstance();
+                    String          topicStateUri   = mqttTopicNameBase + MQTT_ENDPOINT_READ_ACCESS;
+
+                    if (false == mqttService.publish(topicStateUri, topicContent))
+                    {
+                        LOG_WARNING("Couldn't publish %s.", topicStateUri.c_str());
+                    }
+                    else
+                    {
+                        LOG_INFO("Published: %s", topicStateUri.c_str());
+                    }
                 }
             }
         }
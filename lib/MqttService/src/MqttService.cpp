@@ -36,6 +36,7 @@
 
 #include <Logging.h>
 #include <SettingsService.h>
+#include <Profiler.hpp>
 
 /******************************************************************************
  * Compiler Switches
@@ -195,7 +196,7 @@ bool MqttService::subscribe(const char* topic, TopicCallback callback)
 
         if (it == m_subscriberList.end())
         {
-            Subscriber* subscriber = new(std::nothrow) Subscriber;
+            Subscriber* subscriber = m_subscriberPool.create();
 
             if (nullptr != subscriber)
             {
@@ -222,7 +223,7 @@ bool MqttService::subscribe(const char* topic, TopicCallback callback)
 
                 if (false == isSuccessful)
                 {
-                    delete subscriber;
+                    m_subscriberPool.destroy(subscriber);
                     subscriber = nullptr;
                 }
             }
@@ -254,7 +255,7 @@ void MqttService::unsubscribe(const char* topic)
                     m_mqttClient.unsubscribe(subscriber->topic.c_str());
 
                     (void)m_subscriberList.erase(it);
-                    delete subscriber;
+                    m_subscriberPool.destroy(subscriber);
 
                     break;
                 }
@@ -366,9 +367,12 @@ void MqttService::rxCallback(char* topic, uint8_t* payload, uint32_t length)
         {
             if (0 == strcmp((*it)->topic.c_str(), topic))
             {
-                Subscriber* subscriber = *it;
+                Subscriber* subscriber  = *it;
+                uint32_t    timestamp   = micros();
 
                 subscriber->callback(topic, payload, length);
+
+                Profiler::getInstance().getMqttDispatch().record(micros() - timestamp);
                 break;
             }
         }
@@ -47,6 +47,9 @@
 #include <functional>
 #include <vector>
 #include <SimpleTimer.hpp>
+#include <AllocTracker.h>
+#include <ObjectPool.hpp>
+#include <CriticalSection.hpp>
 
 /******************************************************************************
  * Compiler Switches
@@ -177,7 +180,7 @@ private:
     /**
      * Subscriber information
      */
-    struct Subscriber
+    struct Subscriber : public AllocTracked<AllocTracker::TAG_MQTT>
     {
         String          topic;      /**< The subscriber topic */
         TopicCallback   callback;   /**< The subscriber callback */
@@ -217,6 +220,17 @@ private:
      */
     static const size_t     MAX_BUFFER_SIZE             = 2048U;
 
+    /**
+     * Number of pooled subscribers. If more are subscribed, they will be
+     * allocated on the heap.
+     */
+    static const size_t     SUBSCRIBER_POOL_SIZE        = 32U;
+
+    /**
+     * Pool of subscribers.
+     */
+    typedef ObjectPool<Subscriber, SUBSCRIBER_POOL_SIZE, CriticalSection> SubscriberPool;
+
     KeyValueString          m_mqttBrokerUrlSetting; /**< URL of the MQTT broker setting */
     String                  m_url;                  /**< URL of the MQTT broker */
     String                  m_user;                 /**< MQTT authentication: user name */
@@ -226,6 +240,7 @@ private:
     PubSubClient            m_mqttClient;           /**< MQTT client */
     State                   m_state;                /**< Connection state */
     SubscriberList          m_subscriberList;       /**< List of subscribers */
+    SubscriberPool          m_subscriberPool;       /**< Pool of subscribers */
     SimpleTimer             m_reconnectTimer;       /**< Timer used for periodically reconnecting. */
 
     /**
@@ -242,6 +257,7 @@ private:
         m_mqttClient(m_wifiClient),
         m_state(STATE_DISCONNECTED),
         m_subscriberList(),
+        m_subscriberPool("mqtt subscribers"),
         m_reconnectTimer()
     {
     }
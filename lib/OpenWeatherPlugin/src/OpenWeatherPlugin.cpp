@@ -253,6 +253,9 @@ void OpenWeatherPlugin::start(uint16_t width, uint16_t height)
 
     (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
 
+    /* The plugin starts inactive, therefore the icon is not needed yet. */
+    m_bitmapWidget.giveBack();
+
     /* The text canvas is left aligned to the icon canvas and it spans over
      * the whole display height.
      */
@@ -283,15 +286,6 @@ void OpenWeatherPlugin::start(uint16_t width, uint16_t height)
             LOG_WARNING("Failed to create initial configuration file %s.", getFullPathToConfiguration().c_str());
         }
     }
-    else
-    {
-        /* Remember current timestamp to detect updates of the configuration in the
-         * filesystem without using the plugin API.
-         */
-        updateTimestampLastUpdate();
-    }
-
-    m_cfgReloadTimer.start(CFG_RELOAD_PERIOD);
 
     initHttpClient();
 }
@@ -301,7 +295,6 @@ void OpenWeatherPlugin::stop()
     String                      configurationFilename = getFullPathToConfiguration();
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    m_cfgReloadTimer.stop();
     m_requestTimer.stop();
 
     if (false != FILESYSTEM.remove(configurationFilename))
@@ -316,15 +309,10 @@ void OpenWeatherPlugin::process(bool isConnected)
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
     /* Configuration in persistent memory updated? */
-    if ((true == m_cfgReloadTimer.isTimerRunning()) &&
-        (true == m_cfgReloadTimer.isTimeout()))
+    if (true == isConfigurationUpdated())
     {
-        if (true == isConfigurationUpdated())
-        {
-            m_reloadConfigReq = true;
-        }
-
-        m_cfgReloadTimer.restart();
+        m_reloadConfigReq = true;
+        clearConfigurationUpdated();
     }
 
     if (true == m_storeConfigReq)
@@ -340,10 +328,7 @@ void OpenWeatherPlugin::process(bool isConnected)
     {
         LOG_INFO("Reload configuration: %s", getFullPathToConfiguration().c_str());
 
-        if (true == loadConfiguration())
-        {
-            updateTimestampLastUpdate();
-        }
+        (void)loadConfiguration();
 
         m_reloadConfigReq = false;
     }
@@ -448,6 +433,10 @@ void OpenWeatherPlugin::active(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
+    PLUGIN_NOT_USED(gfx);
+
+    m_bitmapWidget.borrow();
+
     /* Force immediate weather update on activation.
      * By setting the duration counter to 0, start showing
      * the general weather information first.
@@ -466,6 +455,9 @@ void OpenWeatherPlugin::inactive()
     MutexGuard<MutexRecursive> guard(m_mutex);
 
     m_updateContentTimer.stop();
+
+    /* The icon is not needed until the plugin gets active again. */
+    m_bitmapWidget.giveBack();
 }
 
 void OpenWeatherPlugin::update(YAGfx& gfx)
@@ -124,7 +124,6 @@ public:
         m_slotInterf(nullptr),
         m_durationCounter(0u),
         m_isUpdateAvailable(false),
-        m_cfgReloadTimer(),
         m_storeConfigReq(false),
         m_reloadConfigReq(false),
         m_hasTopicChanged(false),
@@ -296,6 +295,16 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return PROCESS_PERIOD_DEFAULT;
+    }
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -462,13 +471,6 @@ private:
     /** Time for duration tick period in ms */
     static const uint32_t   DURATION_TICK_PERIOD    = SIMPLE_TIMER_SECONDS(1U);
 
-    /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
-     */
-    static const uint32_t   CFG_RELOAD_PERIOD   = SIMPLE_TIMER_SECONDS(30U);
-    
     Fonts::FontType             m_fontType;                     /**< Font type which shall be used if there is no conflict with the layout. */
     WidgetGroup                 m_textCanvas;                   /**< Canvas used for the text widget. */
     WidgetGroup                 m_iconCanvas;                   /**< Canvas used for the bitmap widget. */
@@ -493,7 +495,6 @@ private:
     const ISlotPlugin*          m_slotInterf;                   /**< Slot interface */
     uint8_t                     m_durationCounter;              /**< Variable to count the Plugin duration in DURATION_TICK_PERIOD ticks. */
     bool                        m_isUpdateAvailable;            /**< Flag to indicate an updated date value. */
-    SimpleTimer                 m_cfgReloadTimer;               /**< Timer is used to cyclic reload the configuration from persistent memory. */
     bool                        m_storeConfigReq;               /**< Is requested to store the configuration in persistent memory? */
     bool                        m_reloadConfigReq;              /**< Is requested to reload the configuration from persistent memory? */
     bool                        m_hasTopicChanged;              /**< Has the topic content changed? */
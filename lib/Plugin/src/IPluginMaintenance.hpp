@@ -45,6 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <YAGfx.h>
+#include <YAGfxDamage.h>
 #include <ArduinoJson.h>
 #include <Fonts.h>
 #include "ISlotPlugin.hpp"
@@ -257,6 +258,13 @@ public:
      */
     virtual void process(bool isConnected) = 0;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms. If 0, the plugin is not processed.
+     */
+    virtual uint32_t getProcessPeriod() const = 0;
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -282,6 +290,16 @@ public:
      */
     virtual void update(YAGfx& gfx) = 0;
 
+    /**
+     * Update the display and report the changed regions.
+     * It is called instead of update() by the display manager, which copies
+     * only the reported regions to the display.
+     *
+     * @param[in]       gfx     Display graphics interface
+     * @param[in,out]   damage  Regions of the display, which were changed.
+     */
+    virtual void updateDamaged(YAGfx& gfx, YAGfxDamage& damage) = 0;
+
 protected:
 
     /**
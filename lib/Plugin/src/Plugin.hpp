@@ -44,10 +44,13 @@
  * Includes
  *****************************************************************************/
 #include "IPluginMaintenance.hpp"
+#include "PluginConfigNotifier.h"
 
 #include <stdint.h>
 #include <YAGfx.h>
 #include <JsonFile.h>
+#include <JsonDocPool.h>
+#include <AllocTracker.h>
 #include <ArduinoJson.h>
 
 /******************************************************************************
@@ -63,8 +66,9 @@
 
 /**
  * A plugin can be plugged into a display slot and will shown.
+ * All plugin instances are tracked by the allocation tracker.
  */
-class Plugin : public IPluginMaintenance
+class Plugin : public IPluginMaintenance, public AllocTracked<AllocTracker::TAG_PLUGIN>
 {
 public:
 
@@ -320,6 +324,18 @@ public:
         PLUGIN_NOT_USED(isConnected);
     }
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * Overwrite it together with process(), otherwise the plugin is not
+     * processed at all.
+     * 
+     * @return Process period in ms. If 0, the plugin is not processed.
+     */
+    uint32_t getProcessPeriod() const override
+    {
+        return 0U;
+    }
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -341,8 +357,26 @@ public:
     {
     }
 
+    /**
+     * Update the display and report the changed regions.
+     * By default the whole display is updated and reported as changed.
+     * Overwrite it if your plugin knows which regions changed, e.g. by using
+     * WidgetGroup::repaintDamaged().
+     *
+     * @param[in]       gfx     Display graphics interface
+     * @param[in,out]   damage  Regions of the display, which were changed.
+     */
+    void updateDamaged(YAGfx& gfx, YAGfxDamage& damage) override
+    {
+        update(gfx);
+        damage.add(0, 0, gfx.getWidth(), gfx.getHeight());
+    }
+
 protected:
 
+    /** Default period in ms, how often a plugin is processed. */
+    static const uint32_t   PROCESS_PERIOD_DEFAULT = 100U;
+
     bool    m_isEnabled;    /**< Plugin is enabled or disabled */
 
     /**
@@ -353,6 +387,8 @@ protected:
      * @param[in] uid   Unique id
      */
     Plugin(const String& name, uint16_t uid) :
+        IPluginMaintenance(),
+        AllocTracked<AllocTracker::TAG_PLUGIN>(),
         m_isEnabled(false),
         m_uid(uid),
         m_alias(),
@@ -375,7 +411,7 @@ private:
  * This class handles the plugin configuration file in the filesystem.
  * Use it for loading and saving the configuration, as well as checking
  * whether the configuration file was changed without the handlers
- * knowledge.
+ * knowledge. Changes are notified via the plugin configuration notifier.
  */
 class PluginConfigFsHandler
 {
@@ -386,6 +422,7 @@ public:
      */
     ~PluginConfigFsHandler()
     {
+        PluginConfigNotifier::getInstance().unregisterHandler(this);
     }
 
     /**
@@ -413,6 +450,15 @@ public:
         return generateFullPath(m_uid, ".json");
     }
 
+    /**
+     * Notify that the configuration file was updated without using the
+     * plugin API.
+     */
+    void notifyConfigurationUpdated()
+    {
+        m_isConfigurationUpdated = true;
+    }
+
     /**
      * Path where plugin specific configuration files shall be stored.
      */
@@ -422,7 +468,7 @@ protected:
 
     const uint16_t  m_uid;                          /**< Unique id */
     FS&             m_fs;                           /**< Filesystem used to load and save the configuration file. */
-    time_t          m_timestampOfLastFileUpdate;    /**< Configuration in persistent memory written the last time (unix timeformat). */
+    volatile bool   m_isConfigurationUpdated;       /**< Is the configuration file updated without using the plugin API? */
 
     PluginConfigFsHandler();
     PluginConfigFsHandler(const PluginConfigFsHandler& handler);
@@ -437,8 +483,9 @@ protected:
     PluginConfigFsHandler(uint16_t uid, FS& fs) :
         m_uid(uid),
         m_fs(fs),
-        m_timestampOfLastFileUpdate(0U)
+        m_isConfigurationUpdated(false)
     {
+        PluginConfigNotifier::getInstance().registerHandler(this);
     }
 
     /**
@@ -457,34 +504,6 @@ protected:
      */
     virtual bool setConfiguration(JsonObjectConst& cfg) = 0;
 
-    /**
-     * Update the internal timestamp of the last configuration file update.
-     */
-    void updateTimestampLastUpdate()
-    {
-        m_timestampOfLastFileUpdate = getLastConfigurationUpdate();
-    }
-
-    /**
-     * Get timestamp of the last configuration update in the persistent memory.
-     * 
-     * @return Timestamp in unix time format.
-     */
-    time_t getLastConfigurationUpdate() const
-    {
-        String  configurationFilename   = getFullPathToConfiguration();
-        File    fd                      = m_fs.open(configurationFilename, "r");
-        time_t  timestamp               = 0U;
-
-        if (true == fd)
-        {
-            timestamp = fd.getLastWrite();
-            fd.close();
-        }
-
-        return timestamp;
-    }
-
     /**
      * Is the configuration in persistent memory updated without using the
      * plugin API?
@@ -493,15 +512,16 @@ protected:
      */
     bool isConfigurationUpdated() const
     {
-        bool    isConfigurationUpdated      = false;
-        time_t  timestampOfLastFileUpdate   = getLastConfigurationUpdate();
-        
-        if (timestampOfLastFileUpdate != m_timestampOfLastFileUpdate)
-        {
-            isConfigurationUpdated = true;
-        }
+        return m_isConfigurationUpdated;
+    }
 
-        return isConfigurationUpdated;
+    /**
+     * Clear the configuration updated notification. Call it before the
+     * configuration is reloaded, to not miss a further update.
+     */
+    void clearConfigurationUpdated()
+    {
+        m_isConfigurationUpdated = false;
     }
 
     /**
@@ -514,19 +534,27 @@ protected:
         bool                status                  = true;
         JsonFile            jsonFile(m_fs);
         const size_t        JSON_DOC_SIZE           = 1024U;
-        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-        JsonObject          jsonRootObject          = jsonDoc.to<JsonObject>();
+        JsonDocLease        jsonDocLease("Plugin::saveConfiguration", JSON_DOC_SIZE);
         String              configurationFilename   = getFullPathToConfiguration();
 
-        getConfiguration(jsonRootObject);
-        
-        if (false == jsonFile.save(configurationFilename, jsonDoc))
+        if (false == jsonDocLease.isValid())
         {
             status = false;
         }
         else
         {
-            m_timestampOfLastFileUpdate = getLastConfigurationUpdate();
+            JsonObject jsonRootObject = jsonDocLease->to<JsonObject>();
+
+            getConfiguration(jsonRootObject);
+
+            if (false == jsonFile.save(configurationFilename, *jsonDocLease))
+            {
+                status = false;
+            }
+            else
+            {
+                PluginConfigNotifier::getInstance().notifyConfigurationSaved();
+            }
         }
 
         return status;
@@ -542,16 +570,23 @@ protected:
         bool                status                  = true;
         JsonFile            jsonFile(m_fs);
         const size_t        JSON_DOC_SIZE           = 1024U;
-        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-        JsonObjectConst     jsonRootObject          = jsonDoc.to<JsonObject>();
+        JsonDocLease        jsonDocLease("Plugin::loadConfiguration", JSON_DOC_SIZE);
         String              configurationFilename   = getFullPathToConfiguration();
 
-        if (false == jsonFile.load(configurationFilename, jsonDoc))
+        if (false == jsonDocLease.isValid())
+        {
+            status = false;
+        }
+        /* The configuration may be provided faster than by the file, e.g. during boot. */
+        else if ((false == PluginConfigNotifier::getInstance().getConfiguration(m_uid, *jsonDocLease)) &&
+                 (false == jsonFile.load(configurationFilename, *jsonDocLease)))
         {
             status = false;
         }
         else
         {
+            JsonObjectConst jsonRootObject = jsonDocLease->as<JsonObjectConst>();
+
             status = setConfiguration(jsonRootObject);
         }
 
@@ -0,0 +1,172 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Plugin configuration change notifier
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PluginConfigNotifier.h"
+#include "Plugin.hpp"
+
+#include <algorithm>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void PluginConfigNotifier::registerHandler(PluginConfigFsHandler* handler)
+{
+    if (nullptr != handler)
+    {
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
+        /* Register handler only once! */
+        if (std::find(m_handlers.begin(), m_handlers.end(), handler) == m_handlers.end())
+        {
+            m_handlers.push_back(handler);
+        }
+    }
+}
+
+void PluginConfigNotifier::unregisterHandler(PluginConfigFsHandler* handler)
+{
+    MutexGuard<MutexRecursive>                      guard(m_mutex);
+    std::vector<PluginConfigFsHandler*>::iterator   it = m_handlers.begin();
+
+    while(m_handlers.end() != it)
+    {
+        if (handler == *it)
+        {
+            it = m_handlers.erase(it);
+            break;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void PluginConfigNotifier::notifyFileUpdated(const String& fullPath)
+{
+    /* Only files in the plugin configuration directory are of interest. */
+    if (true == fullPath.startsWith(PluginConfigFsHandler::CONFIG_PATH))
+    {
+        MutexGuard<MutexRecursive>                          guard(m_mutex);
+        std::vector<PluginConfigFsHandler*>::const_iterator it;
+
+        if (nullptr != m_listener)
+        {
+            m_listener->onConfigurationChanged();
+        }
+
+        for(it = m_handlers.begin(); it != m_handlers.end(); ++it)
+        {
+            if (fullPath == (*it)->getFullPathToConfiguration())
+            {
+                (*it)->notifyConfigurationUpdated();
+                break;
+            }
+        }
+    }
+}
+
+void PluginConfigNotifier::notifyConfigurationSaved()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if (nullptr != m_listener)
+    {
+        m_listener->onConfigurationChanged();
+    }
+}
+
+void PluginConfigNotifier::setListener(Listener* listener)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    m_listener = listener;
+}
+
+void PluginConfigNotifier::setProvider(Provider* provider)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    m_provider = provider;
+}
+
+bool PluginConfigNotifier::getConfiguration(uint16_t uid, JsonDocument& jsonDoc)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    bool                        isAvailable = false;
+
+    if (nullptr != m_provider)
+    {
+        isAvailable = m_provider->getConfiguration(uid, jsonDoc);
+    }
+
+    return isAvailable;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
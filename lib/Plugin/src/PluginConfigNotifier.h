@@ -0,0 +1,245 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Plugin configuration change notifier
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup plugin
+ *
+ * @{
+ */
+
+#ifndef PLUGIN_CONFIG_NOTIFIER_H
+#define PLUGIN_CONFIG_NOTIFIER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <WString.h>
+#include <Mutex.hpp>
+#include <ArduinoJson.h>
+#include <vector>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/* Forward declaration */
+class PluginConfigFsHandler;
+
+/**
+ * The plugin configuration notifier knows all plugin configuration filesystem
+ * handlers. Everyone who writes or removes a file in the filesystem, not using
+ * the plugin API, shall notify about it. The plugin which owns the
+ * configuration file will be informed and can reload its configuration.
+ * This way no plugin needs to poll its configuration file for updates.
+ *
+ * Additional a listener can be informed about any configuration change and
+ * during boot the plugin configurations may be provided by a faster source
+ * than the configuration files.
+ */
+class PluginConfigNotifier
+{
+public:
+
+    /**
+     * Listener, which is informed about any changed plugin configuration.
+     */
+    class Listener
+    {
+    public:
+
+        /**
+         * Destroys the listener.
+         */
+        virtual ~Listener()
+        {
+        }
+
+        /**
+         * A plugin configuration or the slot configuration changed in the
+         * filesystem.
+         */
+        virtual void onConfigurationChanged() = 0;
+
+    protected:
+
+        /**
+         * Constructs the listener.
+         */
+        Listener()
+        {
+        }
+    };
+
+    /**
+     * Provider of plugin configurations, used instead of the plugin
+     * configuration files.
+     */
+    class Provider
+    {
+    public:
+
+        /**
+         * Destroys the provider.
+         */
+        virtual ~Provider()
+        {
+        }
+
+        /**
+         * Get the configuration of a plugin.
+         *
+         * @param[in]   uid     Plugin UID
+         * @param[out]  jsonDoc JSON document, which will contain the configuration.
+         *
+         * @return If the configuration is available, it will return true otherwise false.
+         */
+        virtual bool getConfiguration(uint16_t uid, JsonDocument& jsonDoc) = 0;
+
+    protected:
+
+        /**
+         * Constructs the provider.
+         */
+        Provider()
+        {
+        }
+    };
+
+    /**
+     * Get the plugin configuration notifier instance.
+     *
+     * @return Plugin configuration notifier
+     */
+    static PluginConfigNotifier& getInstance()
+    {
+        static PluginConfigNotifier instance; /* idiom */
+
+        return instance;
+    }
+
+    /**
+     * Register a plugin configuration filesystem handler.
+     *
+     * @param[in] handler   Plugin configuration filesystem handler
+     */
+    void registerHandler(PluginConfigFsHandler* handler);
+
+    /**
+     * Unregister a plugin configuration filesystem handler.
+     *
+     * @param[in] handler   Plugin configuration filesystem handler
+     */
+    void unregisterHandler(PluginConfigFsHandler* handler);
+
+    /**
+     * Notify that a file in the filesystem was written or removed.
+     * If the file is a plugin configuration file, the owning plugin will be
+     * informed.
+     *
+     * @param[in] fullPath  Full path of the file
+     */
+    void notifyFileUpdated(const String& fullPath);
+
+    /**
+     * Notify that a plugin saved its configuration via plugin API.
+     */
+    void notifyConfigurationSaved();
+
+    /**
+     * Set the listener, which is informed about any changed configuration.
+     *
+     * @param[in] listener  Listener, use nullptr to remove it.
+     */
+    void setListener(Listener* listener);
+
+    /**
+     * Set the provider, which shall be asked first for a plugin configuration.
+     *
+     * @param[in] provider  Provider, use nullptr to remove it.
+     */
+    void setProvider(Provider* provider);
+
+    /**
+     * Get the configuration of a plugin from the provider.
+     *
+     * @param[in]   uid     Plugin UID
+     * @param[out]  jsonDoc JSON document, which will contain the configuration.
+     *
+     * @return If the configuration is available, it will return true otherwise false.
+     */
+    bool getConfiguration(uint16_t uid, JsonDocument& jsonDoc);
+
+private:
+
+    MutexRecursive                      m_mutex;    /**< Protects the handler list against concurrent access. */
+    std::vector<PluginConfigFsHandler*> m_handlers; /**< Registered plugin configuration filesystem handlers */
+    Listener*                           m_listener; /**< Listener for any configuration change */
+    Provider*                           m_provider; /**< Provider of plugin configurations */
+
+    /**
+     * Constructs the plugin configuration notifier.
+     */
+    PluginConfigNotifier() :
+        m_mutex(),
+        m_handlers(),
+        m_listener(nullptr),
+        m_provider(nullptr)
+    {
+        (void)m_mutex.create();
+    }
+
+    /**
+     * Destroys the plugin configuration notifier.
+     */
+    ~PluginConfigNotifier()
+    {
+        m_mutex.destroy();
+    }
+
+    /* An instance shall not be copied. */
+    PluginConfigNotifier(const PluginConfigNotifier& notifier);
+    PluginConfigNotifier& operator=(const PluginConfigNotifier& notifier);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* PLUGIN_CONFIG_NOTIFIER_H */
+
+/** @} */
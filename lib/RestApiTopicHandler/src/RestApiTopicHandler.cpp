@@ -41,6 +41,7 @@
 
 #include <Logging.h>
 #include <Util.h>
+#include <JsonDocPool.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -164,10 +165,8 @@ String RestApiTopicHandler::getBaseUri(const String& entityId)
 
 void RestApiTopicHandler::webReqHandler(AsyncWebServerRequest *request, TopicMetaData* topicMetaData)
 {
-    String              content;
     const size_t        JSON_DOC_SIZE   = 2048U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-    JsonObject          dataObj         = jsonDoc.createNestedObject("data");
+    JsonDocLease        jsonDocLease("RestApiTopicHandler", JSON_DOC_SIZE);
     uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
 
     if ((nullptr == request) ||
@@ -176,6 +175,16 @@ void RestApiTopicHandler::webReqHandler(AsyncWebServerRequest *request, TopicMet
         return;
     }
 
+    /* No JSON document available? */
+    if (false == jsonDocLease.isValid())
+    {
+        request->send(HttpStatus::STATUS_CODE_SERVICE_UNAVAILABLE, "text/plain", "Out of memory.");
+        return;
+    }
+
+    DynamicJsonDocument&    jsonDoc = *jsonDocLease;
+    JsonObject              dataObj = jsonDoc.createNestedObject("data");
+
     if ((HTTP_GET == request->method()) &&
         (nullptr != topicMetaData->getTopicFunc))
     {
@@ -199,9 +208,17 @@ void RestApiTopicHandler::webReqHandler(AsyncWebServerRequest *request, TopicMet
     else if ((HTTP_POST == request->method()) &&
              (nullptr != topicMetaData->setTopicFunc))
     {
-        DynamicJsonDocument jsonDocPar(JSON_DOC_SIZE);
+        JsonDocLease        jsonDocParLease("RestApiTopicHandler::par", JSON_DOC_SIZE);
         JsonObjectConst     jsonValue;
-        
+
+        if (false == jsonDocParLease.isValid())
+        {
+            request->send(HttpStatus::STATUS_CODE_SERVICE_UNAVAILABLE, "text/plain", "Out of memory.");
+            return;
+        }
+
+        DynamicJsonDocument& jsonDocPar = *jsonDocParLease;
+
         /* Topic data is in the HTTP parameters and needs to be converted to JSON. */
         par2Json(jsonDocPar, request);
 
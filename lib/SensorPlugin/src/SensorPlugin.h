@@ -82,7 +82,6 @@ public:
         m_sensorIdx(0U),
         m_channelIdx(0U),
         m_sensorChannel(nullptr),
-        m_cfgReloadTimer(),
         m_storeConfigReq(false),
         m_reloadConfigReq(false),
         m_hasTopicChanged(false)
@@ -229,6 +228,17 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * The sensor values change slowly, therefore a lower rate is sufficient.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return SIMPLE_TIMER_SECONDS(1U);
+    }
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -247,13 +257,6 @@ private:
     /** Sensor value update period in ms. */
     static const uint32_t   UPDATE_PERIOD   = SIMPLE_TIMER_SECONDS(2U);
 
-    /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
-     */
-    static const uint32_t   CFG_RELOAD_PERIOD   = SIMPLE_TIMER_SECONDS(30U);
-
     Fonts::FontType         m_fontType;                 /**< Font type which shall be used if there is no conflict with the layout. */
     TextWidget              m_textWidget;               /**< Text widget, used for showing the text. */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
@@ -261,7 +264,6 @@ private:
     uint8_t                 m_channelIdx;               /**< Index of selected channel. */
     ISensorChannel*         m_sensorChannel;            /**< Values of this channel will be shown. */
     SimpleTimer             m_updateTimer;              /**< Sensor value update timer. */
-    SimpleTimer             m_cfgReloadTimer;           /**< Timer is used to cyclic reload the configuration from persistent memory. */
     bool                    m_storeConfigReq;           /**< Is requested to store the configuration in persistent memory? */
     bool                    m_reloadConfigReq;          /**< Is requested to reload the configuration from persistent memory? */
     bool                    m_hasTopicChanged;          /**< Has the topic content changed? */
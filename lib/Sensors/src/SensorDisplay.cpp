@@ -25,14 +25,16 @@
     DESCRIPTION
 *******************************************************************************/
 /**
- * @brief  HTTP header
+ * @brief  Display current estimation driver
  * @author Andreas Merkle <web@blue-andi.de>
  */
 
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "HttpHeader.h"
+#include "SensorDisplay.h"
+
+#include <Display.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -58,39 +60,29 @@
  * Public Methods
  *****************************************************************************/
 
-HttpHeader& HttpHeader::operator=(const HttpHeader& hdr)
+uint32_t DisplayChannelCurrent::getValue()
 {
-    if (this != &hdr)
-    {
-        m_name = hdr.m_name;
-        m_value = hdr.m_value;
-    }
-
-    return *this;
+    return Display::getInstance().getCurrent() + m_offset;
 }
 
-void HttpHeader::parse(const String& line)
+ISensorChannel* SensorDisplay::getChannel(uint8_t index)
 {
-    int idx = line.indexOf(':');
+    ISensorChannel* channel = nullptr;
 
-    if (0 <= idx)
+    if (true == m_isAvailable)
     {
-        m_name = line.substring(0, idx);
-        m_value = line.substring(idx + 2);
-
-        /* There may be CRLF at the end, which must be removed. */
-        idx = m_value.indexOf("\r\n");
-
-        if (0 <= idx)
+        switch(index)
         {
-            m_value.remove(idx);
+        case CHANNEL_ID_CURRENT:
+            channel = &m_currentChannel;
+            break;
+
+        default:
+            break;
         }
     }
-}
 
-String HttpHeader::toString() const
-{
-    return String(m_name + ": " + m_value);
+    return channel;
 }
 
 /******************************************************************************
@@ -0,0 +1,231 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Display current estimation driver
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup hal
+ *
+ * @{
+ */
+
+#ifndef SENSOR_DISPLAY_H
+#define SENSOR_DISPLAY_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include <ISensor.hpp>
+#include <SensorChannelType.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Current channel of the display sensor.
+ */
+class DisplayChannelCurrent : public SensorChannelUInt32
+{
+public:
+
+    /**
+     * Constructs the current channel of the display sensor.
+     */
+    DisplayChannelCurrent() :
+        m_offset(0U)
+    {
+    }
+
+    /**
+     * Destroys the current channel of the display sensor.
+     */
+    ~DisplayChannelCurrent()
+    {
+    }
+
+    /**
+     * Get sensor channel type.
+     * 
+     * @return Sensor channel type
+     */
+    Type getType() const final
+    {
+        return ISensorChannel::TYPE_CURRENT_MILLIAMPERE;
+    }
+
+    /**
+     * Get data value.
+     * 
+     * @return Sensor data value in mA.
+     */
+    uint32_t getValue() final;
+
+    /**
+     * Get the correction offset, used for sensor tolerance compensation.
+     * 
+     * @return Offset value in mA.
+     */
+    uint32_t getOffset() const final
+    {
+        return m_offset;
+    }
+
+    /**
+     * Set correction offset to compensate sensor tolerance.
+     * 
+     * @param[in] offset    The correction offset value in mA.
+     */
+    void setOffset(uint32_t offset) final
+    {
+        m_offset = offset;
+    }
+
+private:
+
+    uint32_t    m_offset;   /**< Current offset in mA. */
+
+    DisplayChannelCurrent(const DisplayChannelCurrent& channel);
+    DisplayChannelCurrent& operator=(const DisplayChannelCurrent& channel);
+};
+
+/**
+ * The sensor provides the current, which the display draws. It is
+ * estimated by the display from the shown content.
+ */
+class SensorDisplay : public ISensor
+{
+public:
+
+    /**
+     * Constructs the driver for the display sensor.
+     */
+    SensorDisplay() :
+        m_isAvailable(false),
+        m_currentChannel()
+    {
+    }
+
+    /**
+     * Destroys the driver for the display sensor.
+     */
+    ~SensorDisplay()
+    {
+    }
+
+    /**
+     * Configures the sensor, so it is able to provide sensor data.
+     */
+    void begin() final
+    {
+        m_isAvailable = true;
+    }
+
+    /**
+     * Process the sensor driver. Mainly used to read the sensor value and
+     * provide its data cached to the sensor channels.
+     */
+    void process() final
+    {
+        /* Nothing to do.*/
+    }
+
+    /**
+     * Get sensor name.
+     * 
+     * @return Sensor name
+     */
+    const char* getName() const final
+    {
+        return "Display";
+    }
+
+    /**
+     * Is sensor available?
+     * If a sensor is physically not available or the initialization failed (see begin()),
+     * this can be checked with this method.
+     *
+     * @return If sensor is available, it will return true otherwise false.
+     */
+    bool isAvailable() const final
+    {
+        return m_isAvailable;
+    }
+
+    /**
+     * Get number of data channels.
+     * 
+     * @return Number of data channels.
+     */
+    uint8_t getNumChannels() const final
+    {
+        return static_cast<uint8_t>(CHANNEL_ID_MAX);
+    }
+
+    /**
+     * Get data channel by index.
+     * If sensor is not available or channel index is out of bounds, it will 
+     * return nullptr.
+     * 
+     * @return Data channel
+     */
+    ISensorChannel* getChannel(uint8_t index) final;
+
+private:
+
+    /**
+     * Supported channels.
+     */
+    enum ChannelId
+    {
+        CHANNEL_ID_CURRENT = 0, /**< Id of current channel. */
+        CHANNEL_ID_MAX          /**< Max. number of supported channels. */
+    };
+
+    bool                    m_isAvailable;      /**< Is a sensor available or not? */
+    DisplayChannelCurrent   m_currentChannel;   /**< Current channel. */
+
+    SensorDisplay(const SensorDisplay& sensor);
+    SensorDisplay& operator=(const SensorDisplay& sensor);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* SENSOR_DISPLAY_H */
+
+/** @} */
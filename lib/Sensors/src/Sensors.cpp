@@ -39,6 +39,7 @@
 #include <SensorSht3X.h>
 #include <SensorDhtX.h>
 #include <SensorBattery.h>
+#include <SensorDisplay.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -72,6 +73,9 @@ static SensorDhtX       gDht11(SensorDhtX::MODEL_DHT11);
 /** Battery sensor. */
 static SensorBattery    gBattery;
 
+/** Display sensor, which provides the estimated current. */
+static SensorDisplay    gDisplay;
+
 /** A list with all registered sensors. */
 static ISensor*         gSensors[] =
 {
@@ -79,7 +83,8 @@ static ISensor*         gSensors[] =
     /* 0 */ &gLdr,
     /* 1 */ &gSht3x,
     /* 2 */ &gDht11,
-    /* 3 */ &gBattery
+    /* 3 */ &gBattery,
+    /* 4 */ &gDisplay
 };
 
 /** The concrete sensor data provider implementation. */
@@ -72,6 +72,38 @@ public:
         TYPE_UINT32         /**< uint32_t type */
     };
 
+    /**
+     * Listener, which is notified about every changed value in the cache.
+     */
+    class Listener
+    {
+    public:
+
+        /**
+         * Destroys the listener.
+         */
+        virtual ~Listener()
+        {
+        }
+
+        /**
+         * The cached value of the key value pair changed and is not stored
+         * in the persistent storage yet.
+         *
+         * @param[in] kv    Key value pair
+         */
+        virtual void onValueChanged(KeyValue& kv) = 0;
+
+    protected:
+
+        /**
+         * Constructs the listener.
+         */
+        Listener()
+        {
+        }
+    };
+
     /**
      * Destroys a key value pair.
      */
@@ -89,6 +121,76 @@ public:
         m_preferences = &pref;
     }
 
+    /**
+     * Set the listener, which is notified about every changed cached value.
+     *
+     * @param[in] listener  Listener, use nullptr to remove it.
+     */
+    void setListener(Listener* listener)
+    {
+        m_listener = listener;
+    }
+
+    /**
+     * Load the value from the persistent storage into the cache.
+     * After that all reads and writes are served by the cache, until
+     * the cache is disabled again.
+     *
+     * Note, the persistent storage must be opened!
+     */
+    void load()
+    {
+        readValue();
+
+        m_isCached  = true;
+        m_isDirty   = false;
+    }
+
+    /**
+     * Write the cached value to the persistent storage, if it was changed.
+     *
+     * Note, the persistent storage must be opened in write mode!
+     */
+    void store()
+    {
+        if ((true == m_isCached) &&
+            (true == m_isDirty))
+        {
+            writeValue();
+            m_isDirty = false;
+        }
+    }
+
+    /**
+     * Disable the cache. All reads and writes will access the persistent
+     * storage directly again. Not stored values will be lost.
+     */
+    void disableCache()
+    {
+        m_isCached  = false;
+        m_isDirty   = false;
+    }
+
+    /**
+     * Is the value served by the cache?
+     *
+     * @return If cached, it will return true otherwise false.
+     */
+    bool isCached() const
+    {
+        return m_isCached;
+    }
+
+    /**
+     * Is the cached value changed, but not stored yet?
+     *
+     * @return If changed, it will return true otherwise false.
+     */
+    bool isDirty() const
+    {
+        return m_isDirty;
+    }
+
     /**
      * Get value type.
      *
@@ -113,12 +215,18 @@ public:
 protected:
 
     Preferences*    m_preferences;  /**< Persistent storage */
+    Listener*       m_listener;     /**< Listener for changed cached values */
+    bool            m_isCached;     /**< Is the value served by the cache? */
+    bool            m_isDirty;      /**< Is the cached value changed, but not stored yet? */
 
     /**
      * Constructs a key value pair.
      */
     KeyValue() :
-        m_preferences(nullptr)
+        m_preferences(nullptr),
+        m_listener(nullptr),
+        m_isCached(false),
+        m_isDirty(false)
     {
     }
 
@@ -128,10 +236,36 @@ protected:
      * @param[in] pref  Persistent storage
      */
     KeyValue(Preferences& pref) :
-        m_preferences(&pref)
+        m_preferences(&pref),
+        m_listener(nullptr),
+        m_isCached(false),
+        m_isDirty(false)
+    {
+    }
+
+    /**
+     * Mark the cached value as changed and notify the listener.
+     */
+    void markDirty()
     {
+        m_isDirty = true;
+
+        if (nullptr != m_listener)
+        {
+            m_listener->onValueChanged(*this);
+        }
     }
 
+    /**
+     * Read the value from the persistent storage into the cache.
+     */
+    virtual void readValue() = 0;
+
+    /**
+     * Write the cached value to the persistent storage.
+     */
+    virtual void writeValue() = 0;
+
 };
 
 /**
@@ -151,7 +285,8 @@ public:
         m_name(name),
         m_defValue(defValue),
         m_min(min),
-        m_max(max)
+        m_max(max),
+        m_value(defValue)
     {
     }
 
@@ -164,7 +299,8 @@ public:
         m_name(name),
         m_defValue(defValue),
         m_min(min),
-        m_max(max)
+        m_max(max),
+        m_value(defValue)
     {
     }
 
@@ -246,6 +382,21 @@ protected:
     T               m_defValue; /**< Default value */
     T               m_min;      /**< Min. length */
     T               m_max;      /**< Max. length */
+    T               m_value;    /**< Cached value */
+
+    /**
+     * Set the cached value. The listener is only notified if the value changed.
+     *
+     * @param[in] value Value
+     */
+    void setCachedValue(T value)
+    {
+        if (m_value != value)
+        {
+            m_value = value;
+            markDirty();
+        }
+    }
 
 private:
 
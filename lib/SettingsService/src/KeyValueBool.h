@@ -67,7 +67,8 @@ public:
         KeyValue(),
         m_key(key),
         m_name(name),
-        m_defValue(defValue)
+        m_defValue(defValue),
+        m_value(defValue)
     {
     }
 
@@ -78,7 +79,8 @@ public:
         KeyValue(pref),
         m_key(key),
         m_name(name),
-        m_defValue(defValue)
+        m_defValue(defValue),
+        m_value(defValue)
     {
     }
 
@@ -126,7 +128,14 @@ public:
      */
     bool getValue() const
     {
-        return m_preferences->getBool(m_key, getDefault());
+        bool value = m_value;
+
+        if (false == m_isCached)
+        {
+            value = m_preferences->getBool(m_key, getDefault());
+        }
+
+        return value;
     }
 
     /**
@@ -136,7 +145,19 @@ public:
      */
     void setValue(bool value)
     {
-        m_preferences->putBool(m_key, value);
+        if (false == m_isCached)
+        {
+            (void)m_preferences->putBool(m_key, value);
+        }
+        else if (m_value != value)
+        {
+            m_value = value;
+            markDirty();
+        }
+        else
+        {
+            ;
+        }
     }
 
     /**
@@ -154,6 +175,23 @@ private:
     const char*     m_key;      /**< Key */
     const char*     m_name;     /**< Name */
     bool            m_defValue; /**< Default value */
+    bool            m_value;    /**< Cached value */
+
+    /**
+     * Read the value from the persistent storage into the cache.
+     */
+    void readValue() final
+    {
+        m_value = m_preferences->getBool(m_key, getDefault());
+    }
+
+    /**
+     * Write the cached value to the persistent storage.
+     */
+    void writeValue() final
+    {
+        (void)m_preferences->putBool(m_key, m_value);
+    }
 
     /* An instance shall not be copied. */
     KeyValueBool(const KeyValueBool& kv);
@@ -70,7 +70,8 @@ public:
         m_name(name),
         m_defValue(defValue),
         m_min(min),
-        m_max(max)
+        m_max(max),
+        m_value()
     {
     }
 
@@ -83,7 +84,8 @@ public:
         m_name(name),
         m_defValue(defValue),
         m_min(min),
-        m_max(max)
+        m_max(max),
+        m_value()
     {
     }
 
@@ -151,7 +153,14 @@ public:
      */
     String getValue() const
     {
-        return m_preferences->getString(m_key, getDefault());
+        String value = m_value;
+
+        if (false == m_isCached)
+        {
+            value = m_preferences->getString(m_key, getDefault());
+        }
+
+        return value;
     }
 
     /**
@@ -161,7 +170,19 @@ public:
      */
     void setValue(const String& value)
     {
-        m_preferences->putString(m_key, value);
+        if (false == m_isCached)
+        {
+            (void)m_preferences->putString(m_key, value);
+        }
+        else if (m_value != value)
+        {
+            m_value = value;
+            markDirty();
+        }
+        else
+        {
+            ;
+        }
     }
 
     /**
@@ -181,6 +202,23 @@ private:
     const char*     m_defValue; /**< Default value */
     size_t          m_min;      /**< Min. length */
     size_t          m_max;      /**< Max. length */
+    String          m_value;    /**< Cached value */
+
+    /**
+     * Read the value from the persistent storage into the cache.
+     */
+    void readValue() final
+    {
+        m_value = m_preferences->getString(m_key, getDefault());
+    }
+
+    /**
+     * Write the cached value to the persistent storage.
+     */
+    void writeValue() final
+    {
+        (void)m_preferences->putString(m_key, m_value);
+    }
 
     /* An instance shall not be copied. */
     KeyValueJson(const KeyValueJson& kv);
@@ -77,7 +77,8 @@ public:
         m_defValue(defValue),
         m_min(min),
         m_max(max),
-        m_isSecret(isSecret)
+        m_isSecret(isSecret),
+        m_value()
     {
     }
 
@@ -98,7 +99,8 @@ public:
         m_defValue(defValue),
         m_min(min),
         m_max(max),
-        m_isSecret(isSecret)
+        m_isSecret(isSecret),
+        m_value()
     {
     }
 
@@ -166,7 +168,14 @@ public:
      */
     String getValue() const
     {
-        return m_preferences->getString(m_key, getDefault());
+        String value = m_value;
+
+        if (false == m_isCached)
+        {
+            value = m_preferences->getString(m_key, getDefault());
+        }
+
+        return value;
     }
 
     /**
@@ -176,7 +185,19 @@ public:
      */
     void setValue(const String& value)
     {
-        m_preferences->putString(m_key, value);
+        if (false == m_isCached)
+        {
+            (void)m_preferences->putString(m_key, value);
+        }
+        else if (m_value != value)
+        {
+            m_value = value;
+            markDirty();
+        }
+        else
+        {
+            ;
+        }
     }
 
     /**
@@ -222,6 +243,23 @@ private:
     const size_t    m_max;      /**< Max. length */
     const bool      m_isSecret; /**< Is the value a secret value? */
     String          m_uniqueId; /**< Unique id to make the default value unique. */
+    String          m_value;    /**< Cached value */
+
+    /**
+     * Read the value from the persistent storage into the cache.
+     */
+    void readValue() final
+    {
+        m_value = m_preferences->getString(m_key, getDefault());
+    }
+
+    /**
+     * Write the cached value to the persistent storage.
+     */
+    void writeValue() final
+    {
+        (void)m_preferences->putString(m_key, m_value);
+    }
 
     /* An instance shall not be copied. */
     KeyValueString(const KeyValueString& kv);
@@ -100,7 +100,14 @@ public:
      */
     uint32_t getValue() const final
     {
-        return m_preferences->getUInt(m_key, m_defValue);
+        uint32_t value = m_value;
+
+        if (false == m_isCached)
+        {
+            value = m_preferences->getUInt(m_key, m_defValue);
+        }
+
+        return value;
     }
 
     /**
@@ -110,7 +117,32 @@ public:
      */
     void setValue(uint32_t value) final
     {
-        m_preferences->putUInt(m_key, value);
+        if (false == m_isCached)
+        {
+            (void)m_preferences->putUInt(m_key, value);
+        }
+        else
+        {
+            setCachedValue(value);
+        }
+    }
+
+protected:
+
+    /**
+     * Read the value from the persistent storage into the cache.
+     */
+    void readValue() final
+    {
+        m_value = m_preferences->getUInt(m_key, m_defValue);
+    }
+
+    /**
+     * Write the cached value to the persistent storage.
+     */
+    void writeValue() final
+    {
+        (void)m_preferences->putUInt(m_key, m_value);
     }
 
 private:
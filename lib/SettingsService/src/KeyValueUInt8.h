@@ -100,7 +100,14 @@ public:
      */
     uint8_t getValue() const final
     {
-        return m_preferences->getUChar(m_key, m_defValue);
+        uint8_t value = m_value;
+
+        if (false == m_isCached)
+        {
+            value = m_preferences->getUChar(m_key, m_defValue);
+        }
+
+        return value;
     }
 
     /**
@@ -110,7 +117,32 @@ public:
      */
     void setValue(uint8_t value) final
     {
-        m_preferences->putUChar(m_key, value);
+        if (false == m_isCached)
+        {
+            (void)m_preferences->putUChar(m_key, value);
+        }
+        else
+        {
+            setCachedValue(value);
+        }
+    }
+
+protected:
+
+    /**
+     * Read the value from the persistent storage into the cache.
+     */
+    void readValue() final
+    {
+        m_value = m_preferences->getUChar(m_key, m_defValue);
+    }
+
+    /**
+     * Write the cached value to the persistent storage.
+     */
+    void writeValue() final
+    {
+        (void)m_preferences->putUChar(m_key, m_value);
     }
 
 private:
@@ -36,6 +36,7 @@
 #include "nvs.h"
 
 #include <Logging.h>
+#include <Util.h>
 #include <algorithm>
 
 /******************************************************************************
@@ -325,6 +326,23 @@ static const size_t     MAX_VALUE_NOTIFY_URL            = 64U;
 
 bool SettingsService::start()
 {
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* Load all settings once into the cache. If that fails, the settings
+     * will be read from the persistent storage on demand.
+     */
+    if (false == openStorage(true))
+    {
+        LOG_WARNING("Settings are not cached.");
+    }
+    else
+    {
+        loadCache();
+        closeStorage();
+
+        m_isCacheEnabled = true;
+    }
+
     LOG_INFO("Settings service started.");
 
     return true;
@@ -332,34 +350,42 @@ bool SettingsService::start()
 
 void SettingsService::stop()
 {
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* Write all pending changes, before the cache is disabled. */
+    flush();
+    disableCache();
+
+    m_isCacheEnabled = false;
+
     LOG_INFO("Settings service stopped.");
 }
 
 void SettingsService::process()
 {
-    /* Nothing to do. */
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if ((true == m_flushTimer.isTimerRunning()) &&
+        (true == m_flushTimer.isTimeout()))
+    {
+        flush();
+    }
 }
 
 bool SettingsService::open(bool readOnly)
 {
-    /* Open Preferences with namespace. Each application module, library, etc
-     * has to use a namespace name to prevent key name collisions. We will open storage in
-     * RW-mode (second parameter has to be false).
-     * Note: Namespace name is limited to 15 chars.
-     */
-    bool status = m_preferences.begin(PREF_NAMESPACE, readOnly);
+    bool status = true;
 
-    /* If settings storage doesn't exist, it will be created. */
-    if ((false == status) &&
-        (true == readOnly))
+    (void)m_mutex.take(portMAX_DELAY);
+
+    if (false == m_isCacheEnabled)
     {
-        status = m_preferences.begin(PREF_NAMESPACE, false);
+        status = openStorage(readOnly);
+    }
 
-        if (true == status)
-        {
-            m_preferences.end();
-            status = m_preferences.begin(PREF_NAMESPACE, readOnly);
-        }
+    if (false == status)
+    {
+        (void)m_mutex.give();
     }
 
     return status;
@@ -367,12 +393,99 @@ bool SettingsService::open(bool readOnly)
 
 void SettingsService::close()
 {
-    m_preferences.end();
+    if (false == m_isCacheEnabled)
+    {
+        closeStorage();
+    }
+    /* The service is not processed in every system state, therefore pending
+     * changes are written here too, as soon as they are due.
+     */
+    else if ((true == m_flushTimer.isTimerRunning()) &&
+             (true == m_flushTimer.isTimeout()))
+    {
+        flush();
+    }
+    else
+    {
+        ;
+    }
+
+    (void)m_mutex.give();
+}
+
+void SettingsService::flush()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    m_flushTimer.stop();
+
+    if (true == m_isCacheEnabled)
+    {
+        if (false == openStorage(false))
+        {
+            LOG_ERROR("Failed to write settings.");
+        }
+        else
+        {
+            storeCache();
+            closeStorage();
+        }
+    }
+}
+
+void SettingsService::onValueChanged(KeyValue& kv)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(kv);
+
+    ++m_generation;
+
+    /* Every change restarts the timer, so several changes in a row are
+     * written in one batch.
+     */
+    m_flushTimer.start(FLUSH_DELAY);
+}
+
+bool SettingsService::clear()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+    bool                       isSuccessful    = false;
+
+    if (false == m_isCacheEnabled)
+    {
+        isSuccessful = m_preferences.clear();
+    }
+    else if (true == openStorage(false))
+    {
+        isSuccessful = m_preferences.clear();
+
+        /* Pending changes are discarded, all settings are factory defaults now. */
+        m_flushTimer.stop();
+        loadCache();
+        closeStorage();
+
+        ++m_generation;
+    }
+    else
+    {
+        ;
+    }
+
+    return isSuccessful;
 }
 
 void SettingsService::cleanUp()
 {
-    uint32_t storedVersion = m_version.getValue();
+    uint32_t    storedVersion   = m_version.getValue();
+    bool        isStorageOpen   = false;
+
+    /* If the settings are cached, the persistent storage is not opened yet. */
+    if ((VERSION != storedVersion) &&
+        (true == m_isCacheEnabled))
+    {
+        isStorageOpen = openStorage(false);
+    }
 
     /* Clean up is only necessary, if settings version is different. */
     if (VERSION != storedVersion)
@@ -408,6 +521,11 @@ void SettingsService::cleanUp()
         /* Update version */
         m_version.setValue(VERSION);
     }
+
+    if (true == isStorageOpen)
+    {
+        closeStorage();
+    }
 }
 
 KeyValue* SettingsService::getSettingByKey(const char* key)
@@ -437,9 +555,21 @@ bool SettingsService::registerSetting(KeyValue* setting)
     if (nullptr != setting)
     {
         /* Register setting only once! */
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
         if (std::find(m_keyValueList.begin(), m_keyValueList.end(), setting) == m_keyValueList.end())
         {
             setting->setPersistentStorage(m_preferences);
+            setting->setListener(this);
+
+            /* Settings registered after the service start, are cached immediately. */
+            if ((true == m_isCacheEnabled) &&
+                (true == openStorage(true)))
+            {
+                setting->load();
+                closeStorage();
+            }
+
             m_keyValueList.push_back(setting);
 
             isSuccessful = true;
@@ -451,12 +581,24 @@ bool SettingsService::registerSetting(KeyValue* setting)
 
 void SettingsService::unregisterSetting(KeyValue* setting)
 {
-    std::vector<KeyValue*>::iterator it = m_keyValueList.begin();
+    MutexGuard<MutexRecursive>          guard(m_mutex);
+    std::vector<KeyValue*>::iterator    it = m_keyValueList.begin();
 
     while(m_keyValueList.end() != it)
     {
         if (setting == *it)
         {
+            /* Don't loose a pending change. */
+            if ((true == setting->isDirty()) &&
+                (true == openStorage(false)))
+            {
+                setting->store();
+                closeStorage();
+            }
+
+            setting->disableCache();
+            setting->setListener(nullptr);
+
             it = m_keyValueList.erase(it);
             break;
         }
@@ -478,6 +620,10 @@ void SettingsService::unregisterSetting(KeyValue* setting)
 SettingsService::SettingsService() :
     m_preferences(),
     m_keyValueList(),
+    m_mutex(),
+    m_isCacheEnabled(false),
+    m_flushTimer(),
+    m_generation(0U),
     m_version               (m_preferences, KEY_VERSION,                NAME_VERSION,               DEFAULT_VERSION,                MIN_VALUE_VERSION,              MAX_VALUE_VERSION),
     m_wifiSSID              (m_preferences, KEY_WIFI_SSID,              NAME_WIFI_SSID,             DEFAULT_WIFI_SSID,              MIN_VALUE_WIFI_SSID,            MAX_VALUE_WIFI_SSID),
     m_wifiPassphrase        (m_preferences, KEY_WIFI_PASSPHRASE,        NAME_WIFI_PASSPHRASE,       DEFAULT_WIFI_PASSPHRASE,        MIN_VALUE_WIFI_PASSPHRASE,      MAX_VALUE_WIFI_PASSPHRASE,      true),
@@ -495,6 +641,7 @@ SettingsService::SettingsService() :
     m_notifyURL             (m_preferences, KEY_NOTIFY_URL,             NAME_NOTIFY_URL,            DEFAULT_NOTIFY_URL,             MIN_VALUE_NOTIFY_URL,           MAX_VALUE_NOTIFY_URL),
     m_quietMode             (m_preferences, KEY_QUIET_MODE,             NAME_QUIET_MODE,            DEFAULT_QUIET_MODE)
 {
+    std::vector<KeyValue*>::iterator it;
 
     /* Skip m_version, because it shall not be modified by the user. */
     m_keyValueList.push_back(&m_wifiSSID);
@@ -512,10 +659,96 @@ SettingsService::SettingsService() :
     m_keyValueList.push_back(&m_scrollPause);
     m_keyValueList.push_back(&m_notifyURL);
     m_keyValueList.push_back(&m_quietMode);
+
+    /* The version is not part of the list, but cached too. */
+    m_version.setListener(this);
+
+    for(it = m_keyValueList.begin(); it != m_keyValueList.end(); ++it)
+    {
+        (*it)->setListener(this);
+    }
+
+    (void)m_mutex.create();
 }
 
 SettingsService::~SettingsService()
 {
+    m_mutex.destroy();
+}
+
+bool SettingsService::openStorage(bool readOnly)
+{
+    /* Open Preferences with namespace. Each application module, library, etc
+     * has to use a namespace name to prevent key name collisions. We will open storage in
+     * RW-mode (second parameter has to be false).
+     * Note: Namespace name is limited to 15 chars.
+     */
+    bool status = m_preferences.begin(PREF_NAMESPACE, readOnly);
+
+    /* If settings storage doesn't exist, it will be created. */
+    if ((false == status) &&
+        (true == readOnly))
+    {
+        status = m_preferences.begin(PREF_NAMESPACE, false);
+
+        if (true == status)
+        {
+            m_preferences.end();
+            status = m_preferences.begin(PREF_NAMESPACE, readOnly);
+        }
+    }
+
+    return status;
+}
+
+void SettingsService::closeStorage()
+{
+    m_preferences.end();
+}
+
+void SettingsService::loadCache()
+{
+    std::vector<KeyValue*>::iterator it;
+
+    m_version.load();
+
+    for(it = m_keyValueList.begin(); it != m_keyValueList.end(); ++it)
+    {
+        if (nullptr != *it)
+        {
+            (*it)->load();
+        }
+    }
+}
+
+void SettingsService::storeCache()
+{
+    std::vector<KeyValue*>::iterator it;
+
+    m_version.store();
+
+    for(it = m_keyValueList.begin(); it != m_keyValueList.end(); ++it)
+    {
+        if (nullptr != *it)
+        {
+            (*it)->store();
+        }
+    }
+}
+
+void SettingsService::disableCache()
+{
+    std::vector<KeyValue*>::iterator it;
+
+    m_version.disableCache();
+
+    for(it = m_keyValueList.begin(); it != m_keyValueList.end(); ++it)
+    {
+        if (nullptr != *it)
+        {
+            (*it)->disableCache();
+        }
+    }
 }
 
 /******************************************************************************
@@ -45,6 +45,8 @@
  *****************************************************************************/
 #include <Preferences.h>
 #include <IService.hpp>
+#include <Mutex.hpp>
+#include <SimpleTimer.hpp>
 #include <vector>
 
 #include "KeyValue.h"
@@ -65,8 +67,13 @@
 
 /**
  * Persistent storage of key value pairs.
+ *
+ * After the service is started, all registered key value pairs are cached in
+ * RAM. Reads are served from the cache and changed values are written in one
+ * batch to the persistent storage, after no further value changed for a
+ * while. Stopping the service writes all pending changes immediately.
  */
-class SettingsService : public IService
+class SettingsService : public IService, public KeyValue::Listener
 {
 public:
 
@@ -103,6 +110,10 @@ public:
      * Open settings.
      * If the settings storage doesn't exist, it will be created.
      *
+     * The settings are locked against concurrent access until they are closed
+     * again. As long as the cache is enabled, the persistent storage itself
+     * is not accessed.
+     *
      * @param[in] readOnly  Open read only or read/write
      *
      * @return Status
@@ -116,6 +127,31 @@ public:
      */
     void close();
 
+    /**
+     * Write all changed values from the cache to the persistent storage
+     * immediately.
+     */
+    void flush();
+
+    /**
+     * Get the change generation. It is incremented with every changed value,
+     * which can be used by readers to detect whether they need to read the
+     * settings again.
+     *
+     * @return Change generation
+     */
+    uint32_t getGeneration() const
+    {
+        return m_generation;
+    }
+
+    /**
+     * The cached value of a key value pair changed.
+     *
+     * @param[in] kv    Key value pair
+     */
+    void onValueChanged(KeyValue& kv) final;
+
     /**
      * Remove obsolete keys in the persistency. It can be used to prevent a
      * growing up persistency with obsolete key/value pairs.
@@ -170,10 +206,7 @@ public:
      *
      * @return If successful cleared, it will return true otherwise false.
      */
-    bool clear()
-    {
-        return m_preferences.clear();
-    }
+    bool clear();
 
     /**
      * Get remote wifi network SSID.
@@ -334,10 +367,20 @@ public:
      */
     static const uint32_t   VERSION = 2U;
 
+    /**
+     * Time in ms after the last changed value, till all changed values are
+     * written to the persistent storage.
+     */
+    static const uint32_t   FLUSH_DELAY = 2000U;
+
 private:
 
     Preferences             m_preferences;          /**< Persistent storage */
     std::vector<KeyValue*>  m_keyValueList;         /**< List of key/value pairs, stored in persistent storage. */
+    MutexRecursive          m_mutex;                /**< Protects the settings against concurrent access. */
+    bool                    m_isCacheEnabled;       /**< Are the key value pairs served by the cache? */
+    SimpleTimer             m_flushTimer;           /**< Timer used to delay writing changed values. */
+    uint32_t                m_generation;           /**< Change generation */
 
     KeyValueUInt32          m_version;              /**< Settings version (just an consequtive incremented number) */
     KeyValueString          m_wifiSSID;             /**< Remote wifi network SSID */
@@ -369,6 +412,38 @@ private:
     /* An instance shall not be copied. */
     SettingsService(const SettingsService& service);
     SettingsService& operator=(const SettingsService& service);
+
+    /**
+     * Open the persistent storage.
+     * If the persistent storage doesn't exist, it will be created.
+     *
+     * @param[in] readOnly  Open read only or read/write
+     *
+     * @return If successful opened, it will return true otherwise false.
+     */
+    bool openStorage(bool readOnly);
+
+    /**
+     * Close the persistent storage.
+     */
+    void closeStorage();
+
+    /**
+     * Load all key value pairs from the persistent storage into the cache.
+     * Note, the persistent storage must be opened!
+     */
+    void loadCache();
+
+    /**
+     * Write all changed key value pairs to the persistent storage.
+     * Note, the persistent storage must be opened in write mode!
+     */
+    void storeCache();
+
+    /**
+     * Disable the cache of all key value pairs.
+     */
+    void disableCache();
 };
 
 /******************************************************************************
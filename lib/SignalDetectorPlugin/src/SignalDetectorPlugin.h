@@ -86,7 +86,6 @@ public:
         m_isUpdateReq(false),
         m_timer(),
         m_slotInterf(nullptr),
-        m_cfgReloadTimer(),
         m_storeConfigReq(false),
         m_reloadConfigReq(false),
         m_hasTopicChanged(false)
@@ -263,6 +262,16 @@ public:
      */
     void process(bool isConnected) final;
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return PROCESS_PERIOD_DEFAULT;
+    }
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -283,13 +292,6 @@ private:
      */
     static const char*      DEFAULT_TEXT;
 
-    /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
-     */
-    static const uint32_t   CFG_RELOAD_PERIOD   = SIMPLE_TIMER_SECONDS(30U);
-
     Fonts::FontType         m_fontType;         /**< Font type which shall be used if there is no conflict with the layout. */
     TextWidget              m_textWidget;       /**< If signal is detected, it will show a corresponding text. */
     mutable MutexRecursive  m_mutex;            /**< Mutex to protect against concurrent access. */
@@ -299,7 +301,6 @@ private:
     bool                    m_isUpdateReq;      /**< Display update request, by changing the text. */
     SimpleTimer             m_timer;            /**< Timer used for slot duration timeout detection in case deactivate() is not called. */
     const ISlotPlugin*      m_slotInterf;       /**< Slot interface */
-    SimpleTimer             m_cfgReloadTimer;   /**< Timer is used to cyclic reload the configuration from persistent memory. */
     bool                    m_storeConfigReq;   /**< Is requested to store the configuration in persistent memory? */
     bool                    m_reloadConfigReq;  /**< Is requested to reload the configuration from persistent memory? */
     bool                    m_hasTopicChanged;  /**< Has the topic content changed? */
@@ -177,6 +177,9 @@ void SunrisePlugin::start(uint16_t width, uint16_t height)
 
     (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH);
 
+    /* The plugin starts inactive, therefore the icon is not needed yet. */
+    m_bitmapWidget.giveBack();
+
     /* The text canvas is left aligned to the icon canvas and it spans over
      * the whole display height.
      */
@@ -207,15 +210,6 @@ void SunrisePlugin::start(uint16_t width, uint16_t height)
             LOG_WARNING("Failed to create initial configuration file %s.", getFullPathToConfiguration().c_str());
         }
     }
-    else
-    {
-        /* Remember current timestamp to detect updates of the configuration in the
-         * filesystem without using the plugin API.
-         */
-        updateTimestampLastUpdate();
-    }
-
-    m_cfgReloadTimer.start(CFG_RELOAD_PERIOD);
 
     initHttpClient();
 }
@@ -225,7 +219,6 @@ void SunrisePlugin::stop()
     String                      configurationFilename = getFullPathToConfiguration();
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    m_cfgReloadTimer.stop();
     m_requestTimer.stop();
 
     if (false != FILESYSTEM.remove(configurationFilename))
@@ -240,15 +233,10 @@ void SunrisePlugin::process(bool isConnected)
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
     /* Configuration in persistent memory updated? */
-    if ((true == m_cfgReloadTimer.isTimerRunning()) &&
-        (true == m_cfgReloadTimer.isTimeout()))
+    if (true == isConfigurationUpdated())
     {
-        if (true == isConfigurationUpdated())
-        {
-            m_reloadConfigReq = true;
-        }
-
-        m_cfgReloadTimer.restart();
+        m_reloadConfigReq = true;
+        clearConfigurationUpdated();
     }
 
     if (true == m_storeConfigReq)
@@ -264,10 +252,7 @@ void SunrisePlugin::process(bool isConnected)
     {
         LOG_INFO("Reload configuration: %s", getFullPathToConfiguration().c_str());
 
-        if (true == loadConfiguration())
-        {
-            updateTimestampLastUpdate();
-        }
+        (void)loadConfiguration();
 
         m_reloadConfigReq = false;
     }
@@ -342,6 +327,23 @@ void SunrisePlugin::process(bool isConnected)
     }
 }
 
+void SunrisePlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    PLUGIN_NOT_USED(gfx);
+
+    m_bitmapWidget.borrow();
+}
+
+void SunrisePlugin::inactive()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* The icon is not needed until the plugin gets active again. */
+    m_bitmapWidget.giveBack();
+}
+
 void SunrisePlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -193,6 +193,17 @@ public:
      */
     void process(bool isConnected) final; 
 
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * The sensor values change slowly, therefore a lower rate is sufficient.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return SIMPLE_TIMER_SECONDS(1U);
+    }
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
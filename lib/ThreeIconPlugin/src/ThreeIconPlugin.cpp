@@ -383,6 +383,9 @@ void ThreeIconPlugin::start(uint16_t width, uint16_t height)
             m_spriteSheetPaths[iconId]  = spriteSheetFullPath;
         }
 
+        /* The plugin starts inactive, therefore the icon is not needed yet. */
+        m_bitmapWidgets[iconId].giveBack();
+
         m_hasTopicChanged[iconId] = true;
     }
 }
@@ -409,6 +412,47 @@ void ThreeIconPlugin::stop()
     }
 }
 
+void ThreeIconPlugin::process(bool isConnected)
+{
+    uint8_t                     iconId = 0U;
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    UTIL_NOT_USED(isConnected);
+
+    for(iconId = 0U; iconId < MAX_ICONS; ++iconId)
+    {
+        m_bitmapWidgets[iconId].process();
+    }
+}
+
+void ThreeIconPlugin::active(YAGfx& gfx)
+{
+    uint8_t                     iconId = 0U;
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    for(iconId = 0U; iconId < MAX_ICONS; ++iconId)
+    {
+        m_bitmapWidgets[iconId].borrow();
+    }
+
+    /* The framebuffer may contain the content of another plugin. */
+    m_isFullRepaintRequired = true;
+}
+
+void ThreeIconPlugin::inactive()
+{
+    uint8_t                     iconId = 0U;
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    /* The icons are not needed until the plugin gets active again. */
+    for(iconId = 0U; iconId < MAX_ICONS; ++iconId)
+    {
+        m_bitmapWidgets[iconId].giveBack();
+    }
+}
+
 void ThreeIconPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive>  guard(m_mutex);
@@ -417,6 +461,23 @@ void ThreeIconPlugin::update(YAGfx& gfx)
     m_threeIconCanvas.update(gfx);
 }
 
+void ThreeIconPlugin::updateDamaged(YAGfx& gfx, YAGfxDamage& damage)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    if (true == m_isFullRepaintRequired)
+    {
+        update(gfx);
+        damage.add(0, 0, gfx.getWidth(), gfx.getHeight());
+
+        m_isFullRepaintRequired = false;
+    }
+    else
+    {
+        m_threeIconCanvas.repaintDamaged(gfx, ColorDef::BLACK, damage);
+    }
+}
+
 bool ThreeIconPlugin::loadBitmap(uint8_t iconId, const String& filename)
 {
     bool status = false;
@@ -79,7 +79,8 @@ public:
         m_spriteSheetPaths(),
         m_isUploadError(false),
         m_mutex(),
-        m_hasTopicChanged()
+        m_hasTopicChanged(),
+        m_isFullRepaintRequired(true)
     {
         (void)m_mutex.create();
     }
@@ -199,6 +200,39 @@ public:
      */
     void stop() final;
 
+    /**
+     * Process the plugin.
+     * It prefetches the next frame of an animated icon.
+     * 
+     * @param[in] isConnected   The network connection status. If network
+     *                          connection is established, it will be true otherwise false.
+     */
+    void process(bool isConnected) final;
+
+    /**
+     * Get the period in ms, how often the plugin shall be processed.
+     * 
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return BitmapWidget::PROCESS_PERIOD;
+    }
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface.
+     */
+    void active(YAGfx& gfx) final;
+
+    /**
+     * This method will be called in case the plugin is set inactive, which means
+     * it won't be shown on the display anymore.
+     */
+    void inactive() final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -207,6 +241,17 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Update the display and report the changed regions.
+     * After activation the framebuffer may contain the content of another
+     * plugin, therefore the first update repaints the whole display. After
+     * that only the damaged regions of the canvases are repainted.
+     *
+     * @param[in]       gfx     Display graphics interface.
+     * @param[in,out]   damage  Regions of the display, which were changed.
+     */
+    void updateDamaged(YAGfx& gfx, YAGfxDamage& damage) final;
+
     /**
      * Load bitmap image from filesystem. If a sprite sheet is available, the
      * bitmap will be automatically used as texture for animation.
@@ -344,6 +389,7 @@ private:
     bool                    m_isUploadError;                /**< Flag to signal a upload error. */
     mutable MutexRecursive  m_mutex;                        /**< Mutex to protect against concurrent access. */
     bool                    m_hasTopicChanged[MAX_ICONS];  /**< Has the topic content changed? */
+    bool                    m_isFullRepaintRequired;        /**< Shall the whole display be repainted with the next update? */
 
     /**
      * Get image filename with path.
@@ -25,16 +25,16 @@
     DESCRIPTION
 *******************************************************************************/
 /**
- * @brief  HTTP header
+ * @brief  LED segment interface
  * @author Andreas Merkle <web@blue-andi.de>
  *
- * @addtogroup web
+ * @addtogroup hal
  *
  * @{
  */
 
-#ifndef HTTP_HEADER_H
-#define HTTP_HEADER_H
+#ifndef ILED_SEGMENT_HPP
+#define ILED_SEGMENT_HPP
 
 /******************************************************************************
  * Compile Switches
@@ -43,7 +43,8 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include <WString.h>
+#include <stdint.h>
+#include <YAColor.h>
 
 /******************************************************************************
  * Macros
@@ -54,125 +55,84 @@
  *****************************************************************************/
 
 /**
- * Request/Response http header
+ * The LED segment interface abstracts a single LED strip, driven by its own
+ * data output pin. A physical LED panel is connected to exactly one segment.
  */
-class HttpHeader
+class ILedSegment
 {
 public:
 
     /**
-     * Constructs a empty header.
+     * Destroys the LED segment.
      */
-    HttpHeader() :
-        m_name(),
-        m_value()
+    virtual ~ILedSegment()
     {
     }
 
     /**
-     * Constructs header, based on the given values.
+     * Initialize the LED segment.
      *
-     * @param[in] name  Field name
-     * @param[in] value Field value
+     * @return If successful, returns true otherwise false.
      */
-    HttpHeader(const String& name, const String& value) :
-        m_name(name),
-        m_value(value)
-    {
-    }
+    virtual bool begin() = 0;
 
     /**
-     * Constructs a header, based on a single header line.
+     * Get number of LEDs in the segment.
      *
-     * @param[in] line  Header line, which contains name and value.
-     */
-    HttpHeader(const String& line) :
-        m_name(),
-        m_value()
-    {
-        parse(line);
-    }
-
-    /**
-     * Destroys the header.
+     * @return Number of LEDs
      */
-    ~HttpHeader()
-    {
-    }
+    virtual uint16_t getLength() const = 0;
 
     /**
-     * Get field name.
+     * Set color of a single LED. The color will be shown after the next call
+     * of show().
      *
-     * @return Field name
+     * @param[in] index Index of the LED in the segment
+     * @param[in] color Color in RGB888 format
      */
-    const String& getName() const
-    {
-        return m_name;
-    }
+    virtual void setPixel(uint16_t index, const Color& color) = 0;
 
     /**
-     * Get field value.
-     *
-     * @return Field value
+     * Set all LEDs to black. The LEDs will be cleared after the next call
+     * of show().
      */
-    const String& getValue() const
-    {
-        return m_value;
-    }
+    virtual void clear() = 0;
 
     /**
-     * Set field name.
-     *
-     * @param[in] name  Field name
+     * Start clocking out the LED colors. This shall not wait until the
+     * transfer is finished, so several segments can be updated in parallel.
      */
-    void setName(const String& name)
-    {
-        m_name = name;
-    }
+    virtual void show() = 0;
 
     /**
-     * Set field value.
+     * The segment is ready, when the last transfer is finished.
      *
-     * @param[in] value Field value
+     * @return If ready for another update via show(), it will return true otherwise false.
      */
-    void setValue(const String& value)
-    {
-        m_value = value;
-    }
+    virtual bool isReady() const = 0;
 
     /**
-     * Assign a header.
-     *
-     * @param[in] hdr   Header, which to assign.
+     * Set luminance of all LEDs in the segment.
      *
-     * @return Header
+     * @param[in] luminance Luminance [0; 255]
      */
-    HttpHeader& operator=(const HttpHeader& hdr);
+    virtual void setLuminance(uint8_t luminance) = 0;
 
-    /**
-     * Parse "<name>: <value>" string.
-     *
-     * @param[in] line  String line
-     */
-    void parse(const String& line);
+protected:
 
     /**
-     * Get header as single line.
-     *
-     * @return Header
+     * Constructs the LED segment.
      */
-    String toString() const;
-
-private:
+    ILedSegment()
+    {
+    }
 
-    String  m_name;     /**< Header field name */
-    String  m_value;    /**< Header field value */
 };
 
 /******************************************************************************
  * Functions
  *****************************************************************************/
 
-#endif  /* HTTP_HEADER_H */
+#endif  /* ILED_SEGMENT_HPP */
 
-/** @} */
\ No newline at end of file
+/** @} */
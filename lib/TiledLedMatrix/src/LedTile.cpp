@@ -0,0 +1,145 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  LED tile
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "LedTile.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+uint32_t LedTile::map(uint16_t x, uint16_t y) const
+{
+    uint32_t index = INVALID_INDEX;
+
+    if ((getWidth() > x) &&
+        (getHeight() > y))
+    {
+        uint32_t    px  = x;    /* x-coordinate in the panel, as wired */
+        uint32_t    py  = y;    /* y-coordinate in the panel, as wired */
+
+        switch(m_rotation)
+        {
+        case ROTATE_0:
+            break;
+
+        case ROTATE_90:
+            px = y;
+            py = m_panelHeight - 1U - x;
+            break;
+
+        case ROTATE_180:
+            px = m_panelWidth - 1U - x;
+            py = m_panelHeight - 1U - y;
+            break;
+
+        case ROTATE_270:
+            px = m_panelWidth - 1U - y;
+            py = x;
+            break;
+
+        default:
+            break;
+        }
+
+        switch(m_layout)
+        {
+        case LAYOUT_ROW_MAJOR:
+            index = py * m_panelWidth + px;
+            break;
+
+        case LAYOUT_ROW_MAJOR_ALTERNATING:
+            if (0U != (py & 1U))
+            {
+                px = m_panelWidth - 1U - px;
+            }
+
+            index = py * m_panelWidth + px;
+            break;
+
+        case LAYOUT_COLUMN_MAJOR:
+            index = px * m_panelHeight + py;
+            break;
+
+        case LAYOUT_COLUMN_MAJOR_ALTERNATING:
+            if (0U != (px & 1U))
+            {
+                py = m_panelHeight - 1U - py;
+            }
+
+            index = px * m_panelHeight + py;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return index;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,217 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  LED tile
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup hal
+ *
+ * @{
+ */
+
+#ifndef LED_TILE_H
+#define LED_TILE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A LED tile describes where a physical LED panel is placed in the logical
+ * framebuffer, how its LEDs are wired (layout) and how the panel is mounted
+ * (rotation). It maps framebuffer coordinates to the LED index in the panel.
+ */
+class LedTile
+{
+public:
+
+    /**
+     * Wiring of the LEDs in the panel.
+     * Same as the layouts of the NeoPixelBus topology.
+     */
+    enum Layout
+    {
+        LAYOUT_ROW_MAJOR = 0,               /**< Rows from left to right */
+        LAYOUT_ROW_MAJOR_ALTERNATING,       /**< Rows in zig-zag */
+        LAYOUT_COLUMN_MAJOR,                /**< Columns from top to bottom */
+        LAYOUT_COLUMN_MAJOR_ALTERNATING     /**< Columns in zig-zag */
+    };
+
+    /**
+     * Clockwise rotation of the mounted panel.
+     */
+    enum Rotation
+    {
+        ROTATE_0 = 0,   /**< Not rotated */
+        ROTATE_90,      /**< Rotated by 90° */
+        ROTATE_180,     /**< Rotated by 180° */
+        ROTATE_270      /**< Rotated by 270° */
+    };
+
+    /**
+     * Constructs a tile with no LEDs.
+     */
+    LedTile() :
+        m_x(0U),
+        m_y(0U),
+        m_panelWidth(0U),
+        m_panelHeight(0U),
+        m_layout(LAYOUT_ROW_MAJOR),
+        m_rotation(ROTATE_0)
+    {
+    }
+
+    /**
+     * Constructs a tile.
+     *
+     * @param[in] x             x-coordinate of the upper left tile corner in the framebuffer
+     * @param[in] y             y-coordinate of the upper left tile corner in the framebuffer
+     * @param[in] panelWidth    Panel width in pixels, as wired (not rotated)
+     * @param[in] panelHeight   Panel height in pixels, as wired (not rotated)
+     * @param[in] layout        Wiring of the LEDs in the panel
+     * @param[in] rotation      Clockwise rotation of the mounted panel
+     */
+    LedTile(uint16_t x, uint16_t y, uint16_t panelWidth, uint16_t panelHeight, Layout layout, Rotation rotation) :
+        m_x(x),
+        m_y(y),
+        m_panelWidth(panelWidth),
+        m_panelHeight(panelHeight),
+        m_layout(layout),
+        m_rotation(rotation)
+    {
+    }
+
+    /**
+     * Destroys the tile.
+     */
+    ~LedTile()
+    {
+    }
+
+    /**
+     * Get x-coordinate of the upper left tile corner in the framebuffer.
+     *
+     * @return x-coordinate
+     */
+    uint16_t getX() const
+    {
+        return m_x;
+    }
+
+    /**
+     * Get y-coordinate of the upper left tile corner in the framebuffer.
+     *
+     * @return y-coordinate
+     */
+    uint16_t getY() const
+    {
+        return m_y;
+    }
+
+    /**
+     * Get tile width in the framebuffer, considering the rotation.
+     *
+     * @return Width in pixels
+     */
+    uint16_t getWidth() const
+    {
+        return (true == isTransposed()) ? m_panelHeight : m_panelWidth;
+    }
+
+    /**
+     * Get tile height in the framebuffer, considering the rotation.
+     *
+     * @return Height in pixels
+     */
+    uint16_t getHeight() const
+    {
+        return (true == isTransposed()) ? m_panelWidth : m_panelHeight;
+    }
+
+    /**
+     * Get number of LEDs in the panel.
+     *
+     * @return Number of LEDs
+     */
+    uint32_t getLength() const
+    {
+        return static_cast<uint32_t>(m_panelWidth) * m_panelHeight;
+    }
+
+    /**
+     * Map a framebuffer coordinate inside the tile to the LED index in the panel.
+     *
+     * @param[in] x x-coordinate relative to the upper left tile corner
+     * @param[in] y y-coordinate relative to the upper left tile corner
+     *
+     * @return LED index in the panel. If the coordinate is outside the tile, INVALID_INDEX will be returned.
+     */
+    uint32_t map(uint16_t x, uint16_t y) const;
+
+    /** Index returned for coordinates outside the tile. */
+    static const uint32_t   INVALID_INDEX   = UINT32_MAX;
+
+private:
+
+    uint16_t    m_x;            /**< x-coordinate of the upper left tile corner in the framebuffer */
+    uint16_t    m_y;            /**< y-coordinate of the upper left tile corner in the framebuffer */
+    uint16_t    m_panelWidth;   /**< Panel width in pixels, as wired */
+    uint16_t    m_panelHeight;  /**< Panel height in pixels, as wired */
+    Layout      m_layout;       /**< Wiring of the LEDs */
+    Rotation    m_rotation;     /**< Clockwise rotation of the mounted panel */
+
+    /**
+     * Are width and height swapped in the framebuffer because of the rotation?
+     *
+     * @return If swapped, it will return true otherwise false.
+     */
+    bool isTransposed() const
+    {
+        return ((ROTATE_90 == m_rotation) || (ROTATE_270 == m_rotation));
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* LED_TILE_H */
+
+/** @} */
@@ -0,0 +1,267 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Tiled LED matrix
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TiledLedMatrix.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool TiledLedMatrix::addSegment(ILedSegment& segment, const LedTile& tile)
+{
+    bool        isSuccessful    = false;
+    uint32_t    right           = static_cast<uint32_t>(tile.getX()) + tile.getWidth();
+    uint32_t    bottom          = static_cast<uint32_t>(tile.getY()) + tile.getHeight();
+
+    if ((MAX_SEGMENTS > m_segmentCount) &&
+        (m_framebuffer.getWidth() >= right) &&
+        (m_framebuffer.getHeight() >= bottom) &&
+        (segment.getLength() >= tile.getLength()))
+    {
+        m_segments[m_segmentCount].segment  = &segment;
+        m_segments[m_segmentCount].tile     = tile;
+        ++m_segmentCount;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool TiledLedMatrix::begin()
+{
+    bool    isSuccessful    = true;
+    uint8_t idx             = 0U;
+
+    for(idx = 0U; idx < m_segmentCount; ++idx)
+    {
+        if (false == m_segments[idx].segment->begin())
+        {
+            isSuccessful = false;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void TiledLedMatrix::write()
+{
+    const uint16_t  fbWidth     = m_framebuffer.getWidth();
+    const uint16_t  fbHeight    = m_framebuffer.getHeight();
+    uint8_t         idx         = 0U;
+
+    /* The current is estimated first, so that the luminance limits the
+     * frame, which is written now and not only the next one.
+     */
+    if (nullptr != m_powerLimiter)
+    {
+        estimate();
+    }
+
+    if (nullptr != m_colorPipeline)
+    {
+        if (nullptr != m_powerLimiter)
+        {
+            m_colorPipeline->setLuminance(m_powerLimiter->getLuminance());
+        }
+
+        m_colorPipeline->beginFrame();
+    }
+
+    for(idx = 0U; idx < m_segmentCount; ++idx)
+    {
+        ILedSegment*    segment = m_segments[idx].segment;
+        const LedTile&  tile    = m_segments[idx].tile;
+        const uint16_t  width   = tile.getWidth();
+        const uint16_t  height  = tile.getHeight();
+        uint16_t        x       = 0U;
+        uint16_t        y       = 0U;
+
+        for(y = 0U; y < height; ++y)
+        {
+            uint16_t fbY = tile.getY() + y;
+
+            if (true == m_isRotated180)
+            {
+                fbY = fbHeight - 1U - fbY;
+            }
+
+            for(x = 0U; x < width; ++x)
+            {
+                uint16_t        fbX     = tile.getX() + x;
+                uint16_t        index   = static_cast<uint16_t>(tile.map(x, y));
+                const Color*    color   = nullptr;
+
+                if (true == m_isRotated180)
+                {
+                    fbX = fbWidth - 1U - fbX;
+                }
+
+                color = &m_framebuffer.getColor(fbX, fbY);
+
+                if (nullptr == m_colorPipeline)
+                {
+                    segment->setPixel(index, *color);
+                }
+                else
+                {
+                    uint8_t red     = color->getRed();
+                    uint8_t green   = color->getGreen();
+                    uint8_t blue    = color->getBlue();
+
+                    m_colorPipeline->apply(index, red, green, blue);
+                    segment->setPixel(index, Color(red, green, blue));
+                }
+            }
+        }
+    }
+}
+
+void TiledLedMatrix::clear()
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < m_segmentCount; ++idx)
+    {
+        m_segments[idx].segment->clear();
+    }
+}
+
+void TiledLedMatrix::show()
+{
+    uint8_t idx = 0U;
+
+    /* Every segment starts its transfer without waiting for its end,
+     * therefore all segments are clocked out in parallel.
+     */
+    for(idx = 0U; idx < m_segmentCount; ++idx)
+    {
+        m_segments[idx].segment->show();
+    }
+}
+
+bool TiledLedMatrix::isReady() const
+{
+    bool    isReady = true;
+    uint8_t idx     = 0U;
+
+    for(idx = 0U; (idx < m_segmentCount) && (true == isReady); ++idx)
+    {
+        isReady = m_segments[idx].segment->isReady();
+    }
+
+    return isReady;
+}
+
+void TiledLedMatrix::setLuminance(uint8_t luminance)
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < m_segmentCount; ++idx)
+    {
+        m_segments[idx].segment->setLuminance(luminance);
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void TiledLedMatrix::estimate()
+{
+    const uint16_t  fbWidth     = m_framebuffer.getWidth();
+    const uint16_t  fbHeight    = m_framebuffer.getHeight();
+    uint16_t        x           = 0U;
+    uint16_t        y           = 0U;
+
+    m_powerLimiter->beginFrame();
+
+    for(y = 0U; y < fbHeight; ++y)
+    {
+        for(x = 0U; x < fbWidth; ++x)
+        {
+            const Color& color = m_framebuffer.getColor(x, y);
+
+            /* The LED current depends on the gamma corrected and white balanced values. */
+            if (nullptr == m_colorPipeline)
+            {
+                m_powerLimiter->addPixel(
+                    static_cast<uint16_t>(color.getRed() << ColorPipeline::FRACTION_BITS),
+                    static_cast<uint16_t>(color.getGreen() << ColorPipeline::FRACTION_BITS),
+                    static_cast<uint16_t>(color.getBlue() << ColorPipeline::FRACTION_BITS));
+            }
+            else
+            {
+                m_powerLimiter->addPixel(
+                    m_colorPipeline->getPreciseValue(ColorPipeline::CHANNEL_RED, color.getRed()),
+                    m_colorPipeline->getPreciseValue(ColorPipeline::CHANNEL_GREEN, color.getGreen()),
+                    m_colorPipeline->getPreciseValue(ColorPipeline::CHANNEL_BLUE, color.getBlue()));
+            }
+        }
+    }
+
+    m_powerLimiter->endFrame();
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
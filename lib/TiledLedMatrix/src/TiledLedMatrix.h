@@ -0,0 +1,236 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Tiled LED matrix
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup hal
+ *
+ * @{
+ */
+
+#ifndef TILED_LED_MATRIX_H
+#define TILED_LED_MATRIX_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfxBitmap.h>
+#include <PowerLimiter.h>
+#include <ColorPipeline.h>
+
+#include "ILedSegment.hpp"
+#include "LedTile.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A tiled LED matrix maps one logical framebuffer onto several LED segments.
+ * Every segment drives one physical panel, described by a tile.
+ *
+ * The colors of all segments are written first and afterwards all segments
+ * are started, so that the segments are clocked out in parallel.
+ */
+class TiledLedMatrix
+{
+public:
+
+    /** Max. number of segments (one per RMT channel on the ESP32). */
+    static const uint8_t    MAX_SEGMENTS    = 8U;
+
+    /**
+     * Constructs a tiled LED matrix without any segment.
+     *
+     * @param[in] framebuffer   The framebuffer, which shall be shown.
+     */
+    explicit TiledLedMatrix(const YAGfxBitmap& framebuffer) :
+        m_framebuffer(framebuffer),
+        m_segments(),
+        m_segmentCount(0U),
+        m_isRotated180(false),
+        m_powerLimiter(nullptr),
+        m_colorPipeline(nullptr)
+    {
+    }
+
+    /**
+     * Destroys the tiled LED matrix.
+     * The segments are not owned and therefore not destroyed.
+     */
+    ~TiledLedMatrix()
+    {
+    }
+
+    /**
+     * Add a segment, which shows the framebuffer part described by the tile.
+     * The tile must be completely inside the framebuffer and the segment
+     * must provide at least as many LEDs as the tile.
+     *
+     * @param[in] segment   LED segment
+     * @param[in] tile      Tile of the physical panel
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addSegment(ILedSegment& segment, const LedTile& tile);
+
+    /**
+     * Get number of segments.
+     *
+     * @return Number of segments
+     */
+    uint8_t getSegmentCount() const
+    {
+        return m_segmentCount;
+    }
+
+    /**
+     * Rotate the whole framebuffer by 180° on the panels.
+     *
+     * @param[in] isRotated180  Rotate by 180° or not
+     */
+    void setRotate180(bool isRotated180)
+    {
+        m_isRotated180 = isRotated180;
+    }
+
+    /**
+     * Set the power limiter, which estimates the current of every written frame.
+     *
+     * @param[in] powerLimiter  Power limiter or nullptr to disable the estimation
+     */
+    void setPowerLimiter(PowerLimiter* powerLimiter)
+    {
+        m_powerLimiter = powerLimiter;
+    }
+
+    /**
+     * Set the color pipeline, which converts the colors on the way to the segments.
+     *
+     * @param[in] colorPipeline Color pipeline or nullptr to write the framebuffer colors unchanged
+     */
+    void setColorPipeline(ColorPipeline* colorPipeline)
+    {
+        m_colorPipeline = colorPipeline;
+    }
+
+    /**
+     * Initialize all segments.
+     *
+     * @return If all are successful initialized, it will return true otherwise false.
+     */
+    bool begin();
+
+    /**
+     * Write the framebuffer to all segments.
+     * The colors are shown after the next call of show().
+     * If a power limiter is set, the frame is estimated before it is written
+     * and its luminance is applied to the color pipeline.
+     * If a color pipeline is set, the colors are converted while writing.
+     */
+    void write();
+
+    /**
+     * Clear all segments, the framebuffer is not touched.
+     * The segments are cleared after the next call of show().
+     */
+    void clear();
+
+    /**
+     * Start clocking out all segments.
+     */
+    void show();
+
+    /**
+     * The tiled LED matrix is ready, when the transfer of every segment is finished.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    bool isReady() const;
+
+    /**
+     * Set luminance of all segments.
+     *
+     * @param[in] luminance Luminance [0; 255]
+     */
+    void setLuminance(uint8_t luminance);
+
+private:
+
+    /**
+     * A LED segment together with the tile it shows.
+     */
+    struct Segment
+    {
+        ILedSegment*    segment;    /**< LED segment */
+        LedTile         tile;       /**< Tile of the physical panel */
+
+        /**
+         * Constructs a unused segment.
+         */
+        Segment() :
+            segment(nullptr),
+            tile()
+        {
+        }
+    };
+
+    const YAGfxBitmap&  m_framebuffer;                  /**< Framebuffer, which is shown */
+    Segment             m_segments[MAX_SEGMENTS];       /**< Segments */
+    uint8_t             m_segmentCount;                 /**< Number of used segments */
+    bool                m_isRotated180;                 /**< Is the framebuffer rotated by 180°? */
+    PowerLimiter*       m_powerLimiter;                 /**< Power limiter, which estimates the frames */
+    ColorPipeline*      m_colorPipeline;                /**< Color pipeline, which converts the colors */
+
+    TiledLedMatrix();
+    TiledLedMatrix(const TiledLedMatrix& matrix);
+    TiledLedMatrix& operator=(const TiledLedMatrix& matrix);
+
+    /**
+     * Estimate the current of the framebuffer content with the power limiter.
+     * The tiles are expected to cover the whole framebuffer.
+     */
+    void estimate();
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* TILED_LED_MATRIX_H */
+
+/** @} */
@@ -36,6 +36,7 @@
 #include "TopicHandlers.h"
 
 #include <Logging.h>
+#include <JsonDocPool.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -101,72 +102,81 @@ void TopicHandlerService::registerTopics(const String& deviceId, IPluginMaintena
         (nullptr != plugin))
     {
         const size_t        JSON_DOC_SIZE   = 1024U;
-        DynamicJsonDocument topicsDoc(JSON_DOC_SIZE);
-        JsonArray           jsonTopics      = topicsDoc.createNestedArray("topics");
+        JsonDocLease        topicsDocLease("TopicHandlerService::registerTopics", JSON_DOC_SIZE);
 
-        /* Get topics from plugin. */
-        plugin->getTopics(jsonTopics);
-
-        if (true == topicsDoc.overflowed())
+        if (false == topicsDocLease.isValid())
         {
-            LOG_ERROR("JSON document has less memory available.");
+            LOG_ERROR("No JSON document available for %s topics.", plugin->getName());
         }
-
-        /* Handle each topic */
-        if (0U < jsonTopics.size())
+        else
         {
-            for (JsonVariantConst jsonTopic : jsonTopics)
+            DynamicJsonDocument&    topicsDoc   = *topicsDocLease;
+            JsonArray               jsonTopics  = topicsDoc.createNestedArray("topics");
+
+            /* Get topics from plugin. */
+            plugin->getTopics(jsonTopics);
+
+            if (true == topicsDoc.overflowed())
+            {
+                LOG_ERROR("JSON document has less memory available.");
+            }
+
+            /* Handle each topic */
+            if (0U < jsonTopics.size())
             {
-                String                          topicName;
-                JsonObjectConst                 extra;
-                String                          topicAccess     = DEFAULT_ACCESS;
-                ITopicHandler::GetTopicFunc     getTopicFunc    = nullptr;
-                ITopicHandler::SetTopicFunc     setTopicFunc    = nullptr;
-                ITopicHandler::UploadReqFunc    uploadReqFunc   = nullptr;
-
-                /* Topic specific parameter available? */
-                if (true == jsonTopic.is<JsonObjectConst>())
+                for (JsonVariantConst jsonTopic : jsonTopics)
                 {
-                    JsonVariantConst    jsonTopicName   = jsonTopic["name"];
-                    JsonVariantConst    jsonTopicAccess = jsonTopic["access"];
+                    String                          topicName;
+                    JsonObjectConst                 extra;
+                    String                          topicAccess     = DEFAULT_ACCESS;
+                    ITopicHandler::GetTopicFunc     getTopicFunc    = nullptr;
+                    ITopicHandler::SetTopicFunc     setTopicFunc    = nullptr;
+                    ITopicHandler::UploadReqFunc    uploadReqFunc   = nullptr;
+
+                    /* Topic specific parameter available? */
+                    if (true == jsonTopic.is<JsonObjectConst>())
+                    {
+                        JsonVariantConst    jsonTopicName   = jsonTopic["name"];
+                        JsonVariantConst    jsonTopicAccess = jsonTopic["access"];
 
-                    if (true == jsonTopicName.is<String>())
+                        if (true == jsonTopicName.is<String>())
+                        {
+                            topicName = jsonTopicName.as<String>();
+                        }
+
+                        if (true == jsonTopicAccess.is<String>())
+                        {
+                            topicAccess = jsonTopicAccess.as<String>();
+                        }
+
+                        extra = jsonTopic;
+                    }
+                    /* Only topic name is available */
+                    else if (true == jsonTopic.is<String>())
                     {
-                        topicName = jsonTopicName.as<String>();
+                        topicName = jsonTopic.as<String>();
                     }
-
-                    if (true == jsonTopicAccess.is<String>())
+                    else
                     {
-                        topicAccess = jsonTopicAccess.as<String>();
+                        /* Skip */
+                        ;
                     }
 
-                    extra = jsonTopic;
-                }
-                /* Only topic name is available */
-                else if (true == jsonTopic.is<String>())
-                {
-                    topicName = jsonTopic.as<String>();
-                }
-                else
-                {
-                    /* Skip */
-                    ;
-                }
-
-                if (false == topicName.isEmpty())
-                {
-                    strToAccess(plugin, topicAccess, getTopicFunc, setTopicFunc, uploadReqFunc);
+                    if (false == topicName.isEmpty())
+                    {
+                        strToAccess(plugin, topicAccess, getTopicFunc, setTopicFunc, uploadReqFunc);
                     
-                    /* Register plugin topic with plugin UID as entity id. */
-                    registerTopic(deviceId, getEntityIdByPluginUid(plugin->getUID()), topicName, extra, getTopicFunc, nullptr, setTopicFunc, uploadReqFunc);
+                        /* Register plugin topic with plugin UID as entity id. */
+                        registerTopic(deviceId, getEntityIdByPluginUid(plugin->getUID()), topicName, extra, getTopicFunc, nullptr, setTopicFunc, uploadReqFunc);
 
-                    /* Register plugin topic with plugin alias as entity id (if possible). */
-                    if (false == plugin->getAlias().isEmpty())
-                    {
-                        registerTopic(deviceId, getEntityIdByPluginAlias(plugin->getAlias()), topicName, extra, getTopicFunc, nullptr, setTopicFunc, uploadReqFunc);
-                    }
+                        /* Register plugin topic with plugin alias as entity id (if possible). */
+                        if (false == plugin->getAlias().isEmpty())
+                        {
+                            registerTopic(deviceId, getEntityIdByPluginAlias(plugin->getAlias()), topicName, extra, getTopicFunc, nullptr, setTopicFunc, uploadReqFunc);
+                        }
 
-                    addToPluginMetaDataList(deviceId, plugin, topicName);
+                        addToPluginMetaDataList(deviceId, plugin, topicName);
+                    }
                 }
             }
         }
@@ -179,52 +189,61 @@ void TopicHandlerService::unregisterTopics(const String& deviceId, IPluginMainte
         (nullptr != plugin))
     {
         const size_t        JSON_DOC_SIZE   = 512U;
-        DynamicJsonDocument topicsDoc(JSON_DOC_SIZE);
-        JsonArray           jsonTopics      = topicsDoc.createNestedArray("topics");
-
-        /* Get topics from plugin. */
-        plugin->getTopics(jsonTopics);
+        JsonDocLease        topicsDocLease("TopicHandlerService::unregisterTopics", JSON_DOC_SIZE);
 
-        /* Handle each topic */
-        if (0U < jsonTopics.size())
+        if (false == topicsDocLease.isValid())
         {
-            for (JsonVariantConst jsonTopic : jsonTopics)
-            {
-                String topicName;
+            LOG_ERROR("No JSON document available for %s topics.", plugin->getName());
+        }
+        else
+        {
+            DynamicJsonDocument&    topicsDoc   = *topicsDocLease;
+            JsonArray               jsonTopics  = topicsDoc.createNestedArray("topics");
 
-                /* Topic specific parameter available? */
-                if (true == jsonTopic.is<JsonObjectConst>())
-                {
-                    JsonVariantConst jsonTopicName = jsonTopic["name"];
+            /* Get topics from plugin. */
+            plugin->getTopics(jsonTopics);
 
-                    if (true == jsonTopicName.is<String>())
-                    {
-                        topicName = jsonTopicName.as<String>();
-                    }
-                }
-                /* Only topic name is available */
-                else if (true == jsonTopic.is<String>())
-                {
-                    topicName = jsonTopic.as<String>();
-                }
-                else
+            /* Handle each topic */
+            if (0U < jsonTopics.size())
+            {
+                for (JsonVariantConst jsonTopic : jsonTopics)
                 {
-                    /* Skip */
-                    ;
-                }
+                    String topicName;
 
-                if (false == topicName.isEmpty())
-                {
-                    /* Unregister plugin topic with plugin UID as entity id. */
-                    unregisterTopic(deviceId, getEntityIdByPluginUid(plugin->getUID()), topicName);
+                    /* Topic specific parameter available? */
+                    if (true == jsonTopic.is<JsonObjectConst>())
+                    {
+                        JsonVariantConst jsonTopicName = jsonTopic["name"];
 
-                    /* Unregister plugin topic with plugin UID as entity id (if possible). */
-                    if (false == plugin->getAlias().isEmpty())
+                        if (true == jsonTopicName.is<String>())
+                        {
+                            topicName = jsonTopicName.as<String>();
+                        }
+                    }
+                    /* Only topic name is available */
+                    else if (true == jsonTopic.is<String>())
                     {
-                        unregisterTopic(deviceId, getEntityIdByPluginAlias(plugin->getAlias()), topicName);
+                        topicName = jsonTopic.as<String>();
                     }
+                    else
+                    {
+                        /* Skip */
+                        ;
+                    }
+
+                    if (false == topicName.isEmpty())
+                    {
+                        /* Unregister plugin topic with plugin UID as entity id. */
+                        unregisterTopic(deviceId, getEntityIdByPluginUid(plugin->getUID()), topicName);
 
-                    removeFromPluginMetaDataList(deviceId, plugin);
+                        /* Unregister plugin topic with plugin UID as entity id (if possible). */
+                        if (false == plugin->getAlias().isEmpty())
+                        {
+                            unregisterTopic(deviceId, getEntityIdByPluginAlias(plugin->getAlias()), topicName);
+                        }
+
+                        removeFromPluginMetaDataList(deviceId, plugin);
+                    }
                 }
             }
         }
@@ -386,7 +405,7 @@ void TopicHandlerService::addToTopicMetaDataList(const String& deviceId, const S
         (false == topic.isEmpty()) &&
         (nullptr != hasChangedFunc))
     {
-        TopicMetaData* topicMetaData = new(std::nothrow) TopicMetaData();
+        TopicMetaData* topicMetaData = m_topicMetaDataPool.create();
 
         if (nullptr != topicMetaData)
         {
@@ -415,7 +434,7 @@ void TopicHandlerService::removeFromTopicMetaDataList(const String& deviceId, co
         {
             topicMetaDataListIt = m_topicMetaDataList.erase(topicMetaDataListIt);
             
-            delete topicMetaData;
+            m_topicMetaDataPool.destroy(topicMetaData);
             topicMetaData = nullptr;
         }
         else
@@ -431,7 +450,7 @@ void TopicHandlerService::addToPluginMetaDataList(const String& deviceId, IPlugi
         (nullptr != plugin) &&
         (false == topic.isEmpty()))
     {
-        PluginMetaData* pluginMetaData = new(std::nothrow) PluginMetaData();
+        PluginMetaData* pluginMetaData = m_pluginMetaDataPool.create();
 
         if (nullptr != pluginMetaData)
         {
@@ -458,7 +477,7 @@ void TopicHandlerService::removeFromPluginMetaDataList(const String& deviceId, I
         {
             pluginMetaDataListIt = m_pluginMetaDataList.erase(pluginMetaDataListIt);
             
-            delete pluginMetaData;
+            m_pluginMetaDataPool.destroy(pluginMetaData);
             pluginMetaData = nullptr;
         }
         else
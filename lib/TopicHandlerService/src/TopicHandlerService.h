@@ -44,6 +44,8 @@
 #include <ITopicHandler.h>
 #include <IPluginMaintenance.hpp>
 #include <SimpleTimer.hpp>
+#include <ObjectPool.hpp>
+#include <CriticalSection.hpp>
 #include <vector>
 
 /******************************************************************************
@@ -194,8 +196,32 @@ private:
      */
     typedef std::vector<PluginMetaData*>    PluginMetaDataList;
 
+    /**
+     * Number of pooled topic meta data. If more are required, they will be
+     * allocated on the heap.
+     */
+    static const size_t     TOPIC_META_DATA_POOL_SIZE   = 32U;
+
+    /**
+     * Number of pooled plugin meta data. If more are required, they will be
+     * allocated on the heap.
+     */
+    static const size_t     PLUGIN_META_DATA_POOL_SIZE  = 16U;
+
+    /**
+     * Pool of topic meta data.
+     */
+    typedef ObjectPool<TopicMetaData, TOPIC_META_DATA_POOL_SIZE, CriticalSection>   TopicMetaDataPool;
+
+    /**
+     * Pool of plugin meta data.
+     */
+    typedef ObjectPool<PluginMetaData, PLUGIN_META_DATA_POOL_SIZE, CriticalSection> PluginMetaDataPool;
+
     TopicMetaDataList   m_topicMetaDataList;    /**< List of readable topics and the required meta data. */
     PluginMetaDataList  m_pluginMetaDataList;   /**< List of plugins, which topics are handled. */
+    TopicMetaDataPool   m_topicMetaDataPool;    /**< Pool of topic meta data */
+    PluginMetaDataPool  m_pluginMetaDataPool;   /**< Pool of plugin meta data */
     SimpleTimer         m_onChangeTimer;        /**< Timer for on change processing period. */
 
     /**
@@ -205,6 +231,8 @@ private:
         IService(),
         m_topicMetaDataList(),
         m_pluginMetaDataList(),
+        m_topicMetaDataPool("topic meta data"),
+        m_pluginMetaDataPool("plugin meta data"),
         m_onChangeTimer()
     {
     }
@@ -0,0 +1,274 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Heap allocation tracker
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "AllocTracker.h"
+
+#include <stdlib.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+#if (0 != CONFIG_ALLOC_TRACKER_ENABLE)
+
+void* AllocTracker::allocate(Tag tag, size_t size)
+{
+    void* ptr = nullptr;
+
+    if (TAG_COUNT > tag)
+    {
+        Counters&   counters    = m_counters[tag];
+        Header*     header      = static_cast<Header*>(malloc(sizeof(Header) + size));
+
+        if (nullptr == header)
+        {
+            (void)counters.failures.fetch_add(1U, std::memory_order_relaxed);
+        }
+        else
+        {
+            uint32_t allocations = counters.allocations.fetch_add(1U, std::memory_order_relaxed);
+
+            header->size        = size;
+            header->tag         = tag;
+            header->isSampled   = (0U == (allocations % SAMPLE_RATE)) ? 1U : 0U;
+
+            (void)counters.liveBlocks.fetch_add(1U, std::memory_order_relaxed);
+
+            if (0U != header->isSampled)
+            {
+                addBytes(counters, size * SAMPLE_RATE);
+            }
+
+            ptr = &header[1];
+        }
+    }
+
+    return ptr;
+}
+
+void AllocTracker::release(void* ptr)
+{
+    if (nullptr != ptr)
+    {
+        Header* header = &static_cast<Header*>(ptr)[-1];
+
+        if (TAG_COUNT > header->tag)
+        {
+            Counters& counters = m_counters[header->tag];
+
+            (void)counters.liveBlocks.fetch_sub(1U, std::memory_order_relaxed);
+
+            if (0U != header->isSampled)
+            {
+                (void)counters.liveBytes.fetch_sub(header->size * SAMPLE_RATE, std::memory_order_relaxed);
+            }
+        }
+
+        free(header);
+    }
+}
+
+size_t AllocTracker::getSize(const void* ptr)
+{
+    size_t size = 0U;
+
+    if (nullptr != ptr)
+    {
+        size = static_cast<const Header*>(ptr)[-1].size;
+    }
+
+    return size;
+}
+
+void AllocTracker::notifyAllocation(Tag tag, size_t size)
+{
+    if (TAG_COUNT > tag)
+    {
+        Counters& counters = m_counters[tag];
+
+        (void)counters.allocations.fetch_add(1U, std::memory_order_relaxed);
+        (void)counters.liveBlocks.fetch_add(1U, std::memory_order_relaxed);
+        addBytes(counters, size);
+    }
+}
+
+void AllocTracker::notifyFailure(Tag tag)
+{
+    if (TAG_COUNT > tag)
+    {
+        (void)m_counters[tag].failures.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+void AllocTracker::notifyRelease(Tag tag, size_t size)
+{
+    if (TAG_COUNT > tag)
+    {
+        Counters& counters = m_counters[tag];
+
+        (void)counters.liveBlocks.fetch_sub(1U, std::memory_order_relaxed);
+        (void)counters.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+}
+
+bool AllocTracker::getStatistics(Tag tag, Statistics& stats) const
+{
+    bool isSuccessful = false;
+
+    if (TAG_COUNT > tag)
+    {
+        const Counters& counters = m_counters[tag];
+
+        stats.liveBytes     = counters.liveBytes.load(std::memory_order_relaxed);
+        stats.peakBytes     = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.liveBlocks    = counters.liveBlocks.load(std::memory_order_relaxed);
+        stats.allocations   = counters.allocations.load(std::memory_order_relaxed);
+        stats.failures      = counters.failures.load(std::memory_order_relaxed);
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+#endif  /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+
+const char* AllocTracker::tagToStr(Tag tag)
+{
+    const char* str = "unknown";
+
+    switch(tag)
+    {
+    case TAG_GFX:
+        str = "gfx";
+        break;
+
+    case TAG_HTTP:
+        str = "http";
+        break;
+
+    case TAG_JSON:
+        str = "json";
+        break;
+
+    case TAG_MQTT:
+        str = "mqtt";
+        break;
+
+    case TAG_PLUGIN:
+        str = "plugin";
+        break;
+
+    default:
+        break;
+    }
+
+    return str;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+#if (0 != CONFIG_ALLOC_TRACKER_ENABLE)
+
+AllocTracker::AllocTracker() :
+    m_counters()
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < TAG_COUNT; ++idx)
+    {
+        m_counters[idx].liveBytes.store(0U, std::memory_order_relaxed);
+        m_counters[idx].peakBytes.store(0U, std::memory_order_relaxed);
+        m_counters[idx].liveBlocks.store(0U, std::memory_order_relaxed);
+        m_counters[idx].allocations.store(0U, std::memory_order_relaxed);
+        m_counters[idx].failures.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void AllocTracker::addBytes(Counters& counters, uint32_t size)
+{
+    uint32_t liveBytes  = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint32_t peakBytes  = counters.peakBytes.load(std::memory_order_relaxed);
+
+    /* If a different task updated the peak in the meantime,
+     * the compare fails and the peak is compared again.
+     */
+    while((peakBytes < liveBytes) &&
+          (false == counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed)))
+    {
+        ;
+    }
+}
+
+#else   /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+
+AllocTracker::AllocTracker()
+{
+}
+
+#endif  /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,463 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Heap allocation tracker
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_ALLOC_TRACKER_ENABLE
+
+/**
+ * Enable (1) or disable (0) the allocation tracker. If disabled, the tracker
+ * allocates directly from the heap, without header and without recording
+ * anything. No statistics are available then.
+ */
+#define CONFIG_ALLOC_TRACKER_ENABLE         (1)
+
+#endif  /* CONFIG_ALLOC_TRACKER_ENABLE */
+
+#ifndef CONFIG_ALLOC_TRACKER_SAMPLE_RATE
+
+/**
+ * Every n-th allocation per tag is considered for the byte statistics.
+ * With 1 every allocation is considered and the statistics are exact.
+ */
+#define CONFIG_ALLOC_TRACKER_SAMPLE_RATE    (1U)
+
+#endif  /* CONFIG_ALLOC_TRACKER_SAMPLE_RATE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <new>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The allocation tracker records the heap usage per subsystem (tag). Every
+ * tracked allocation gets a small header in front of the user memory, which
+ * contains the size and the tag. This way a release needs no further
+ * information and the live bytes are known per tag.
+ *
+ * All counters are lock-free, therefore the tracker can be used from any task.
+ *
+ * To keep the overhead low in the release build, only every n-th allocation
+ * (see CONFIG_ALLOC_TRACKER_SAMPLE_RATE) is considered for the live and peak
+ * bytes. Its size is weighted with the sample rate, which results in an
+ * estimation. The number of allocations, live blocks and failures are always
+ * exact.
+ *
+ * If the tracker is disabled (see CONFIG_ALLOC_TRACKER_ENABLE), it is compiled
+ * out completely and all methods are thin inline wrappers around the heap.
+ */
+class AllocTracker
+{
+public:
+
+    /**
+     * Tags of the tracked subsystems.
+     */
+    enum Tag
+    {
+        TAG_GFX = 0,    /**< Graphic buffers */
+        TAG_HTTP,       /**< HTTP client */
+        TAG_JSON,       /**< JSON documents */
+        TAG_MQTT,       /**< MQTT service */
+        TAG_PLUGIN,     /**< Plugin instances */
+        TAG_COUNT       /**< Number of tags */
+    };
+
+    /**
+     * Allocation statistics of a tag.
+     */
+    struct Statistics
+    {
+        uint32_t    liveBytes;      /**< Currently allocated bytes */
+        uint32_t    peakBytes;      /**< Max. allocated bytes at the same time */
+        uint32_t    liveBlocks;     /**< Number of currently allocated blocks */
+        uint32_t    allocations;    /**< Number of allocations since startup */
+        uint32_t    failures;       /**< Number of failed allocations since startup */
+
+        /**
+         * Initializes empty statistics.
+         */
+        Statistics() :
+            liveBytes(0U),
+            peakBytes(0U),
+            liveBlocks(0U),
+            allocations(0U),
+            failures(0U)
+        {
+        }
+    };
+
+    /**
+     * Get allocation tracker instance.
+     *
+     * @return Allocation tracker instance
+     */
+    static AllocTracker& getInstance()
+    {
+        static AllocTracker instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Allocate memory on the heap and track it with the given tag.
+     * Release it only with release()!
+     *
+     * @param[in] tag   Tag of the allocating subsystem
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    void* allocate(Tag tag, size_t size);
+
+    /**
+     * Release memory, which was allocated with allocate() before.
+     *
+     * @param[in] ptr   Memory, may be nullptr.
+     */
+    void release(void* ptr);
+
+#if (0 != CONFIG_ALLOC_TRACKER_ENABLE)
+
+    /**
+     * Get the size of memory, which was allocated with allocate() before.
+     *
+     * @param[in] ptr   Memory, may be nullptr.
+     *
+     * @return Size in byte
+     */
+    static size_t getSize(const void* ptr);
+
+#endif  /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+
+    /**
+     * Allocate an array on the heap and track it with the given tag.
+     * The elements are default initialized, like with new[].
+     * Release it only with deleteArray()!
+     *
+     * @tparam T    Element type
+     *
+     * @param[in] tag   Tag of the allocating subsystem
+     * @param[in] count Number of elements
+     *
+     * @return If successful, it will return the array otherwise nullptr.
+     */
+    template < typename T >
+    T* newArray(Tag tag, size_t count)
+    {
+#if (0 != CONFIG_ALLOC_TRACKER_ENABLE)
+        T* array = static_cast<T*>(allocate(tag, count * sizeof(T)));
+
+        if (nullptr != array)
+        {
+            size_t idx = 0U;
+
+            for(idx = 0U; idx < count; ++idx)
+            {
+                (void)::new(&array[idx]) T;
+            }
+        }
+#else   /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+        T* array = new(std::nothrow) T[count];
+
+        (void)tag;
+#endif  /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+
+        return array;
+    }
+
+    /**
+     * Destroy an array, which was allocated with newArray() before.
+     *
+     * @tparam T    Element type
+     *
+     * @param[in] array Array, may be nullptr.
+     */
+    template < typename T >
+    void deleteArray(T* array)
+    {
+#if (0 != CONFIG_ALLOC_TRACKER_ENABLE)
+        if (nullptr != array)
+        {
+            size_t count    = getSize(array) / sizeof(T);
+            size_t idx      = 0U;
+
+            for(idx = 0U; idx < count; ++idx)
+            {
+                array[idx].~T();
+            }
+
+            release(array);
+        }
+#else   /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+        delete[] array;
+#endif  /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+    }
+
+    /**
+     * Notify about a heap allocation, which was not done by the tracker.
+     * Use it for memory, which is allocated by third party code.
+     * It is always considered for the byte statistics.
+     *
+     * @param[in] tag   Tag of the allocating subsystem
+     * @param[in] size  Size in byte
+     */
+    void notifyAllocation(Tag tag, size_t size);
+
+    /**
+     * Notify about a failed heap allocation, which was not done by the tracker.
+     *
+     * @param[in] tag   Tag of the allocating subsystem
+     */
+    void notifyFailure(Tag tag);
+
+    /**
+     * Notify about a heap release, which was not done by the tracker.
+     * It must correspond to a notifyAllocation() call.
+     *
+     * @param[in] tag   Tag of the allocating subsystem
+     * @param[in] size  Size in byte
+     */
+    void notifyRelease(Tag tag, size_t size);
+
+    /**
+     * Get the allocation statistics of a tag.
+     *
+     * @param[in]   tag     Tag of the subsystem
+     * @param[out]  stats   Allocation statistics
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool getStatistics(Tag tag, Statistics& stats) const;
+
+    /**
+     * Get the tag as user friendly string.
+     *
+     * @param[in] tag   Tag of the subsystem
+     *
+     * @return Tag name
+     */
+    static const char* tagToStr(Tag tag);
+
+    /** Is the allocation tracker enabled? */
+    static const bool       IS_ENABLED  = (0 != CONFIG_ALLOC_TRACKER_ENABLE);
+
+    /** Every n-th allocation per tag is considered for the byte statistics. */
+    static const uint32_t   SAMPLE_RATE = CONFIG_ALLOC_TRACKER_SAMPLE_RATE;
+
+private:
+
+#if (0 != CONFIG_ALLOC_TRACKER_ENABLE)
+
+    /**
+     * Header in front of every tracked allocation. Its size is a multiple of
+     * 8 byte, to keep the alignment of the user memory.
+     */
+    struct Header
+    {
+        uint32_t    size;       /**< Size of the user memory in byte */
+        uint16_t    tag;        /**< Tag of the allocating subsystem */
+        uint16_t    isSampled;  /**< Is allocation considered in the byte statistics? */
+    };
+
+    /**
+     * Lock-free counters of a tag.
+     */
+    struct Counters
+    {
+        std::atomic<uint32_t>   liveBytes;      /**< Currently allocated bytes */
+        std::atomic<uint32_t>   peakBytes;      /**< Max. allocated bytes at the same time */
+        std::atomic<uint32_t>   liveBlocks;     /**< Number of currently allocated blocks */
+        std::atomic<uint32_t>   allocations;    /**< Number of allocations */
+        std::atomic<uint32_t>   failures;       /**< Number of failed allocations */
+    };
+
+    Counters    m_counters[TAG_COUNT];  /**< Counters per tag */
+
+#endif  /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+
+    /**
+     * Constructs the allocation tracker.
+     */
+    AllocTracker();
+
+    /**
+     * Destroys the allocation tracker.
+     */
+    ~AllocTracker()
+    {
+        /* Will never be called. */
+    }
+
+    AllocTracker(const AllocTracker& tracker);
+    AllocTracker& operator=(const AllocTracker& tracker);
+
+#if (0 != CONFIG_ALLOC_TRACKER_ENABLE)
+
+    /**
+     * Add bytes to the live bytes and update the peak.
+     *
+     * @param[in] counters  Counters of the tag
+     * @param[in] size      Size in byte
+     */
+    void addBytes(Counters& counters, uint32_t size);
+
+#endif  /* (0 != CONFIG_ALLOC_TRACKER_ENABLE) */
+};
+
+#if (0 == CONFIG_ALLOC_TRACKER_ENABLE)
+
+inline void* AllocTracker::allocate(Tag tag, size_t size)
+{
+    (void)tag;
+
+    return ::operator new(size, std::nothrow);
+}
+
+inline void AllocTracker::release(void* ptr)
+{
+    ::operator delete(ptr);
+}
+
+inline void AllocTracker::notifyAllocation(Tag tag, size_t size)
+{
+    (void)tag;
+    (void)size;
+}
+
+inline void AllocTracker::notifyFailure(Tag tag)
+{
+    (void)tag;
+}
+
+inline void AllocTracker::notifyRelease(Tag tag, size_t size)
+{
+    (void)tag;
+    (void)size;
+}
+
+inline bool AllocTracker::getStatistics(Tag tag, Statistics& stats) const
+{
+    (void)tag;
+    (void)stats;
+
+    return false;
+}
+
+#endif  /* (0 == CONFIG_ALLOC_TRACKER_ENABLE) */
+
+/**
+ * Derive from it to track all instances of a class with the given tag.
+ * The instances shall be created with new(std::nothrow), like everywhere.
+ *
+ * @tparam TAG  Tag of the subsystem
+ */
+template < AllocTracker::Tag TAG >
+class AllocTracked
+{
+public:
+
+    /**
+     * Allocate memory for an instance.
+     *
+     * @param[in] size  Size of the instance in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    static void* operator new(size_t size, const std::nothrow_t&) noexcept
+    {
+        return AllocTracker::getInstance().allocate(TAG, size);
+    }
+
+    /**
+     * Release the memory of an instance.
+     *
+     * @param[in] ptr   Memory of the instance
+     */
+    static void operator delete(void* ptr) noexcept
+    {
+        AllocTracker::getInstance().release(ptr);
+    }
+
+    /**
+     * Release the memory of an instance, whose construction failed.
+     *
+     * @param[in] ptr   Memory of the instance
+     */
+    static void operator delete(void* ptr, const std::nothrow_t&) noexcept
+    {
+        AllocTracker::getInstance().release(ptr);
+    }
+
+protected:
+
+    /**
+     * Constructs the tracked instance.
+     */
+    AllocTracked()
+    {
+    }
+
+    /**
+     * Destroys the tracked instance.
+     */
+    ~AllocTracked()
+    {
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* ALLOC_TRACKER_H */
+
+/** @} */
@@ -0,0 +1,123 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  LED output color pipeline
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ColorPipeline.h"
+
+#include <math.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize dither pattern. */
+const uint8_t ColorPipeline::DITHER_PATTERN[1U << FRACTION_BITS] =
+{
+    0U, 8U, 4U, 12U, 2U, 10U, 6U, 14U, 1U, 9U, 5U, 13U, 3U, 11U, 7U, 15U
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void ColorPipeline::setCalibration(float gamma, uint8_t red, uint8_t green, uint8_t blue)
+{
+    if ((gamma != m_gamma) ||
+        (red != m_whiteBalance[CHANNEL_RED]) ||
+        (green != m_whiteBalance[CHANNEL_GREEN]) ||
+        (blue != m_whiteBalance[CHANNEL_BLUE]))
+    {
+        m_gamma                         = gamma;
+        m_whiteBalance[CHANNEL_RED]     = red;
+        m_whiteBalance[CHANNEL_GREEN]   = green;
+        m_whiteBalance[CHANNEL_BLUE]    = blue;
+
+        rebuild();
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void ColorPipeline::rebuild()
+{
+    const float MAX_VALUE   = static_cast<float>(PRECISE_VALUE_MAX);
+    uint16_t    value       = 0U;
+    uint8_t     channel     = 0U;
+
+    for(value = 0U; value <= UINT8_MAX; ++value)
+    {
+        float corrected = static_cast<float>(value) / UINT8_MAX;
+
+        if (1.0F != m_gamma)
+        {
+            corrected = powf(corrected, m_gamma);
+        }
+
+        corrected *= MAX_VALUE;
+
+        for(channel = 0U; channel < CHANNEL_MAX; ++channel)
+        {
+            m_lut[channel][value] = static_cast<uint16_t>((corrected * m_whiteBalance[channel] / UINT8_MAX) + 0.5F);
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,232 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  LED output color pipeline
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef COLOR_PIPELINE_H
+#define COLOR_PIPELINE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The color pipeline converts the framebuffer colors to the LED output
+ * colors. Gamma correction and white balance are combined in one lookup
+ * table per color channel with 12 bit precision. The lookup tables don't
+ * depend on the luminance and are only rebuilt, if the calibration changes.
+ * The luminance is applied as integer scale factor, therefore changing it
+ * every frame is cheap.
+ *
+ * The additional 4 bit are not lost, they are distributed over 16 frames by
+ * temporal dithering. This way low brightness levels are shown smooth instead
+ * of in visible steps.
+ */
+class ColorPipeline
+{
+public:
+
+    /**
+     * Constructs the color pipeline without gamma correction, with neutral
+     * white balance and full luminance.
+     */
+    ColorPipeline() :
+        m_lut(),
+        m_gamma(1.0F),
+        m_whiteBalance{ UINT8_MAX, UINT8_MAX, UINT8_MAX },
+        m_luminance(UINT8_MAX),
+        m_scale(LUMINANCE_SCALE_MAX),
+        m_frame(0U)
+    {
+        rebuild();
+    }
+
+    /**
+     * Destroys the color pipeline.
+     */
+    ~ColorPipeline()
+    {
+    }
+
+    /**
+     * Set the calibration of the LEDs.
+     *
+     * @param[in] gamma Gamma value, e.g. 2.2. A value of 1 disables the gamma correction.
+     * @param[in] red   White balance factor of the red channel [0; 255]
+     * @param[in] green White balance factor of the green channel [0; 255]
+     * @param[in] blue  White balance factor of the blue channel [0; 255]
+     */
+    void setCalibration(float gamma, uint8_t red, uint8_t green, uint8_t blue);
+
+    /**
+     * Set the luminance.
+     *
+     * @param[in] luminance Luminance [0; 255]
+     */
+    void setLuminance(uint8_t luminance)
+    {
+        m_luminance = luminance;
+        m_scale     = (static_cast<uint32_t>(luminance) * LUMINANCE_SCALE_MAX) / UINT8_MAX;
+    }
+
+    /**
+     * Get the luminance.
+     *
+     * @return Luminance [0; 255]
+     */
+    uint8_t getLuminance() const
+    {
+        return m_luminance;
+    }
+
+    /**
+     * Start a new frame. Call it once before the pixels of a frame are converted.
+     */
+    void beginFrame()
+    {
+        ++m_frame;
+    }
+
+    /**
+     * Convert a single pixel to its output color.
+     *
+     * @param[in]       index   Index of the pixel, used to spread the dithering spatial.
+     * @param[in,out]   red     Red channel
+     * @param[in,out]   green   Green channel
+     * @param[in,out]   blue    Blue channel
+     */
+    void apply(uint32_t index, uint8_t& red, uint8_t& green, uint8_t& blue) const
+    {
+        const uint16_t THRESHOLD = DITHER_PATTERN[(m_frame + index) & DITHER_MASK];
+
+        red     = static_cast<uint8_t>((scale(m_lut[CHANNEL_RED][red]) + THRESHOLD) >> FRACTION_BITS);
+        green   = static_cast<uint8_t>((scale(m_lut[CHANNEL_GREEN][green]) + THRESHOLD) >> FRACTION_BITS);
+        blue    = static_cast<uint8_t>((scale(m_lut[CHANNEL_BLUE][blue]) + THRESHOLD) >> FRACTION_BITS);
+    }
+
+    /**
+     * Get the gamma corrected and white balanced value of a color channel
+     * with internal precision. The luminance is not applied.
+     *
+     * @param[in] channel   Channel index (0: red, 1: green, 2: blue)
+     * @param[in] value     Channel value [0; 255]
+     *
+     * @return Value with 12 bit precision [0; 4080]
+     */
+    uint16_t getPreciseValue(uint8_t channel, uint8_t value) const
+    {
+        return (CHANNEL_MAX > channel) ? m_lut[channel][value] : 0U;
+    }
+
+    /** Color channel index. */
+    enum Channel
+    {
+        CHANNEL_RED = 0,    /**< Red */
+        CHANNEL_GREEN,      /**< Green */
+        CHANNEL_BLUE,       /**< Blue */
+        CHANNEL_MAX         /**< Number of channels */
+    };
+
+    /** Number of additional fraction bits of the internal precision. */
+    static const uint8_t    FRACTION_BITS       = 4U;
+
+    /** Max. value with internal precision, which results in 255 after dithering. */
+    static const uint16_t   PRECISE_VALUE_MAX   = static_cast<uint16_t>(UINT8_MAX) << FRACTION_BITS;
+
+private:
+
+    /** Number of fraction bits of the luminance scale factor. */
+    static const uint8_t    LUMINANCE_SCALE_BITS    = 16U;
+
+    /** Luminance scale factor of full luminance. */
+    static const uint32_t   LUMINANCE_SCALE_MAX     = 1UL << LUMINANCE_SCALE_BITS;
+
+    /** Mask to select the dither threshold. */
+    static const uint8_t    DITHER_MASK     = (1U << FRACTION_BITS) - 1U;
+
+    /**
+     * Dither thresholds in bit-reversed order. It distributes the on frames
+     * of a fraction as evenly as possible over time.
+     */
+    static const uint8_t    DITHER_PATTERN[1U << FRACTION_BITS];
+
+    uint16_t    m_lut[CHANNEL_MAX][UINT8_MAX + 1U]; /**< Gamma and white balance lookup table per channel with 12 bit precision */
+    float       m_gamma;                            /**< Gamma value */
+    uint8_t     m_whiteBalance[CHANNEL_MAX];        /**< White balance factor per channel */
+    uint8_t     m_luminance;                        /**< Luminance */
+    uint32_t    m_scale;                            /**< Luminance scale factor with 16 fraction bits */
+    uint8_t     m_frame;                            /**< Frame counter, used for temporal dithering */
+
+    ColorPipeline(const ColorPipeline& pipeline);
+    ColorPipeline& operator=(const ColorPipeline& pipeline);
+
+    /**
+     * Apply the luminance to a value with internal precision.
+     *
+     * @param[in] value Value with 12 bit precision [0; 4080]
+     *
+     * @return Value with luminance applied [0; 4080]
+     */
+    uint16_t scale(uint16_t value) const
+    {
+        const uint32_t HALF = LUMINANCE_SCALE_MAX >> 1U;
+
+        return static_cast<uint16_t>(((value * m_scale) + HALF) >> LUMINANCE_SCALE_BITS);
+    }
+
+    /**
+     * Rebuild the lookup tables.
+     */
+    void rebuild();
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* COLOR_PIPELINE_H */
+
+/** @} */
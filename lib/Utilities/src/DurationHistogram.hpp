@@ -0,0 +1,229 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Duration histogram
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef DURATION_HISTOGRAM_HPP
+#define DURATION_HISTOGRAM_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <atomic>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A histogram of durations in us with logarithmic buckets. The first bucket
+ * contains all durations below 250 us, every following bucket doubles the
+ * limit and the last bucket contains all remaining durations.
+ *
+ * All counters are lock-free, therefore a duration can be recorded from
+ * any task without blocking it. The counters are never reset implicit and
+ * wrap around. A reader shall calculate the difference between two
+ * snapshots to get e.g. the average duration in between.
+ */
+class DurationHistogram
+{
+public:
+
+    /** Number of buckets */
+    static const uint8_t    BUCKET_COUNT        = 9U;
+
+    /** Upper limit in us of the first bucket (exclusive). */
+    static const uint32_t   FIRST_BUCKET_LIMIT  = 250U;
+
+    /**
+     * Constructs the duration histogram with all counters cleared.
+     */
+    DurationHistogram() :
+        m_buckets(),
+        m_count(0U),
+        m_sum(0U),
+        m_max(0U)
+    {
+        reset();
+    }
+
+    /**
+     * Destroys the duration histogram.
+     */
+    ~DurationHistogram()
+    {
+    }
+
+    /**
+     * Record a duration.
+     *
+     * @param[in] duration  Duration in us
+     */
+    void record(uint32_t duration)
+    {
+        uint8_t     idx = 0U;
+        uint32_t    max = m_max.load(std::memory_order_relaxed);
+
+        while(((BUCKET_COUNT - 1U) > idx) && (getBucketLimit(idx) <= duration))
+        {
+            ++idx;
+        }
+
+        (void)m_buckets[idx].fetch_add(1U, std::memory_order_relaxed);
+        (void)m_count.fetch_add(1U, std::memory_order_relaxed);
+        (void)m_sum.fetch_add(duration, std::memory_order_relaxed);
+
+        /* If a different task updated the max. value in the meantime,
+         * the compare fails and the max. value is compared again.
+         */
+        while((max < duration) &&
+              (false == m_max.compare_exchange_weak(max, duration, std::memory_order_relaxed)))
+        {
+            ;
+        }
+    }
+
+    /**
+     * Clear all counters.
+     */
+    void reset()
+    {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < BUCKET_COUNT; ++idx)
+        {
+            m_buckets[idx].store(0U, std::memory_order_relaxed);
+        }
+
+        m_count.store(0U, std::memory_order_relaxed);
+        m_sum.store(0U, std::memory_order_relaxed);
+        m_max.store(0U, std::memory_order_relaxed);
+    }
+
+    /**
+     * Get number of recorded durations in the given bucket.
+     *
+     * @param[in] idx   Bucket index
+     *
+     * @return Number of recorded durations. If the bucket index is invalid, it will return 0.
+     */
+    uint32_t getBucket(uint8_t idx) const
+    {
+        uint32_t count = 0U;
+
+        if (BUCKET_COUNT > idx)
+        {
+            count = m_buckets[idx].load(std::memory_order_relaxed);
+        }
+
+        return count;
+    }
+
+    /**
+     * Get number of all recorded durations.
+     *
+     * @return Number of recorded durations
+     */
+    uint32_t getCount() const
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get sum of all recorded durations in us.
+     * Note, it wraps around after about 71 minutes of summed up durations.
+     *
+     * @return Sum of recorded durations in us
+     */
+    uint32_t getSum() const
+    {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get max. recorded duration in us.
+     *
+     * @return Max. duration in us
+     */
+    uint32_t getMax() const
+    {
+        return m_max.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the upper limit in us (exclusive) of the given bucket.
+     * The last bucket has no upper limit, it will return UINT32_MAX.
+     *
+     * @param[in] idx   Bucket index
+     *
+     * @return Upper limit in us
+     */
+    static uint32_t getBucketLimit(uint8_t idx)
+    {
+        uint32_t limit = UINT32_MAX;
+
+        if ((BUCKET_COUNT - 1U) > idx)
+        {
+            limit = FIRST_BUCKET_LIMIT << idx;
+        }
+
+        return limit;
+    }
+
+private:
+
+    std::atomic<uint32_t>   m_buckets[BUCKET_COUNT];    /**< Number of recorded durations per bucket */
+    std::atomic<uint32_t>   m_count;                    /**< Number of all recorded durations */
+    std::atomic<uint32_t>   m_sum;                      /**< Sum of all recorded durations in us */
+    std::atomic<uint32_t>   m_max;                      /**< Max. recorded duration in us */
+
+    DurationHistogram(const DurationHistogram& histogram);
+    DurationHistogram& operator=(const DurationHistogram& histogram);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* DURATION_HISTOGRAM_HPP */
+
+/** @} */
@@ -0,0 +1,187 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Easing curves
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Easing.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint32_t square(uint32_t progress);
+static uint32_t cube(uint32_t progress);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+extern uint16_t Easing::getProgress(uint32_t elapsed, uint32_t duration)
+{
+    uint16_t progress = PROGRESS_ONE;
+
+    if (elapsed < duration)
+    {
+        progress = static_cast<uint16_t>((static_cast<uint64_t>(elapsed) << PROGRESS_SHIFT) / duration);
+    }
+
+    return progress;
+}
+
+extern uint16_t Easing::apply(Curve curve, uint16_t progress)
+{
+    uint32_t p       = progress;
+    uint32_t result  = 0U;
+
+    if (PROGRESS_ONE < p)
+    {
+        p = PROGRESS_ONE;
+    }
+
+    switch(curve)
+    {
+    case CURVE_IN_QUAD:
+        result = square(p);
+        break;
+
+    case CURVE_OUT_QUAD:
+        result = PROGRESS_ONE - square(PROGRESS_ONE - p);
+        break;
+
+    case CURVE_IN_OUT_QUAD:
+        if (PROGRESS_HALF > p)
+        {
+            result = 2U * square(p);
+        }
+        else
+        {
+            result = PROGRESS_ONE - (2U * square(PROGRESS_ONE - p));
+        }
+        break;
+
+    case CURVE_IN_CUBIC:
+        result = cube(p);
+        break;
+
+    case CURVE_OUT_CUBIC:
+        result = PROGRESS_ONE - cube(PROGRESS_ONE - p);
+        break;
+
+    case CURVE_IN_OUT_CUBIC:
+        if (PROGRESS_HALF > p)
+        {
+            result = 4U * cube(p);
+        }
+        else
+        {
+            result = PROGRESS_ONE - (4U * cube(PROGRESS_ONE - p));
+        }
+        break;
+
+    case CURVE_SMOOTH:
+        /* p^2 * (3 - 2p) */
+        result = (square(p) * ((3U * PROGRESS_ONE) - (2U * p))) >> PROGRESS_SHIFT;
+        break;
+
+    case CURVE_LINEAR:
+        /* fallthrough */
+    default:
+        result = p;
+        break;
+    }
+
+    return static_cast<uint16_t>(result);
+}
+
+extern int32_t Easing::interpolate(int32_t from, int32_t to, uint16_t progress)
+{
+    int64_t delta = static_cast<int64_t>(to) - from;
+
+    /* Rounded to the nearest value. */
+    return from + static_cast<int32_t>(((delta * progress) + PROGRESS_HALF) >> PROGRESS_SHIFT);
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Square the progress.
+ *
+ * @param[in] progress  Progress [0; PROGRESS_ONE]
+ *
+ * @return Squared progress [0; PROGRESS_ONE]
+ */
+static uint32_t square(uint32_t progress)
+{
+    return (progress * progress) >> Easing::PROGRESS_SHIFT;
+}
+
+/**
+ * Cube the progress.
+ *
+ * @param[in] progress  Progress [0; PROGRESS_ONE]
+ *
+ * @return Cubed progress [0; PROGRESS_ONE]
+ */
+static uint32_t cube(uint32_t progress)
+{
+    return (square(progress) * progress) >> Easing::PROGRESS_SHIFT;
+}
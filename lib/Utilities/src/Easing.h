@@ -0,0 +1,129 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Easing curves
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef EASING_H
+#define EASING_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Easing curves map the linear progress of an animation to the eased
+ * progress. The progress is a fixed-point value with PROGRESS_SHIFT
+ * fractional bits, where 0 is the begin and PROGRESS_ONE the end of the
+ * animation. Only integer maths is used, no floating point.
+ */
+namespace Easing
+{
+
+/** Number of fractional bits of the progress. */
+static const uint8_t    PROGRESS_SHIFT  = 12U;
+
+/** Progress at the end of an animation. */
+static const uint16_t   PROGRESS_ONE    = 1U << PROGRESS_SHIFT;
+
+/** Progress at the half of an animation. */
+static const uint16_t   PROGRESS_HALF   = PROGRESS_ONE / 2U;
+
+/**
+ * Easing curves.
+ */
+enum Curve
+{
+    CURVE_LINEAR = 0,   /**< Constant speed */
+    CURVE_IN_QUAD,      /**< Accelerate quadratic */
+    CURVE_OUT_QUAD,     /**< Decelerate quadratic */
+    CURVE_IN_OUT_QUAD,  /**< Accelerate and decelerate quadratic */
+    CURVE_IN_CUBIC,     /**< Accelerate cubic */
+    CURVE_OUT_CUBIC,    /**< Decelerate cubic */
+    CURVE_IN_OUT_CUBIC, /**< Accelerate and decelerate cubic */
+    CURVE_SMOOTH        /**< Smoothstep, accelerate and decelerate */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Get the linear progress of an animation.
+ *
+ * @param[in] elapsed   Elapsed time since the animation start in ms
+ * @param[in] duration  Animation duration in ms
+ *
+ * @return Progress [0; PROGRESS_ONE]
+ */
+extern uint16_t getProgress(uint32_t elapsed, uint32_t duration);
+
+/**
+ * Apply an easing curve to the linear progress.
+ * A progress greater than PROGRESS_ONE is limited.
+ *
+ * @param[in] curve     Easing curve
+ * @param[in] progress  Linear progress [0; PROGRESS_ONE]
+ *
+ * @return Eased progress [0; PROGRESS_ONE]
+ */
+extern uint16_t apply(Curve curve, uint16_t progress);
+
+/**
+ * Interpolate between two values.
+ *
+ * @param[in] from      Value at progress 0
+ * @param[in] to        Value at progress PROGRESS_ONE
+ * @param[in] progress  Progress [0; PROGRESS_ONE]
+ *
+ * @return Interpolated value
+ */
+extern int32_t interpolate(int32_t from, int32_t to, uint16_t progress);
+
+}
+
+#endif  /* EASING_H */
+
+/** @} */
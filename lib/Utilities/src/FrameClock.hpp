@@ -0,0 +1,306 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Global frame clock
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef FRAME_CLOCK_HPP
+#define FRAME_CLOCK_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Arduino.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The frame clock is sampled once per frame, before the display content is
+ * updated. All animations of a frame use the same frame time, which makes
+ * their motion independent of the frame rate and consistent to each other.
+ *
+ * The time between two frames is limited, so a long blocking (e.g. flash
+ * write cycles) doesn't lead to a jump of all animations.
+ */
+class FrameClock
+{
+public:
+
+    /**
+     * Get the frame clock instance.
+     *
+     * @return Frame clock
+     */
+    static FrameClock& getInstance()
+    {
+        static FrameClock instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Sample the clock at the begin of a frame.
+     */
+    void tick()
+    {
+        tick(millis());
+    }
+
+    /**
+     * Sample the clock at the begin of a frame with the given timestamp.
+     *
+     * @param[in] timestamp Timestamp in ms
+     */
+    void tick(uint32_t timestamp)
+    {
+        if (false == m_isStarted)
+        {
+            m_delta     = 0U;
+            m_isStarted = true;
+        }
+        else
+        {
+            m_delta = timestamp - m_timestamp;
+
+            if (MAX_DELTA < m_delta)
+            {
+                m_delta = MAX_DELTA;
+            }
+        }
+
+        m_timestamp = timestamp;
+        m_time     += m_delta;
+    }
+
+    /**
+     * Get the frame time.
+     *
+     * @return Frame time in ms
+     */
+    uint32_t getTime() const
+    {
+        return m_time;
+    }
+
+    /**
+     * Get the time between the last two frames.
+     *
+     * @return Frame delta time in ms
+     */
+    uint32_t getDelta() const
+    {
+        return m_delta;
+    }
+
+    /** Max. time between two frames in ms. */
+    static const uint32_t   MAX_DELTA   = 250U;
+
+private:
+
+    bool        m_isStarted;    /**< Is the clock sampled at least once? */
+    uint32_t    m_timestamp;    /**< Timestamp of the last sample in ms */
+    uint32_t    m_time;         /**< Frame time in ms */
+    uint32_t    m_delta;        /**< Time between the last two frames in ms */
+
+    /**
+     * Constructs the frame clock.
+     */
+    FrameClock() :
+        m_isStarted(false),
+        m_timestamp(0U),
+        m_time(0U),
+        m_delta(0U)
+    {
+    }
+
+    /**
+     * Destroys the frame clock.
+     */
+    ~FrameClock()
+    {
+    }
+
+    FrameClock(const FrameClock& clock);
+    FrameClock& operator=(const FrameClock& clock);
+};
+
+/**
+ * Timer, based on the frame clock. In difference to the SimpleTimer it can
+ * be continued without drift, which is useful to step through animation
+ * frames in a constant rate.
+ */
+class FrameTimer
+{
+public:
+
+    /**
+     * Constructs a frame timer.
+     */
+    FrameTimer() :
+        m_isRunning(false),
+        m_duration(0U),
+        m_start(0U)
+    {
+    }
+
+    /**
+     * Destroys a frame timer.
+     */
+    ~FrameTimer()
+    {
+    }
+
+    /**
+     * Constructs a frame timer by assign one.
+     *
+     * @param[in] timer Frame timer, which to assign.
+     */
+    FrameTimer(const FrameTimer& timer) :
+        m_isRunning(timer.m_isRunning),
+        m_duration(timer.m_duration),
+        m_start(timer.m_start)
+    {
+    }
+
+    /**
+     * Copy a frame timer.
+     *
+     * @param[in] timer Frame timer, which to copy.
+     */
+    FrameTimer& operator=(const FrameTimer& timer)
+    {
+        if (&timer != this)
+        {
+            m_isRunning = timer.m_isRunning;
+            m_duration  = timer.m_duration;
+            m_start     = timer.m_start;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Start timer with the given duration at the current frame time.
+     *
+     * @param[in] duration  Duration in ms
+     */
+    void start(uint32_t duration)
+    {
+        m_isRunning = true;
+        m_duration  = duration;
+        m_start     = FrameClock::getInstance().getTime();
+    }
+
+    /**
+     * Continue the timer with the given duration, right after the timeout
+     * of the previous duration. If the timer is more than a whole duration
+     * behind the frame time, it is started again at the current frame time.
+     *
+     * @param[in] duration  Duration in ms
+     */
+    void next(uint32_t duration)
+    {
+        uint32_t now = FrameClock::getInstance().getTime();
+
+        m_start    += m_duration;
+        m_duration  = duration;
+
+        if ((false == m_isRunning) ||
+            (m_duration < (now - m_start)))
+        {
+            m_start = now;
+        }
+
+        m_isRunning = true;
+    }
+
+    /**
+     * Stop timer.
+     */
+    void stop()
+    {
+        m_isRunning = false;
+    }
+
+    /**
+     * Is timer running?
+     *
+     * @return If timer is running, it will return true otherwise false.
+     */
+    bool isTimerRunning() const
+    {
+        return m_isRunning;
+    }
+
+    /**
+     * Is timeout?
+     * If timer is not running, it will always return false.
+     *
+     * @return If timeout it will return true, otherwise false.
+     */
+    bool isTimeout() const
+    {
+        bool isTimeout = false;
+
+        if (true == m_isRunning)
+        {
+            isTimeout = (m_duration <= (FrameClock::getInstance().getTime() - m_start));
+        }
+
+        return isTimeout;
+    }
+
+private:
+
+    bool        m_isRunning;    /**< Timer is running or not. */
+    uint32_t    m_duration;     /**< Duration in ms */
+    uint32_t    m_start;        /**< Frame time at start in ms */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* FRAME_CLOCK_HPP */
+
+/** @} */
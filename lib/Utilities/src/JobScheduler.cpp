@@ -0,0 +1,344 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Periodic job scheduler
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "JobScheduler.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void JobScheduler::start(Job& job, uint32_t now, uint32_t delay)
+{
+    lock();
+
+    stopLocked(job);
+    syncCursor(now);
+
+    job.m_deadline = now + delay;
+    insert(job);
+
+    unlock();
+}
+
+void JobScheduler::stop(Job& job)
+{
+    lock();
+    stopLocked(job);
+    unlock();
+}
+
+bool JobScheduler::isRunning(const Job& job) const
+{
+    bool isJobRunning = false;
+
+    lock();
+    isJobRunning = (&job == m_runningJob);
+    unlock();
+
+    return isJobRunning;
+}
+
+uint32_t JobScheduler::process(uint32_t now)
+{
+    uint32_t waitTime = WAIT_FOREVER;
+
+    lock();
+
+    collectDueJobs(now);
+
+    /* Run all due jobs. A job may start or stop any job, therefore the
+     * periodic job is rescheduled before its function is called. The
+     * function is called outside of the lock, so it may use the scheduler
+     * and other tasks are not blocked by it.
+     */
+    while(nullptr != m_dueHead)
+    {
+        Job* job = m_dueHead;
+
+        m_dueHead       = job->m_nextDue;
+        job->m_nextDue  = nullptr;
+
+        if (0U == job->m_period)
+        {
+            job->m_state = Job::STATE_IDLE;
+        }
+        else
+        {
+            job->m_deadline += job->m_period;
+
+            /* Skip missed periods. */
+            if (true == isReached(job->m_deadline, now))
+            {
+                job->m_deadline = now + job->m_period;
+            }
+
+            insert(*job);
+        }
+
+        if (nullptr != job->m_func)
+        {
+            m_runningJob = job;
+            unlock();
+
+            job->m_func();
+
+            lock();
+            m_runningJob = nullptr;
+        }
+    }
+
+    waitTime = getWaitTimeLocked(now);
+
+    unlock();
+
+    return waitTime;
+}
+
+uint32_t JobScheduler::getWaitTime(uint32_t now) const
+{
+    uint32_t waitTime = WAIT_FOREVER;
+
+    lock();
+    waitTime = getWaitTimeLocked(now);
+    unlock();
+
+    return waitTime;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void JobScheduler::syncCursor(uint32_t now)
+{
+    /* The timer wheel starts with the first usage. */
+    if (false == m_isCursorSynced)
+    {
+        m_cursorTime        = now;
+        m_isCursorSynced    = true;
+    }
+}
+
+void JobScheduler::insert(Job& job)
+{
+    uint32_t ticks = 0U;
+
+    /* A deadline in the past is put into the current tick. */
+    if (true == isReached(m_cursorTime, job.m_deadline))
+    {
+        ticks = (job.m_deadline - m_cursorTime) / TICK_DURATION;
+    }
+
+    job.m_bucket    = (m_cursor + (ticks % WHEEL_SIZE)) % WHEEL_SIZE;
+    job.m_next      = m_wheel[job.m_bucket];
+    job.m_state     = Job::STATE_SCHEDULED;
+
+    m_wheel[job.m_bucket] = &job;
+}
+
+void JobScheduler::remove(Job& job)
+{
+    Job** link = &m_wheel[job.m_bucket];
+
+    while((nullptr != *link) && (&job != *link))
+    {
+        link = &(*link)->m_next;
+    }
+
+    if (nullptr != *link)
+    {
+        *link = job.m_next;
+    }
+
+    job.m_next  = nullptr;
+    job.m_state = Job::STATE_IDLE;
+}
+
+void JobScheduler::stopLocked(Job& job)
+{
+    if (Job::STATE_SCHEDULED == job.m_state)
+    {
+        remove(job);
+    }
+    else if (Job::STATE_DUE == job.m_state)
+    {
+        /* Remove it from the due list, because the job may be destroyed
+         * right after it is stopped.
+         */
+        Job** link = &m_dueHead;
+
+        while((nullptr != *link) && (&job != *link))
+        {
+            link = &(*link)->m_nextDue;
+        }
+
+        if (nullptr != *link)
+        {
+            *link = job.m_nextDue;
+        }
+
+        job.m_nextDue   = nullptr;
+        job.m_state     = Job::STATE_IDLE;
+    }
+    else
+    {
+        ;
+    }
+}
+
+void JobScheduler::collectDueJobs(uint32_t now)
+{
+    Job**       dueTail         = &m_dueHead;
+    uint32_t    elapsedTicks    = 0U;
+    size_t      bucketCount     = 0U;
+    size_t      idx             = 0U;
+
+    syncCursor(now);
+
+    if (true == isReached(m_cursorTime, now))
+    {
+        elapsedTicks = (now - m_cursorTime) / TICK_DURATION;
+    }
+
+    /* Visit only the buckets of the elapsed ticks, including the current one. */
+    if (WHEEL_SIZE <= elapsedTicks)
+    {
+        bucketCount = WHEEL_SIZE;
+    }
+    else
+    {
+        bucketCount = elapsedTicks + 1U;
+    }
+
+    /* Append to jobs, which may be still due. */
+    while(nullptr != *dueTail)
+    {
+        dueTail = &(*dueTail)->m_nextDue;
+    }
+
+    for(idx = 0U; idx < bucketCount; ++idx)
+    {
+        Job** link = &m_wheel[(m_cursor + idx) % WHEEL_SIZE];
+
+        /* The bucket may contain jobs of later wheel rounds too. */
+        while(nullptr != *link)
+        {
+            Job* job = *link;
+
+            if (false == isReached(job->m_deadline, now))
+            {
+                link = &job->m_next;
+            }
+            else
+            {
+                *link           = job->m_next;
+                job->m_next     = nullptr;
+                job->m_nextDue  = nullptr;
+                job->m_state    = Job::STATE_DUE;
+
+                *dueTail        = job;
+                dueTail         = &job->m_nextDue;
+            }
+        }
+    }
+
+    m_cursor        = (m_cursor + (elapsedTicks % WHEEL_SIZE)) % WHEEL_SIZE;
+    m_cursorTime   += elapsedTicks * TICK_DURATION;
+}
+
+uint32_t JobScheduler::getWaitTimeLocked(uint32_t now) const
+{
+    uint32_t    waitTime    = WAIT_FOREVER;
+    size_t      idx         = 0U;
+
+    for(idx = 0U; idx < WHEEL_SIZE; ++idx)
+    {
+        const Job* job = m_wheel[idx];
+
+        while(nullptr != job)
+        {
+            /* Latest possible run of the job. */
+            uint32_t latest = job->m_deadline + job->m_jitter;
+
+            if (true == isReached(latest, now))
+            {
+                waitTime = 0U;
+            }
+            else if ((latest - now) < waitTime)
+            {
+                waitTime = latest - now;
+            }
+            else
+            {
+                ;
+            }
+
+            job = job->m_next;
+        }
+    }
+
+    return waitTime;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,388 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Periodic job scheduler
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef JOB_SCHEDULER_H
+#define JOB_SCHEDULER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The job scheduler runs one-shot and periodic jobs on their deadline.
+ * The jobs are kept in a timer wheel, which is only advanced by the elapsed
+ * time. Therefore a task doesn't need to poll each job, instead it sleeps
+ * until the scheduler requests the next wakeup.
+ *
+ * Every job has a jitter tolerance. A job is never run before its deadline,
+ * but may be delayed up to its jitter. The scheduler wakes up at the latest
+ * possible time of the earliest job and runs all jobs which are due until
+ * then together. This coalesces jobs and reduces the number of wakeups.
+ *
+ * Without a lock the scheduler is not thread-safe and shall be used by a
+ * single task only, which also runs the jobs. With a lock, jobs may be started
+ * and stopped by any task, while a single task processes the scheduler. The
+ * job functions are always called outside of the lock.
+ */
+class JobScheduler
+{
+public:
+
+    /**
+     * Job function, which is called on the job deadline.
+     */
+    typedef std::function<void()> JobFunc;
+
+    /**
+     * Lock, which protects the scheduler against concurrent access.
+     */
+    class ILock
+    {
+    public:
+
+        /**
+         * Destroys the lock.
+         */
+        virtual ~ILock()
+        {
+        }
+
+        /**
+         * Enter the locked section.
+         */
+        virtual void enter() = 0;
+
+        /**
+         * Exit the locked section.
+         */
+        virtual void exit() = 0;
+
+    protected:
+
+        /**
+         * Constructs the lock.
+         */
+        ILock()
+        {
+        }
+    };
+
+    /**
+     * A job, which is owned by the component. It is linked into the
+     * scheduler, which causes no allocation.
+     */
+    class Job
+    {
+    public:
+
+        /**
+         * Constructs a job without function.
+         */
+        Job() :
+            m_func(),
+            m_period(0U),
+            m_jitter(0U),
+            m_deadline(0U),
+            m_state(STATE_IDLE),
+            m_bucket(0U),
+            m_next(nullptr),
+            m_nextDue(nullptr)
+        {
+        }
+
+        /**
+         * Destroys the job. It must be stopped before!
+         */
+        ~Job()
+        {
+        }
+
+        /**
+         * Set up the job. Don't call it while the job is scheduled or running.
+         *
+         * @param[in] func      Job function
+         * @param[in] period    Period in ms. If 0, the job is a one-shot job.
+         * @param[in] jitter    Jitter tolerance in ms, the job may be delayed at most.
+         */
+        void setup(const JobFunc& func, uint32_t period, uint32_t jitter)
+        {
+            m_func      = func;
+            m_period    = period;
+            m_jitter    = jitter;
+        }
+
+        /**
+         * Is the job scheduled?
+         *
+         * @return If scheduled, it will return true otherwise false.
+         */
+        bool isScheduled() const
+        {
+            return (STATE_IDLE != m_state);
+        }
+
+        /**
+         * Get the job period.
+         *
+         * @return Period in ms
+         */
+        uint32_t getPeriod() const
+        {
+            return m_period;
+        }
+
+    private:
+
+        friend class JobScheduler;
+
+        /**
+         * Job states.
+         */
+        enum State
+        {
+            STATE_IDLE = 0,     /**< Not scheduled */
+            STATE_SCHEDULED,    /**< Waiting in the timer wheel */
+            STATE_DUE           /**< Due, waiting to be run */
+        };
+
+        JobFunc     m_func;         /**< Job function */
+        uint32_t    m_period;       /**< Period in ms, 0 for one-shot */
+        uint32_t    m_jitter;       /**< Jitter tolerance in ms */
+        uint32_t    m_deadline;     /**< Next deadline in ms */
+        State       m_state;        /**< Job state */
+        size_t      m_bucket;       /**< Timer wheel bucket index */
+        Job*        m_next;         /**< Next job in the same bucket */
+        Job*        m_nextDue;      /**< Next due job */
+
+        Job(const Job& job);
+        Job& operator=(const Job& job);
+    };
+
+    /**
+     * Constructs an empty scheduler.
+     *
+     * @param[in] lock  Lock, which protects the scheduler. If nullptr, the scheduler is not thread-safe.
+     */
+    explicit JobScheduler(ILock* lock = nullptr) :
+        m_wheel(),
+        m_dueHead(nullptr),
+        m_runningJob(nullptr),
+        m_cursor(0U),
+        m_cursorTime(0U),
+        m_isCursorSynced(false),
+        m_lock(lock)
+    {
+    }
+
+    /**
+     * Destroys the scheduler.
+     */
+    ~JobScheduler()
+    {
+    }
+
+    /**
+     * Start a job. If it is already scheduled, it will be restarted.
+     *
+     * @param[in] job   Job, which must be set up before.
+     * @param[in] now   Current timestamp in ms
+     * @param[in] delay Delay in ms until the first deadline.
+     */
+    void start(Job& job, uint32_t now, uint32_t delay);
+
+    /**
+     * Stop a job. It can be called from a job function too.
+     * Note, if the job is stopped by a different task, its function may still
+     * be running. See isRunning().
+     *
+     * @param[in] job   Job
+     */
+    void stop(Job& job);
+
+    /**
+     * Is the job function running at the moment?
+     *
+     * @param[in] job   Job
+     *
+     * @return If running, it will return true otherwise false.
+     */
+    bool isRunning(const Job& job) const;
+
+    /**
+     * Run all due jobs and reschedule the periodic ones. If a periodic job
+     * missed one or more periods, the missed runs are skipped.
+     *
+     * @param[in] now   Current timestamp in ms
+     *
+     * @return Time in ms until the next wakeup. If no job is scheduled, it will return WAIT_FOREVER.
+     */
+    uint32_t process(uint32_t now);
+
+    /**
+     * Get the time until the next wakeup, which is the latest possible run
+     * of the earliest job.
+     *
+     * @param[in] now   Current timestamp in ms
+     *
+     * @return Time in ms until the next wakeup. If no job is scheduled, it will return WAIT_FOREVER.
+     */
+    uint32_t getWaitTime(uint32_t now) const;
+
+    /** Duration of a timer wheel tick in ms. */
+    static const uint32_t   TICK_DURATION   = 10U;
+
+    /** Number of timer wheel buckets, each covering a tick. */
+    static const size_t     WHEEL_SIZE      = 32U;
+
+    /** Wait time, if no job is scheduled. */
+    static const uint32_t   WAIT_FOREVER    = UINT32_MAX;
+
+private:
+
+    Job*        m_wheel[WHEEL_SIZE];    /**< Timer wheel, every bucket contains a list of jobs. */
+    Job*        m_dueHead;              /**< List of due jobs, which wait to be run. */
+    const Job*  m_runningJob;           /**< Job, whose function is running. */
+    size_t      m_cursor;               /**< Bucket index of the current tick */
+    uint32_t    m_cursorTime;           /**< Start timestamp of the current tick in ms */
+    bool        m_isCursorSynced;       /**< Is the cursor synchronized to the time? */
+    ILock*      m_lock;                 /**< Lock, may be nullptr. */
+
+    JobScheduler(const JobScheduler& scheduler);
+    JobScheduler& operator=(const JobScheduler& scheduler);
+
+    /**
+     * Enter the locked section, if a lock is available.
+     */
+    void lock() const
+    {
+        if (nullptr != m_lock)
+        {
+            m_lock->enter();
+        }
+    }
+
+    /**
+     * Exit the locked section, if a lock is available.
+     */
+    void unlock() const
+    {
+        if (nullptr != m_lock)
+        {
+            m_lock->exit();
+        }
+    }
+
+    /**
+     * Stop a job. The lock must be entered.
+     *
+     * @param[in] job   Job
+     */
+    void stopLocked(Job& job);
+
+    /**
+     * Collect all jobs, which are due until now, in the due list.
+     * The lock must be entered.
+     *
+     * @param[in] now   Current timestamp in ms
+     */
+    void collectDueJobs(uint32_t now);
+
+    /**
+     * Get the time until the next wakeup. The lock must be entered.
+     *
+     * @param[in] now   Current timestamp in ms
+     *
+     * @return Time in ms until the next wakeup. If no job is scheduled, it will return WAIT_FOREVER.
+     */
+    uint32_t getWaitTimeLocked(uint32_t now) const;
+
+    /**
+     * Synchronize the timer wheel cursor to the time on the first usage.
+     *
+     * @param[in] now   Current timestamp in ms
+     */
+    void syncCursor(uint32_t now);
+
+    /**
+     * Insert a job into the timer wheel, according to its deadline.
+     *
+     * @param[in] job   Job
+     */
+    void insert(Job& job);
+
+    /**
+     * Remove a job from the timer wheel.
+     *
+     * @param[in] job   Job
+     */
+    void remove(Job& job);
+
+    /**
+     * Is the timestamp reached?
+     *
+     * @param[in] timestamp Timestamp in ms
+     * @param[in] now       Current timestamp in ms
+     *
+     * @return If reached, it will return true otherwise false.
+     */
+    static bool isReached(uint32_t timestamp, uint32_t now)
+    {
+        /* Handles the timestamp overflow. */
+        return (0 <= static_cast<int32_t>(now - timestamp));
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* JOB_SCHEDULER_H */
+
+/** @} */
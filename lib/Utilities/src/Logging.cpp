@@ -133,6 +133,16 @@ LogSink* Logging::getSelectedSink()
     return m_selectedSink;
 }
 
+void Logging::setDeferringSink(LogSink* sink)
+{
+    m_deferringSink = sink;
+}
+
+void Logging::setMirrorSink(LogSink* sink)
+{
+    m_mirrorSink = sink;
+}
+
 void Logging::setLogLevel(const LogLevel logLevel)
 {
     m_currentLogLevel = logLevel;
@@ -174,7 +184,7 @@ void Logging::processLogMessage(const char* file, int line, const Logging::LogLe
         msg.line        = line;
         msg.str         = buffer;
 
-        m_selectedSink->send(msg);
+        send(msg);
     }
     else
     {
@@ -195,7 +205,7 @@ void Logging::processLogMessage(const char* file, int line, const Logging::LogLe
         msg.line        = line;
         msg.str         = message.c_str();
 
-        m_selectedSink->send(msg);
+        send(msg);
     }
     else
     {
@@ -216,7 +226,7 @@ void Logging::processLogMessage(uint32_t timestamp, const String& logger, const
         msg.line        = 0;
         msg.str         = message.c_str();
 
-        m_selectedSink->send(msg);
+        send(msg);
     }
     else
     {
@@ -232,6 +242,23 @@ void Logging::processLogMessage(uint32_t timestamp, const String& logger, const
  * Private Methods
  *****************************************************************************/
 
+void Logging::send(const Msg& msg)
+{
+    if (nullptr != m_mirrorSink)
+    {
+        m_mirrorSink->send(msg);
+    }
+
+    if (nullptr != m_deferringSink)
+    {
+        m_deferringSink->send(msg);
+    }
+    else
+    {
+        m_selectedSink->send(msg);
+    }
+}
+
 bool Logging::isSeverityEnabled(Logging::LogLevel logLevel) const
 {
     return (logLevel <= m_currentLogLevel);
@@ -239,6 +239,25 @@ public:
      */
     LogSink* getSelectedSink();
 
+    /**
+     * Set a deferring sink. If set, all log messages are handed over to it,
+     * instead of the selected sink. The deferring sink is responsible to
+     * forward them later to the selected sink, e.g. out of a low priority
+     * task. This keeps the sink output away from the context of the caller.
+     *
+     * @param[in] sink  Deferring sink, use nullptr to disable.
+     */
+    void setDeferringSink(LogSink* sink);
+
+    /**
+     * Set a mirror sink. If set, it gets every log message additionally in
+     * the context of the caller. Therefore its send() must be fast and shall
+     * never block.
+     *
+     * @param[in] sink  Mirror sink, use nullptr to disable.
+     */
+    void setMirrorSink(LogSink* sink);
+
     /**
      * Set the logLevel.
      *
@@ -307,6 +326,20 @@ private:
     /** Active sink */
     LogSink*    m_selectedSink;
 
+    /** Deferring sink, which forwards the messages later to the active sink. */
+    LogSink*    m_deferringSink;
+
+    /** Mirror sink, which gets every message additionally. */
+    LogSink*    m_mirrorSink;
+
+    /**
+     * Send the log message to the mirror sink if available. Afterwards to
+     * the deferring sink if available, otherwise directly to the selected sink.
+     *
+     * @param[in] msg   Log message
+     */
+    void send(const Msg& msg);
+
     /**
      * Checks wether the given severity of a logMessage is enabled to be printed.
      *
@@ -331,7 +364,9 @@ private:
     Logging() :
         m_currentLogLevel(LOG_LEVEL_INFO),
         m_sinks(),
-        m_selectedSink(nullptr)
+        m_selectedSink(nullptr),
+        m_deferringSink(nullptr),
+        m_mirrorSink(nullptr)
     {
         uint8_t index = 0U;
 
@@ -0,0 +1,431 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Fixed capacity object pool
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef OBJECT_POOL_HPP
+#define OBJECT_POOL_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Lock for object pools, which are used by a single task only.
+ * A lock provides enter() and exit(), like the CriticalSection does.
+ */
+class ObjectPoolNoLock
+{
+public:
+
+    /**
+     * Constructs the lock.
+     */
+    ObjectPoolNoLock()
+    {
+    }
+
+    /**
+     * Destroys the lock.
+     */
+    ~ObjectPoolNoLock()
+    {
+    }
+
+    /**
+     * Enter the locked section.
+     */
+    void enter()
+    {
+    }
+
+    /**
+     * Exit the locked section.
+     */
+    void exit()
+    {
+    }
+};
+
+/**
+ * Type independent part of the object pool, which provides the occupancy
+ * statistics. Every pool registers itself at construction, so all pools can
+ * be walked through with getFirst() and getNext().
+ */
+class ObjectPoolBase
+{
+public:
+
+    /**
+     * Get pool name.
+     *
+     * @return Pool name
+     */
+    const char* getName() const
+    {
+        return m_name;
+    }
+
+    /**
+     * Get max. number of objects in the pool.
+     *
+     * @return Pool capacity
+     */
+    size_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Get number of objects, which are currently taken from the pool.
+     *
+     * @return Number of used objects
+     */
+    size_t getUsed() const
+    {
+        return m_used;
+    }
+
+    /**
+     * Get max. number of objects, which were taken from the pool at the same time.
+     *
+     * @return Peak of used objects
+     */
+    size_t getPeak() const
+    {
+        return m_peak;
+    }
+
+    /**
+     * Get number of objects, which were allocated on the heap, because the
+     * pool was exhausted.
+     *
+     * @return Number of heap fallbacks
+     */
+    uint32_t getFallbacks() const
+    {
+        return m_fallbacks;
+    }
+
+    /**
+     * Get the next registered pool.
+     *
+     * @return If available, it will return the next pool otherwise nullptr.
+     */
+    const ObjectPoolBase* getNext() const
+    {
+        return m_next;
+    }
+
+    /**
+     * Get the first registered pool.
+     *
+     * @return If available, it will return the first pool otherwise nullptr.
+     */
+    static const ObjectPoolBase* getFirst()
+    {
+        return getHead().load();
+    }
+
+protected:
+
+    size_t      m_used;         /**< Number of used objects */
+    size_t      m_peak;         /**< Peak of used objects */
+    uint32_t    m_fallbacks;    /**< Number of heap fallbacks */
+
+    /**
+     * Constructs the pool statistics and registers the pool.
+     *
+     * @param[in] name      Pool name, must be a string literal.
+     * @param[in] capacity  Max. number of objects in the pool
+     */
+    ObjectPoolBase(const char* name, size_t capacity) :
+        m_used(0U),
+        m_peak(0U),
+        m_fallbacks(0U),
+        m_name(name),
+        m_capacity(capacity),
+        m_next(getHead().load())
+    {
+        /* If a different pool registered in the meantime, m_next is updated
+         * and the registration is tried again.
+         */
+        while(false == getHead().compare_exchange_weak(m_next, this))
+        {
+            ;
+        }
+    }
+
+    /**
+     * Destroys the pool statistics and unregisters the pool.
+     * Note, this is not thread-safe. Pools are usually never destroyed.
+     */
+    ~ObjectPoolBase()
+    {
+        ObjectPoolBase* pool = getHead().load();
+
+        if (this == pool)
+        {
+            getHead().store(m_next);
+        }
+        else
+        {
+            while((nullptr != pool) && (this != pool->m_next))
+            {
+                pool = pool->m_next;
+            }
+
+            if (nullptr != pool)
+            {
+                pool->m_next = m_next;
+            }
+        }
+    }
+
+    /**
+     * Count a taken object.
+     */
+    void countTaken()
+    {
+        ++m_used;
+
+        if (m_peak < m_used)
+        {
+            m_peak = m_used;
+        }
+    }
+
+private:
+
+    const char*     m_name;     /**< Pool name */
+    size_t          m_capacity; /**< Pool capacity */
+    ObjectPoolBase* m_next;     /**< Next registered pool */
+
+    /**
+     * Get head of the registered pools.
+     *
+     * @return Head of the registered pools
+     */
+    static std::atomic<ObjectPoolBase*>& getHead()
+    {
+        static std::atomic<ObjectPoolBase*> head(nullptr); /* singleton idiom to force initialization in the first usage. */
+
+        return head;
+    }
+
+    ObjectPoolBase();
+    ObjectPoolBase(const ObjectPoolBase& pool);
+    ObjectPoolBase& operator=(const ObjectPoolBase& pool);
+};
+
+/**
+ * Fixed capacity pool of objects. The memory of all objects is part of the
+ * pool, therefore taking and giving back an object causes no heap allocation.
+ * If the pool is exhausted, the object will be allocated on the heap as
+ * fallback. Every fallback is counted.
+ *
+ * The lock only protects the free list. The objects are constructed and
+ * destroyed outside of it.
+ *
+ * @tparam T        Object type
+ * @tparam N        Pool capacity
+ * @tparam TLock    Lock type with enter() and exit(), e.g. CriticalSection.
+ */
+template < typename T, size_t N, typename TLock = ObjectPoolNoLock >
+class ObjectPool : public ObjectPoolBase
+{
+public:
+
+    /**
+     * Constructs the object pool.
+     *
+     * @param[in] name  Pool name, must be a string literal.
+     */
+    explicit ObjectPool(const char* name) :
+        ObjectPoolBase(name, N),
+        m_slots(),
+        m_freeList(nullptr),
+        m_lock()
+    {
+        size_t idx = N;
+
+        while(0U < idx)
+        {
+            --idx;
+
+            m_slots[idx].next   = m_freeList;
+            m_freeList          = &m_slots[idx];
+        }
+    }
+
+    /**
+     * Destroys the object pool.
+     * All objects must be given back before!
+     */
+    ~ObjectPool()
+    {
+    }
+
+    /**
+     * Create an object.
+     *
+     * @tparam TArgs    Constructor argument types
+     *
+     * @param[in] args  Constructor arguments
+     *
+     * @return If successful, it will return the object otherwise nullptr.
+     */
+    template < typename... TArgs >
+    T* create(TArgs&&... args)
+    {
+        Slot*   slot    = nullptr;
+        T*      object  = nullptr;
+
+        m_lock.enter();
+
+        slot = m_freeList;
+
+        if (nullptr != slot)
+        {
+            m_freeList = slot->next;
+            countTaken();
+        }
+        else
+        {
+            ++m_fallbacks;
+        }
+
+        m_lock.exit();
+
+        if (nullptr != slot)
+        {
+            object = ::new(&slot->storage) T(std::forward<TArgs>(args)...);
+        }
+        else
+        {
+            object = new(std::nothrow) T(std::forward<TArgs>(args)...);
+        }
+
+        return object;
+    }
+
+    /**
+     * Destroy an object, which was created by this pool before.
+     *
+     * @param[in] object    Object, may be nullptr.
+     */
+    void destroy(T* object)
+    {
+        if (nullptr != object)
+        {
+            if (false == isPooled(object))
+            {
+                delete object;
+            }
+            else
+            {
+                Slot* slot = reinterpret_cast<Slot*>(object);
+
+                object->~T();
+
+                m_lock.enter();
+
+                slot->next  = m_freeList;
+                m_freeList  = slot;
+                --m_used;
+
+                m_lock.exit();
+            }
+        }
+    }
+
+    /**
+     * Is the object part of the pool or was it allocated on the heap?
+     *
+     * @param[in] object    Object
+     *
+     * @return If part of the pool, it will return true otherwise false.
+     */
+    bool isPooled(const T* object) const
+    {
+        const void* ptr = object;
+
+        return ((ptr >= static_cast<const void*>(m_slots)) &&
+                (ptr < static_cast<const void*>(m_slots + N)));
+    }
+
+private:
+
+    /**
+     * A slot contains either an object or the link to the next free slot.
+     */
+    union Slot
+    {
+        Slot*                                                       next;       /**< Next free slot */
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type  storage;    /**< Object memory */
+    };
+
+    Slot    m_slots[N];     /**< Object memory */
+    Slot*   m_freeList;     /**< Free slots */
+    TLock   m_lock;         /**< Protects the free list */
+
+    ObjectPool();
+    ObjectPool(const ObjectPool& pool);
+    ObjectPool& operator=(const ObjectPool& pool);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* OBJECT_POOL_HPP */
+
+/** @} */
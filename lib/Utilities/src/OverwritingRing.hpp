@@ -0,0 +1,213 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Overwriting ring buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef OVERWRITING_RING_HPP
+#define OVERWRITING_RING_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Ring buffer, which overwrites its oldest entry if it is full. Every
+ * overwritten entry is counted, until the counter is taken.
+ *
+ * It has no constructor on purpose, because it shall be placed in memory
+ * which is not initialized at startup, e.g. the RTC memory, to survive a
+ * reset. The magic pattern shows whether its content is valid. The counters
+ * are free running, the index in the ring buffer is derived by modulo.
+ *
+ * It is not thread-safe, the caller shall protect it.
+ *
+ * @tparam T    Entry type
+ * @tparam N    Number of entries, must be a power of two.
+ */
+template < typename T, uint32_t N >
+struct OverwritingRing
+{
+    static_assert(0U == (N & (N - 1U)), "Ring size is no power of two.");
+
+    uint32_t    magic;          /**< Magic pattern to detect a valid content. */
+    uint32_t    writeCnt;       /**< Number of written entries */
+    uint32_t    readCnt;        /**< Number of read entries */
+    uint32_t    overwritten;    /**< Number of entries, which were overwritten before they were read. */
+    T           entries[N];     /**< Entries */
+
+    /**
+     * Is the ring buffer content valid?
+     *
+     * @param[in] pattern   Magic pattern of a valid content
+     *
+     * @return If valid, it will return true otherwise false.
+     */
+    bool isValid(uint32_t pattern) const
+    {
+        return ((pattern == magic) && (N >= (writeCnt - readCnt)));
+    }
+
+    /**
+     * Remove all entries, reset the overwritten counter and mark the content
+     * as valid.
+     *
+     * @param[in] pattern   Magic pattern of a valid content
+     */
+    void clear(uint32_t pattern)
+    {
+        magic       = pattern;
+        writeCnt    = 0U;
+        readCnt     = 0U;
+        overwritten = 0U;
+    }
+
+    /**
+     * Write an entry. If the ring buffer is full, the oldest entry is
+     * overwritten.
+     *
+     * @param[in] entry Entry
+     */
+    void write(const T& entry)
+    {
+        entries[writeCnt % N] = entry;
+        ++writeCnt;
+
+        /* Oldest not read entry overwritten? */
+        if (N < (writeCnt - readCnt))
+        {
+            ++readCnt;
+            ++overwritten;
+        }
+    }
+
+    /**
+     * Get number of entries, which are not read yet.
+     *
+     * @return Number of pending entries
+     */
+    uint32_t getPendingCount() const
+    {
+        return writeCnt - readCnt;
+    }
+
+    /**
+     * Get a pending entry, without reading it.
+     *
+     * @param[in]   idx     Index of the pending entry [0; getPendingCount() - 1]
+     * @param[out]  entry   Entry
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool peek(uint32_t idx, T& entry) const
+    {
+        bool isSuccessful = false;
+
+        if (getPendingCount() > idx)
+        {
+            entry           = entries[(readCnt + idx) % N];
+            isSuccessful    = true;
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Read the oldest pending entries.
+     *
+     * @param[out]  buffer      Buffer for the entries
+     * @param[in]   maxCount    Max. number of entries, which fit into the buffer
+     *
+     * @return Number of read entries
+     */
+    uint32_t read(T* buffer, uint32_t maxCount)
+    {
+        uint32_t    count   = getPendingCount();
+        uint32_t    idx     = 0U;
+
+        if (nullptr == buffer)
+        {
+            count = 0U;
+        }
+        else if (maxCount < count)
+        {
+            count = maxCount;
+        }
+        else
+        {
+            ;
+        }
+
+        for(idx = 0U; idx < count; ++idx)
+        {
+            buffer[idx] = entries[readCnt % N];
+            ++readCnt;
+        }
+
+        return count;
+    }
+
+    /**
+     * Get the number of overwritten entries since the last call and reset it.
+     *
+     * @return Number of overwritten entries
+     */
+    uint32_t takeOverwritten()
+    {
+        uint32_t count = overwritten;
+
+        overwritten = 0U;
+
+        return count;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* OVERWRITING_RING_HPP */
+
+/** @} */
@@ -0,0 +1,112 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  LED power limiter
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PowerLimiter.h"
+#include "ColorPipeline.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void PowerLimiter::endFrame()
+{
+    const uint32_t  IDLE_CURRENT    = m_ledCount * m_idleCurrentPerLed;
+    /* Current of the frame content at full luminance. 64 bit, because of huge matrices. */
+    const uint64_t  FULL_CURRENT    = (static_cast<uint64_t>(m_channelSum) * m_channelCurrentMax) / ColorPipeline::PRECISE_VALUE_MAX;
+    uint32_t        available       = 0U;
+    uint32_t        target          = m_brightness;
+
+    if (m_supplyCurrentMax > IDLE_CURRENT)
+    {
+        available = m_supplyCurrentMax - IDLE_CURRENT;
+    }
+
+    /* Limit only if the requested brightness would exceed the supply. */
+    if ((FULL_CURRENT * m_brightness) > (static_cast<uint64_t>(available) * UINT8_MAX))
+    {
+        target = static_cast<uint32_t>((static_cast<uint64_t>(available) * UINT8_MAX) / FULL_CURRENT);
+    }
+
+    /* Reduce immediately to protect the supply, but raise slowly to avoid pumping. */
+    if (target < m_luminance)
+    {
+        m_luminance = static_cast<uint8_t>(target);
+    }
+    else if ((target - m_luminance) > RELEASE_STEP)
+    {
+        m_luminance += RELEASE_STEP;
+    }
+    else
+    {
+        m_luminance = static_cast<uint8_t>(target);
+    }
+
+    m_current = IDLE_CURRENT + static_cast<uint32_t>((FULL_CURRENT * m_luminance) / UINT8_MAX);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,203 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  LED power limiter
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef POWER_LIMITER_H
+#define POWER_LIMITER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The power limiter estimates the current of a LED matrix from the content
+ * of every frame. The color channels of all pixels are summed up, before the
+ * frame is converted for output. The channel values are expected to be gamma
+ * corrected and white balanced, but without luminance, because this is what
+ * drives the LEDs (see ColorPipeline::getPreciseValue()). At the end of the estimation the luminance
+ * is only reduced below the requested brightness, if the estimated current
+ * would exceed the max. supply current.
+ *
+ * Because the luminance is determined before the frame is converted, it
+ * applies to the same frame. A sudden change from dark to bright content
+ * can therefore not exceed the supply current for a single frame.
+ *
+ * To avoid pumping, the luminance is reduced immediately, but raised slowly
+ * frame by frame.
+ */
+class PowerLimiter
+{
+public:
+
+    /**
+     * Constructs the power limiter.
+     *
+     * @param[in] supplyCurrentMax      Max. supply current in mA
+     * @param[in] ledCount              Number of LEDs
+     * @param[in] channelCurrentMax     Max. current in mA of a single color channel of a LED
+     * @param[in] idleCurrentPerLed     Current in mA of a LED, which is off
+     */
+    PowerLimiter(uint32_t supplyCurrentMax, uint32_t ledCount, uint32_t channelCurrentMax, uint32_t idleCurrentPerLed) :
+        m_supplyCurrentMax(supplyCurrentMax),
+        m_ledCount(ledCount),
+        m_channelCurrentMax(channelCurrentMax),
+        m_idleCurrentPerLed(idleCurrentPerLed),
+        m_brightness(UINT8_MAX),
+        m_luminance(UINT8_MAX),
+        m_channelSum(0U),
+        m_current(0U)
+    {
+    }
+
+    /**
+     * Destroys the power limiter.
+     */
+    ~PowerLimiter()
+    {
+    }
+
+    /**
+     * Set the requested brightness. The luminance will never exceed it.
+     * A lower brightness is applied immediately.
+     *
+     * @param[in] brightness    Brightness [0; 255]
+     */
+    void setBrightness(uint8_t brightness)
+    {
+        m_brightness = brightness;
+
+        if (m_brightness < m_luminance)
+        {
+            m_luminance = m_brightness;
+        }
+    }
+
+    /**
+     * Get the requested brightness.
+     *
+     * @return Brightness [0; 255]
+     */
+    uint8_t getBrightness() const
+    {
+        return m_brightness;
+    }
+
+    /**
+     * Get the luminance, which shall be applied on the output.
+     *
+     * @return Luminance [0; 255]
+     */
+    uint8_t getLuminance() const
+    {
+        return m_luminance;
+    }
+
+    /**
+     * Start the estimation of a new frame.
+     */
+    void beginFrame()
+    {
+        m_channelSum = 0U;
+    }
+
+    /**
+     * Add a single pixel of the frame, as it is put out at full luminance.
+     *
+     * @param[in] red   Red channel with 12 bit precision [0; 4080]
+     * @param[in] green Green channel with 12 bit precision [0; 4080]
+     * @param[in] blue  Blue channel with 12 bit precision [0; 4080]
+     */
+    void addPixel(uint16_t red, uint16_t green, uint16_t blue)
+    {
+        m_channelSum += static_cast<uint32_t>(red) + green + blue;
+    }
+
+    /**
+     * Finish the estimation of the frame and determine the luminance,
+     * which shall be applied on its conversion.
+     */
+    void endFrame();
+
+    /**
+     * Get the estimated current of the last frame with the luminance applied.
+     *
+     * @return Current in mA
+     */
+    uint32_t getCurrent() const
+    {
+        return m_current;
+    }
+
+    /**
+     * Max. luminance increase per frame. With a display update period of 20 ms,
+     * the luminance needs about 1.3 s to raise from dark to full.
+     */
+    static const uint8_t    RELEASE_STEP    = 4U;
+
+private:
+
+    const uint32_t  m_supplyCurrentMax;     /**< Max. supply current in mA */
+    const uint32_t  m_ledCount;             /**< Number of LEDs */
+    const uint32_t  m_channelCurrentMax;    /**< Max. current in mA per color channel */
+    const uint32_t  m_idleCurrentPerLed;    /**< Current in mA of a LED, which is off */
+    uint8_t         m_brightness;           /**< Requested brightness */
+    uint8_t         m_luminance;            /**< Luminance, which shall be applied */
+    uint32_t        m_channelSum;           /**< Sum of all color channels of the current frame */
+    uint32_t        m_current;              /**< Estimated current in mA of the last frame */
+
+    PowerLimiter();
+    PowerLimiter(const PowerLimiter& limiter);
+    PowerLimiter& operator=(const PowerLimiter& limiter);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* POWER_LIMITER_H */
+
+/** @} */
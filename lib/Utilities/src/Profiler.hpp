@@ -0,0 +1,246 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Profiler
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "DurationHistogram.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The profiler collects duration histograms of the time critical parts of
+ * the system, like the plugin processing, the display refresh and the
+ * network communication. It is always active, because recording a duration
+ * is just a few lock-free counter updates.
+ */
+class Profiler
+{
+public:
+
+    /**
+     * Get profiler instance.
+     *
+     * @return Profiler instance
+     */
+    static Profiler& getInstance()
+    {
+        static Profiler instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Get the histogram of the display refresh period.
+     *
+     * @return Frame period histogram
+     */
+    DurationHistogram& getFramePeriod()
+    {
+        return m_framePeriod;
+    }
+
+    /**
+     * Get the histogram of the display refresh period deviation from the
+     * configured period.
+     *
+     * @return Frame jitter histogram
+     */
+    DurationHistogram& getFrameJitter()
+    {
+        return m_frameJitter;
+    }
+
+    /**
+     * Get the histogram of the plugin process() duration in the given slot.
+     *
+     * @param[in] slotId    Slot id
+     *
+     * @return Histogram or nullptr, if the slot id is out of range.
+     */
+    DurationHistogram* getPluginProcess(uint8_t slotId)
+    {
+        DurationHistogram* histogram = nullptr;
+
+        if (MAX_SLOTS > slotId)
+        {
+            histogram = &m_pluginProcess[slotId];
+        }
+
+        return histogram;
+    }
+
+    /**
+     * Get the histogram of the plugin update() duration in the given slot.
+     *
+     * @param[in] slotId    Slot id
+     *
+     * @return Histogram or nullptr, if the slot id is out of range.
+     */
+    DurationHistogram* getPluginUpdate(uint8_t slotId)
+    {
+        DurationHistogram* histogram = nullptr;
+
+        if (MAX_SLOTS > slotId)
+        {
+            histogram = &m_pluginUpdate[slotId];
+        }
+
+        return histogram;
+    }
+
+    /**
+     * Record the plugin process() duration in the given slot.
+     *
+     * @param[in] slotId    Slot id
+     * @param[in] duration  Duration in us
+     */
+    void recordPluginProcess(uint8_t slotId, uint32_t duration)
+    {
+        if (MAX_SLOTS > slotId)
+        {
+            m_pluginProcess[slotId].record(duration);
+        }
+    }
+
+    /**
+     * Record the plugin update() duration in the given slot.
+     *
+     * @param[in] slotId    Slot id
+     * @param[in] duration  Duration in us
+     */
+    void recordPluginUpdate(uint8_t slotId, uint32_t duration)
+    {
+        if (MAX_SLOTS > slotId)
+        {
+            m_pluginUpdate[slotId].record(duration);
+        }
+    }
+
+    /**
+     * Clear the plugin histograms of the given slot, e.g. after a different
+     * plugin was installed.
+     *
+     * @param[in] slotId    Slot id
+     */
+    void resetPlugin(uint8_t slotId)
+    {
+        if (MAX_SLOTS > slotId)
+        {
+            m_pluginProcess[slotId].reset();
+            m_pluginUpdate[slotId].reset();
+        }
+    }
+
+    /**
+     * Get the histogram of the HTTP client event queue latency. It is the
+     * time between a event is queued by the TCP/IP stack and its handling.
+     *
+     * @return HTTP client queue latency histogram
+     */
+    DurationHistogram& getHttpClientQueue()
+    {
+        return m_httpClientQueue;
+    }
+
+    /**
+     * Get the histogram of the MQTT message dispatch duration. It is the time
+     * a received message needs to be handled by its subscriber.
+     *
+     * @return MQTT message dispatch histogram
+     */
+    DurationHistogram& getMqttDispatch()
+    {
+        return m_mqttDispatch;
+    }
+
+    /** Max. number of slots, which are profiled. */
+    static const uint8_t MAX_SLOTS  = 16U;
+
+private:
+
+    DurationHistogram   m_framePeriod;              /**< Display refresh period */
+    DurationHistogram   m_frameJitter;              /**< Display refresh period deviation */
+    DurationHistogram   m_pluginProcess[MAX_SLOTS]; /**< Plugin process() duration per slot */
+    DurationHistogram   m_pluginUpdate[MAX_SLOTS];  /**< Plugin update() duration per slot */
+    DurationHistogram   m_httpClientQueue;          /**< HTTP client event queue latency */
+    DurationHistogram   m_mqttDispatch;             /**< MQTT message dispatch duration */
+
+    /**
+     * Constructs the profiler.
+     */
+    Profiler() :
+        m_framePeriod(),
+        m_frameJitter(),
+        m_pluginProcess(),
+        m_pluginUpdate(),
+        m_httpClientQueue(),
+        m_mqttDispatch()
+    {
+    }
+
+    /**
+     * Destroys the profiler.
+     */
+    ~Profiler()
+    {
+        /* Will never be called. */
+    }
+
+    Profiler(const Profiler& profiler);
+    Profiler& operator=(const Profiler& profiler);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* PROFILER_HPP */
+
+/** @} */
@@ -0,0 +1,183 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Tween
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Tween.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+Tween& Tween::operator=(const Tween& tween)
+{
+    if (&tween != this)
+    {
+        m_from      = tween.m_from;
+        m_to        = tween.m_to;
+        m_start     = tween.m_start;
+        m_delay     = tween.m_delay;
+        m_duration  = tween.m_duration;
+        m_curve     = tween.m_curve;
+        m_repeat    = tween.m_repeat;
+        m_isRunning = tween.m_isRunning;
+    }
+
+    return *this;
+}
+
+void Tween::start(int32_t from, int32_t to, uint32_t duration, Easing::Curve curve, uint32_t delay)
+{
+    m_from      = from;
+    m_to        = to;
+    m_start     = FrameClock::getInstance().getTime();
+    m_delay     = delay;
+    m_duration  = duration;
+    m_curve     = curve;
+    m_isRunning = true;
+}
+
+void Tween::stop()
+{
+    int32_t value = getValue();
+
+    m_from      = value;
+    m_to        = value;
+    m_isRunning = false;
+}
+
+bool Tween::isRunning() const
+{
+    bool isRunning = false;
+
+    if (true == m_isRunning)
+    {
+        if (REPEAT_NONE != m_repeat)
+        {
+            isRunning = true;
+        }
+        else
+        {
+            isRunning = ((m_delay + m_duration) > (FrameClock::getInstance().getTime() - m_start));
+        }
+    }
+
+    return isRunning;
+}
+
+uint16_t Tween::getProgress() const
+{
+    uint16_t progress = Easing::PROGRESS_ONE;
+
+    if ((true == m_isRunning) &&
+        (0U < m_duration))
+    {
+        uint32_t elapsed = getElapsed();
+
+        switch(m_repeat)
+        {
+        case REPEAT_LOOP:
+            elapsed %= m_duration;
+            break;
+
+        case REPEAT_PING_PONG:
+            elapsed %= 2U * m_duration;
+
+            if (m_duration < elapsed)
+            {
+                elapsed = (2U * m_duration) - elapsed;
+            }
+            break;
+
+        case REPEAT_NONE:
+            /* fallthrough */
+        default:
+            break;
+        }
+
+        progress = Easing::apply(m_curve, Easing::getProgress(elapsed, m_duration));
+    }
+
+    return progress;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+uint32_t Tween::getElapsed() const
+{
+    uint32_t elapsed = FrameClock::getInstance().getTime() - m_start;
+
+    if (m_delay > elapsed)
+    {
+        elapsed = 0U;
+    }
+    else
+    {
+        elapsed -= m_delay;
+    }
+
+    return elapsed;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
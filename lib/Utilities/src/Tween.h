@@ -0,0 +1,216 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Tween
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef TWEEN_H
+#define TWEEN_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "Easing.h"
+#include "FrameClock.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A tween interpolates a value over time, e.g. a position, a color channel or
+ * an alpha value. It is placed on the timeline of the frame clock, therefore
+ * all tweens of a frame are sampled at the same time and their speed is
+ * independent of the frame rate.
+ *
+ * Use fixed-point values (e.g. with 8 fractional bits) to get sub-pixel
+ * positions.
+ */
+class Tween
+{
+public:
+
+    /**
+     * Repeat mode, after the end of the tween is reached.
+     */
+    enum Repeat
+    {
+        REPEAT_NONE = 0,    /**< Stop at the end. */
+        REPEAT_LOOP,        /**< Start again from the begin. */
+        REPEAT_PING_PONG    /**< Run backward to the begin, then forward again. */
+    };
+
+    /**
+     * Constructs a tween, which is not running and has the value 0.
+     */
+    Tween() :
+        m_from(0),
+        m_to(0),
+        m_start(0U),
+        m_delay(0U),
+        m_duration(0U),
+        m_curve(Easing::CURVE_LINEAR),
+        m_repeat(REPEAT_NONE),
+        m_isRunning(false)
+    {
+    }
+
+    /**
+     * Destroys the tween.
+     */
+    ~Tween()
+    {
+    }
+
+    /**
+     * Constructs a tween by assign one.
+     *
+     * @param[in] tween Tween, which to assign.
+     */
+    Tween(const Tween& tween) :
+        m_from(tween.m_from),
+        m_to(tween.m_to),
+        m_start(tween.m_start),
+        m_delay(tween.m_delay),
+        m_duration(tween.m_duration),
+        m_curve(tween.m_curve),
+        m_repeat(tween.m_repeat),
+        m_isRunning(tween.m_isRunning)
+    {
+    }
+
+    /**
+     * Assign a tween.
+     *
+     * @param[in] tween Tween, which to assign.
+     *
+     * @return Tween
+     */
+    Tween& operator=(const Tween& tween);
+
+    /**
+     * Start the tween at the current frame time.
+     *
+     * @param[in] from      Start value
+     * @param[in] to        End value
+     * @param[in] duration  Duration in ms
+     * @param[in] curve     Easing curve
+     * @param[in] delay     Delay in ms, before the value starts to change.
+     */
+    void start(int32_t from, int32_t to, uint32_t duration, Easing::Curve curve = Easing::CURVE_LINEAR, uint32_t delay = 0U);
+
+    /**
+     * Start the tween from the current value to a new value.
+     *
+     * @param[in] to        End value
+     * @param[in] duration  Duration in ms
+     * @param[in] curve     Easing curve
+     */
+    void moveTo(int32_t to, uint32_t duration, Easing::Curve curve = Easing::CURVE_LINEAR)
+    {
+        start(getValue(), to, duration, curve);
+    }
+
+    /**
+     * Stop the tween. The value is kept at the current value.
+     */
+    void stop();
+
+    /**
+     * Set the repeat mode.
+     *
+     * @param[in] repeat    Repeat mode
+     */
+    void setRepeat(Repeat repeat)
+    {
+        m_repeat = repeat;
+    }
+
+    /**
+     * Is the tween running? A repeating tween runs until it is stopped.
+     *
+     * @return If running, it will return true otherwise false.
+     */
+    bool isRunning() const;
+
+    /**
+     * Get the eased progress at the current frame time.
+     *
+     * @return Progress [0; Easing::PROGRESS_ONE]
+     */
+    uint16_t getProgress() const;
+
+    /**
+     * Get the value at the current frame time.
+     *
+     * @return Value
+     */
+    int32_t getValue() const
+    {
+        return Easing::interpolate(m_from, m_to, getProgress());
+    }
+
+private:
+
+    int32_t         m_from;         /**< Start value */
+    int32_t         m_to;           /**< End value */
+    uint32_t        m_start;        /**< Frame time at start in ms */
+    uint32_t        m_delay;        /**< Delay before the value starts to change in ms */
+    uint32_t        m_duration;     /**< Duration in ms */
+    Easing::Curve   m_curve;        /**< Easing curve */
+    Repeat          m_repeat;       /**< Repeat mode */
+    bool            m_isRunning;    /**< Is tween started? */
+
+    /**
+     * Get the elapsed time since the tween started to change the value.
+     *
+     * @return Elapsed time in ms
+     */
+    uint32_t getElapsed() const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* TWEEN_H */
+
+/** @} */
@@ -0,0 +1,224 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color in RGB565 format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef RGB565_H
+#define RGB565_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Rgb888.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Compact color, which stores the base colors red, green and blue in a single
+ * 16-bit value in RGB565 format. There is no intensity, which halves the
+ * memory consumption of a bitmap in comparison to RGB888 with intensity.
+ */
+class Rgb565
+{
+public:
+
+    /**
+     * Constructs the color black.
+     */
+    Rgb565() :
+        m_value(0U)
+    {
+    }
+
+    /**
+     * Destroys the color.
+     */
+    ~Rgb565()
+    {
+    }
+
+    /**
+     * Specialized constructor, used in case every base color (RGB) is given.
+     *
+     * @param[in] red   Red value
+     * @param[in] green Green value
+     * @param[in] blue  Blue value
+     */
+    Rgb565(uint8_t red, uint8_t green, uint8_t blue) :
+        m_value(Rgb888(red, green, blue).to565())
+    {
+    }
+
+    /**
+     * Constructs the color from a RGB888 color.
+     * The intensity of the RGB888 color is applied.
+     *
+     * @param[in] color RGB888 color
+     */
+    Rgb565(const Rgb888& color) :
+        m_value(color.to565())
+    {
+    }
+
+    /**
+     * Copy the given color.
+     *
+     * @param[in] color Color, which to copy
+     */
+    Rgb565(const Rgb565& color) :
+        m_value(color.m_value)
+    {
+    }
+
+    /**
+     * Assign color.
+     *
+     * @param[in] color Color, which to assign
+     */
+    Rgb565& operator=(const Rgb565& color)
+    {
+        if (this != &color)
+        {
+            m_value = color.m_value;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Convert to RGB888 color with max. intensity.
+     */
+    operator Rgb888() const
+    {
+        return Rgb888(getRed(), getGreen(), getBlue());
+    }
+
+    /**
+     * Get red color value, expanded to 8 bit.
+     *
+     * @return Red value
+     */
+    uint8_t getRed() const
+    {
+        return expand5((m_value >> 11U) & 0x1fU);
+    }
+
+    /**
+     * Get green color value, expanded to 8 bit.
+     *
+     * @return Green value
+     */
+    uint8_t getGreen() const
+    {
+        return expand6((m_value >> 5U) & 0x3fU);
+    }
+
+    /**
+     * Get blue color value, expanded to 8 bit.
+     *
+     * @return Blue value
+     */
+    uint8_t getBlue() const
+    {
+        return expand5((m_value >> 0U) & 0x1fU);
+    }
+
+    /**
+     * Get color in 5-6-5 RGB format.
+     *
+     * @return Color in 5-6-5 RGB format
+     */
+    uint16_t to565() const
+    {
+        return m_value;
+    }
+
+    /**
+     * Set color in 5-6-5 RGB format.
+     *
+     * @param[in] value Color in 5-6-5 RGB format
+     */
+    void set565(uint16_t value)
+    {
+        m_value = value;
+    }
+
+private:
+
+    uint16_t    m_value;    /**< Color in 5-6-5 RGB format */
+
+    /**
+     * Expand a 5-bit base color to 8 bit. The upper bits are replicated
+     * into the lower bits, so full bright stays full bright.
+     *
+     * @param[in] value 5-bit base color
+     *
+     * @return 8-bit base color
+     */
+    static uint8_t expand5(uint16_t value)
+    {
+        return static_cast<uint8_t>((value << 3U) | (value >> 2U));
+    }
+
+    /**
+     * Expand a 6-bit base color to 8 bit. The upper bits are replicated
+     * into the lower bits, so full bright stays full bright.
+     *
+     * @param[in] value 6-bit base color
+     *
+     * @return 8-bit base color
+     */
+    static uint8_t expand6(uint16_t value)
+    {
+        return static_cast<uint8_t>((value << 2U) | (value >> 4U));
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* RGB565_H */
+
+/** @} */
@@ -0,0 +1,190 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color in packed RGB888 format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef RGB888_PACKED_H
+#define RGB888_PACKED_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Rgb888.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Compact color, which stores only the base colors red, green and blue as
+ * 8-bit values. In comparison to RGB888 there is no intensity byte and no
+ * intensity is applied on read.
+ */
+class Rgb888Packed
+{
+public:
+
+    /**
+     * Constructs the color black.
+     */
+    Rgb888Packed() :
+        m_red(0U),
+        m_green(0U),
+        m_blue(0U)
+    {
+    }
+
+    /**
+     * Destroys the color.
+     */
+    ~Rgb888Packed()
+    {
+    }
+
+    /**
+     * Specialized constructor, used in case every base color (RGB) is given.
+     *
+     * @param[in] red   Red value
+     * @param[in] green Green value
+     * @param[in] blue  Blue value
+     */
+    Rgb888Packed(uint8_t red, uint8_t green, uint8_t blue) :
+        m_red(red),
+        m_green(green),
+        m_blue(blue)
+    {
+    }
+
+    /**
+     * Constructs the color from a RGB888 color.
+     * The intensity of the RGB888 color is applied.
+     *
+     * @param[in] color RGB888 color
+     */
+    Rgb888Packed(const Rgb888& color) :
+        m_red(color.getRed()),
+        m_green(color.getGreen()),
+        m_blue(color.getBlue())
+    {
+    }
+
+    /**
+     * Copy the given color.
+     *
+     * @param[in] color Color, which to copy
+     */
+    Rgb888Packed(const Rgb888Packed& color) :
+        m_red(color.m_red),
+        m_green(color.m_green),
+        m_blue(color.m_blue)
+    {
+    }
+
+    /**
+     * Assign color.
+     *
+     * @param[in] color Color, which to assign
+     */
+    Rgb888Packed& operator=(const Rgb888Packed& color)
+    {
+        if (this != &color)
+        {
+            m_red   = color.m_red;
+            m_green = color.m_green;
+            m_blue  = color.m_blue;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Convert to RGB888 color with max. intensity.
+     */
+    operator Rgb888() const
+    {
+        return Rgb888(m_red, m_green, m_blue);
+    }
+
+    /**
+     * Get red color value.
+     *
+     * @return Red value
+     */
+    uint8_t getRed() const
+    {
+        return m_red;
+    }
+
+    /**
+     * Get green color value.
+     *
+     * @return Green value
+     */
+    uint8_t getGreen() const
+    {
+        return m_green;
+    }
+
+    /**
+     * Get blue color value.
+     *
+     * @return Blue value
+     */
+    uint8_t getBlue() const
+    {
+        return m_blue;
+    }
+
+private:
+
+    uint8_t m_red;      /**< Red value */
+    uint8_t m_green;    /**< Green value */
+    uint8_t m_blue;     /**< Blue value */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* RGB888_PACKED_H */
+
+/** @} */
@@ -0,0 +1,163 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Anti-aliased primitives with fixed-point maths
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "YAGfxAA.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Sine of a quarter circle [0 deg; 90 deg] in 1 deg steps, with TRIGO_SHIFT fractional bits.
+ */
+static const int16_t gSinTable[91U] =
+{
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,
+     2280,  2563,  2845,  3126,  3406,  3686,  3964,  4240,
+     4516,  4790,  5063,  5334,  5604,  5872,  6138,  6402,
+     6664,  6924,  7182,  7438,  7692,  7943,  8192,  8438,
+     8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982,
+    12176, 12365, 12551, 12733, 12911, 13085, 13255, 13421,
+    13583, 13741, 13894, 14044, 14189, 14330, 14466, 14598,
+    14726, 14849, 14968, 15082, 15191, 15296, 15396, 15491,
+    15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362,
+    16374, 16382, 16384
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+int32_t YAGfxAA::sinDeg(int32_t angle)
+{
+    int32_t result  = 0;
+    int32_t quarter = 0;
+
+    angle %= 360;
+    if (0 > angle)
+    {
+        angle += 360;
+    }
+
+    quarter = angle / 90;
+    angle   = angle % 90;
+
+    switch(quarter)
+    {
+    case 0:
+        result = gSinTable[angle];
+        break;
+
+    case 1:
+        result = gSinTable[90 - angle];
+        break;
+
+    case 2:
+        result = -gSinTable[angle];
+        break;
+
+    default:
+        result = -gSinTable[90 - angle];
+        break;
+    }
+
+    return result;
+}
+
+int32_t YAGfxAA::cosDeg(int32_t angle)
+{
+    return sinDeg(angle + 90);
+}
+
+uint32_t YAGfxAA::sqrtInt(uint64_t value)
+{
+    uint64_t result = 0U;
+    uint64_t bit    = 1ULL << 62U;
+
+    while(bit > value)
+    {
+        bit >>= 2U;
+    }
+
+    while(0U != bit)
+    {
+        if (value >= (result + bit))
+        {
+            value   -= result + bit;
+            result  = (result >> 1U) + bit;
+        }
+        else
+        {
+            result >>= 1U;
+        }
+
+        bit >>= 2U;
+    }
+
+    return static_cast<uint32_t>(result);
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,688 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Anti-aliased primitives with fixed-point maths
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef YAGFX_AA_H
+#define YAGFX_AA_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <BaseGfx.hpp>
+#include <YAColor.h>
+#include <YAGfxBlit.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Anti-aliased lines, arcs, rings and filled polygons. The coverage of every
+ * touched pixel is calculated and the color is blended with the existing pixel.
+ *
+ * All coordinates are fixed-point values with 8 fractional bits, where 0 is
+ * the upper left corner of the pixel (0, 0). Use toFixed() to get the center
+ * of a pixel. Only integer maths is used, no floating point.
+ */
+namespace YAGfxAA
+{
+
+/** Fixed-point value with 8 fractional bits. */
+typedef int32_t Fixed;
+
+/** Number of fractional bits of a fixed-point value. */
+static const uint8_t    FIXED_SHIFT         = 8U;
+
+/** Fixed-point 1.0, which is the size of one pixel. */
+static const Fixed      FIXED_ONE           = 1 << FIXED_SHIFT;
+
+/** Fixed-point 0.5, which is the half size of one pixel. */
+static const Fixed      FIXED_HALF          = FIXED_ONE / 2;
+
+/** Coverage of a fully covered pixel. */
+static const uint16_t   COVERAGE_FULL       = 256U;
+
+/** Fixed-point 1.0 of the sine and cosine results. */
+static const int32_t    TRIGO_ONE           = 16384;
+
+/** Number of fractional bits of the sine and cosine results. */
+static const uint8_t    TRIGO_SHIFT         = 14U;
+
+/** Number of sub-scanlines per pixel row, used to fill polygons. */
+static const uint8_t    POLYGON_SUBSAMPLES  = 4U;
+
+/** Max. number of polygon vertices. */
+static const uint8_t    POLYGON_MAX_VERTICES = 16U;
+
+/** Number of pixels, which are blended together while filling a polygon. */
+static const uint8_t    POLYGON_CHUNK_SIZE  = 32U;
+
+/**
+ * A point in fixed-point coordinates.
+ */
+struct Point
+{
+    Fixed   x;  /**< x-coordinate */
+    Fixed   y;  /**< y-coordinate */
+};
+
+/**
+ * Clipping rectangle. The upper left corner is inclusive, the lower right
+ * corner is exclusive.
+ */
+struct Clip
+{
+    int16_t x1; /**< x-coordinate of the upper left corner */
+    int16_t y1; /**< y-coordinate of the upper left corner */
+    int16_t x2; /**< x-coordinate of the lower right corner */
+    int16_t y2; /**< y-coordinate of the lower right corner */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Get the sine of an angle.
+ *
+ * @param[in] angle Angle in degree
+ *
+ * @return Sine as fixed-point value with TRIGO_SHIFT fractional bits.
+ */
+int32_t sinDeg(int32_t angle);
+
+/**
+ * Get the cosine of an angle.
+ *
+ * @param[in] angle Angle in degree
+ *
+ * @return Cosine as fixed-point value with TRIGO_SHIFT fractional bits.
+ */
+int32_t cosDeg(int32_t angle);
+
+/**
+ * Get the integer square root, rounded down.
+ *
+ * @param[in] value Value
+ *
+ * @return Square root
+ */
+uint32_t sqrtInt(uint64_t value);
+
+/**
+ * Get the fixed-point coordinate of a pixel center.
+ *
+ * @param[in] pixel Pixel coordinate
+ *
+ * @return Fixed-point coordinate
+ */
+inline Fixed toFixed(int16_t pixel)
+{
+    return (static_cast<Fixed>(pixel) * FIXED_ONE) + FIXED_HALF;
+}
+
+/**
+ * Get the pixel, which contains the fixed-point coordinate.
+ *
+ * @param[in] value Fixed-point coordinate
+ *
+ * @return Pixel coordinate
+ */
+inline int32_t toPixel(Fixed value)
+{
+    return value >> FIXED_SHIFT;
+}
+
+/**
+ * Get the point on a circle, where the angle 0 deg is the 12 o'clock position
+ * and the angle increases clockwise. Useful e.g. for the hands of a clock.
+ *
+ * @param[in]   centerX x-coordinate of the circle center
+ * @param[in]   centerY y-coordinate of the circle center
+ * @param[in]   radius  Radius
+ * @param[in]   angle   Angle in degree
+ *
+ * @return Point on the circle
+ */
+inline Point pointOnCircle(Fixed centerX, Fixed centerY, Fixed radius, int32_t angle)
+{
+    Point point;
+
+    point.x = centerX + ((radius * sinDeg(angle)) >> TRIGO_SHIFT);
+    point.y = centerY - ((radius * cosDeg(angle)) >> TRIGO_SHIFT);
+
+    return point;
+}
+
+/**
+ * Limit a value to a range.
+ *
+ * @param[in] value Value
+ * @param[in] min   Min. value
+ * @param[in] max   Max. value
+ *
+ * @return Limited value
+ */
+inline int32_t limit(int32_t value, int32_t min, int32_t max)
+{
+    int32_t result = value;
+
+    if (min > value)
+    {
+        result = min;
+    }
+    else if (max < value)
+    {
+        result = max;
+    }
+    else
+    {
+        ;
+    }
+
+    return result;
+}
+
+/**
+ * Get the clipping rectangle of the graphics interface.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in]   gfx     Graphics interface
+ * @param[out]  clip    Clipping rectangle
+ */
+template < typename TColor >
+inline void getClip(const BaseGfx<TColor>& gfx, Clip& clip)
+{
+    gfx.getClipRect(clip.x1, clip.y1, clip.x2, clip.y2);
+}
+
+/**
+ * Blend a color with a pixel, depended on the pixel coverage.
+ * Pixels outside the clipping rectangle are skipped.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] clip      Clipping rectangle
+ * @param[in] x         x-coordinate of the pixel
+ * @param[in] y         y-coordinate of the pixel
+ * @param[in] color     Color
+ * @param[in] coverage  Pixel coverage [0; COVERAGE_FULL]
+ */
+template < typename TColor >
+inline void blendPixel(BaseGfx<TColor>& gfx, const Clip& clip, int32_t x, int32_t y, const Color& color, uint16_t coverage)
+{
+    if ((0U < coverage) &&
+        (clip.x1 <= x) &&
+        (clip.x2 > x) &&
+        (clip.y1 <= y) &&
+        (clip.y2 > y))
+    {
+        if (COVERAGE_FULL <= coverage)
+        {
+            gfx.drawPixel(x, y, YAGfxBlit::fromColor<TColor>(color));
+        }
+        else
+        {
+            const uint16_t  REMAINING   = COVERAGE_FULL - coverage;
+            Color           dst         = YAGfxBlit::toColor(gfx.getColor(x, y));
+            uint8_t         red         = (color.getRed() * coverage + dst.getRed() * REMAINING) >> FIXED_SHIFT;
+            uint8_t         green       = (color.getGreen() * coverage + dst.getGreen() * REMAINING) >> FIXED_SHIFT;
+            uint8_t         blue        = (color.getBlue() * coverage + dst.getBlue() * REMAINING) >> FIXED_SHIFT;
+
+            gfx.drawPixel(x, y, YAGfxBlit::fromColor<TColor>(Color(red, green, blue)));
+        }
+    }
+}
+
+/**
+ * Draw an anti-aliased line with a width of one pixel (Xiaolin Wu).
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] gfx   Graphics interface
+ * @param[in] x0    x-coordinate of the start point
+ * @param[in] y0    y-coordinate of the start point
+ * @param[in] x1    x-coordinate of the end point
+ * @param[in] y1    y-coordinate of the end point
+ * @param[in] color Line color
+ */
+template < typename TColor >
+void drawLine(BaseGfx<TColor>& gfx, Fixed x0, Fixed y0, Fixed x1, Fixed y1, const Color& color)
+{
+    Clip    clip;
+    bool    isSteep     = false;
+    Fixed   tmp         = 0;
+    Fixed   deltaX      = 0;
+    Fixed   deltaY      = 0;
+    Fixed   gradient    = 0;
+    Fixed   interY      = 0;
+    int32_t majorBegin  = 0;
+    int32_t majorEnd    = 0;
+    int32_t major       = 0;
+
+    getClip(gfx, clip);
+
+    isSteep = ((y1 > y0) ? (y1 - y0) : (y0 - y1)) > ((x1 > x0) ? (x1 - x0) : (x0 - x1));
+
+    /* Walk always along the major axis. */
+    if (true == isSteep)
+    {
+        tmp = x0;
+        x0  = y0;
+        y0  = tmp;
+        tmp = x1;
+        x1  = y1;
+        y1  = tmp;
+
+        majorBegin  = clip.y1;
+        majorEnd    = clip.y2 - 1;
+    }
+    else
+    {
+        majorBegin  = clip.x1;
+        majorEnd    = clip.x2 - 1;
+    }
+
+    if (x0 > x1)
+    {
+        tmp = x0;
+        x0  = x1;
+        x1  = tmp;
+        tmp = y0;
+        y0  = y1;
+        y1  = tmp;
+    }
+
+    /* Move into the pixel center space, where an integer value is a pixel center. */
+    x0 -= FIXED_HALF;
+    y0 -= FIXED_HALF;
+    x1 -= FIXED_HALF;
+    y1 -= FIXED_HALF;
+
+    deltaX  = x1 - x0;
+    deltaY  = y1 - y0;
+
+    if (0 < deltaX)
+    {
+        gradient = (deltaY * FIXED_ONE) / deltaX;
+    }
+
+    /* Skip the pixels outside the clipping rectangle along the major axis. */
+    majorBegin  = (toPixel(x0 + FIXED_HALF) > majorBegin) ? toPixel(x0 + FIXED_HALF) : majorBegin;
+    majorEnd    = (toPixel(x1 + FIXED_HALF) < majorEnd) ? toPixel(x1 + FIXED_HALF) : majorEnd;
+    interY      = y0 + ((gradient * (majorBegin * FIXED_ONE - x0)) >> FIXED_SHIFT);
+
+    for(major = majorBegin; major <= majorEnd; ++major)
+    {
+        int32_t     minor       = toPixel(interY);
+        uint16_t    frac        = interY & (FIXED_ONE - 1);
+        Fixed       weight      = FIXED_ONE;
+        uint16_t    coverage0   = 0U;
+        uint16_t    coverage1   = 0U;
+
+        /* The first and the last pixel are only partly covered along the major axis. */
+        if (0 < deltaX)
+        {
+            Fixed   low     = major * FIXED_ONE - FIXED_HALF;
+            Fixed   high    = major * FIXED_ONE + FIXED_HALF;
+
+            low     = (x0 > low) ? x0 : low;
+            high    = (x1 < high) ? x1 : high;
+            weight  = limit(high - low, 0, FIXED_ONE);
+        }
+
+        coverage0   = ((FIXED_ONE - frac) * weight) >> FIXED_SHIFT;
+        coverage1   = (frac * weight) >> FIXED_SHIFT;
+
+        if (true == isSteep)
+        {
+            blendPixel(gfx, clip, minor, major, color, coverage0);
+            blendPixel(gfx, clip, minor + 1, major, color, coverage1);
+        }
+        else
+        {
+            blendPixel(gfx, clip, major, minor, color, coverage0);
+            blendPixel(gfx, clip, major, minor + 1, color, coverage1);
+        }
+
+        interY += gradient;
+    }
+}
+
+/**
+ * Draw an anti-aliased arc of a ring. The angle 0 deg is the 12 o'clock position
+ * and the angle increases clockwise.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] gfx           Graphics interface
+ * @param[in] centerX       x-coordinate of the center
+ * @param[in] centerY       y-coordinate of the center
+ * @param[in] radius        Outer radius
+ * @param[in] thickness     Ring thickness, at least the radius fills the circle.
+ * @param[in] startAngle    Start angle in degree
+ * @param[in] endAngle      End angle in degree, at least 360 deg after the start angle draws the whole ring.
+ * @param[in] color         Arc color
+ */
+template < typename TColor >
+void drawArc(BaseGfx<TColor>& gfx, Fixed centerX, Fixed centerY, Fixed radius, Fixed thickness, int32_t startAngle, int32_t endAngle, const Color& color)
+{
+    Clip    clip;
+    Fixed   innerRadius = radius - thickness;
+    int32_t sweep       = endAngle - startAngle;
+    bool    isFull      = (360 <= sweep);
+    int32_t startDirX   = sinDeg(startAngle);
+    int32_t startDirY   = -cosDeg(startAngle);
+    int32_t endDirX     = sinDeg(endAngle);
+    int32_t endDirY     = -cosDeg(endAngle);
+    int32_t xBegin      = 0;
+    int32_t xEnd        = 0;
+    int32_t yBegin      = 0;
+    int32_t yEnd        = 0;
+    int32_t x           = 0;
+    int32_t y           = 0;
+
+    getClip(gfx, clip);
+
+    sweep %= 360;
+    if (0 > sweep)
+    {
+        sweep += 360;
+    }
+
+    xBegin  = limit(toPixel(centerX - radius) - 1, clip.x1, clip.x2);
+    xEnd    = limit(toPixel(centerX + radius) + 1, clip.x1, clip.x2 - 1);
+    yBegin  = limit(toPixel(centerY - radius) - 1, clip.y1, clip.y2);
+    yEnd    = limit(toPixel(centerY + radius) + 1, clip.y1, clip.y2 - 1);
+
+    if ((0 < radius) &&
+        (0 < thickness) &&
+        ((true == isFull) || (0 < sweep)))
+    {
+        for(y = yBegin; y <= yEnd; ++y)
+        {
+            Fixed distY = toFixed(y) - centerY;
+
+            for(x = xBegin; x <= xEnd; ++x)
+            {
+                Fixed       distX       = toFixed(x) - centerX;
+                /* The squared distance doesn't fit into 32 bit for larger radii. */
+                int64_t     distSquare  = static_cast<int64_t>(distX) * distX + static_cast<int64_t>(distY) * distY;
+                Fixed       dist        = static_cast<Fixed>(sqrtInt(static_cast<uint64_t>(distSquare)));
+                int32_t     coverage    = limit(radius - dist + FIXED_HALF, 0, FIXED_ONE);
+
+                if (0 < innerRadius)
+                {
+                    int32_t innerCoverage = limit(dist - innerRadius + FIXED_HALF, 0, FIXED_ONE);
+
+                    coverage = (innerCoverage < coverage) ? innerCoverage : coverage;
+                }
+
+                if ((0 < coverage) && (false == isFull))
+                {
+                    /* Signed distances to the start and the end edge, positive on the arc side. */
+                    Fixed   startDist       = static_cast<Fixed>((static_cast<int64_t>(startDirX) * distY - static_cast<int64_t>(startDirY) * distX) >> TRIGO_SHIFT);
+                    Fixed   endDist         = static_cast<Fixed>((static_cast<int64_t>(endDirY) * distX - static_cast<int64_t>(endDirX) * distY) >> TRIGO_SHIFT);
+                    int32_t startCoverage   = limit(startDist + FIXED_HALF, 0, FIXED_ONE);
+                    int32_t endCoverage     = limit(endDist + FIXED_HALF, 0, FIXED_ONE);
+                    int32_t angleCoverage   = 0;
+
+                    /* Up to a half circle, the arc is the intersection of both half planes,
+                     * otherwise it is the union of them.
+                     */
+                    if (180 >= sweep)
+                    {
+                        angleCoverage = (startCoverage < endCoverage) ? startCoverage : endCoverage;
+                    }
+                    else
+                    {
+                        angleCoverage = (startCoverage > endCoverage) ? startCoverage : endCoverage;
+                    }
+
+                    coverage = (coverage * angleCoverage) >> FIXED_SHIFT;
+                }
+
+                blendPixel(gfx, clip, x, y, color, coverage);
+            }
+        }
+    }
+}
+
+/**
+ * Draw an anti-aliased ring.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] centerX   x-coordinate of the center
+ * @param[in] centerY   y-coordinate of the center
+ * @param[in] radius    Outer radius
+ * @param[in] thickness Ring thickness
+ * @param[in] color     Ring color
+ */
+template < typename TColor >
+inline void drawRing(BaseGfx<TColor>& gfx, Fixed centerX, Fixed centerY, Fixed radius, Fixed thickness, const Color& color)
+{
+    drawArc(gfx, centerX, centerY, radius, thickness, 0, 360, color);
+}
+
+/**
+ * Draw an anti-aliased circle with a line width of one pixel.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] centerX   x-coordinate of the center
+ * @param[in] centerY   y-coordinate of the center
+ * @param[in] radius    Radius
+ * @param[in] color     Circle color
+ */
+template < typename TColor >
+inline void drawCircle(BaseGfx<TColor>& gfx, Fixed centerX, Fixed centerY, Fixed radius, const Color& color)
+{
+    drawArc(gfx, centerX, centerY, radius + FIXED_HALF, FIXED_ONE, 0, 360, color);
+}
+
+/**
+ * Draw an anti-aliased filled circle.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] centerX   x-coordinate of the center
+ * @param[in] centerY   y-coordinate of the center
+ * @param[in] radius    Radius
+ * @param[in] color     Fill color
+ */
+template < typename TColor >
+inline void fillCircle(BaseGfx<TColor>& gfx, Fixed centerX, Fixed centerY, Fixed radius, const Color& color)
+{
+    drawArc(gfx, centerX, centerY, radius, radius, 0, 360, color);
+}
+
+/**
+ * Draw an anti-aliased filled polygon with the even-odd rule.
+ * Every pixel row is sampled with POLYGON_SUBSAMPLES sub-scanlines, which are
+ * covered exactly in horizontal direction.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] points    Polygon vertices
+ * @param[in] count     Number of vertices [3; POLYGON_MAX_VERTICES]
+ * @param[in] color     Fill color
+ */
+template < typename TColor >
+void fillPolygon(BaseGfx<TColor>& gfx, const Point* points, uint8_t count, const Color& color)
+{
+    const Fixed SUBSCANLINE_HEIGHT  = FIXED_ONE / POLYGON_SUBSAMPLES;
+    Clip        clip;
+    Fixed       crossings[POLYGON_SUBSAMPLES][POLYGON_MAX_VERTICES];
+    uint8_t     crossingCnt[POLYGON_SUBSAMPLES];
+    uint16_t    coverage[POLYGON_CHUNK_SIZE];
+    Fixed       minX        = 0;
+    Fixed       maxX        = 0;
+    Fixed       minY        = 0;
+    Fixed       maxY        = 0;
+    int32_t     xBegin      = 0;
+    int32_t     xEnd        = 0;
+    int32_t     yBegin      = 0;
+    int32_t     yEnd        = 0;
+    int32_t     y           = 0;
+    uint8_t     idx         = 0U;
+
+    if ((nullptr == points) ||
+        (3U > count) ||
+        (POLYGON_MAX_VERTICES < count))
+    {
+        return;
+    }
+
+    getClip(gfx, clip);
+
+    minX = points[0].x;
+    maxX = points[0].x;
+    minY = points[0].y;
+    maxY = points[0].y;
+
+    for(idx = 1U; idx < count; ++idx)
+    {
+        minX = (points[idx].x < minX) ? points[idx].x : minX;
+        maxX = (points[idx].x > maxX) ? points[idx].x : maxX;
+        minY = (points[idx].y < minY) ? points[idx].y : minY;
+        maxY = (points[idx].y > maxY) ? points[idx].y : maxY;
+    }
+
+    xBegin  = limit(toPixel(minX), clip.x1, clip.x2);
+    xEnd    = limit(toPixel(maxX) + 1, clip.x1, clip.x2);
+    yBegin  = limit(toPixel(minY), clip.y1, clip.y2);
+    yEnd    = limit(toPixel(maxY) + 1, clip.y1, clip.y2);
+
+    for(y = yBegin; y < yEnd; ++y)
+    {
+        uint8_t subIdx  = 0U;
+        int32_t chunkX  = 0;
+
+        /* Find and sort the edge crossings of every sub-scanline. */
+        for(subIdx = 0U; subIdx < POLYGON_SUBSAMPLES; ++subIdx)
+        {
+            Fixed sampleY = y * FIXED_ONE + subIdx * SUBSCANLINE_HEIGHT + SUBSCANLINE_HEIGHT / 2;
+
+            crossingCnt[subIdx] = 0U;
+
+            for(idx = 0U; idx < count; ++idx)
+            {
+                const Point&    from    = points[idx];
+                const Point&    to      = points[(idx + 1U) % count];
+
+                if (((from.y <= sampleY) && (to.y > sampleY)) ||
+                    ((to.y <= sampleY) && (from.y > sampleY)))
+                {
+                    int64_t offset  = static_cast<int64_t>(sampleY - from.y) * (to.x - from.x) / (to.y - from.y);
+                    Fixed   crossX  = from.x + static_cast<Fixed>(offset);
+                    uint8_t pos     = crossingCnt[subIdx];
+
+                    /* Insertion sort */
+                    while((0U < pos) && (crossings[subIdx][pos - 1U] > crossX))
+                    {
+                        crossings[subIdx][pos] = crossings[subIdx][pos - 1U];
+                        --pos;
+                    }
+
+                    crossings[subIdx][pos] = crossX;
+                    ++crossingCnt[subIdx];
+                }
+            }
+        }
+
+        /* Accumulate the coverage chunk by chunk and blend it. */
+        for(chunkX = xBegin; chunkX < xEnd; chunkX += POLYGON_CHUNK_SIZE)
+        {
+            int32_t chunkEnd    = ((chunkX + POLYGON_CHUNK_SIZE) < xEnd) ? (chunkX + POLYGON_CHUNK_SIZE) : xEnd;
+            int32_t x           = 0;
+
+            for(x = chunkX; x < chunkEnd; ++x)
+            {
+                coverage[x - chunkX] = 0U;
+            }
+
+            for(subIdx = 0U; subIdx < POLYGON_SUBSAMPLES; ++subIdx)
+            {
+                for(idx = 0U; (idx + 1U) < crossingCnt[subIdx]; idx += 2U)
+                {
+                    Fixed   spanBegin   = crossings[subIdx][idx];
+                    Fixed   spanEnd     = crossings[subIdx][idx + 1U];
+                    int32_t pixelBegin  = limit(toPixel(spanBegin), chunkX, chunkEnd);
+                    int32_t pixelEnd    = limit(toPixel(spanEnd) + 1, chunkX, chunkEnd);
+
+                    for(x = pixelBegin; x < pixelEnd; ++x)
+                    {
+                        Fixed low   = x * FIXED_ONE;
+                        Fixed high  = low + FIXED_ONE;
+
+                        low     = (spanBegin > low) ? spanBegin : low;
+                        high    = (spanEnd < high) ? spanEnd : high;
+
+                        if (low < high)
+                        {
+                            coverage[x - chunkX] += (high - low) / POLYGON_SUBSAMPLES;
+                        }
+                    }
+                }
+            }
+
+            for(x = chunkX; x < chunkEnd; ++x)
+            {
+                blendPixel(gfx, clip, x, y, color, coverage[x - chunkX]);
+            }
+        }
+    }
+}
+
+}
+
+#endif  /* YAGFX_AA_H */
+
+/** @} */
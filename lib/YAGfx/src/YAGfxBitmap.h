@@ -45,6 +45,8 @@
  *****************************************************************************/
 #include <BaseGfxBitmap.hpp>
 #include <YAColor.h>
+#include <Rgb565.h>
+#include <Rgb888Packed.h>
 
 /******************************************************************************
  * Macros
@@ -71,6 +73,51 @@ using YAGfxDynamicBitmap = BaseGfxDynamicBitmap<Color>;
 /** GFX overlay bitmap with concrete color. */
 using YAGfxOverlayBitmap = BaseGfxOverlayBitmap<Color>;
 
+/** GFX bitmap interface with compact RGB565 color (2 byte per pixel). */
+using YAGfxBitmapRgb565 = BaseGfxBitmap<Rgb565>;
+
+/** GFX static bitmap with compact RGB565 color (2 byte per pixel).
+ * 
+ * @tparam width    Bitmap width in pixels.
+ * @tparam height   Bitmap height in pixels.
+ */
+template < uint16_t width, uint16_t height >
+using YAGfxStaticBitmapRgb565 = BaseGfxStaticBitmap<Rgb565, width, height>;
+
+/** GFX dynamic bitmap with compact RGB565 color (2 byte per pixel). */
+using YAGfxDynamicBitmapRgb565 = BaseGfxDynamicBitmap<Rgb565>;
+
+/** GFX overlay bitmap with compact RGB565 color (2 byte per pixel). */
+using YAGfxOverlayBitmapRgb565 = BaseGfxOverlayBitmap<Rgb565>;
+
+/** GFX bitmap interface with packed RGB888 color (3 byte per pixel). */
+using YAGfxBitmapRgb888Packed = BaseGfxBitmap<Rgb888Packed>;
+
+/** GFX static bitmap with packed RGB888 color (3 byte per pixel).
+ * 
+ * @tparam width    Bitmap width in pixels.
+ * @tparam height   Bitmap height in pixels.
+ */
+template < uint16_t width, uint16_t height >
+using YAGfxStaticBitmapRgb888Packed = BaseGfxStaticBitmap<Rgb888Packed, width, height>;
+
+/** GFX dynamic bitmap with packed RGB888 color (3 byte per pixel). */
+using YAGfxDynamicBitmapRgb888Packed = BaseGfxDynamicBitmap<Rgb888Packed>;
+
+/** GFX bitmap interface with 8-bit palette index (1 byte per pixel), see YAGfxPalette. */
+using YAGfxBitmapPalette8 = BaseGfxBitmap<uint8_t>;
+
+/** GFX static bitmap with 8-bit palette index (1 byte per pixel), see YAGfxPalette.
+ * 
+ * @tparam width    Bitmap width in pixels.
+ * @tparam height   Bitmap height in pixels.
+ */
+template < uint16_t width, uint16_t height >
+using YAGfxStaticBitmapPalette8 = BaseGfxStaticBitmap<uint8_t, width, height>;
+
+/** GFX dynamic bitmap with 8-bit palette index (1 byte per pixel), see YAGfxPalette. */
+using YAGfxDynamicBitmapPalette8 = BaseGfxDynamicBitmap<uint8_t>;
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
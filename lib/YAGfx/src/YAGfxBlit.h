@@ -0,0 +1,345 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Blit and convert kernels between the bitmap pixel formats
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef YAGFX_BLIT_H
+#define YAGFX_BLIT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <type_traits>
+#include <BaseGfx.hpp>
+#include <YAColor.h>
+#include <Rgb565.h>
+#include <Rgb888Packed.h>
+#include <YAGfxPalette.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Blit kernels, which copy a source bitmap to a destination at a given position.
+ * Source and destination may have different pixel formats (Color, Rgb565,
+ * Rgb888Packed or 8-bit palette index), the pixels are converted on the fly.
+ * The source is clipped to the destination once, so no pixel outside is touched.
+ */
+namespace YAGfxBlit
+{
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Clip a source range to the destination clipping range along one axis.
+ *
+ * @param[in]   pos         Position of the source in the destination
+ * @param[in]   srcLength   Source length in pixels
+ * @param[in]   clip1       First pixel of the destination clipping range
+ * @param[in]   clip2       First pixel after the destination clipping range
+ * @param[out]  begin       First visible source pixel
+ * @param[out]  end         First not visible source pixel after the visible ones
+ */
+inline void clipRange(int16_t pos, uint16_t srcLength, int16_t clip1, int16_t clip2, int32_t& begin, int32_t& end)
+{
+    begin   = static_cast<int32_t>(clip1) - static_cast<int32_t>(pos);
+    end     = static_cast<int32_t>(clip2) - static_cast<int32_t>(pos);
+
+    if (0 > begin)
+    {
+        begin = 0;
+    }
+
+    if (static_cast<int32_t>(srcLength) < end)
+    {
+        end = srcLength;
+    }
+}
+
+/**
+ * Clip a source to the clipping rectangle of the destination. A destination
+ * context, e.g. limited to a damaged region, is considered this way.
+ *
+ * @tparam TDst Destination pixel format
+ * @tparam TSrc Source pixel format
+ *
+ * @param[in]   dst     Destination
+ * @param[in]   x       x-coordinate of the upper left source corner in the destination
+ * @param[in]   y       y-coordinate of the upper left source corner in the destination
+ * @param[in]   src     Source
+ * @param[out]  beginX  First visible source column
+ * @param[out]  endX    First not visible source column after the visible ones
+ * @param[out]  beginY  First visible source row
+ * @param[out]  endY    First not visible source row after the visible ones
+ */
+template < typename TDst, typename TSrc >
+inline void clip(const BaseGfx<TDst>& dst, int16_t x, int16_t y, const BaseGfx<TSrc>& src, int32_t& beginX, int32_t& endX, int32_t& beginY, int32_t& endY)
+{
+    int16_t clipX1  = 0;
+    int16_t clipY1  = 0;
+    int16_t clipX2  = 0;
+    int16_t clipY2  = 0;
+
+    dst.getClipRect(clipX1, clipY1, clipX2, clipY2);
+
+    clipRange(x, src.getWidth(), clipX1, clipX2, beginX, endX);
+    clipRange(y, src.getHeight(), clipY1, clipY2, beginY, endY);
+}
+
+/**
+ * Convert a pixel to the general color.
+ *
+ * @tparam TSrc Source pixel format
+ *
+ * @param[in] pixel Source pixel
+ *
+ * @return Color
+ */
+template < typename TSrc >
+inline Color toColor(const TSrc& pixel)
+{
+    static_assert(false == std::is_integral<TSrc>::value, "A palettized source needs a palette.");
+
+    return static_cast<Color>(pixel);
+}
+
+/**
+ * Convert the general color to a pixel.
+ *
+ * @tparam TDst Destination pixel format
+ *
+ * @param[in] color Color
+ *
+ * @return Destination pixel
+ */
+template < typename TDst >
+inline TDst fromColor(const Color& color)
+{
+    static_assert(false == std::is_integral<TDst>::value, "A palettized destination needs a palette.");
+
+    return TDst(color);
+}
+
+/**
+ * Blit a source bitmap with the same pixel format, without any conversion.
+ *
+ * @tparam TColor Pixel format
+ *
+ * @param[in] dst   Destination
+ * @param[in] x     x-coordinate of the upper left source corner in the destination
+ * @param[in] y     y-coordinate of the upper left source corner in the destination
+ * @param[in] src   Source
+ */
+template < typename TColor >
+void blit(BaseGfx<TColor>& dst, int16_t x, int16_t y, const BaseGfx<TColor>& src)
+{
+    int32_t srcX    = 0;
+    int32_t srcY    = 0;
+    int32_t beginX  = 0;
+    int32_t endX    = 0;
+    int32_t beginY  = 0;
+    int32_t endY    = 0;
+
+    clip(dst, x, y, src, beginX, endX, beginY, endY);
+
+    for(srcY = beginY; srcY < endY; ++srcY)
+    {
+        for(srcX = beginX; srcX < endX; ++srcX)
+        {
+            dst.drawPixel(x + srcX, y + srcY, src.getColor(srcX, srcY));
+        }
+    }
+}
+
+/**
+ * Blit a source bitmap and convert the pixels to the destination pixel format.
+ *
+ * @tparam TDst Destination pixel format
+ * @tparam TSrc Source pixel format
+ *
+ * @param[in] dst   Destination
+ * @param[in] x     x-coordinate of the upper left source corner in the destination
+ * @param[in] y     y-coordinate of the upper left source corner in the destination
+ * @param[in] src   Source
+ */
+template < typename TDst, typename TSrc >
+void blit(BaseGfx<TDst>& dst, int16_t x, int16_t y, const BaseGfx<TSrc>& src)
+{
+    int32_t srcX    = 0;
+    int32_t srcY    = 0;
+    int32_t beginX  = 0;
+    int32_t endX    = 0;
+    int32_t beginY  = 0;
+    int32_t endY    = 0;
+
+    clip(dst, x, y, src, beginX, endX, beginY, endY);
+
+    for(srcY = beginY; srcY < endY; ++srcY)
+    {
+        for(srcX = beginX; srcX < endX; ++srcX)
+        {
+            dst.drawPixel(x + srcX, y + srcY, fromColor<TDst>(toColor(src.getColor(srcX, srcY))));
+        }
+    }
+}
+
+/**
+ * Blit a 8-bit palettized source bitmap and resolve the pixels via palette.
+ *
+ * @tparam TDst Destination pixel format
+ *
+ * @param[in] dst       Destination
+ * @param[in] x         x-coordinate of the upper left source corner in the destination
+ * @param[in] y         y-coordinate of the upper left source corner in the destination
+ * @param[in] src       Source
+ * @param[in] palette   Source palette
+ */
+template < typename TDst >
+void blit(BaseGfx<TDst>& dst, int16_t x, int16_t y, const BaseGfx<uint8_t>& src, const YAGfxPalette& palette)
+{
+    int32_t srcX    = 0;
+    int32_t srcY    = 0;
+    int32_t beginX  = 0;
+    int32_t endX    = 0;
+    int32_t beginY  = 0;
+    int32_t endY    = 0;
+
+    clip(dst, x, y, src, beginX, endX, beginY, endY);
+
+    for(srcY = beginY; srcY < endY; ++srcY)
+    {
+        for(srcX = beginX; srcX < endX; ++srcX)
+        {
+            dst.drawPixel(x + srcX, y + srcY, fromColor<TDst>(palette.getColor(src.getColor(srcX, srcY))));
+        }
+    }
+}
+
+/**
+ * Blit a source bitmap into a 8-bit palettized destination. Every pixel is
+ * mapped to the nearest palette entry.
+ *
+ * @tparam TSrc Source pixel format
+ *
+ * @param[in] dst       Destination
+ * @param[in] x         x-coordinate of the upper left source corner in the destination
+ * @param[in] y         y-coordinate of the upper left source corner in the destination
+ * @param[in] src       Source
+ * @param[in] palette   Destination palette
+ */
+template < typename TSrc >
+void quantize(BaseGfx<uint8_t>& dst, int16_t x, int16_t y, const BaseGfx<TSrc>& src, const YAGfxPalette& palette)
+{
+    int32_t srcX    = 0;
+    int32_t srcY    = 0;
+    int32_t beginX  = 0;
+    int32_t endX    = 0;
+    int32_t beginY  = 0;
+    int32_t endY    = 0;
+
+    clip(dst, x, y, src, beginX, endX, beginY, endY);
+
+    for(srcY = beginY; srcY < endY; ++srcY)
+    {
+        for(srcX = beginX; srcX < endX; ++srcX)
+        {
+            dst.drawPixel(x + srcX, y + srcY, palette.findNearest(toColor(src.getColor(srcX, srcY))));
+        }
+    }
+}
+
+/**
+ * Blit a source bitmap and dim all pixels by a global intensity.
+ * The source is not modified, which allows non-destructive fading without a
+ * intensity per pixel.
+ *
+ * @tparam TDst Destination pixel format
+ * @tparam TSrc Source pixel format
+ *
+ * @param[in] dst       Destination
+ * @param[in] x         x-coordinate of the upper left source corner in the destination
+ * @param[in] y         y-coordinate of the upper left source corner in the destination
+ * @param[in] src       Source
+ * @param[in] intensity Intensity [0; 255] - 0: min. bright / 255: max. bright
+ */
+template < typename TDst, typename TSrc >
+void blitDimmed(BaseGfx<TDst>& dst, int16_t x, int16_t y, const BaseGfx<TSrc>& src, uint8_t intensity)
+{
+    if (Color::MAX_BRIGHT == intensity)
+    {
+        blit(dst, x, y, src);
+    }
+    else
+    {
+        const uint16_t  INTENSITY   = intensity;
+        int32_t         srcX        = 0;
+        int32_t         srcY        = 0;
+        int32_t         beginX      = 0;
+        int32_t         endX        = 0;
+        int32_t         beginY      = 0;
+        int32_t         endY        = 0;
+
+        clip(dst, x, y, src, beginX, endX, beginY, endY);
+
+        for(srcY = beginY; srcY < endY; ++srcY)
+        {
+            for(srcX = beginX; srcX < endX; ++srcX)
+            {
+                Color   color   = toColor(src.getColor(srcX, srcY));
+                uint8_t red     = (color.getRed() * INTENSITY) / Color::MAX_BRIGHT;
+                uint8_t green   = (color.getGreen() * INTENSITY) / Color::MAX_BRIGHT;
+                uint8_t blue    = (color.getBlue() * INTENSITY) / Color::MAX_BRIGHT;
+
+                dst.drawPixel(x + srcX, y + srcY, fromColor<TDst>(Color(red, green, blue)));
+            }
+        }
+    }
+}
+
+}
+
+#endif  /* YAGFX_BLIT_H */
+
+/** @} */
@@ -0,0 +1,367 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Damaged regions of a canvas
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef YAGFX_DAMAGE_H
+#define YAGFX_DAMAGE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A small list of damaged rectangles of a canvas, which were changed and must
+ * be repainted respectively transferred. Overlapping or touching rectangles are
+ * merged. If the list is full, the rectangle is merged with the one, which
+ * grows least.
+ */
+class YAGfxDamage
+{
+public:
+
+    /**
+     * A rectangle.
+     */
+    struct Rect
+    {
+        int16_t     x;      /**< x-coordinate of the upper left corner */
+        int16_t     y;      /**< y-coordinate of the upper left corner */
+        uint16_t    width;  /**< Width in pixel */
+        uint16_t    height; /**< Height in pixel */
+
+        /**
+         * Constructs a empty rectangle.
+         */
+        Rect() :
+            x(0),
+            y(0),
+            width(0U),
+            height(0U)
+        {
+        }
+
+        /**
+         * Constructs a rectangle.
+         *
+         * @param[in] posX        x-coordinate of the upper left corner
+         * @param[in] posY        y-coordinate of the upper left corner
+         * @param[in] rectWidth   Width in pixel
+         * @param[in] rectHeight  Height in pixel
+         */
+        Rect(int16_t posX, int16_t posY, uint16_t rectWidth, uint16_t rectHeight) :
+            x(posX),
+            y(posY),
+            width(rectWidth),
+            height(rectHeight)
+        {
+        }
+
+        /**
+         * Is the rectangle empty?
+         *
+         * @return If empty, it will return true otherwise false.
+         */
+        bool isEmpty() const
+        {
+            return ((0U == width) || (0U == height));
+        }
+
+        /**
+         * Get the intersection with another rectangle.
+         *
+         * @param[in] rect  Other rectangle
+         *
+         * @return Intersection, which is empty if they don't intersect.
+         */
+        Rect intersect(const Rect& rect) const
+        {
+            Rect    result;
+            int32_t x1      = (x > rect.x) ? x : rect.x;
+            int32_t y1      = (y > rect.y) ? y : rect.y;
+            int32_t x2      = (getRight() < rect.getRight()) ? getRight() : rect.getRight();
+            int32_t y2      = (getBottom() < rect.getBottom()) ? getBottom() : rect.getBottom();
+
+            if ((x1 < x2) &&
+                (y1 < y2))
+            {
+                result = Rect(x1, y1, x2 - x1, y2 - y1);
+            }
+
+            return result;
+        }
+
+        /**
+         * Get the x-coordinate right of the rectangle.
+         *
+         * @return x-coordinate of the first column after the rectangle
+         */
+        int32_t getRight() const
+        {
+            return static_cast<int32_t>(x) + width;
+        }
+
+        /**
+         * Get the y-coordinate below the rectangle.
+         *
+         * @return y-coordinate of the first row after the rectangle
+         */
+        int32_t getBottom() const
+        {
+            return static_cast<int32_t>(y) + height;
+        }
+    };
+
+    /** Max. number of damaged rectangles. */
+    static const uint8_t MAX_RECTS = 4U;
+
+    /**
+     * Constructs a empty damage list.
+     */
+    YAGfxDamage() :
+        m_rects(),
+        m_count(0U)
+    {
+    }
+
+    /**
+     * Destroys the damage list.
+     */
+    ~YAGfxDamage()
+    {
+    }
+
+    /**
+     * Clear the damage list.
+     */
+    void clear()
+    {
+        m_count = 0U;
+    }
+
+    /**
+     * Is nothing damaged?
+     *
+     * @return If nothing is damaged, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return (0U == m_count);
+    }
+
+    /**
+     * Get the number of damaged rectangles.
+     *
+     * @return Number of damaged rectangles
+     */
+    uint8_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Get a damaged rectangle.
+     *
+     * @param[in] index Index [0; getCount()[
+     *
+     * @return Damaged rectangle
+     */
+    const Rect& getRect(uint8_t index) const
+    {
+        return m_rects[index % MAX_RECTS];
+    }
+
+    /**
+     * Add a damaged rectangle. A empty rectangle is ignored.
+     *
+     * @param[in] rect  Damaged rectangle
+     */
+    void add(const Rect& rect)
+    {
+        uint8_t index       = 0U;
+        Rect    merged      = rect;
+        bool    isMerged    = false;
+
+        if (false == rect.isEmpty())
+        {
+            /* Merge all rectangles, which overlap or touch the new one. Because the
+             * merged rectangle grows, it is checked again from the begin.
+             */
+            do
+            {
+                isMerged = false;
+
+                for(index = 0U; (index < m_count) && (false == isMerged); ++index)
+                {
+                    if (true == isTouching(m_rects[index], merged))
+                    {
+                        merged = unite(m_rects[index], merged);
+                        remove(index);
+                        isMerged = true;
+                    }
+                }
+            }
+            while(true == isMerged);
+
+            /* No space left? Merge with the rectangle, which grows least. */
+            if (MAX_RECTS <= m_count)
+            {
+                uint8_t bestIndex   = 0U;
+                int32_t bestGrowth  = INT32_MAX;
+
+                for(index = 0U; index < m_count; ++index)
+                {
+                    int32_t growth = getArea(unite(m_rects[index], merged)) - getArea(m_rects[index]);
+
+                    if (bestGrowth > growth)
+                    {
+                        bestGrowth  = growth;
+                        bestIndex   = index;
+                    }
+                }
+
+                merged = unite(m_rects[bestIndex], merged);
+                remove(bestIndex);
+
+                /* The merged rectangle may touch others now. */
+                add(merged);
+            }
+            else
+            {
+                m_rects[m_count] = merged;
+                ++m_count;
+            }
+        }
+    }
+
+    /**
+     * Add a damaged rectangle. A empty rectangle is ignored.
+     *
+     * @param[in] x         x-coordinate of the upper left corner
+     * @param[in] y         y-coordinate of the upper left corner
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    void add(int16_t x, int16_t y, uint16_t width, uint16_t height)
+    {
+        add(Rect(x, y, width, height));
+    }
+
+private:
+
+    Rect    m_rects[MAX_RECTS]; /**< Damaged rectangles */
+    uint8_t m_count;            /**< Number of damaged rectangles */
+
+    /**
+     * Do two rectangles overlap or touch each other?
+     *
+     * @param[in] rect1 Rectangle 1
+     * @param[in] rect2 Rectangle 2
+     *
+     * @return If they overlap or touch, it will return true otherwise false.
+     */
+    static bool isTouching(const Rect& rect1, const Rect& rect2)
+    {
+        return ((rect1.x <= rect2.getRight()) &&
+                (rect2.x <= rect1.getRight()) &&
+                (rect1.y <= rect2.getBottom()) &&
+                (rect2.y <= rect1.getBottom()));
+    }
+
+    /**
+     * Get the bounding rectangle of two rectangles.
+     *
+     * @param[in] rect1 Rectangle 1
+     * @param[in] rect2 Rectangle 2
+     *
+     * @return Bounding rectangle
+     */
+    static Rect unite(const Rect& rect1, const Rect& rect2)
+    {
+        int32_t x1  = (rect1.x < rect2.x) ? rect1.x : rect2.x;
+        int32_t y1  = (rect1.y < rect2.y) ? rect1.y : rect2.y;
+        int32_t x2  = (rect1.getRight() > rect2.getRight()) ? rect1.getRight() : rect2.getRight();
+        int32_t y2  = (rect1.getBottom() > rect2.getBottom()) ? rect1.getBottom() : rect2.getBottom();
+
+        return Rect(x1, y1, x2 - x1, y2 - y1);
+    }
+
+    /**
+     * Get the area of a rectangle.
+     *
+     * @param[in] rect  Rectangle
+     *
+     * @return Area in pixel
+     */
+    static int32_t getArea(const Rect& rect)
+    {
+        return static_cast<int32_t>(rect.width) * rect.height;
+    }
+
+    /**
+     * Remove a rectangle from the list.
+     *
+     * @param[in] index Index of the rectangle
+     */
+    void remove(uint8_t index)
+    {
+        --m_count;
+
+        while(index < m_count)
+        {
+            m_rects[index] = m_rects[index + 1U];
+            ++index;
+        }
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* YAGFX_DAMAGE_H */
+
+/** @} */
@@ -45,6 +45,7 @@
  *****************************************************************************/
 #include <BaseGfxMap.hpp>
 #include <YAColor.h>
+#include <Rgb565.h>
 
 /******************************************************************************
  * Macros
@@ -57,6 +58,9 @@
 /** GFX map canvas with concrete color. A canvas maps always to a underlying bitmap. */
 using YAGfxMap = BaseGfxMap<Color>;
 
+/** GFX map canvas with compact RGB565 color (2 byte per pixel). A canvas maps always to a underlying bitmap. */
+using YAGfxMapRgb565 = BaseGfxMap<Rgb565>;
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
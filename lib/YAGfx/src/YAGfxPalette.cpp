@@ -0,0 +1,138 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color palette for 8-bit palettized bitmaps
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "YAGfxPalette.h"
+
+#include <AllocTracker.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool YAGfxPalette::create(uint16_t size)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr == m_colors) &&
+        (0U < size) &&
+        (MAX_SIZE >= size))
+    {
+        m_colors = AllocTracker::getInstance().newArray<Rgb888Packed>(AllocTracker::TAG_GFX, size);
+
+        if (nullptr != m_colors)
+        {
+            m_size = size;
+
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void YAGfxPalette::release()
+{
+    if (nullptr != m_colors)
+    {
+        AllocTracker::getInstance().deleteArray(m_colors);
+        m_colors = nullptr;
+    }
+
+    m_size = 0U;
+}
+
+uint8_t YAGfxPalette::findNearest(const Color& color) const
+{
+    uint8_t     nearestIndex    = 0U;
+    uint32_t    nearestDistance = UINT32_MAX;
+    uint16_t    index           = 0U;
+    int32_t     red             = color.getRed();
+    int32_t     green           = color.getGreen();
+    int32_t     blue            = color.getBlue();
+
+    while((m_size > index) && (0U < nearestDistance))
+    {
+        const Rgb888Packed& entry       = m_colors[index];
+        int32_t             deltaRed    = red - static_cast<int32_t>(entry.getRed());
+        int32_t             deltaGreen  = green - static_cast<int32_t>(entry.getGreen());
+        int32_t             deltaBlue   = blue - static_cast<int32_t>(entry.getBlue());
+        uint32_t            distance    = static_cast<uint32_t>((deltaRed * deltaRed) + (deltaGreen * deltaGreen) + (deltaBlue * deltaBlue));
+
+        if (nearestDistance > distance)
+        {
+            nearestDistance = distance;
+            nearestIndex    = static_cast<uint8_t>(index);
+        }
+
+        ++index;
+    }
+
+    return nearestIndex;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,172 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color palette for 8-bit palettized bitmaps
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef YAGFX_PALETTE_H
+#define YAGFX_PALETTE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAColor.h>
+#include <Rgb888Packed.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Color palette, which maps the pixel value of a 8-bit palettized bitmap
+ * to its color. The palette entries are allocated dynamically, so small
+ * palettes need only few memory.
+ */
+class YAGfxPalette
+{
+public:
+
+    /** Max. number of palette entries, addressable by a 8-bit index. */
+    static const uint16_t MAX_SIZE = 256U;
+
+    /**
+     * Constructs the palette, but without entries.
+     */
+    YAGfxPalette() :
+        m_colors(nullptr),
+        m_size(0U)
+    {
+    }
+
+    /**
+     * Destroys the palette.
+     */
+    ~YAGfxPalette()
+    {
+        release();
+    }
+
+    /**
+     * Create the palette entries. All entries are black.
+     * If the palette entries already exists, it will fail.
+     *
+     * @param[in] size  Number of palette entries [1; 256]
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t size);
+
+    /**
+     * Release the palette entries.
+     */
+    void release();
+
+    /**
+     * Get number of palette entries.
+     *
+     * @return Number of palette entries
+     */
+    uint16_t getSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Set the color of a palette entry.
+     * Setting a not existing entry is ignored.
+     *
+     * @param[in] index Palette entry index
+     * @param[in] color Color, the intensity is applied.
+     */
+    void setColor(uint8_t index, const Color& color)
+    {
+        if (m_size > index)
+        {
+            m_colors[index] = color;
+        }
+    }
+
+    /**
+     * Get the color of a palette entry.
+     * A not existing entry is black.
+     *
+     * @param[in] index Palette entry index
+     *
+     * @return Color with max. intensity
+     */
+    Color getColor(uint8_t index) const
+    {
+        Color color;
+
+        if (m_size > index)
+        {
+            color = m_colors[index];
+        }
+
+        return color;
+    }
+
+    /**
+     * Find the palette entry, which is nearest to the given color.
+     * The distance is the squared euclidean distance in the RGB space.
+     *
+     * @param[in] color Color
+     *
+     * @return Palette entry index. If the palette is empty, it will return 0.
+     */
+    uint8_t findNearest(const Color& color) const;
+
+private:
+
+    Rgb888Packed*   m_colors;   /**< Palette entries */
+    uint16_t        m_size;     /**< Number of palette entries */
+
+    YAGfxPalette(const YAGfxPalette& palette);
+    YAGfxPalette& operator=(const YAGfxPalette& palette);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* YAGFX_PALETTE_H */
+
+/** @} */
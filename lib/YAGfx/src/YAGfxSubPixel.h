@@ -0,0 +1,247 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Horizontal sub-pixel drawing context
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef YAGFX_SUB_PIXEL_H
+#define YAGFX_SUB_PIXEL_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfx.h>
+#include <YAGfxAA.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Drawing context, which shifts everything drawn by a fraction of a pixel to
+ * the right. Every pixel is split between its own position and its right
+ * neighbour, depended on the fraction, and blended with the underlying
+ * canvas. This way e.g. a scrolling text moves smooth with fractional
+ * offsets and its edges are blended.
+ *
+ * Pixels, which are drawn in a row from left to right (like font glyphs),
+ * are combined with their left neighbour to a single pixel. This avoids
+ * that the background shines through a solid area.
+ *
+ * All pixels are drawn latest, if the context is destroyed.
+ */
+class YAGfxSubPixel : public YAGfx
+{
+public:
+
+    /**
+     * Constructs the sub-pixel context.
+     *
+     * @param[in] gfx       Underlying graphics interface
+     * @param[in] fraction  Shift to the right in 1/256 pixel.
+     */
+    YAGfxSubPixel(YAGfx& gfx, uint8_t fraction) :
+        YAGfx(),
+        m_gfx(gfx),
+        m_clip(),
+        m_fraction(fraction),
+        m_isPending(false),
+        m_pendingX(0),
+        m_pendingY(0),
+        m_pendingColor()
+    {
+        YAGfxAA::getClip(m_gfx, m_clip);
+    }
+
+    /**
+     * Destroys the sub-pixel context. Pending pixels are drawn.
+     */
+    ~YAGfxSubPixel()
+    {
+        flush();
+    }
+
+    /**
+     * Get canvas width in pixel.
+     *
+     * @return Canvas width in pixel
+     */
+    uint16_t getWidth() const final
+    {
+        return m_gfx.getWidth();
+    }
+
+    /**
+     * Get canvas height in pixel.
+     *
+     * @return Canvas height in pixel
+     */
+    uint16_t getHeight() const final
+    {
+        return m_gfx.getHeight();
+    }
+
+    /**
+     * Get pixel color at given position of the underlying canvas.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    Color& getColor(int16_t x, int16_t y) final
+    {
+        return m_gfx.getColor(x, y);
+    }
+
+    /**
+     * Get pixel color at given position of the underlying canvas.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    const Color& getColor(int16_t x, int16_t y) const final
+    {
+        return static_cast<const YAGfx&>(m_gfx).getColor(x, y);
+    }
+
+    /**
+     * Draw a single pixel, shifted by the fraction to the right.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Pixel color
+     */
+    void drawPixel(int16_t x, int16_t y, const Color& color) final
+    {
+        const uint16_t COVERAGE_LEFT = YAGfxAA::COVERAGE_FULL - m_fraction;
+
+        /* Is the right part of the previous pixel in the same place? Then both are combined. */
+        if ((true == m_isPending) &&
+            (m_pendingY == y) &&
+            ((m_pendingX + 1) == x))
+        {
+            YAGfxAA::blendPixel(m_gfx, m_clip, x, y, mix(m_pendingColor, color), YAGfxAA::COVERAGE_FULL);
+        }
+        else
+        {
+            flush();
+            YAGfxAA::blendPixel(m_gfx, m_clip, x, y, color, COVERAGE_LEFT);
+        }
+
+        m_isPending     = true;
+        m_pendingX      = x;
+        m_pendingY      = y;
+        m_pendingColor  = color;
+    }
+
+    /**
+     * Get the clipping rectangle. It is one pixel wider on the left side,
+     * because a pixel left of the underlying clipping rectangle is partly
+     * shifted into it.
+     *
+     * @param[out] x1   x-coordinate of upper left point
+     * @param[out] y1   y-coordinate of upper left point
+     * @param[out] x2   x-coordinate of lower right point + 1
+     * @param[out] y2   y-coordinate of lower right point + 1
+     */
+    void getClipRect(int16_t& x1, int16_t& y1, int16_t& x2, int16_t& y2) const final
+    {
+        x1 = m_clip.x1 - 1;
+        y1 = m_clip.y1;
+        x2 = m_clip.x2;
+        y2 = m_clip.y2;
+    }
+
+    /**
+     * Draw the right part of the last pixel, which is still pending.
+     */
+    void flush()
+    {
+        if (true == m_isPending)
+        {
+            YAGfxAA::blendPixel(m_gfx, m_clip, m_pendingX + 1, m_pendingY, m_pendingColor, m_fraction);
+            m_isPending = false;
+        }
+    }
+
+private:
+
+    YAGfx&          m_gfx;          /**< Underlying graphics interface */
+    YAGfxAA::Clip   m_clip;         /**< Clipping rectangle of the underlying graphics interface */
+    uint8_t         m_fraction;     /**< Shift to the right in 1/256 pixel */
+    bool            m_isPending;    /**< Is the right part of the last pixel pending? */
+    int16_t         m_pendingX;     /**< x-coordinate of the last pixel */
+    int16_t         m_pendingY;     /**< y-coordinate of the last pixel */
+    Color           m_pendingColor; /**< Color of the last pixel */
+
+    YAGfxSubPixel();
+    YAGfxSubPixel(const YAGfxSubPixel& gfx);
+    YAGfxSubPixel& operator=(const YAGfxSubPixel& gfx);
+
+    /**
+     * Mix the right part of the left pixel with the left part of the right pixel.
+     *
+     * @param[in] left  Color of the left pixel
+     * @param[in] right Color of the right pixel
+     *
+     * @return Mixed color
+     */
+    Color mix(const Color& left, const Color& right) const
+    {
+        const uint16_t  COVERAGE_LEFT   = YAGfxAA::COVERAGE_FULL - m_fraction;
+        uint8_t         red             = (left.getRed() * m_fraction + right.getRed() * COVERAGE_LEFT) >> YAGfxAA::FIXED_SHIFT;
+        uint8_t         green           = (left.getGreen() * m_fraction + right.getGreen() * COVERAGE_LEFT) >> YAGfxAA::FIXED_SHIFT;
+        uint8_t         blue            = (left.getBlue() * m_fraction + right.getBlue() * COVERAGE_LEFT) >> YAGfxAA::FIXED_SHIFT;
+
+        return Color(red, green, blue);
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* YAGFX_SUB_PIXEL_H */
+
+/** @} */
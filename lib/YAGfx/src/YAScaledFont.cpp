@@ -0,0 +1,365 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Scaled font with anti-aliased glyphs
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "YAScaledFont.h"
+
+#include <string.h>
+#include <AllocTracker.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+YAGfxAA::Fixed YAScaledFont::getHeight() const
+{
+    YAGfxAA::Fixed height = 0;
+
+    if (nullptr != m_gfxFont)
+    {
+        height = static_cast<YAGfxAA::Fixed>(m_gfxFont->yAdvance) * m_scale;
+    }
+
+    return height;
+}
+
+YAGfxAA::Fixed YAScaledFont::getTextWidth(const char* text) const
+{
+    YAGfxAA::Fixed width = 0;
+
+    if (nullptr != text)
+    {
+        while('\0' != *text)
+        {
+            const GFXglyph* glyph = getGlyph(*text);
+
+            if (nullptr != glyph)
+            {
+                width += static_cast<YAGfxAA::Fixed>(glyph->xAdvance) * m_scale;
+            }
+
+            ++text;
+        }
+    }
+
+    return width;
+}
+
+void YAScaledFont::drawChar(YAGfx& gfx, YAGfxAA::Fixed& cursorX, YAGfxAA::Fixed& cursorY, char singleChar, const Color& color)
+{
+    if (nullptr == m_gfxFont)
+    {
+        return;
+    }
+
+    /* Set cursor to next line? */
+    if ('\n' == singleChar)
+    {
+        cursorX = 0;
+        cursorY += getHeight();
+    }
+    else
+    {
+        const GFXglyph* glyph = getGlyph(singleChar);
+
+        /* Is character available in the font? Note, carriage return is skipped. */
+        if (nullptr != glyph)
+        {
+            YAGfxAA::Fixed  originX = cursorX + static_cast<YAGfxAA::Fixed>(glyph->xOffset) * m_scale;
+            /* The base line is snapped to a pixel border, only the horizontal position keeps its subpixel phase. */
+            YAGfxAA::Fixed  baseY   = YAGfxAA::toPixel(cursorY + YAGfxAA::FIXED_HALF) * YAGfxAA::FIXED_ONE;
+            YAGfxAA::Fixed  originY = baseY + static_cast<YAGfxAA::Fixed>(glyph->yOffset) * m_scale;
+            uint8_t         phase   = ((originX & (YAGfxAA::FIXED_ONE - 1)) * SUBPIXEL_PHASES) >> YAGfxAA::FIXED_SHIFT;
+            int32_t         glyphX  = YAGfxAA::toPixel(originX);
+            int32_t         glyphY  = YAGfxAA::toPixel(originY);
+            YAGfxAA::Clip   clip;
+
+            YAGfxAA::getClip(gfx, clip);
+
+            /* Skip the glyph completely, if it is outside. The alpha map of a
+             * glyph is never larger than its scaled glyph size plus one pixel
+             * in each direction.
+             */
+            if ((0U < glyph->width) &&
+                (0U < glyph->height) &&
+                (clip.x1 <= (glyphX + ((glyph->width * m_scale) >> YAGfxAA::FIXED_SHIFT) + 1)) &&
+                (clip.x2 > glyphX) &&
+                (clip.y1 <= (glyphY + ((glyph->height * m_scale) >> YAGfxAA::FIXED_SHIFT) + 1)) &&
+                (clip.y2 > glyphY))
+            {
+                const CachedGlyph* entry = getCachedGlyph(singleChar, *glyph, phase);
+
+                if (nullptr != entry)
+                {
+                    const uint8_t*  alpha   = entry->alpha;
+                    int32_t         x       = 0;
+                    int32_t         y       = 0;
+
+                    for(y = 0; y < entry->height; ++y)
+                    {
+                        for(x = 0; x < entry->width; ++x)
+                        {
+                            /* Map the alpha [0; 255] to the coverage [0; 256]. */
+                            uint16_t coverage = *alpha + (*alpha >> 7U);
+
+                            YAGfxAA::blendPixel(gfx, clip, glyphX + x, glyphY + y, color, coverage);
+                            ++alpha;
+                        }
+                    }
+                }
+            }
+
+            cursorX += static_cast<YAGfxAA::Fixed>(glyph->xAdvance) * m_scale;
+        }
+    }
+}
+
+void YAScaledFont::drawText(YAGfx& gfx, YAGfxAA::Fixed& cursorX, YAGfxAA::Fixed& cursorY, const char* text, const Color& color)
+{
+    if (nullptr != text)
+    {
+        while('\0' != *text)
+        {
+            drawChar(gfx, cursorX, cursorY, *text, color);
+            ++text;
+        }
+    }
+}
+
+void YAScaledFont::clearCache()
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < CACHE_SIZE; ++idx)
+    {
+        if (nullptr != m_cache[idx].alpha)
+        {
+            AllocTracker::getInstance().deleteArray(m_cache[idx].alpha);
+        }
+
+        m_cache[idx] = CachedGlyph();
+    }
+
+    m_useCnt = 0U;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+const GFXglyph* YAScaledFont::getGlyph(char singleChar) const
+{
+    const GFXglyph* glyph   = nullptr;
+    uint8_t         uChar   = static_cast<uint8_t>(singleChar);
+
+    if ((nullptr != m_gfxFont) &&
+        (m_gfxFont->first <= uChar) &&
+        (m_gfxFont->last >= uChar) &&
+        ('\n' != singleChar) &&
+        ('\r' != singleChar))
+    {
+        glyph = &(m_gfxFont->glyph[uChar - m_gfxFont->first]);
+    }
+
+    return glyph;
+}
+
+const YAScaledFont::CachedGlyph* YAScaledFont::getCachedGlyph(char singleChar, const GFXglyph& glyph, uint8_t phase)
+{
+    CachedGlyph*    entry   = nullptr;
+    CachedGlyph*    victim  = &m_cache[0U];
+    uint8_t         idx     = 0U;
+
+    ++m_useCnt;
+
+    for(idx = 0U; (idx < CACHE_SIZE) && (nullptr == entry); ++idx)
+    {
+        CachedGlyph& candidate = m_cache[idx];
+
+        if ((nullptr != candidate.alpha) &&
+            (singleChar == candidate.character) &&
+            (phase == candidate.phase))
+        {
+            entry = &candidate;
+        }
+        /* Prefer a free entry, otherwise the least recently used one. */
+        else if ((nullptr != victim->alpha) &&
+                 ((nullptr == candidate.alpha) || (victim->lastUsed > candidate.lastUsed)))
+        {
+            victim = &candidate;
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    if (nullptr == entry)
+    {
+        if (true == renderGlyph(*victim, glyph, phase))
+        {
+            victim->character   = singleChar;
+            victim->phase       = phase;
+            entry               = victim;
+        }
+    }
+
+    if (nullptr != entry)
+    {
+        entry->lastUsed = m_useCnt;
+    }
+
+    return entry;
+}
+
+bool YAScaledFont::renderGlyph(CachedGlyph& entry, const GFXglyph& glyph, uint8_t phase)
+{
+    const YAGfxAA::Fixed    SCALE           = m_scale;
+    const YAGfxAA::Fixed    OFFSET_X        = (phase * YAGfxAA::FIXED_ONE) / SUBPIXEL_PHASES;
+    /* The base line is always on a pixel border, therefore the vertical offset depends only on the glyph. */
+    const YAGfxAA::Fixed    OFFSET_Y        = (glyph.yOffset * SCALE) & (YAGfxAA::FIXED_ONE - 1);
+    YAGfxAA::Fixed          scaledWidth     = glyph.width * SCALE + OFFSET_X;
+    YAGfxAA::Fixed          scaledHeight    = glyph.height * SCALE + OFFSET_Y;
+    int32_t                 width           = (scaledWidth + YAGfxAA::FIXED_ONE - 1) >> YAGfxAA::FIXED_SHIFT;
+    int32_t                 height          = (scaledHeight + YAGfxAA::FIXED_ONE - 1) >> YAGfxAA::FIXED_SHIFT;
+    bool                    isSuccessful    = false;
+
+    if (nullptr != entry.alpha)
+    {
+        AllocTracker::getInstance().deleteArray(entry.alpha);
+        entry = CachedGlyph();
+    }
+
+    if ((0 < width) &&
+        (UINT8_MAX >= width) &&
+        (0 < height) &&
+        (UINT8_MAX >= height))
+    {
+        entry.alpha = AllocTracker::getInstance().newArray<uint8_t>(AllocTracker::TAG_GFX, width * height);
+    }
+
+    if (nullptr != entry.alpha)
+    {
+        uint16_t    bitmapOffset    = glyph.bitmapOffset;
+        uint8_t     bitmapRowBits   = 0U;
+        uint8_t     bitCnt          = 0U;
+        int32_t     srcX            = 0;
+        int32_t     srcY            = 0;
+
+        memset(entry.alpha, 0, width * height);
+        entry.width     = width;
+        entry.height    = height;
+
+        for(srcY = 0; srcY < glyph.height; ++srcY)
+        {
+            for(srcX = 0; srcX < glyph.width; ++srcX)
+            {
+                /* Every 8 bit, the bitmap offset must be increased. */
+                if (0U == (bitCnt & 0x07))
+                {
+                    bitmapRowBits = m_gfxFont->bitmap[bitmapOffset];
+                    ++bitmapOffset;
+                }
+                ++bitCnt;
+
+                /* Distribute a set source pixel by its area to the covered alpha map pixels. */
+                if (0U != (bitmapRowBits & 0x80U))
+                {
+                    YAGfxAA::Fixed  left    = OFFSET_X + srcX * SCALE;
+                    YAGfxAA::Fixed  right   = left + SCALE;
+                    YAGfxAA::Fixed  top     = OFFSET_Y + srcY * SCALE;
+                    YAGfxAA::Fixed  bottom  = top + SCALE;
+                    int32_t         dstX    = 0;
+                    int32_t         dstY    = 0;
+
+                    for(dstY = YAGfxAA::toPixel(top); dstY <= YAGfxAA::toPixel(bottom - 1); ++dstY)
+                    {
+                        YAGfxAA::Fixed  lowY        = dstY * YAGfxAA::FIXED_ONE;
+                        YAGfxAA::Fixed  highY       = lowY + YAGfxAA::FIXED_ONE;
+                        YAGfxAA::Fixed  overlapY    = ((bottom < highY) ? bottom : highY) - ((top > lowY) ? top : lowY);
+
+                        for(dstX = YAGfxAA::toPixel(left); dstX <= YAGfxAA::toPixel(right - 1); ++dstX)
+                        {
+                            YAGfxAA::Fixed  lowX        = dstX * YAGfxAA::FIXED_ONE;
+                            YAGfxAA::Fixed  highX       = lowX + YAGfxAA::FIXED_ONE;
+                            YAGfxAA::Fixed  overlapX    = ((right < highX) ? right : highX) - ((left > lowX) ? left : lowX);
+                            uint16_t        sum         = 0U;
+                            uint8_t&        alpha       = entry.alpha[dstX + dstY * width];
+
+                            sum         = alpha + ((overlapX * overlapY) >> YAGfxAA::FIXED_SHIFT);
+                            alpha       = (UINT8_MAX < sum) ? UINT8_MAX : sum;
+                        }
+                    }
+                }
+
+                bitmapRowBits <<= 1U;
+            }
+        }
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
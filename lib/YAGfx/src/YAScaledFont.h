@@ -0,0 +1,282 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Scaled font with anti-aliased glyphs
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef YASCALEDFONT_H
+#define YASCALEDFONT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <gfxfont.h>
+#include <YAGfx.h>
+#include <YAGfxAA.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A GFXfont, which is drawn scaled by any fixed-point factor. Every glyph is
+ * resampled once by area coverage into an alpha map and kept in a small glyph
+ * cache. Because the horizontal glyph position is not snapped to full pixels,
+ * the alpha maps are cached per subpixel phase. Drawing a cached glyph is only
+ * blending its alpha map, which is fast enough for animated text.
+ */
+class YAScaledFont
+{
+public:
+
+    /** Scale factor 1.0, which draws the font in its original size. */
+    static const uint16_t   SCALE_ONE       = 256U;
+
+    /** Number of cached glyphs. */
+    static const uint8_t    CACHE_SIZE      = 16U;
+
+    /** Number of subpixel phases per pixel in horizontal direction. */
+    static const uint8_t    SUBPIXEL_PHASES = 4U;
+
+    /**
+     * Constructs a scaled font without a GFXfont.
+     */
+    YAScaledFont() :
+        m_gfxFont(nullptr),
+        m_scale(SCALE_ONE),
+        m_cache(),
+        m_useCnt(0U)
+    {
+    }
+
+    /**
+     * Constructs a scaled font.
+     *
+     * @param[in] gfxFont   GFXfont
+     * @param[in] scale     Scale factor as fixed-point value, see SCALE_ONE.
+     */
+    YAScaledFont(const GFXfont* gfxFont, uint16_t scale) :
+        m_gfxFont(gfxFont),
+        m_scale(scale),
+        m_cache(),
+        m_useCnt(0U)
+    {
+    }
+
+    /**
+     * Destroys the scaled font and its glyph cache.
+     */
+    ~YAScaledFont()
+    {
+        clearCache();
+    }
+
+    /**
+     * Get the GFXfont.
+     *
+     * @return GFXfont
+     */
+    const GFXfont* getGfxFont() const
+    {
+        return m_gfxFont;
+    }
+
+    /**
+     * Set the GFXfont. The glyph cache is cleared.
+     *
+     * @param[in] gfxFont   GFXfont
+     */
+    void setGfxFont(const GFXfont* gfxFont)
+    {
+        if (gfxFont != m_gfxFont)
+        {
+            clearCache();
+            m_gfxFont = gfxFont;
+        }
+    }
+
+    /**
+     * Get the scale factor.
+     *
+     * @return Scale factor as fixed-point value, see SCALE_ONE.
+     */
+    uint16_t getScale() const
+    {
+        return m_scale;
+    }
+
+    /**
+     * Set the scale factor. The glyph cache is cleared.
+     *
+     * @param[in] scale Scale factor as fixed-point value, see SCALE_ONE.
+     */
+    void setScale(uint16_t scale)
+    {
+        if (scale != m_scale)
+        {
+            clearCache();
+            m_scale = scale;
+        }
+    }
+
+    /**
+     * Get the scaled font height, which is the distance between two lines.
+     *
+     * @return Font height as fixed-point value.
+     */
+    YAGfxAA::Fixed getHeight() const;
+
+    /**
+     * Get the scaled width of a text.
+     *
+     * @param[in] text  Text
+     *
+     * @return Text width as fixed-point value.
+     */
+    YAGfxAA::Fixed getTextWidth(const char* text) const;
+
+    /**
+     * Draw single character at current cursor position. The cursor is the
+     * left side of the base line and it is moved to the new position.
+     *
+     * A newline will place the cursor on the begin of the next line.
+     *
+     * @param[in]       gfx         Graphics interface
+     * @param[in,out]   cursorX     The cursor position x-coordinate.
+     * @param[in,out]   cursorY     The cursor position y-coordinate.
+     * @param[in]       singleChar  Single character which to draw
+     * @param[in]       color       Text color
+     */
+    void drawChar(YAGfx& gfx, YAGfxAA::Fixed& cursorX, YAGfxAA::Fixed& cursorY, char singleChar, const Color& color);
+
+    /**
+     * Draw a text at current cursor position. The cursor is moved to the end
+     * of the text.
+     *
+     * @param[in]       gfx         Graphics interface
+     * @param[in,out]   cursorX     The cursor position x-coordinate.
+     * @param[in,out]   cursorY     The cursor position y-coordinate.
+     * @param[in]       text        Text which to draw
+     * @param[in]       color       Text color
+     */
+    void drawText(YAGfx& gfx, YAGfxAA::Fixed& cursorX, YAGfxAA::Fixed& cursorY, const char* text, const Color& color);
+
+    /**
+     * Clear the glyph cache and release its memory.
+     */
+    void clearCache();
+
+private:
+
+    /**
+     * A glyph, resampled to an alpha map.
+     */
+    struct CachedGlyph
+    {
+        uint8_t*    alpha;      /**< Alpha map, one coverage value per pixel */
+        uint32_t    lastUsed;   /**< Use counter value, when it was used last time */
+        uint8_t     width;      /**< Alpha map width in pixel */
+        uint8_t     height;     /**< Alpha map height in pixel */
+        char        character;  /**< Character */
+        uint8_t     phase;      /**< Subpixel phase */
+
+        /**
+         * Constructs a empty cache entry.
+         */
+        CachedGlyph() :
+            alpha(nullptr),
+            lastUsed(0U),
+            width(0U),
+            height(0U),
+            character('\0'),
+            phase(0U)
+        {
+        }
+    };
+
+    const GFXfont*  m_gfxFont;              /**< GFXfont */
+    uint16_t        m_scale;                /**< Scale factor as fixed-point value */
+    CachedGlyph     m_cache[CACHE_SIZE];    /**< Glyph cache */
+    uint32_t        m_useCnt;               /**< Use counter, used to find the least recently used cache entry */
+
+    YAScaledFont(const YAScaledFont& font);
+    YAScaledFont& operator=(const YAScaledFont& font);
+
+    /**
+     * Get a glyph object from the font for the choosen character.
+     *
+     * @param[in] singleChar    Character for what the glyph is requested.
+     *
+     * @return If glyph is found, it will be returned otherwise nullptr.
+     */
+    const GFXglyph* getGlyph(char singleChar) const;
+
+    /**
+     * Get the cached alpha map of a glyph. If it is not cached yet, the least
+     * recently used cache entry will be replaced.
+     *
+     * @param[in] singleChar    Character
+     * @param[in] glyph         Glyph of the character
+     * @param[in] phase         Subpixel phase
+     *
+     * @return If successful, it will return the cache entry otherwise nullptr.
+     */
+    const CachedGlyph* getCachedGlyph(char singleChar, const GFXglyph& glyph, uint8_t phase);
+
+    /**
+     * Resample a glyph by area coverage to an alpha map.
+     *
+     * @param[out]  entry   Cache entry
+     * @param[in]   glyph   Glyph
+     * @param[in]   phase   Subpixel phase
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool renderGlyph(CachedGlyph& entry, const GFXglyph& glyph, uint8_t phase);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* YASCALEDFONT_H */
+
+/** @} */
@@ -70,9 +70,11 @@ BitmapWidget& BitmapWidget::operator=(const BitmapWidget& widget)
     if (&widget != this)
     {
         Widget::operator=(widget);
-        
-        m_bitmap        = widget.m_bitmap;
+
+        copyBitmap(widget);
+
         m_spriteSheet   = widget.m_spriteSheet;
+        m_animation     = widget.m_animation;
         m_timer         = widget.m_timer;
         m_duration      = widget.m_duration;
     }
@@ -82,15 +84,22 @@ BitmapWidget& BitmapWidget::operator=(const BitmapWidget& widget)
 
 void BitmapWidget::clear(const Color& color)
 {
-    if (true == m_spriteSheet.isEmpty())
+    if ((true == m_spriteSheet.isEmpty()) &&
+        (true == m_animation.isEmpty()))
     {
-        m_bitmap.fillScreen(color);
+        m_bitmap.fillScreen(Rgb565(color));
+
+        /* The content differs from the file now, therefore it can't be reloaded. */
+        m_bitmapFs = nullptr;
+        m_bitmapFileName.clear();
     }
     else
     {
         m_spriteSheet.release();
+        m_animation.release();
         m_timer.stop();
     }
+    m_isDirty = true;
 }
 
 bool BitmapWidget::load(FS& fs, const String& filename)
@@ -101,6 +110,10 @@ bool BitmapWidget::load(FS& fs, const String& filename)
     {
         LOG_WARNING("File %s doesn't exists.", filename.c_str());
     }
+    else if (0U != filename.endsWith(IndexedAnimation::FILE_EXT))
+    {
+        isSuccessful = loadAnimation(fs, filename);
+    }
     else
     {
         BmpImgLoader        loader;
@@ -108,6 +121,10 @@ bool BitmapWidget::load(FS& fs, const String& filename)
 
         if (BmpImgLoader::RET_OK != ret)
         {
+            /* The loader released the bitmap. */
+            m_bitmapFs = nullptr;
+            m_bitmapFileName.clear();
+
             if (BmpImgLoader::RET_FILE_NOT_FOUND == ret)
             {
                 LOG_ERROR("Failed to open file %s.", filename.c_str());
@@ -135,9 +152,14 @@ bool BitmapWidget::load(FS& fs, const String& filename)
              * shall be shown or the single bitmap image.
              */
             m_spriteSheet.release();
+            m_animation.release();
             m_timer.stop();
 
-            isSuccessful = true;
+            m_bitmapFs          = &fs;
+            m_bitmapFileName    = filename;
+
+            m_isDirty       = true;
+            isSuccessful    = true;
         }
     }
 
@@ -164,9 +186,42 @@ bool BitmapWidget::loadSpriteSheet(FS& fs, const String& spriteSheetFileName, co
         /* Avoid wasting memory. Additional this is important to detect whether the sprite sheet
          * shall be shown or the single bitmap image.
          */
-        m_bitmap.release();        
+        m_bitmap.giveBack();
+        m_bitmapFs = nullptr;
+        m_bitmapFileName.clear();
+        m_animation.release();
+        m_timer.stop();
+
+        m_isDirty       = true;
+        isSuccessful    = true;
+    }
+
+    return isSuccessful;
+}
+
+bool BitmapWidget::loadAnimation(FS& fs, const String& filename)
+{
+    bool isSuccessful = false;
+
+    if (false == fs.exists(filename))
+    {
+        LOG_WARNING("File %s doesn't exists.", filename.c_str());
+    }
+    else if (false == m_animation.load(fs, filename))
+    {
+        LOG_ERROR("Failed to load animation %s.", filename.c_str());
+    }
+    else
+    {
+        /* Avoid wasting memory. Only the animation is shown. */
+        m_bitmap.giveBack();
+        m_bitmapFs = nullptr;
+        m_bitmapFileName.clear();
+        m_spriteSheet.release();
+        m_timer.stop();
 
-        isSuccessful = true;
+        m_isDirty       = true;
+        isSuccessful    = true;
     }
 
     return isSuccessful;
@@ -180,6 +235,7 @@ bool BitmapWidget::isSpriteSheetForward() const
 void BitmapWidget::setSpriteSheetForward(bool forward)
 {
     m_spriteSheet.setForward(forward);
+    m_animation.setForward(forward);
 }
 
 bool BitmapWidget::isSpriteSheetRepeatInfinite() const
@@ -190,6 +246,39 @@ bool BitmapWidget::isSpriteSheetRepeatInfinite() const
 void BitmapWidget::setSpriteSheetRepeatInfinite(bool repeat)
 {
     m_spriteSheet.repeatInfinite(repeat);
+    m_animation.repeatInfinite(repeat);
+}
+
+void BitmapWidget::giveBack()
+{
+    if ((nullptr != m_bitmapFs) &&
+        (true == m_bitmap.isBorrowed()))
+    {
+        m_bitmapWidth   = m_bitmap.getWidth();
+        m_bitmapHeight  = m_bitmap.getHeight();
+
+        m_bitmap.giveBack(true);
+    }
+}
+
+void BitmapWidget::borrow()
+{
+    if ((nullptr != m_bitmapFs) &&
+        (false == m_bitmap.isBorrowed()))
+    {
+        if ((false == m_bitmap.borrow(m_bitmapWidth, m_bitmapHeight)) ||
+            (false == m_bitmap.isContentPreserved()))
+        {
+            BmpImgLoader loader;
+
+            if (BmpImgLoader::RET_OK != loader.load(*m_bitmapFs, m_bitmapFileName, m_bitmap))
+            {
+                LOG_WARNING("Failed to reload %s.", m_bitmapFileName.c_str());
+            }
+        }
+
+        m_isDirty = true;
+    }
 }
 
 /******************************************************************************
@@ -200,6 +289,24 @@ void BitmapWidget::setSpriteSheetRepeatInfinite(bool repeat)
  * Private Methods
  *****************************************************************************/
 
+void BitmapWidget::copyBitmap(const BitmapWidget& widget)
+{
+    if ((true == widget.m_bitmap.isBorrowed()) &&
+        (true == m_bitmap.borrow(widget.m_bitmap.getWidth(), widget.m_bitmap.getHeight())))
+    {
+        YAGfxBlit::blit(m_bitmap, 0, 0, widget.m_bitmap);
+    }
+    else
+    {
+        m_bitmap.giveBack();
+    }
+
+    m_bitmapFs          = widget.m_bitmapFs;
+    m_bitmapFileName    = widget.m_bitmapFileName;
+    m_bitmapWidth       = widget.m_bitmapWidth;
+    m_bitmapHeight      = widget.m_bitmapHeight;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -45,10 +45,14 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <FS.h>
-#include <SimpleTimer.hpp>
+#include <FrameClock.hpp>
+#include <Util.h>
+#include <YAGfxBlit.h>
+#include <CanvasPool.h>
 
 #include "Widget.hpp"
 #include "SpriteSheet.h"
+#include "IndexedAnimation.h"
 
 /******************************************************************************
  * Macros
@@ -71,7 +75,12 @@ public:
     BitmapWidget() :
         Widget(WIDGET_TYPE),
         m_bitmap(),
+        m_bitmapFs(nullptr),
+        m_bitmapFileName(),
+        m_bitmapWidth(0U),
+        m_bitmapHeight(0U),
         m_spriteSheet(),
+        m_animation(),
         m_timer(),
         m_duration(0U)
     {
@@ -84,11 +93,17 @@ public:
      */
     BitmapWidget(const BitmapWidget& widget) :
         Widget(WIDGET_TYPE),
-        m_bitmap(widget.m_bitmap),
+        m_bitmap(),
+        m_bitmapFs(nullptr),
+        m_bitmapFileName(),
+        m_bitmapWidth(0U),
+        m_bitmapHeight(0U),
         m_spriteSheet(widget.m_spriteSheet),
+        m_animation(widget.m_animation),
         m_timer(widget.m_timer),
         m_duration(widget.m_duration)
     {
+        copyBitmap(widget);
     }
 
     /**
@@ -106,22 +121,30 @@ public:
     BitmapWidget& operator=(const BitmapWidget& widget);
 
     /**
-     * Set a bitmap.
+     * Set a bitmap. It is stored in the compact RGB565 format in a canvas,
+     * borrowed from the canvas pool.
      *
      * @param[in] bitmap    Bitmap
      */
     void set(const YAGfxBitmap& bitmap)
     {
-        if (true == m_bitmap.create(bitmap.getWidth(), bitmap.getHeight()))
+        if (true == m_bitmap.borrow(bitmap.getWidth(), bitmap.getHeight()))
         {
-            m_bitmap.copy(bitmap);
+            YAGfxBlit::blit(m_bitmap, 0, 0, bitmap);
         }
 
+        /* The bitmap is not backed by a file, therefore it can't be reloaded. */
+        m_bitmapFs = nullptr;
+        m_bitmapFileName.clear();
+
         /* Release sprite sheet to avoid wasting memory. The widget can
          * only show one of them.
          */
         m_spriteSheet.release();
+        m_animation.release();
         m_timer.stop();
+
+        m_isDirty = true;
     }
 
     /**
@@ -129,7 +152,7 @@ public:
      *
      * @return Bitmap
      */
-    const YAGfxBitmap& get() const
+    const YAGfxBitmapRgb565& get() const
     {
         return m_bitmap;
     }
@@ -143,7 +166,8 @@ public:
 
     /**
      * Load bitmap image from filesystem.
-     * If a sprite sheet is active, it will be disabled.
+     * If a sprite sheet or animation is active, it will be disabled.
+     * A animation file (.anim) is loaded as animation.
      *
      * @param[in] fs        Filesystem
      * @param[in] filename  Filename with full path
@@ -163,6 +187,32 @@ public:
      */
     bool loadSpriteSheet(FS& fs, const String& spriteSheetFileName, const String& textureFileName);
 
+    /**
+     * Load animation file (.anim) from filesystem.
+     * Only the current frame is decoded, the others stay in the filesystem.
+     *
+     * @param[in] fs        Filesystem
+     * @param[in] filename  Name of the animation file in the filesystem
+     *
+     * @return If successful loaded it will return true otherwise false.
+     */
+    bool loadAnimation(FS& fs, const String& filename);
+
+    /**
+     * Give the bitmap back to the canvas pool, e.g. while the plugin is
+     * inactive. Its content is preserved, as long as the canvas pool doesn't
+     * need it for others. Only a bitmap, which was loaded from a file, is
+     * given back, because only it can be reloaded.
+     */
+    void giveBack();
+
+    /**
+     * Borrow the bitmap from the canvas pool again, after it was given back,
+     * e.g. when the plugin gets active. If its content was lost meanwhile, it
+     * will be reloaded from its file.
+     */
+    void borrow();
+
     /**
      * Get the animation control flag FORWARD of a sprite sheet.
      * 
@@ -190,16 +240,88 @@ public:
      * @param[in] repeat The repeat flat to be set.
      */
     void setSpriteSheetRepeatInfinite(bool repeat);
+
+    /**
+     * Process the widget. It decodes the next frame of an animation in
+     * advance, which needs access to the filesystem. Therefore call it
+     * periodically outside of the display update, at least every
+     * PROCESS_PERIOD.
+     */
+    void process()
+    {
+        m_animation.prefetch();
+    }
+
+    /**
+     * Is the widget dirty? A pending frame of a sprite sheet or an animation
+     * makes it dirty too.
+     *
+     * @return If dirty, it will return true otherwise false.
+     */
+    bool isDirty() override
+    {
+        bool isDirty = m_isDirty;
+
+        if ((false == isDirty) &&
+            ((false == m_animation.isEmpty()) || (false == m_spriteSheet.isEmpty())))
+        {
+            isDirty = ((false == m_timer.isTimerRunning()) || (true == m_timer.isTimeout()));
+        }
+
+        return isDirty;
+    }
+
+    /**
+     * Get the bounding box of the shown bitmap in the canvas.
+     *
+     * @param[in]   canvasWidth     Canvas width in pixel
+     * @param[in]   canvasHeight    Canvas height in pixel
+     * @param[out]  box             Bounding box
+     */
+    void getBoundingBox(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage::Rect& box) const override
+    {
+        UTIL_NOT_USED(canvasWidth);
+        UTIL_NOT_USED(canvasHeight);
+
+        if (false == m_animation.isEmpty())
+        {
+            box = YAGfxDamage::Rect(m_posX, m_posY, m_animation.getFrameWidth(), m_animation.getFrameHeight());
+        }
+        else if (true == m_spriteSheet.isEmpty())
+        {
+            box = YAGfxDamage::Rect(m_posX, m_posY, m_bitmap.getWidth(), m_bitmap.getHeight());
+        }
+        else
+        {
+            box = YAGfxDamage::Rect(m_posX, m_posY, m_spriteSheet.getFrameWidth(), m_spriteSheet.getFrameHeight());
+        }
+    }
     
     /** Widget type string */
     static const char* WIDGET_TYPE;
 
+    /** Period in ms, in which process() shall be called to prefetch the animation frames in time. */
+    static const uint32_t PROCESS_PERIOD = 20U;
+
 private:
 
-    YAGfxDynamicBitmap  m_bitmap;       /**< Bitmap image which is shown if no sprite sheet is loaded. */
-    SpriteSheet         m_spriteSheet;  /**< Sprite sheet for animation with texture. */
-    SimpleTimer         m_timer;        /**< Timer used for sprite sheet. */
-    uint32_t            m_duration;     /**< Duration of one frame in ms. */
+    PooledCanvasRgb565          m_bitmap;           /**< Bitmap image (RGB565) which is shown if no sprite sheet is loaded. */
+    FS*                         m_bitmapFs;         /**< Filesystem of the bitmap image file. nullptr if the bitmap is not loaded from a file. */
+    String                      m_bitmapFileName;   /**< Name of the bitmap image file, used to reload it. */
+    uint16_t                    m_bitmapWidth;      /**< Bitmap width in pixels, while it is given back. */
+    uint16_t                    m_bitmapHeight;     /**< Bitmap height in pixels, while it is given back. */
+    SpriteSheet                 m_spriteSheet;      /**< Sprite sheet for animation with texture. */
+    IndexedAnimation            m_animation;        /**< Animation, streamed from the filesystem. */
+    FrameTimer                  m_timer;            /**< Timer used for sprite sheet and animation. */
+    uint32_t                    m_duration;         /**< Duration of one sprite sheet frame in ms. */
+
+    /**
+     * Copy the bitmap of another bitmap widget. A given back bitmap stays
+     * given back and will be reloaded from its file.
+     *
+     * @param[in] widget    Bitmap widget, which to copy from
+     */
+    void copyBitmap(const BitmapWidget& widget);
 
     /**
      * Paint the widget with the given graphics interface.
@@ -208,13 +330,40 @@ private:
      */
     void paint(YAGfx& gfx) override
     {
-        if (true == m_spriteSheet.isEmpty())
+        if (false == m_animation.isEmpty())
         {
-            gfx.drawBitmap(m_posX, m_posY, m_bitmap);
+            gfx.drawBitmap(m_posX, m_posY, m_animation.getFrame());
+
+            /* The delay is specific to every frame. */
+            if (false == m_timer.isTimerRunning())
+            {
+                m_timer.start(m_animation.getDelay());
+            }
+            /* The frame is only switched, if it was already prefetched by process().
+             * Otherwise the timer stays timed out and it is tried again with the next paint.
+             */
+            else if ((true == m_timer.isTimeout()) &&
+                     (true == m_animation.next()))
+            {
+                /* Continue right after the timeout, to keep the frame rate independent of the paint rate. */
+                m_timer.next(m_animation.getDelay());
+
+                /* The next frame is shown with the next paint. */
+                m_isDirty = true;
+            }
+            else
+            {
+                /* Nothing to do. */
+                ;
+            }
+        }
+        else if (true == m_spriteSheet.isEmpty())
+        {
+            YAGfxBlit::blit(gfx, m_posX, m_posY, m_bitmap);
         }
         else
         {
-            gfx.drawBitmap(m_posX, m_posY, m_spriteSheet.getFrame());
+            YAGfxBlit::blit(gfx, m_posX, m_posY, m_spriteSheet.getFrame());
 
             /* If timer is not running, start it. */
             if (false == m_timer.isTimerRunning())
@@ -225,7 +374,10 @@ private:
             else if (true == m_timer.isTimeout())
             {
                 m_spriteSheet.next();
-                m_timer.start(m_duration);
+                m_timer.next(m_duration);
+
+                /* The next frame is shown with the next paint. */
+                m_isDirty = true;
             }
             else
             {
@@ -132,6 +132,30 @@ typedef enum
  *****************************************************************************/
 
 BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynamicBitmap& bitmap)
+{
+    return loadBitmap<Color>(fs, fileName, bitmap);
+}
+
+BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynamicBitmapRgb565& bitmap)
+{
+    return loadBitmap<Rgb565>(fs, fileName, bitmap);
+}
+
+BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, PooledCanvasRgb565& canvas)
+{
+    return loadBitmap<Rgb565>(fs, fileName, canvas);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+template < typename TColor, typename TBitmap >
+BmpImgLoader::Ret BmpImgLoader::loadBitmap(FS& fs, const String& fileName, TBitmap& bitmap)
 {
     Ret     ret = RET_OK;
     File    fd  = fs.open(fileName);
@@ -181,9 +205,7 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
             uint16_t width  = abs(dibHeader.infoHeader.imageWidth);
             uint16_t height = abs(dibHeader.infoHeader.imageHeight);
 
-            bitmap.release();
-
-            if (false == bitmap.create(width, height))
+            if (false == allocBitmap(bitmap, width, height))
             {
                 ret = RET_IMG_TOO_BIG;
             }
@@ -236,7 +258,7 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
                         {
                             Color color(lineBuffer[2], lineBuffer[1], lineBuffer[0]);
 
-                            bitmap.drawPixel(x, y, color);
+                            bitmap.drawPixel(x, y, TColor(color));
                         }
 
                         ++x;
@@ -252,19 +274,39 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
 
     if (RET_OK != ret)
     {
-        bitmap.release();
+        releaseBitmap(bitmap);
     }
 
     return ret;
 }
 
-/******************************************************************************
- * Protected Methods
- *****************************************************************************/
+template < typename TColor >
+bool BmpImgLoader::allocBitmap(BaseGfxDynamicBitmap<TColor>& bitmap, uint16_t width, uint16_t height)
+{
+    bitmap.release();
 
-/******************************************************************************
- * Private Methods
- *****************************************************************************/
+    return bitmap.create(width, height);
+}
+
+template < typename TColor >
+bool BmpImgLoader::allocBitmap(BasePooledCanvas<TColor>& canvas, uint16_t width, uint16_t height)
+{
+    canvas.giveBack();
+
+    return canvas.borrow(width, height);
+}
+
+template < typename TColor >
+void BmpImgLoader::releaseBitmap(BaseGfxDynamicBitmap<TColor>& bitmap)
+{
+    bitmap.release();
+}
+
+template < typename TColor >
+void BmpImgLoader::releaseBitmap(BasePooledCanvas<TColor>& canvas)
+{
+    canvas.giveBack();
+}
 
 bool BmpImgLoader::loadBmpFileHeader(File& fd, BmpFileHeader& header)
 {
@@ -45,6 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <YAGfxBitmap.h>
+#include <CanvasPool.h>
 #include <FS.h>
 
 /******************************************************************************
@@ -107,8 +108,97 @@ public:
      */
     Ret load(FS& fs, const String& fileName, YAGfxDynamicBitmap& bitmap);
 
+    /**
+     * Load bitmap image (.bmp) from file system to a compact RGB565 bitmap buffer.
+     * 
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     * @param[out] bitmap   Bitmap buffer
+     * 
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret load(FS& fs, const String& fileName, YAGfxDynamicBitmapRgb565& bitmap);
+
+    /**
+     * Load bitmap image (.bmp) from file system to a compact RGB565 canvas,
+     * which borrows its pixel buffer from the canvas pool.
+     * 
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     * @param[out] canvas   Canvas
+     * 
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret load(FS& fs, const String& fileName, PooledCanvasRgb565& canvas);
+
 private:
 
+    /**
+     * Load bitmap image (.bmp) from file system to bitmap buffer and convert
+     * the pixels to its pixel format.
+     * 
+     * @tparam TColor   Pixel format of the bitmap buffer
+     * @tparam TBitmap  Bitmap buffer type
+     * 
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     * @param[out] bitmap   Bitmap buffer
+     * 
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    template < typename TColor, typename TBitmap >
+    Ret loadBitmap(FS& fs, const String& fileName, TBitmap& bitmap);
+
+    /**
+     * Allocate a dynamic bitmap buffer with the given size.
+     * A already allocated bitmap buffer is released before.
+     * 
+     * @tparam TColor Pixel format of the bitmap buffer
+     * 
+     * @param[in] bitmap    Bitmap buffer
+     * @param[in] width     Width in pixels
+     * @param[in] height    Height in pixels
+     * 
+     * @return If successful, it will return true otherwise false.
+     */
+    template < typename TColor >
+    static bool allocBitmap(BaseGfxDynamicBitmap<TColor>& bitmap, uint16_t width, uint16_t height);
+
+    /**
+     * Borrow a canvas with the given size from the canvas pool.
+     * A already borrowed pixel buffer is given back before.
+     * 
+     * @tparam TColor Pixel format of the canvas
+     * 
+     * @param[in] canvas    Canvas
+     * @param[in] width     Width in pixels
+     * @param[in] height    Height in pixels
+     * 
+     * @return If successful, it will return true otherwise false.
+     */
+    template < typename TColor >
+    static bool allocBitmap(BasePooledCanvas<TColor>& canvas, uint16_t width, uint16_t height);
+
+    /**
+     * Release a dynamic bitmap buffer.
+     * 
+     * @tparam TColor Pixel format of the bitmap buffer
+     * 
+     * @param[in] bitmap    Bitmap buffer
+     */
+    template < typename TColor >
+    static void releaseBitmap(BaseGfxDynamicBitmap<TColor>& bitmap);
+
+    /**
+     * Give a borrowed canvas back to the canvas pool.
+     * 
+     * @tparam TColor Pixel format of the canvas
+     * 
+     * @param[in] canvas    Canvas
+     */
+    template < typename TColor >
+    static void releaseBitmap(BasePooledCanvas<TColor>& canvas);
+
     /**
      * Load bitmap file header from file system.
      * 
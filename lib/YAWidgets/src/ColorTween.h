@@ -0,0 +1,213 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color tween
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef COLOR_TWEEN_H
+#define COLOR_TWEEN_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAColor.h>
+#include <Tween.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A color tween blends from one color to another over time, driven by the
+ * frame clock. For alpha values use a Tween in the range [0; 255].
+ */
+class ColorTween
+{
+public:
+
+    /**
+     * Constructs a color tween, which is not running and black.
+     */
+    ColorTween() :
+        m_tween(),
+        m_from(),
+        m_to()
+    {
+    }
+
+    /**
+     * Destroys the color tween.
+     */
+    ~ColorTween()
+    {
+    }
+
+    /**
+     * Constructs a color tween by assign one.
+     *
+     * @param[in] tween Color tween, which to assign.
+     */
+    ColorTween(const ColorTween& tween) :
+        m_tween(tween.m_tween),
+        m_from(tween.m_from),
+        m_to(tween.m_to)
+    {
+    }
+
+    /**
+     * Assign a color tween.
+     *
+     * @param[in] tween Color tween, which to assign.
+     *
+     * @return Color tween
+     */
+    ColorTween& operator=(const ColorTween& tween)
+    {
+        if (&tween != this)
+        {
+            m_tween = tween.m_tween;
+            m_from  = tween.m_from;
+            m_to    = tween.m_to;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Start the color tween at the current frame time.
+     *
+     * @param[in] from      Start color
+     * @param[in] to        End color
+     * @param[in] duration  Duration in ms
+     * @param[in] curve     Easing curve
+     * @param[in] delay     Delay in ms, before the color starts to change.
+     */
+    void start(const Color& from, const Color& to, uint32_t duration, Easing::Curve curve = Easing::CURVE_LINEAR, uint32_t delay = 0U)
+    {
+        m_from  = from;
+        m_to    = to;
+        m_tween.start(0, Easing::PROGRESS_ONE, duration, curve, delay);
+    }
+
+    /**
+     * Start the color tween from the current color to a new color.
+     *
+     * @param[in] to        End color
+     * @param[in] duration  Duration in ms
+     * @param[in] curve     Easing curve
+     */
+    void moveTo(const Color& to, uint32_t duration, Easing::Curve curve = Easing::CURVE_LINEAR)
+    {
+        start(getColor(), to, duration, curve);
+    }
+
+    /**
+     * Stop the color tween. The color is kept at the current color.
+     */
+    void stop()
+    {
+        m_from  = getColor();
+        m_to    = m_from;
+        m_tween.stop();
+    }
+
+    /**
+     * Set the repeat mode.
+     *
+     * @param[in] repeat    Repeat mode
+     */
+    void setRepeat(Tween::Repeat repeat)
+    {
+        m_tween.setRepeat(repeat);
+    }
+
+    /**
+     * Is the color tween running?
+     *
+     * @return If running, it will return true otherwise false.
+     */
+    bool isRunning() const
+    {
+        return m_tween.isRunning();
+    }
+
+    /**
+     * Get the color at the current frame time.
+     *
+     * @return Color
+     */
+    Color getColor() const
+    {
+        return interpolate(m_from, m_to, m_tween.getProgress());
+    }
+
+    /**
+     * Interpolate between two colors.
+     *
+     * @param[in] from      Color at progress 0
+     * @param[in] to        Color at progress Easing::PROGRESS_ONE
+     * @param[in] progress  Progress [0; Easing::PROGRESS_ONE]
+     *
+     * @return Interpolated color
+     */
+    static Color interpolate(const Color& from, const Color& to, uint16_t progress)
+    {
+        uint8_t red     = static_cast<uint8_t>(Easing::interpolate(from.getRed(), to.getRed(), progress));
+        uint8_t green   = static_cast<uint8_t>(Easing::interpolate(from.getGreen(), to.getGreen(), progress));
+        uint8_t blue    = static_cast<uint8_t>(Easing::interpolate(from.getBlue(), to.getBlue(), progress));
+
+        return Color(red, green, blue);
+    }
+
+private:
+
+    Tween   m_tween;    /**< Progress of the blending */
+    Color   m_from;     /**< Start color */
+    Color   m_to;       /**< End color */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* COLOR_TWEEN_H */
+
+/** @} */
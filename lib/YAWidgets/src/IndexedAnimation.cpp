@@ -0,0 +1,510 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Streamed indexed color animation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IndexedAnimation.h"
+
+#include <string.h>
+#include <AllocTracker.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint16_t getUInt16(const uint8_t* buffer);
+static uint32_t getUInt32(const uint8_t* buffer);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize the animation file extension. */
+const char* IndexedAnimation::FILE_EXT  = ".anim";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+IndexedAnimation& IndexedAnimation::operator=(const IndexedAnimation& animation)
+{
+    if (this != (&animation))
+    {
+        release();
+
+        if (false == animation.isEmpty())
+        {
+            const uint16_t  PALETTE_SIZE    = animation.m_palette.getSize();
+
+            /* Only the current frame is copied, the next one will be prefetched again. */
+            m_frames[0U]    = animation.m_frames[animation.m_frameBufferIdx];
+            m_frameTable    = AllocTracker::getInstance().newArray<FrameEntry>(AllocTracker::TAG_GFX, animation.m_frameCnt);
+
+            if ((true == m_frames[0U].isAllocated()) &&
+                (true == m_frames[1U].create(m_frames[0U].getWidth(), m_frames[0U].getHeight())) &&
+                (nullptr != m_frameTable) &&
+                (true == m_palette.create(PALETTE_SIZE)))
+            {
+                uint16_t idx = 0U;
+
+                for(idx = 0U; idx < PALETTE_SIZE; ++idx)
+                {
+                    m_palette.setColor(idx, animation.m_palette.getColor(idx));
+                }
+
+                for(idx = 0U; idx < animation.m_frameCnt; ++idx)
+                {
+                    m_frameTable[idx] = animation.m_frameTable[idx];
+                }
+
+                m_fs        = animation.m_fs;
+                m_fileName  = animation.m_fileName;
+                m_frameCnt  = animation.m_frameCnt;
+                m_frameIdx  = animation.m_frameIdx;
+                m_delay     = animation.m_delay;
+            }
+            else
+            {
+                release();
+            }
+        }
+
+        m_repeat    = animation.m_repeat;
+        m_isForward = animation.m_isForward;
+    }
+
+    return *this;
+}
+
+bool IndexedAnimation::load(FS& fs, const String& fileName)
+{
+    bool isSuccessful   = false;
+    File fd             = fs.open(fileName);
+
+    release();
+
+    if (true == fd)
+    {
+        if ((true == loadHeader(fd)) &&
+            (true == decodeFrame(fd, 0U, m_frames[0U])))
+        {
+            selectFrame(0U, 0U);
+
+            m_fs        = &fs;
+            m_fileName  = fileName;
+            m_isForward = true;
+
+            isSuccessful = true;
+        }
+        else
+        {
+            release();
+        }
+
+        fd.close();
+    }
+
+    return isSuccessful;
+}
+
+void IndexedAnimation::prefetch()
+{
+    const uint16_t FRAME_IDX = getNextFrameIndex();
+
+    /* Decode only if the frame really changes and it is not prefetched yet. */
+    if ((FRAME_IDX != m_frameIdx) &&
+        ((false == m_isPrefetched) || (FRAME_IDX != m_prefetchedFrameIdx)))
+    {
+        const uint8_t FRAME_BUFFER_IDX = (m_frameBufferIdx + 1U) % FRAME_BUFFER_CNT;
+
+        m_isPrefetched          = decodeFrame(FRAME_IDX, m_frames[FRAME_BUFFER_IDX]);
+        m_prefetchedFrameIdx    = FRAME_IDX;
+    }
+}
+
+bool IndexedAnimation::next()
+{
+    bool            isSuccessful    = true;
+    const uint16_t  FRAME_IDX       = getNextFrameIndex();
+
+    /* Switch only if the frame really changes. */
+    if (FRAME_IDX != m_frameIdx)
+    {
+        if ((true == m_isPrefetched) &&
+            (FRAME_IDX == m_prefetchedFrameIdx))
+        {
+            selectFrame((m_frameBufferIdx + 1U) % FRAME_BUFFER_CNT, FRAME_IDX);
+        }
+        else
+        {
+            isSuccessful = false;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void IndexedAnimation::reset()
+{
+    if (0U < m_frameCnt)
+    {
+        const uint8_t   FRAME_BUFFER_IDX    = (m_frameBufferIdx + 1U) % FRAME_BUFFER_CNT;
+        uint16_t        frameIdx            = 0U;
+
+        if (false == m_isForward)
+        {
+            frameIdx = m_frameCnt - 1U;
+        }
+
+        /* The other frame buffer is overwritten, which invalidates a prefetched frame. */
+        m_isPrefetched = false;
+
+        if (true == decodeFrame(frameIdx, m_frames[FRAME_BUFFER_IDX]))
+        {
+            selectFrame(FRAME_BUFFER_IDX, frameIdx);
+        }
+    }
+}
+
+void IndexedAnimation::release()
+{
+    if (nullptr != m_frameTable)
+    {
+        AllocTracker::getInstance().deleteArray(m_frameTable);
+        m_frameTable = nullptr;
+    }
+
+    m_palette.release();
+    m_frames[0U].release();
+    m_frames[1U].release();
+
+    m_fs                    = nullptr;
+    m_fileName.clear();
+    m_frameBufferIdx        = 0U;
+    m_frameCnt              = 0U;
+    m_frameIdx              = 0U;
+    m_delay                 = 0U;
+    m_isPrefetched          = false;
+    m_prefetchedFrameIdx    = 0U;
+    m_readBufferLength      = 0U;
+    m_readBufferIdx         = 0U;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool IndexedAnimation::loadHeader(File& fd)
+{
+    bool    isSuccessful    = false;
+    uint8_t header[HEADER_SIZE];
+
+    if ((HEADER_SIZE == fd.read(header, HEADER_SIZE)) &&
+        (0 == memcmp(header, "PXAN", 4U)) &&
+        (VERSION == header[4]))
+    {
+        uint8_t     flags       = header[5];
+        uint16_t    width       = getUInt16(&header[6]);
+        uint16_t    height      = getUInt16(&header[8]);
+        uint16_t    frameCnt    = getUInt16(&header[10]);
+        uint16_t    paletteSize = getUInt16(&header[12]);
+
+        if (0U < frameCnt)
+        {
+            m_frameTable = AllocTracker::getInstance().newArray<FrameEntry>(AllocTracker::TAG_GFX, frameCnt);
+        }
+
+        if ((nullptr != m_frameTable) &&
+            (true == m_palette.create(paletteSize)) &&
+            (true == m_frames[0U].create(width, height)) &&
+            (true == m_frames[1U].create(width, height)))
+        {
+            uint16_t    index   = 0U;
+            uint8_t     paletteEntry[PALETTE_ENTRY_SIZE];
+            uint8_t     frameEntry[FRAME_ENTRY_SIZE];
+
+            isSuccessful = true;
+
+            while((paletteSize > index) && (true == isSuccessful))
+            {
+                if (PALETTE_ENTRY_SIZE != fd.read(paletteEntry, PALETTE_ENTRY_SIZE))
+                {
+                    isSuccessful = false;
+                }
+                else
+                {
+                    m_palette.setColor(index, Color(paletteEntry[0], paletteEntry[1], paletteEntry[2]));
+                    ++index;
+                }
+            }
+
+            /* The frame table directly follows the palette. */
+            index = 0U;
+
+            while((frameCnt > index) && (true == isSuccessful))
+            {
+                if (FRAME_ENTRY_SIZE != fd.read(frameEntry, FRAME_ENTRY_SIZE))
+                {
+                    isSuccessful = false;
+                }
+                else
+                {
+                    m_frameTable[index].offset  = getUInt32(&frameEntry[0]);
+                    m_frameTable[index].delay   = getUInt16(&frameEntry[4]);
+                    ++index;
+                }
+            }
+
+            m_frameCnt  = frameCnt;
+            m_repeat    = (0U != (flags & FLAG_REPEAT));
+        }
+    }
+
+    return isSuccessful;
+}
+
+uint16_t IndexedAnimation::getNextFrameIndex() const
+{
+    uint16_t frameIdx = m_frameIdx;
+
+    if (0U < m_frameCnt)
+    {
+        if (false == m_isForward)
+        {
+            if (0U < frameIdx)
+            {
+                --frameIdx;
+            }
+            /* If animation repeats infinite, it will be set to the end again. */
+            else if (true == m_repeat)
+            {
+                frameIdx = m_frameCnt - 1U;
+            }
+            else
+            {
+                ;
+            }
+        }
+        else
+        {
+            if (m_frameCnt > (frameIdx + 1U))
+            {
+                ++frameIdx;
+            }
+            /* If animation repeats infinite, it will be set to the begin again. */
+            else if (true == m_repeat)
+            {
+                frameIdx = 0U;
+            }
+            else
+            {
+                ;
+            }
+        }
+    }
+
+    return frameIdx;
+}
+
+void IndexedAnimation::selectFrame(uint8_t frameBufferIdx, uint16_t frameIdx)
+{
+    m_frameBufferIdx    = frameBufferIdx;
+    m_frameIdx          = frameIdx;
+    m_delay             = m_frameTable[frameIdx].delay;
+    m_isPrefetched      = false;
+
+    if (0U == m_delay)
+    {
+        m_delay = DEFAULT_DELAY;
+    }
+}
+
+bool IndexedAnimation::decodeFrame(uint16_t frameIdx, YAGfxDynamicBitmap& frame)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != m_fs) &&
+        (m_frameCnt > frameIdx))
+    {
+        File fd = m_fs->open(m_fileName);
+
+        if (true == fd)
+        {
+            isSuccessful = decodeFrame(fd, frameIdx, frame);
+
+            fd.close();
+        }
+    }
+
+    return isSuccessful;
+}
+
+bool IndexedAnimation::decodeFrame(File& fd, uint16_t frameIdx, YAGfxDynamicBitmap& frame)
+{
+    bool isSuccessful = false;
+
+    if ((m_frameCnt > frameIdx) &&
+        (true == fd.seek(m_frameTable[frameIdx].offset)))
+    {
+        uint16_t    width   = frame.getWidth();
+        uint16_t    height  = frame.getHeight();
+        uint16_t    x       = 0U;
+        uint16_t    y       = 0U;
+        bool        isError = false;
+
+        m_readBufferLength  = 0U;
+        m_readBufferIdx     = 0U;
+
+        while((height > y) && (false == isError))
+        {
+            uint8_t ctrl        = 0U;
+            uint8_t colorIdx    = 0U;
+            uint8_t count       = 0U;
+            bool    isRun       = false;
+
+            if (false == readByte(fd, ctrl))
+            {
+                isError = true;
+            }
+            else
+            {
+                count   = (ctrl & CTRL_COUNT_MASK) + 1U;
+                isRun   = (0U != (ctrl & CTRL_RUN));
+
+                if (true == isRun)
+                {
+                    isError = (false == readByte(fd, colorIdx));
+                }
+            }
+
+            while((0U < count) && (height > y) && (false == isError))
+            {
+                if ((false == isRun) &&
+                    (false == readByte(fd, colorIdx)))
+                {
+                    isError = true;
+                }
+                else
+                {
+                    frame.drawPixel(x, y, m_palette.getColor(colorIdx));
+                    --count;
+                    ++x;
+
+                    if (width <= x)
+                    {
+                        x = 0U;
+                        ++y;
+                    }
+                }
+            }
+        }
+
+        isSuccessful = (false == isError);
+    }
+
+    return isSuccessful;
+}
+
+bool IndexedAnimation::readByte(File& fd, uint8_t& value)
+{
+    bool isSuccessful = true;
+
+    if (m_readBufferLength <= m_readBufferIdx)
+    {
+        m_readBufferLength  = fd.read(m_readBuffer, READ_BUFFER_SIZE);
+        m_readBufferIdx     = 0U;
+    }
+
+    if (m_readBufferLength <= m_readBufferIdx)
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        value = m_readBuffer[m_readBufferIdx];
+        ++m_readBufferIdx;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get a 16-bit value, which is stored in little endian format.
+ *
+ * @param[in] buffer    Buffer with the value
+ *
+ * @return Value
+ */
+static uint16_t getUInt16(const uint8_t* buffer)
+{
+    return static_cast<uint16_t>(buffer[0]) |
+           (static_cast<uint16_t>(buffer[1]) << 8U);
+}
+
+/**
+ * Get a 32-bit value, which is stored in little endian format.
+ *
+ * @param[in] buffer    Buffer with the value
+ *
+ * @return Value
+ */
+static uint32_t getUInt32(const uint8_t* buffer)
+{
+    return static_cast<uint32_t>(buffer[0]) |
+           (static_cast<uint32_t>(buffer[1]) << 8U) |
+           (static_cast<uint32_t>(buffer[2]) << 16U) |
+           (static_cast<uint32_t>(buffer[3]) << 24U);
+}
@@ -0,0 +1,440 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Streamed indexed color animation
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef INDEXED_ANIMATION_H
+#define INDEXED_ANIMATION_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfxBitmap.h>
+#include <YAGfxPalette.h>
+#include <FS.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Animation, which keeps its frames compressed in the filesystem and decodes
+ * only the current frame on demand into a small reusable frame buffer.
+ *
+ * The animation file (.anim) contains the frames as 8-bit palette indices,
+ * which are run-length encoded. Every frame has its own delay.
+ *
+ * File layout (all values little endian):
+ * - Header (16 byte):
+ *   - Magic "PXAN"
+ *   - Version (uint8_t)
+ *   - Flags (uint8_t), bit 0: repeat infinite
+ *   - Frame width in pixels (uint16_t)
+ *   - Frame height in pixels (uint16_t)
+ *   - Number of frames (uint16_t)
+ *   - Number of palette entries [1; 256] (uint16_t)
+ *   - Reserved (uint16_t)
+ * - Palette, every entry as red, green and blue (3 byte).
+ * - Frame table, every frame as file offset of the frame data (uint32_t) and
+ *   delay in ms (uint16_t).
+ * - Frame data, a sequence of packets. A packet starts with a control byte.
+ *   If bit 7 is set, the next palette index is repeated (bit 0-6) + 1 times.
+ *   Otherwise the (bit 0-6) + 1 following palette indices are taken literal.
+ *
+ * The frame table is read once during loading and kept in memory. The file
+ * is only opened while a frame is decoded, therefore many animations can be
+ * loaded at the same time, without exhausting the file descriptors of the
+ * filesystem.
+ *
+ * The next frame is decoded in advance with prefetch() into a second frame
+ * buffer. next() only switches between the frame buffers and never accesses
+ * the filesystem. This keeps the filesystem access out of the display update.
+ */
+class IndexedAnimation
+{
+public:
+
+    /**
+     * Constructs a animation, without any frame.
+     */
+    IndexedAnimation() :
+        m_fs(nullptr),
+        m_fileName(),
+        m_palette(),
+        m_frames(),
+        m_frameBufferIdx(0U),
+        m_frameCnt(0U),
+        m_frameTable(nullptr),
+        m_frameIdx(0U),
+        m_delay(0U),
+        m_repeat(true),
+        m_isForward(true),
+        m_isPrefetched(false),
+        m_prefetchedFrameIdx(0U),
+        m_readBuffer(),
+        m_readBufferLength(0U),
+        m_readBufferIdx(0U)
+    {
+    }
+
+    /**
+     * Constructs a animation by copy.
+     * The current decoded frame is copied, the animation file is not opened.
+     *
+     * @param[in] animation The animation, which to copy from.
+     */
+    IndexedAnimation(const IndexedAnimation& animation) :
+        m_fs(nullptr),
+        m_fileName(),
+        m_palette(),
+        m_frames(),
+        m_frameBufferIdx(0U),
+        m_frameCnt(0U),
+        m_frameTable(nullptr),
+        m_frameIdx(0U),
+        m_delay(0U),
+        m_repeat(true),
+        m_isForward(true),
+        m_isPrefetched(false),
+        m_prefetchedFrameIdx(0U),
+        m_readBuffer(),
+        m_readBufferLength(0U),
+        m_readBufferIdx(0U)
+    {
+        *this = animation;
+    }
+
+    /**
+     * Destroys the animation.
+     */
+    ~IndexedAnimation()
+    {
+        release();
+    }
+
+    /**
+     * Assigns a animation.
+     * The current decoded frame is copied, the animation file is not opened.
+     *
+     * @param[in] animation The animation, which to copy from.
+     *
+     * @return The animation itself.
+     */
+    IndexedAnimation& operator=(const IndexedAnimation& animation);
+
+    /**
+     * Does the animation runs infinite or just once?
+     *
+     * @return If the animation is continuously repeated, it will return true otherwise false.
+     */
+    bool isRepeatedInfinite() const
+    {
+        return m_repeat;
+    }
+
+    /**
+     * Set whether the animation is repeated continuously or it runs just once.
+     *
+     * @param[in] repeat    If set to true, the animation will run infinite.
+     */
+    void repeatInfinite(bool repeat)
+    {
+        m_repeat = repeat;
+    }
+
+    /**
+     * Is the animation running forward or backward?
+     *
+     * @return If the animation runs forward, it will return true otherwise false.
+     */
+    bool isForward() const
+    {
+        return m_isForward;
+    }
+
+    /**
+     * Set animation direction to forward or backward.
+     *
+     * @param[in] isForward If set to true, it will run forwards otherwise backwards.
+     */
+    void setForward(bool isForward)
+    {
+        m_isForward = isForward;
+    }
+
+    /**
+     * Get frame width in pixels.
+     *
+     * @return Frame width in pixels
+     */
+    uint16_t getFrameWidth() const
+    {
+        return m_frames[m_frameBufferIdx].getWidth();
+    }
+
+    /**
+     * Get frame height in pixels.
+     *
+     * @return Frame height in pixels
+     */
+    uint16_t getFrameHeight() const
+    {
+        return m_frames[m_frameBufferIdx].getHeight();
+    }
+
+    /**
+     * Get number of frames.
+     *
+     * @return Number of frames
+     */
+    uint16_t getFrameCount() const
+    {
+        return m_frameCnt;
+    }
+
+    /**
+     * Get the index of the current frame.
+     *
+     * @return Frame index
+     */
+    uint16_t getFrameIndex() const
+    {
+        return m_frameIdx;
+    }
+
+    /**
+     * Get how long the current frame shall be shown.
+     *
+     * @return Delay in ms
+     */
+    uint16_t getDelay() const
+    {
+        return m_delay;
+    }
+
+    /**
+     * Get the current decoded frame.
+     *
+     * @return Frame
+     */
+    const YAGfxBitmap& getFrame() const
+    {
+        return m_frames[m_frameBufferIdx];
+    }
+
+    /**
+     * Load the animation file (.anim) from the filesystem and decode the
+     * first frame. A already loaded animation is released before.
+     *
+     * The animation direction will be reset to forward.
+     *
+     * @param[in] fs        The filesystem
+     * @param[in] fileName  Name of the animation file in the filesystem
+     *
+     * @return If successful loaded, it will return true otherwise false.
+     */
+    bool load(FS& fs, const String& fileName);
+
+    /**
+     * Decode the next frame in advance, if not already done. It accesses the
+     * filesystem, therefore call it periodically outside of the display
+     * update.
+     */
+    void prefetch();
+
+    /**
+     * Move to the next frame. Only a prefetched frame is shown, the
+     * filesystem is never accessed.
+     *
+     * @return If the next frame is not prefetched yet, it will return false otherwise true.
+     */
+    bool next();
+
+    /**
+     * Reset animation sequence. The first frame is decoded right away.
+     *
+     * If the animation repeats only once, this will trigger that it will be
+     * repeated once again.
+     */
+    void reset();
+
+    /**
+     * Release the frame buffers, frame table and palette.
+     */
+    void release();
+
+    /**
+     * Use this function to determine whether a animation is loaded or not.
+     *
+     * @return If no animation is loaded, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return !m_frames[m_frameBufferIdx].isAllocated();
+    }
+
+    /** File extension of animation files. */
+    static const char*      FILE_EXT;
+
+    /** Default delay in ms, used if a frame has no delay. */
+    static const uint16_t   DEFAULT_DELAY   = 100U;
+
+private:
+
+    /** Number of frame buffers: the current and the prefetched frame. */
+    static const uint8_t    FRAME_BUFFER_CNT    = 2U;
+
+    /** Size of the read buffer in byte. */
+    static const size_t     READ_BUFFER_SIZE    = 32U;
+
+    /** Size of the file header in byte. */
+    static const size_t     HEADER_SIZE         = 16U;
+
+    /** Size of a palette entry in the file in byte. */
+    static const size_t     PALETTE_ENTRY_SIZE  = 3U;
+
+    /** Size of a frame table entry in the file in byte. */
+    static const size_t     FRAME_ENTRY_SIZE    = 6U;
+
+    /** Supported file format version. */
+    static const uint8_t    VERSION             = 1U;
+
+    /** Header flag: Repeat infinite. */
+    static const uint8_t    FLAG_REPEAT         = 0x01U;
+
+    /** Control byte flag: The next palette index is repeated. */
+    static const uint8_t    CTRL_RUN            = 0x80U;
+
+    /** Control byte mask for the number of pixels - 1. */
+    static const uint8_t    CTRL_COUNT_MASK     = 0x7fU;
+
+    /**
+     * Frame table entry.
+     */
+    struct FrameEntry
+    {
+        uint32_t    offset; /**< File offset of the frame data */
+        uint16_t    delay;  /**< Delay in ms */
+    };
+
+    FS*                 m_fs;                           /**< Filesystem of the animation file */
+    String              m_fileName;                     /**< Name of the animation file */
+    YAGfxPalette        m_palette;                      /**< Color palette */
+    YAGfxDynamicBitmap  m_frames[FRAME_BUFFER_CNT];     /**< Frame buffers for the current and the prefetched frame */
+    uint8_t             m_frameBufferIdx;               /**< Index of the frame buffer with the current frame */
+    uint16_t            m_frameCnt;                     /**< Number of frames */
+    FrameEntry*         m_frameTable;                   /**< Frame table */
+    uint16_t            m_frameIdx;                     /**< Index of the current frame */
+    uint16_t            m_delay;                        /**< Delay of the current frame in ms */
+    bool                m_repeat;                       /**< Repeat animation continuously or it runs just once. */
+    bool                m_isForward;                    /**< The animation runs forwards or backwards. */
+    bool                m_isPrefetched;                 /**< Is a frame prefetched in the other frame buffer? */
+    uint16_t            m_prefetchedFrameIdx;           /**< Index of the prefetched frame */
+    uint8_t             m_readBuffer[READ_BUFFER_SIZE]; /**< Read buffer to avoid single byte file access */
+    size_t              m_readBufferLength;             /**< Number of valid bytes in the read buffer */
+    size_t              m_readBufferIdx;                /**< Read index in the read buffer */
+
+    /**
+     * Load header, palette and frame table from the opened animation file.
+     *
+     * @param[in] fd    Animation file
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool loadHeader(File& fd);
+
+    /**
+     * Get the index of the frame, which follows the current one. It depends
+     * on the animation direction and whether it repeats.
+     *
+     * @return Frame index. If there is no following frame, it will be the current one.
+     */
+    uint16_t getNextFrameIndex() const;
+
+    /**
+     * Select a frame as current one.
+     *
+     * @param[in] frameBufferIdx    Index of the frame buffer, which contains the frame
+     * @param[in] frameIdx          Frame index
+     */
+    void selectFrame(uint8_t frameBufferIdx, uint16_t frameIdx);
+
+    /**
+     * Open the animation file and decode a frame into a frame buffer.
+     * The file is closed afterwards.
+     *
+     * @param[in] frameIdx  Frame index
+     * @param[in] frame     Frame buffer
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool decodeFrame(uint16_t frameIdx, YAGfxDynamicBitmap& frame);
+
+    /**
+     * Decode a frame from the opened animation file into a frame buffer.
+     *
+     * @param[in] fd        Animation file
+     * @param[in] frameIdx  Frame index
+     * @param[in] frame     Frame buffer
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool decodeFrame(File& fd, uint16_t frameIdx, YAGfxDynamicBitmap& frame);
+
+    /**
+     * Read the next byte of the frame data.
+     *
+     * @param[in]   fd      Animation file
+     * @param[out]  value   Read byte
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readByte(File& fd, uint8_t& value);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* INDEXED_ANIMATION_H */
+
+/** @} */
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include <Widget.hpp>
 #include <YAColor.h>
+#include <Util.h>
 
 /******************************************************************************
  * Macros
@@ -139,7 +140,11 @@ public:
      */
     void setOnState(bool state)
     {
-        m_isOn = state;
+        if (state != m_isOn)
+        {
+            m_isOn      = state;
+            m_isDirty   = true;
+        }
     }
 
     /**
@@ -159,7 +164,8 @@ public:
      */
     void setColorOff(const Color& color)
     {
-        m_colorOff = color;
+        m_colorOff  = color;
+        m_isDirty   = true;
     }
 
     /**
@@ -179,7 +185,8 @@ public:
      */
     void setColorOn(const Color& color)
     {
-        m_colorOn = color;
+        m_colorOn   = color;
+        m_isDirty   = true;
     }
 
     /**
@@ -199,7 +206,11 @@ public:
      */
     void setWidth(uint16_t width)
     {
-        m_width = width;
+        if (width != m_width)
+        {
+            m_width     = width;
+            m_isDirty   = true;
+        }
     }
 
     /**
@@ -212,6 +223,21 @@ public:
         return m_width;
     }
 
+    /**
+     * Get the bounding box of the lamp in the canvas.
+     *
+     * @param[in]   canvasWidth     Canvas width in pixel
+     * @param[in]   canvasHeight    Canvas height in pixel
+     * @param[out]  box             Bounding box
+     */
+    void getBoundingBox(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage::Rect& box) const override
+    {
+        UTIL_NOT_USED(canvasWidth);
+        UTIL_NOT_USED(canvasHeight);
+
+        box = YAGfxDamage::Rect(m_posX, m_posY, m_width, HEIGHT);
+    }
+
     /** Widget type string */
     static const char*      WIDGET_TYPE;
 
@@ -34,6 +34,8 @@
  *****************************************************************************/
 #include "ProgressBar.h"
 
+#include <YAGfxAA.h>
+
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
@@ -81,6 +83,10 @@ void ProgressBar::paint(YAGfx& gfx)
         showProgressBar(gfx);
         break;
 
+    case ALGORITHM_RING:
+        showProgressRing(gfx);
+        break;
+
     case ALGORITHM_MAX:
         /* Should never happen. */
         break;
@@ -133,6 +139,23 @@ void ProgressBar::showProgressBar(YAGfx& gfx)
     }
 }
 
+void ProgressBar::showProgressRing(YAGfx& gfx)
+{
+    uint16_t        width       = gfx.getWidth() - m_posX;
+    uint16_t        height      = gfx.getHeight() - m_posY;
+    YAGfxAA::Fixed  centerX     = (static_cast<YAGfxAA::Fixed>(m_posX) * YAGfxAA::FIXED_ONE) + (width * YAGfxAA::FIXED_HALF);
+    YAGfxAA::Fixed  centerY     = (static_cast<YAGfxAA::Fixed>(m_posY) * YAGfxAA::FIXED_ONE) + (height * YAGfxAA::FIXED_HALF);
+    YAGfxAA::Fixed  radius      = ((width < height) ? width : height) * YAGfxAA::FIXED_HALF;
+    YAGfxAA::Fixed  thickness   = radius / 3;
+
+    if (YAGfxAA::FIXED_ONE > thickness)
+    {
+        thickness = YAGfxAA::FIXED_ONE;
+    }
+
+    YAGfxAA::drawArc(gfx, centerX, centerY, radius, thickness, 0, (360 * m_progress) / 100U, m_color);
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
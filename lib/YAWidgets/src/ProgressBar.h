@@ -69,6 +69,7 @@ public:
     {
         ALGORITHM_PROGRESS_BAR = 0, /**< Show progress bar always over the longer dimension. */
         ALGORITHM_PIXEL_WISE,       /**< Show progress pixel wise over the display. */
+        ALGORITHM_RING,             /**< Show progress as anti-aliased arc of a ring. */
         ALGORITHM_MAX               /**< Number of algorithms */
     };
 
@@ -131,11 +132,13 @@ public:
     {
         if (100 < progress)
         {
-            m_progress = 100;
+            progress = 100;
         }
-        else
+
+        if (progress != m_progress)
         {
-            m_progress = progress;
+            m_progress  = progress;
+            m_isDirty   = true;
         }
     }
 
@@ -146,7 +149,8 @@ public:
      */
     void setColor(const Color& color)
     {
-        m_color = color;
+        m_color     = color;
+        m_isDirty   = true;
         return;
     }
 
@@ -157,12 +161,28 @@ public:
      */
     void setAlgo(Algorithm algorithm)
     {
-        if (ALGORITHM_MAX > algorithm)
+        if ((ALGORITHM_MAX > algorithm) &&
+            (algorithm != m_algorithm))
         {
             m_algorithm = algorithm;
+            m_isDirty   = true;
         }
     }
 
+    /**
+     * Get the bounding box of the progress bar in the canvas. It covers the
+     * canvas from its position up to the lower right corner.
+     *
+     * @param[in]   canvasWidth     Canvas width in pixel
+     * @param[in]   canvasHeight    Canvas height in pixel
+     * @param[out]  box             Bounding box
+     */
+    void getBoundingBox(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage::Rect& box) const override
+    {
+        box = YAGfxDamage::Rect(0, 0, canvasWidth, canvasHeight).intersect(
+                YAGfxDamage::Rect(m_posX, m_posY, canvasWidth, canvasHeight));
+    }
+
     /** Widget type string */
     static const char*  WIDGET_TYPE;
 
@@ -192,6 +212,14 @@ private:
      * @param[in] gfx Graphics interface
      */
     void showProgressBar(YAGfx& gfx);
+
+    /**
+     * Show current progress as anti-aliased arc of a ring, centered in the
+     * remaining area. The arc starts at the 12 o'clock position.
+     * 
+     * @param[in] gfx Graphics interface
+     */
+    void showProgressRing(YAGfx& gfx);
 };
 
 /******************************************************************************
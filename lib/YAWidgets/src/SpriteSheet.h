@@ -207,11 +207,11 @@ public:
     }
 
     /**
-     * @brief Get the Frame object
+     * Get the current frame.
      * 
-     * @return YAGfxBitmap& 
+     * @return Current frame in the compact RGB565 format
      */
-    const YAGfxBitmap& getFrame() const
+    const YAGfxBitmapRgb565& getFrame() const
     {
         return m_frame;
     }
@@ -287,17 +287,17 @@ private:
      */
     static const uint8_t    DEFAULT_FPS = 12U;
 
-    YAGfxDynamicBitmap  m_texture;          /**< Texture image. */
-    YAGfxMap            m_textureMap;       /**< Map canvas over the texture image. */
-    YAGfxOverlayBitmap  m_frame;            /**< The current frame. */
-    uint8_t             m_frameCnt;         /**< Number of frames in the texture. */
-    uint8_t             m_fps;              /**< Number of frames per second. */
-    bool                m_repeat;           /**< Repeat animation continuously or it runs just once. */
-    bool                m_isForward;        /**< The animation (order of sprites) runs forwards and backwards. */
-    uint8_t             m_framesX;          /**< Number of frames on texture x-axis. */
-    uint8_t             m_framesY;          /**< Number of frames on texture y-axis. */
-    uint8_t             m_currentFrameX;    /**< x index of current selected frame. */
-    uint8_t             m_currentFrameY;    /**< y index of current selected frame. */
+    YAGfxDynamicBitmapRgb565    m_texture;          /**< Texture image (RGB565). */
+    YAGfxMapRgb565              m_textureMap;       /**< Map canvas over the texture image. */
+    YAGfxOverlayBitmapRgb565    m_frame;            /**< The current frame. */
+    uint8_t                     m_frameCnt;         /**< Number of frames in the texture. */
+    uint8_t                     m_fps;              /**< Number of frames per second. */
+    bool                        m_repeat;           /**< Repeat animation continuously or it runs just once. */
+    bool                        m_isForward;        /**< The animation (order of sprites) runs forwards and backwards. */
+    uint8_t                     m_framesX;          /**< Number of frames on texture x-axis. */
+    uint8_t                     m_framesY;          /**< Number of frames on texture y-axis. */
+    uint8_t                     m_currentFrameX;    /**< x index of current selected frame. */
+    uint8_t                     m_currentFrameY;    /**< y index of current selected frame. */
 
     /**
      * Is the current frame the very first one?
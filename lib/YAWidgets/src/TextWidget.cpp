@@ -37,6 +37,7 @@
 #include <Fonts.h>
 #include <Util.h>
 #include <Logging.h>
+#include <YAGfxSubPixel.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -163,8 +164,8 @@ void TextWidget::prepareNewText(YAGfx& gfx)
                     m_scrollInfoNew.offset = gfx.getWidth();
                 }
 
-                /* Because the scroll timer is stopped, it must be enabled again. */
-                m_scrollTimer.start(0U);
+                /* Because the text is static, scrolling must be started. */
+                startScrolling();
             }
         }
         /* Current text is scrolling. */
@@ -217,103 +218,162 @@ void TextWidget::paint(YAGfx& gfx)
         m_isNewTextAvailable = false;
     }
 
+    /* Move the text(s) to the position of the current frame time. */
+    if (true == m_isScrollActive)
+    {
+        scroll(gfx);
+    }
+
     /* Show current text. */
-    m_gfxText.setTextCursorPos(m_posX + m_scrollInfo.offset, cursorY);
-    show(gfx, m_formatStr, m_scrollInfo.isEnabled);
+    showAtScrollPos(gfx, m_formatStr, m_scrollInfo, cursorY);
 
     /* Show new text. */
     if (true == m_handleNewText)
     {
-        m_gfxText.setTextCursorPos(m_posX + m_scrollInfoNew.offset, cursorY);
-        show(gfx, m_formatStrNew, m_scrollInfoNew.isEnabled);
+        showAtScrollPos(gfx, m_formatStrNew, m_scrollInfoNew, cursorY);
     }
+}
 
-    /* Is it time to scroll the text(s) again? */
-    if (true == m_scrollTimer.isTimeout())
+void TextWidget::scroll(YAGfx& gfx)
+{
+    uint32_t now         = FrameClock::getInstance().getTime();
+    uint32_t elapsed     = now - m_scrollTimestamp;
+    uint32_t distance    = 0U;
+    uint32_t steps       = 0U;
+
+    /* If the widget was not shown for a while, e.g. because the slot was
+     * inactive, the text continues without jumping.
+     */
+    if (FrameClock::MAX_DELTA < elapsed)
     {
-        /* Handle scrolling text. */
-        if (m_scrollInfo.offsetDest < m_scrollInfo.offset)
-        {
-            --m_scrollInfo.offset;
-        }
-        else if (m_scrollInfo.offsetDest > m_scrollInfo.offset)
+        elapsed = FrameClock::MAX_DELTA;
+    }
+
+    distance            = m_scrollFraction + ((elapsed << 8U) / m_scrollPause); /* In 1/256 pixel */
+    steps               = distance >> 8U;
+    m_scrollTimestamp   = now;
+    m_scrollFraction    = static_cast<uint8_t>(distance & 0xFFU);
+
+    while((0U < steps) && (true == m_isScrollActive))
+    {
+        scrollStep(gfx);
+        --steps;
+    }
+
+    /* A stopped text is shown at a whole pixel position. */
+    if (false == m_isScrollActive)
+    {
+        m_scrollFraction = 0U;
+    }
+}
+
+void TextWidget::scrollStep(YAGfx& gfx)
+{
+    /* Handle scrolling text. */
+    if (m_scrollInfo.offsetDest < m_scrollInfo.offset)
+    {
+        --m_scrollInfo.offset;
+    }
+    else if (m_scrollInfo.offsetDest > m_scrollInfo.offset)
+    {
+        ++m_scrollInfo.offset;
+    }
+    else if (false == m_handleNewText)
+    {
+        m_scrollInfo.offset = gfx.getWidth();
+        
+        ++m_scrollingCnt;
+    }
+    else
+    {
+        /* Wait till new text is at destination position. */
+        ;
+    }
+
+    /* Handle scrolling new text. */
+    if (true == m_handleNewText)
+    {
+        if (m_scrollInfoNew.offsetDest < m_scrollInfoNew.offset)
         {
-            ++m_scrollInfo.offset;
+            --m_scrollInfoNew.offset;
         }
-        else if (false == m_handleNewText)
+        else if (m_scrollInfoNew.offsetDest > m_scrollInfoNew.offset)
         {
-            m_scrollInfo.offset = gfx.getWidth();
-            
-            ++m_scrollingCnt;
+            ++m_scrollInfoNew.offset;
         }
         else
         {
-            /* Wait till new text is at destination position. */
-            ;
-        }
+            m_handleNewText = false;
+            m_formatStr     = m_formatStrNew;
+            m_scrollingCnt  = 0U;
 
-        /* Handle scrolling new text. */
-        if (true == m_handleNewText)
-        {
-            if (m_scrollInfoNew.offsetDest < m_scrollInfoNew.offset)
+            /* Any additional new format string available? */
+            if (false == m_formatStrTmp.isEmpty())
+            {
+                m_formatStrNew          = m_formatStrTmp;
+                m_isNewTextAvailable    = true;
+
+                m_formatStrTmp.clear();
+            }
+
+            /* If the new text can be shown static, it must be stopped scrolling  now. */
+            if (true == m_scrollInfoNew.stopAtDest)
             {
-                --m_scrollInfoNew.offset;
+                m_scrollInfoNew.isEnabled   = false;
+                m_scrollInfoNew.stopAtDest  = false;
             }
-            else if (m_scrollInfoNew.offsetDest > m_scrollInfoNew.offset)
+
+            /* Show new text static? */
+            if (false == m_scrollInfoNew.isEnabled)
             {
-                ++m_scrollInfoNew.offset;
+                m_scrollInfo.isEnabled  = false;
+                m_scrollInfo.stopAtDest = false;
+                m_scrollInfo.offsetDest = 0;
+                m_scrollInfo.offset     = 0;
+                m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
             }
             else
+            /* Continue scrolling with new text. */
             {
-                m_handleNewText = false;
-                m_formatStr     = m_formatStrNew;
-                m_scrollingCnt  = 0U;
-
-                /* Any additional new format string available? */
-                if (false == m_formatStrTmp.isEmpty())
-                {
-                    m_formatStrNew          = m_formatStrTmp;
-                    m_isNewTextAvailable    = true;
+                m_scrollInfo.isEnabled  = true;
+                m_scrollInfo.stopAtDest = false;
+                m_scrollInfo.offsetDest = -m_scrollInfoNew.textWidth;
+                m_scrollInfo.offset     = m_scrollInfoNew.offset - 1;   /* Because new text is already at most left position, decrease one pixel to avoid a short stumble. */
+                m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
+            }
+        }
+    }
 
-                    m_formatStrTmp.clear();
-                }
+    if (false == m_scrollInfo.isEnabled)
+    {
+        m_isScrollActive = false;
+    }
+}
 
-                /* If the new text can be shown static, it must be stopped scrolling  now. */
-                if (true == m_scrollInfoNew.stopAtDest)
-                {
-                    m_scrollInfoNew.isEnabled   = false;
-                    m_scrollInfoNew.stopAtDest  = false;
-                }
+void TextWidget::showAtScrollPos(YAGfx& gfx, const String& formatStr, const ScrollInfo& scrollInfo, int16_t cursorY)
+{
+    /* The text moves from the current offset towards the destination. The
+     * fraction of the way to the next pixel is drawn blended between both.
+     */
+    if ((0U == m_scrollFraction) ||
+        (scrollInfo.offsetDest == scrollInfo.offset))
+    {
+        m_gfxText.setTextCursorPos(m_posX + scrollInfo.offset, cursorY);
+        show(gfx, formatStr, scrollInfo.isEnabled);
+    }
+    else if (scrollInfo.offsetDest < scrollInfo.offset)
+    {
+        YAGfxSubPixel subPixelGfx(gfx, static_cast<uint8_t>(YAGfxAA::COVERAGE_FULL - m_scrollFraction));
 
-                /* Show new text static? */
-                if (false == m_scrollInfoNew.isEnabled)
-                {
-                    m_scrollInfo.isEnabled  = false;
-                    m_scrollInfo.stopAtDest = false;
-                    m_scrollInfo.offsetDest = 0;
-                    m_scrollInfo.offset     = 0;
-                    m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
-                }
-                else
-                /* Continue scrolling with new text. */
-                {
-                    m_scrollInfo.isEnabled  = true;
-                    m_scrollInfo.stopAtDest = false;
-                    m_scrollInfo.offsetDest = -m_scrollInfoNew.textWidth;
-                    m_scrollInfo.offset     = m_scrollInfoNew.offset - 1;   /* Because new text is already at most left position, decrease one pixel to avoid a short stumble. */
-                    m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
-                }
-            }
-        }
+        m_gfxText.setTextCursorPos(m_posX + scrollInfo.offset - 1, cursorY);
+        show(subPixelGfx, formatStr, scrollInfo.isEnabled);
+    }
+    else
+    {
+        YAGfxSubPixel subPixelGfx(gfx, m_scrollFraction);
 
-        if (false == m_scrollInfo.isEnabled)
-        {
-            m_scrollTimer.stop();
-        }
-        else
-        {
-            m_scrollTimer.start(m_scrollPause);
-        }
+        m_gfxText.setTextCursorPos(m_posX + scrollInfo.offset, cursorY);
+        show(subPixelGfx, formatStr, scrollInfo.isEnabled);
     }
 }
 
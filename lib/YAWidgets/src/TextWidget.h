@@ -50,6 +50,7 @@
 #include <YAFont.h>
 #include <YAGfxText.h>
 #include <SimpleTimer.hpp>
+#include <FrameClock.hpp>
 
 /******************************************************************************
  * Macros
@@ -92,7 +93,9 @@ public:
         m_gfxText(DEFAULT_FONT, DEFAULT_TEXT_COLOR),
         m_scrollingCnt(0U),
         m_scrollOffset(0),
-        m_scrollTimer()
+        m_isScrollActive(false),
+        m_scrollTimestamp(0U),
+        m_scrollFraction(0U)
     {
     }
 
@@ -115,7 +118,9 @@ public:
         m_gfxText(DEFAULT_FONT, DEFAULT_TEXT_COLOR),
         m_scrollingCnt(0U),
         m_scrollOffset(0),
-        m_scrollTimer()
+        m_isScrollActive(false),
+        m_scrollTimestamp(0U),
+        m_scrollFraction(0U)
     {
     }
 
@@ -136,7 +141,9 @@ public:
         m_gfxText(widget.m_gfxText),
         m_scrollingCnt(widget.m_scrollingCnt),
         m_scrollOffset(widget.m_scrollOffset),
-        m_scrollTimer(widget.m_scrollTimer)
+        m_isScrollActive(widget.m_isScrollActive),
+        m_scrollTimestamp(widget.m_scrollTimestamp),
+        m_scrollFraction(widget.m_scrollFraction)
     {
     }
 
@@ -168,7 +175,9 @@ public:
             m_gfxText               = widget.m_gfxText;
             m_scrollingCnt          = widget.m_scrollingCnt;
             m_scrollOffset          = widget.m_scrollOffset;
-            m_scrollTimer           = widget.m_scrollTimer;
+            m_isScrollActive        = widget.m_isScrollActive;
+            m_scrollTimestamp       = widget.m_scrollTimestamp;
+            m_scrollFraction        = widget.m_scrollFraction;
         }
 
         return *this;
@@ -225,6 +234,8 @@ public:
         m_scrollInfo.offsetDest = 0;
         m_scrollInfo.stopAtDest = false;
         m_scrollInfo.textWidth  = 0U;
+
+        m_isDirty = true;
     }
 
     /**
@@ -255,6 +266,7 @@ public:
     void setTextColor(const Color& color)
     {
         m_gfxText.setTextColor(color);
+        m_isDirty = true;
         return;
     }
 
@@ -290,9 +302,11 @@ public:
     }
 
     /**
-     * Change scroll speed of all text widgets by changing the pause between each movement.
+     * Change scroll speed of all text widgets by changing the time a text needs
+     * to move by one pixel. The text moves smooth with sub-pixel steps in between,
+     * independent of the frame rate.
      *
-     * @param[in] pause Scroll pause in ms
+     * @param[in] pause Scroll pause in ms per pixel
      *
      * @return If successful set, it will return true otherwise false.
      */
@@ -336,6 +350,33 @@ public:
     /** Default text color */
     static const uint32_t   DEFAULT_TEXT_COLOR      = ColorDef::WHITE;
 
+    /**
+     * Is the widget dirty? A new text or a scrolling text makes it dirty too.
+     *
+     * @return If dirty, it will return true otherwise false.
+     */
+    bool isDirty() override
+    {
+        return ((true == m_isDirty) ||
+                (true == m_isNewTextAvailable) ||
+                (true == m_isScrollActive));
+    }
+
+    /**
+     * Get the bounding box of the text in the canvas. Because a scrolling text
+     * moves over the whole canvas width and a text may have several lines, it
+     * covers the canvas from the widget y-position down to the bottom.
+     *
+     * @param[in]   canvasWidth     Canvas width in pixel
+     * @param[in]   canvasHeight    Canvas height in pixel
+     * @param[out]  box             Bounding box
+     */
+    void getBoundingBox(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage::Rect& box) const override
+    {
+        box = YAGfxDamage::Rect(0, 0, canvasWidth, canvasHeight).intersect(
+                YAGfxDamage::Rect(0, m_posY, canvasWidth, canvasHeight));
+    }
+
     /** Widget type string */
     static const char*      WIDGET_TYPE;
 
@@ -390,10 +431,12 @@ private:
     YAGfxText       m_gfxText;              /**< Current gfx for text */
     uint32_t        m_scrollingCnt;         /**< Counts how often a text was complete scrolled. */
     int16_t         m_scrollOffset;         /**< Pixel offset of cursor x position, used for scrolling. */
-    SimpleTimer     m_scrollTimer;          /**< Timer, used for scrolling */
+    bool            m_isScrollActive;       /**< Is the text moving? */
+    uint32_t        m_scrollTimestamp;      /**< Frame time of the last scroll movement in ms. */
+    uint8_t         m_scrollFraction;       /**< Sub-pixel part of the scroll movement in 1/256 pixel. */
 
     static KeywordHandler   m_keywordHandlers[];    /**< List of all supported keyword handlers. */
-    static uint32_t         m_scrollPause;          /**< Pause in ms, between each scroll movement. */
+    static uint32_t         m_scrollPause;          /**< Time in ms, to move the text by one pixel. */
 
     /**
      * Checks new text and prepares the scroll information.
@@ -402,6 +445,41 @@ private:
      */
     void prepareNewText(YAGfx& gfx);
 
+    /**
+     * Start moving the text from the current frame time on.
+     */
+    void startScrolling()
+    {
+        m_isScrollActive    = true;
+        m_scrollTimestamp   = FrameClock::getInstance().getTime();
+        m_scrollFraction    = 0U;
+    }
+
+    /**
+     * Move the text(s) by the time elapsed since the last movement.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void scroll(YAGfx& gfx);
+
+    /**
+     * Move the text(s) by one pixel.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void scrollStep(YAGfx& gfx);
+
+    /**
+     * Show a text at its scroll position. A fractional position is drawn
+     * blended between two pixels.
+     *
+     * @param[in] gfx           Graphics interface
+     * @param[in] formatStr     String which may contain format tags
+     * @param[in] scrollInfo    Scroll information of the text
+     * @param[in] cursorY       Cursor y-position (baseline)
+     */
+    void showAtScrollPos(YAGfx& gfx, const String& formatStr, const ScrollInfo& scrollInfo, int16_t cursorY);
+
     /**
      * Paint the widget with the given graphics interface.
      * 
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include <WString.h>
 #include <YAGfx.h>
+#include <YAGfxDamage.h>
 
 /******************************************************************************
  * Macros
@@ -58,6 +59,10 @@
 /**
  * Base widget, which contains the position
  * inside a canvas and declares the graphics interface.
+ *
+ * A widget is dirty, if anything changed since it was painted last time.
+ * Its bounding box and the bounding box where it was painted last time
+ * are the damaged regions, which need to be repainted.
  */
 class Widget
 {
@@ -87,6 +92,7 @@ public:
             m_posY      = widget.m_posY;
             /* m_name is not assigned! */
             m_isEnabled = widget.m_isEnabled;
+            m_isDirty   = true;
         }
 
         return *this;
@@ -100,8 +106,13 @@ public:
      */
     void move(int16_t x, int16_t y)
     {
-        m_posX = x;
-        m_posY = y;
+        if ((x != m_posX) ||
+            (y != m_posY))
+        {
+            m_posX      = x;
+            m_posY      = y;
+            m_isDirty   = true;
+        }
     }
 
     /**
@@ -124,9 +135,77 @@ public:
      */
     void update(YAGfx& gfx)
     {
+        /* Clear the dirty flag before painting, because painting may change
+         * the widget again, e.g. the next animation frame.
+         */
+        m_isDirty = false;
+
         if (true == m_isEnabled)
         {
             paint(gfx);
+            getBoundingBox(gfx.getWidth(), gfx.getHeight(), m_paintedBox);
+        }
+        else
+        {
+            m_paintedBox = YAGfxDamage::Rect();
+        }
+    }
+
+    /**
+     * Is the widget dirty, which means it changed since it was painted last time?
+     *
+     * @return If dirty, it will return true otherwise false.
+     */
+    virtual bool isDirty()
+    {
+        return m_isDirty;
+    }
+
+    /**
+     * Mark the widget as dirty, which forces a repaint of it.
+     */
+    void setDirty()
+    {
+        m_isDirty = true;
+    }
+
+    /**
+     * Get the bounding box of the widget in the canvas, which contains all
+     * pixels the widget may paint. If the widget size is unknown, the whole
+     * canvas is assumed.
+     *
+     * @param[in]   canvasWidth     Canvas width in pixel
+     * @param[in]   canvasHeight    Canvas height in pixel
+     * @param[out]  box             Bounding box
+     */
+    virtual void getBoundingBox(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage::Rect& box) const
+    {
+        box = YAGfxDamage::Rect(0, 0, canvasWidth, canvasHeight);
+    }
+
+    /**
+     * Collect the damaged regions of a dirty widget: where it was painted last
+     * time and where it will be painted now. The widget is clean afterwards and
+     * the damaged regions must be repainted by the caller.
+     *
+     * @param[in]       canvasWidth     Canvas width in pixel
+     * @param[in]       canvasHeight    Canvas height in pixel
+     * @param[in,out]   damage          Damaged regions in canvas coordinates
+     */
+    virtual void collectDamage(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage& damage)
+    {
+        if (true == isDirty())
+        {
+            damage.add(m_paintedBox);
+            m_paintedBox = YAGfxDamage::Rect();
+
+            if (true == m_isEnabled)
+            {
+                getBoundingBox(canvasWidth, canvasHeight, m_paintedBox);
+                damage.add(m_paintedBox);
+            }
+
+            m_isDirty = false;
         }
     }
 
@@ -177,7 +256,11 @@ public:
      */
     void enable()
     {
-        m_isEnabled = true;
+        if (false == m_isEnabled)
+        {
+            m_isEnabled = true;
+            m_isDirty   = true;
+        }
     }
 
     /**
@@ -186,7 +269,11 @@ public:
      */
     void disable()
     {
-        m_isEnabled = false;
+        if (true == m_isEnabled)
+        {
+            m_isEnabled = false;
+            m_isDirty   = true;
+        }
     }
 
     /**
@@ -212,11 +299,13 @@ public:
 
 protected:
 
-    const char* m_type;         /**< Widget type string */
-    int16_t     m_posX;         /**< Upper left corner (x-coordinate) of the widget in a canvas. */
-    int16_t     m_posY;         /**< Upper left corner (y-coordinate) of the widget in a canvas. */
-    String      m_name;         /**< Widget name for identification. */
-    bool        m_isEnabled;    /**< If widget is enabled, it will be drawn otherwise not. */
+    const char*         m_type;         /**< Widget type string */
+    int16_t             m_posX;         /**< Upper left corner (x-coordinate) of the widget in a canvas. */
+    int16_t             m_posY;         /**< Upper left corner (y-coordinate) of the widget in a canvas. */
+    String              m_name;         /**< Widget name for identification. */
+    bool                m_isEnabled;    /**< If widget is enabled, it will be drawn otherwise not. */
+    bool                m_isDirty;      /**< If widget changed since it was painted last time, it will be true otherwise false. */
+    YAGfxDamage::Rect   m_paintedBox;   /**< Bounding box, where the widget was painted last time. */
 
     /**
      * Constructs a widget at position (0, 0) in the canvas.
@@ -228,7 +317,9 @@ protected:
         m_posX(0),
         m_posY(0),
         m_name(),
-        m_isEnabled(true)
+        m_isEnabled(true),
+        m_isDirty(true),
+        m_paintedBox()
     {
     }
 
@@ -244,7 +335,9 @@ protected:
         m_posX(x),
         m_posY(y),
         m_name(),
-        m_isEnabled(true)
+        m_isEnabled(true),
+        m_isDirty(true),
+        m_paintedBox()
     {
     }
 
@@ -259,7 +352,9 @@ protected:
         m_posX(widget.m_posX),
         m_posY(widget.m_posY),
         m_name(),
-        m_isEnabled(widget.m_isEnabled)
+        m_isEnabled(widget.m_isEnabled),
+        m_isDirty(true),
+        m_paintedBox()
     {
     }
 
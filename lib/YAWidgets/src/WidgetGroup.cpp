@@ -34,6 +34,9 @@
  *****************************************************************************/
 #include "WidgetGroup.h"
 
+#include <ObjectPool.hpp>
+#include <CriticalSection.hpp>
+
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
@@ -46,10 +49,18 @@
  * Types and classes
  *****************************************************************************/
 
+/** Max. number of pooled widget list elements, shared by all widget groups. */
+static const size_t WIDGET_LIST_POOL_SIZE   = 32U;
+
+/** Pool of the widget list elements. */
+typedef ObjectPool<ListElement<Widget*>, WIDGET_LIST_POOL_SIZE, CriticalSection> WidgetListPool;
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
 
+static WidgetListPool& getWidgetListPool();
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -61,6 +72,79 @@ const char* WidgetGroup::WIDGET_TYPE = "widgetGroup";
  * Public Methods
  *****************************************************************************/
 
+ListElement<Widget*>* WidgetListAllocator::create(Widget*& element, ListElement<Widget*>* prev, ListElement<Widget*>* next)
+{
+    return getWidgetListPool().create(element, prev, next);
+}
+
+void WidgetListAllocator::destroy(ListElement<Widget*>* listElement)
+{
+    getWidgetListPool().destroy(listElement);
+}
+
+void WidgetGroup::collectDamage(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage& damage)
+{
+    WidgetListIterator  it(m_widgets);
+    YAGfxDamage         childDamage;
+
+    /* Collect the damage of all widgets, which makes them clean too. */
+    if (true == it.first())
+    {
+        do
+        {
+            (*it.current())->collectDamage(m_width, m_height, childDamage);
+        }
+        while(true == it.next());
+    }
+
+    if (true == isDirty())
+    {
+        Widget::collectDamage(canvasWidth, canvasHeight, damage);
+    }
+    else if (true == m_isEnabled)
+    {
+        YAGfxDamage::Rect   box(m_posX, m_posY, m_width, m_height);
+        uint8_t             index   = 0U;
+
+        /* Translate the damage of the widgets to the canvas and clip it to the group. */
+        for(index = 0U; index < childDamage.getCount(); ++index)
+        {
+            YAGfxDamage::Rect rect = childDamage.getRect(index);
+
+            rect.x += m_posX;
+            rect.y += m_posY;
+
+            damage.add(rect.intersect(box));
+        }
+    }
+    else
+    {
+        /* Disabled group, nothing to repaint. */
+        ;
+    }
+}
+
+void WidgetGroup::repaintDamaged(YAGfx& gfx, const Color& background, YAGfxDamage& damage)
+{
+    YAGfxDamage         groupDamage;
+    YAGfxDamage::Rect   canvas(0, 0, gfx.getWidth(), gfx.getHeight());
+    uint8_t             index       = 0U;
+
+    collectDamage(gfx.getWidth(), gfx.getHeight(), groupDamage);
+
+    for(index = 0U; index < groupDamage.getCount(); ++index)
+    {
+        const YAGfxDamage::Rect&    rect = groupDamage.getRect(index);
+        YAGfxContext                context(gfx, 0, 0, gfx.getWidth(), gfx.getHeight());
+
+        context.clip(rect.x, rect.y, rect.width, rect.height);
+        context.fillScreen(background);
+        update(context);
+
+        damage.add(rect.intersect(canvas));
+    }
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -76,3 +160,15 @@ const char* WidgetGroup::WIDGET_TYPE = "widgetGroup";
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Get the pool of the widget list elements.
+ *
+ * @return Widget list element pool
+ */
+static WidgetListPool& getWidgetListPool()
+{
+    static WidgetListPool pool("widget list"); /* singleton idiom to force initialization in the first usage. */
+
+    return pool;
+}
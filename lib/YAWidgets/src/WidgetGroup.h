@@ -47,6 +47,8 @@
 #include <WString.h>
 #include <LinkedList.hpp>
 #include <Widget.hpp>
+#include <YAGfxContext.h>
+#include <Util.h>
 
 /******************************************************************************
  * Macros
@@ -56,13 +58,52 @@
  * Types and Classes
  *****************************************************************************/
 
+/**
+ * Allocator of the widget group list elements. The list elements of all
+ * widget groups are taken from a pool, which is shared by all groups.
+ */
+class WidgetListAllocator
+{
+public:
+
+    /**
+     * Create a widget list element.
+     *
+     * @param[in] element   Widget
+     * @param[in] prev      Previous list element
+     * @param[in] next      Next list element
+     *
+     * @return If successful, it will return the list element otherwise nullptr.
+     */
+    static ListElement<Widget*>* create(Widget*& element, ListElement<Widget*>* prev, ListElement<Widget*>* next);
+
+    /**
+     * Destroy a widget list element.
+     *
+     * @param[in] listElement   List element
+     */
+    static void destroy(ListElement<Widget*>* listElement);
+};
+
 /**
  * This class defines a widget group and can contain several widgets.
+ * The widgets are painted in a drawing context, which is translated to the
+ * group position and clipped to the group size. Widgets outside the clipping
+ * rectangle are skipped.
+ *
+ * The damage of the widgets is propagated up to the group, which allows to
+ * repaint only the damaged regions instead of the whole group.
  */
-class WidgetGroup : public Widget, private YAGfx
+class WidgetGroup : public Widget
 {
 public:
 
+    /** List of widgets, with pooled list elements. */
+    typedef DLinkedList<Widget*, WidgetListAllocator>           WidgetList;
+
+    /** Iterator of the widget list. */
+    typedef DLinkedListIterator<Widget*, WidgetListAllocator>   WidgetListIterator;
+
     /**
      * Constructs a empty widget group.
      * 
@@ -75,8 +116,7 @@ public:
         Widget(WIDGET_TYPE, x, y),
         m_width(width),
         m_height(height),
-        m_widgets(),
-        m_gfx(nullptr)
+        m_widgets()
     {
     }
 
@@ -89,8 +129,7 @@ public:
         Widget(group),
         m_width(group.m_width),
         m_height(group.m_height),
-        m_widgets(group.m_widgets),
-        m_gfx(group.m_gfx)
+        m_widgets(group.m_widgets)
     {
     }
 
@@ -117,7 +156,6 @@ public:
             m_width     = group.m_width;
             m_height    = group.m_height;
             m_widgets   = group.m_widgets;
-            m_gfx       = group.m_gfx;
         }
 
         return *this;
@@ -128,7 +166,7 @@ public:
      *
      * @return Canvas width in pixel
      */
-    uint16_t getWidth() const final
+    uint16_t getWidth() const
     {
         return m_width;
     }
@@ -138,57 +176,11 @@ public:
      *
      * @return Canvas height in pixel
      */
-    uint16_t getHeight() const final
+    uint16_t getHeight() const
     {
         return m_height;
     }
 
-    /**
-     * Get pixel color at given position.
-     * Attention, it will only return a valid color in case of active painting!
-     *
-     * @param[in] x x-coordinate
-     * @param[in] y y-coordinate
-     *
-     * @return Color in RGB888 format.
-     */
-    Color& getColor(int16_t x, int16_t y) final
-    {
-        static Color    trash;
-        Color*          pixel   = &trash;
-
-        /* Underlying canvas? */
-        if (nullptr != m_gfx)
-        {
-            pixel = &m_gfx->getColor(x, y);
-        }
-
-        return *pixel;
-    }
-
-    /**
-     * Get pixel color at given position.
-     * Attention, it will only return a valid color in case of active painting!
-     *
-     * @param[in] x x-coordinate
-     * @param[in] y y-coordinate
-     *
-     * @return Color in RGB888 format.
-     */
-    const Color& getColor(int16_t x, int16_t y) const final
-    {
-        static Color    trash;
-        const Color*    pixel   = &trash;
-
-        /* Underlying canvas? */
-        if (nullptr != m_gfx)
-        {
-            pixel = &m_gfx->getColor(x, y);
-        }
-
-        return *pixel;
-    }
-
     /**
      * Set canvas width in pixels.
      * 
@@ -196,7 +188,11 @@ public:
      */
     void setWidth(uint16_t width)
     {
-        m_width = width;
+        if (width != m_width)
+        {
+            m_width     = width;
+            m_isDirty   = true;
+        }
     }
 
     /**
@@ -206,7 +202,11 @@ public:
      */
     void setHeight(uint16_t height)
     {
-        m_height = height;
+        if (height != m_height)
+        {
+            m_height    = height;
+            m_isDirty   = true;
+        }
     }
 
     /**
@@ -223,6 +223,7 @@ public:
         m_posY      = offsY;
         m_width     = width;
         m_height    = height;
+        m_isDirty   = true;
     }
 
     /**
@@ -235,6 +236,10 @@ public:
     bool addWidget(Widget& widget)
     {
         Widget* ptr = &widget;
+
+        /* The widget may be painted before somewhere else. */
+        widget.setDirty();
+
         return m_widgets.append(ptr);
     }
 
@@ -247,15 +252,18 @@ public:
      */
     bool removeWidget(const Widget& widget)
     {
-        bool                            status = false;
-        DLinkedListIterator<Widget*>    it(m_widgets);
+        bool                status = false;
+        WidgetListIterator  it(m_widgets);
 
         /* Find widget in the list */
         if (true == it.find(&const_cast<Widget&>(widget)))
         {
-            /* Remove widget */
+            /* Remove widget and repaint the whole group, because the
+             * region of the removed widget is not known.
+             */
             it.remove();
-            status = true;
+            m_isDirty   = true;
+            status      = true;
         }
 
         return status;
@@ -266,7 +274,7 @@ public:
      *
      * @return Children
      */
-    const DLinkedList<Widget*>& children() const
+    const WidgetList& children() const
     {
         return m_widgets;
     }
@@ -290,7 +298,7 @@ public:
         /* If its not the group itself, continue searching in the widget list. */
         if (nullptr == widget)
         {
-            DLinkedListIterator<Widget*> it(m_widgets);
+            WidgetListIterator it(m_widgets);
 
             if (true == it.first())
             {
@@ -306,6 +314,44 @@ public:
         return widget;
     }
 
+    /**
+     * Get the bounding box of the widget group in the canvas.
+     *
+     * @param[in]   canvasWidth     Canvas width in pixel
+     * @param[in]   canvasHeight    Canvas height in pixel
+     * @param[out]  box             Bounding box
+     */
+    void getBoundingBox(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage::Rect& box) const override
+    {
+        UTIL_NOT_USED(canvasWidth);
+        UTIL_NOT_USED(canvasHeight);
+
+        box = YAGfxDamage::Rect(m_posX, m_posY, m_width, m_height);
+    }
+
+    /**
+     * Collect the damaged regions of the widget group. If the group itself is
+     * dirty, the whole group is damaged, otherwise only the damaged regions
+     * of its widgets. All widgets are clean afterwards.
+     *
+     * @param[in]       canvasWidth     Canvas width in pixel
+     * @param[in]       canvasHeight    Canvas height in pixel
+     * @param[in,out]   damage          Damaged regions in canvas coordinates
+     */
+    void collectDamage(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage& damage) override;
+
+    /**
+     * Repaint only the damaged regions of the widget group. Every damaged
+     * region is cleared with the background color and all widgets, which
+     * intersect it, are painted clipped to it. A new group is dirty, so the
+     * first call repaints it completely.
+     *
+     * @param[in]       gfx         Graphics interface
+     * @param[in]       background  Background color
+     * @param[in,out]   damage      The repainted regions are added in canvas coordinates.
+     */
+    void repaintDamaged(YAGfx& gfx, const Color& background, YAGfxDamage& damage);
+
     /** Widget type string */
     static const char*      WIDGET_TYPE;
 
@@ -313,8 +359,7 @@ private:
 
     uint16_t                m_width;    /**< Canvas width in pixels */
     uint16_t                m_height;   /**< Canvas height in pixels */
-    DLinkedList<Widget*>    m_widgets;  /**< Widgets in the group */
-    YAGfx*                  m_gfx;      /**< Graphics interface of the underlying layer */
+    WidgetList              m_widgets;  /**< Widgets in the group */
 
     /**
      * Paint the widget with the given graphics interface.
@@ -323,42 +368,36 @@ private:
      */
     void paint(YAGfx& gfx) override
     {
-        DLinkedListIterator<Widget*> it(m_widgets);
+        WidgetListIterator  it(m_widgets);
+        YAGfxContext        context(gfx, m_posX, m_posY, m_width, m_height);
+        int16_t             clipX1  = 0;
+        int16_t             clipY1  = 0;
+        int16_t             clipX2  = 0;
+        int16_t             clipY2  = 0;
 
-        m_gfx = &gfx;
+        context.getClipRect(clipX1, clipY1, clipX2, clipY2);
 
         /* Walk through all widgets and draw them in the priority as
          * they were added.
          */
         if (true == it.first())
         {
+            YAGfxDamage::Rect clip(clipX1, clipY1, clipX2 - clipX1, clipY2 - clipY1);
+
             do
             {
-                (*it.current())->update(*this);
-            }
-            while(true == it.next());
-        }
+                Widget*             widget  = *it.current();
+                YAGfxDamage::Rect   box;
 
-        m_gfx = nullptr;
-    }
+                widget->getBoundingBox(m_width, m_height, box);
 
-    /**
-     * Draw a single pixel and ensure that the drawing borders are not violated.
-     *
-     * @param[in] x     x-coordinate
-     * @param[in] y     y-coordinate
-     * @param[in] color Pixel color
-     */
-    void drawPixel(int16_t x, int16_t y, const Color& color) final
-    {
-        /* Don't draw outside the canvas. */
-        if ((nullptr != m_gfx) &&
-            (0 <= x) &&
-            (0 <= y) &&
-            (m_width > x) &&
-            (m_height > y))
-        {    
-            m_gfx->drawPixel(m_posX + x, m_posY + y, color);
+                /* Skip widgets, which are completely outside the clipping rectangle. */
+                if (false == box.intersect(clip).isEmpty())
+                {
+                    widget->update(context);
+                }
+            }
+            while(true == it.next());
         }
     }
 };
@@ -36,6 +36,7 @@
  *****************************************************************************/
 #include "PluginList.h"
 
+#include <type_traits>
 $INCLUDES
 
 /******************************************************************************
@@ -54,6 +55,19 @@ $INCLUDES
  * Prototypes
  *****************************************************************************/
 
+/** Size of the largest plugin type in byte. */
+static constexpr size_t MAX_PLUGIN_SIZE = PluginList::MaxSizeOf<
+$PLUGIN_TYPES
+>::value;
+
+/** Max. alignment of all plugin types in byte. */
+static constexpr size_t MAX_PLUGIN_ALIGNMENT = PluginList::MaxAlignOf<
+$PLUGIN_TYPES
+>::value;
+
+/** A slot of the static plugin arena, which fits every plugin type. */
+typedef std::aligned_storage<MAX_PLUGIN_SIZE, MAX_PLUGIN_ALIGNMENT>::type ArenaSlot;
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -66,6 +80,20 @@ static const PluginList::Element gPluginList[] =
 $LIST_ENTRIES
 };
 
+#if (0U < CONFIG_PLUGIN_ARENA_SLOTS)
+
+/**
+ * Static plugin arena. Its size is known at link time.
+ */
+static ArenaSlot gArena[CONFIG_PLUGIN_ARENA_SLOTS];
+
+/**
+ * Marks the used slots of the static plugin arena.
+ */
+static bool gIsArenaSlotUsed[CONFIG_PLUGIN_ARENA_SLOTS];
+
+#endif  /* (0U < CONFIG_PLUGIN_ARENA_SLOTS) */
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -89,6 +117,63 @@ const PluginList::Element* PluginList::getList(uint8_t& length)
     return gPluginList;
 }
 
+void* PluginList::allocateSlot()
+{
+    void* slot = nullptr;
+
+#if (0U < CONFIG_PLUGIN_ARENA_SLOTS)
+    size_t idx = 0U;
+
+    while((nullptr == slot) && (CONFIG_PLUGIN_ARENA_SLOTS > idx))
+    {
+        if (false == gIsArenaSlotUsed[idx])
+        {
+            gIsArenaSlotUsed[idx] = true;
+            slot = &gArena[idx];
+        }
+
+        ++idx;
+    }
+#endif  /* (0U < CONFIG_PLUGIN_ARENA_SLOTS) */
+
+    return slot;
+}
+
+bool PluginList::releaseSlot(IPluginMaintenance* plugin)
+{
+    bool isReleased = false;
+
+#if (0U < CONFIG_PLUGIN_ARENA_SLOTS)
+    const void*     vPlugin = plugin;
+    const uint8_t*  ptr     = static_cast<const uint8_t*>(vPlugin);
+    const void*     vBegin  = &gArena[0];
+    const uint8_t*  begin   = static_cast<const uint8_t*>(vBegin);
+
+    /* The interface may not be at the begin of the plugin object, therefore
+     * the slot is determined by the address range.
+     */
+    if ((nullptr != plugin) &&
+        (begin <= ptr) &&
+        ((begin + sizeof(gArena)) > ptr))
+    {
+        size_t idx = static_cast<size_t>(ptr - begin) / sizeof(ArenaSlot);
+
+        plugin->~IPluginMaintenance();
+        gIsArenaSlotUsed[idx] = false;
+        isReleased = true;
+    }
+#else   /* (0U < CONFIG_PLUGIN_ARENA_SLOTS) */
+    (void)plugin;
+#endif  /* (0U < CONFIG_PLUGIN_ARENA_SLOTS) */
+
+    return isReleased;
+}
+
+size_t PluginList::getSlotSize()
+{
+    return sizeof(ArenaSlot);
+}
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
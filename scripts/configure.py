@@ -152,18 +152,23 @@ def _generate_cpp_plugin_list(plugin_list_full_path, plugin_list):
     """
     includes = ""
     list_entries = ""
+    plugin_types = ""
 
     for idx, plugin_name in enumerate(plugin_list):
         if 0 < idx:
             includes += "\n"
             list_entries += ",\n"
+            plugin_types += ",\n"
 
         includes += f"#include <{plugin_name}.h>"
-        list_entries += f"    {{ \"{plugin_name}\", {plugin_name}::create }}"
+        list_entries += f"    {{ \"{plugin_name}\", {plugin_name}::create, " \
+                        f"PluginList::createInPlace<{plugin_name}>, sizeof({plugin_name}) }}"
+        plugin_types += f"    {plugin_name}"
 
     data = {
         "INCLUDES": includes,
-        "LIST_ENTRIES": list_entries
+        "LIST_ENTRIES": list_entries,
+        "PLUGIN_TYPES": plugin_types
     }
 
     with open(_PLUGIN_LIST_TEMPLATE_FULL_PATH, "r", encoding="utf-8") as file_desc:
@@ -0,0 +1,310 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Log message ring buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "LogRing.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/* The ring positions wrap around at 2^32, which works only for a power of two. */
+static_assert(0U == (LogRing::RING_SIZE & (LogRing::RING_SIZE - 1U)), "Log ring size is no power of two.");
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool LogRing::begin()
+{
+    bool isSuccessful = false;
+
+    if (nullptr == m_taskHandle)
+    {
+        /* Create binary semaphore to signal task exit. */
+        m_xSemaphore = xSemaphoreCreateBinary();
+
+        if (nullptr != m_xSemaphore)
+        {
+            BaseType_t  osRet   = pdFAIL;
+
+            /* Task shall run */
+            m_taskExit = false;
+
+            osRet = xTaskCreateUniversal(   processTask,
+                                            "logRingTask",
+                                            TASK_STACK_SIZE,
+                                            this,
+                                            TASK_PRIORITY,
+                                            &m_taskHandle,
+                                            TASK_RUN_CORE);
+
+            /* Task successful created? */
+            if (pdPASS == osRet)
+            {
+                (void)xSemaphoreGive(m_xSemaphore);
+                isSuccessful = true;
+            }
+            else
+            {
+                vSemaphoreDelete(m_xSemaphore);
+                m_xSemaphore = nullptr;
+                m_taskHandle = nullptr;
+            }
+        }
+
+        if (true == isSuccessful)
+        {
+            Logging::getInstance().setDeferringSink(this);
+        }
+    }
+
+    return isSuccessful;
+}
+
+void LogRing::end()
+{
+    if (nullptr != m_taskHandle)
+    {
+        m_taskExit = true;
+
+        /* Join */
+        (void)xSemaphoreTake(m_xSemaphore, portMAX_DELAY);
+
+        vSemaphoreDelete(m_xSemaphore);
+        m_xSemaphore = nullptr;
+
+        m_taskHandle = nullptr;
+
+        /* Log messages are sent directly to the selected sink again. */
+        Logging::getInstance().setDeferringSink(nullptr);
+
+        /* Forward the remaining log messages, which were stored in the meantime. */
+        flush();
+    }
+}
+
+void LogRing::send(const Logging::Msg& msg)
+{
+    Slot*       slot        = nullptr;
+    uint32_t    pos         = m_writePos.load(std::memory_order_relaxed);
+    bool        isFull      = false;
+
+    /* Reserve a slot. If another producer was faster, try again at the next position. */
+    while((nullptr == slot) && (false == isFull))
+    {
+        Slot&       candidate   = m_ring[pos % RING_SIZE];
+        uint32_t    sequence    = candidate.sequence.load(std::memory_order_acquire);
+        int32_t     diff        = static_cast<int32_t>(sequence - pos);
+
+        if (0 == diff)
+        {
+            /* On failure, the current write position is loaded into pos. */
+            if (true == m_writePos.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+            {
+                slot = &candidate;
+            }
+        }
+        /* Slot still not consumed since the last round, the ring buffer is full. */
+        else if (0 > diff)
+        {
+            isFull = true;
+        }
+        else
+        {
+            pos = m_writePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    /* Never block the caller, if the ring buffer is full, just count it. */
+    if (nullptr == slot)
+    {
+        (void)m_dropped.fetch_add(1U, std::memory_order_relaxed);
+    }
+    else
+    {
+        Entry& entry = slot->entry;
+
+        entry.timestamp = msg.timestamp;
+        entry.level     = msg.level;
+        entry.line      = msg.line;
+
+        if (nullptr == msg.filename)
+        {
+            entry.filename[0U] = '\0';
+        }
+        else
+        {
+            strncpy(entry.filename, msg.filename, FILENAME_SIZE - 1U);
+            entry.filename[FILENAME_SIZE - 1U] = '\0';
+        }
+
+        if (nullptr == msg.str)
+        {
+            entry.str[0U] = '\0';
+        }
+        else
+        {
+            strncpy(entry.str, msg.str, Logging::MESSAGE_BUFFER_SIZE - 1U);
+            entry.str[Logging::MESSAGE_BUFFER_SIZE - 1U] = '\0';
+        }
+
+        /* Publish it to the consumer. */
+        slot->sequence.store(pos + 1U, std::memory_order_release);
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void LogRing::processTask(void* parameters)
+{
+    LogRing* tthis = static_cast<LogRing*>(parameters);
+
+    if ((nullptr != tthis) &&
+        (nullptr != tthis->m_xSemaphore))
+    {
+        (void)xSemaphoreTake(tthis->m_xSemaphore, portMAX_DELAY);
+
+        while(false == tthis->m_taskExit)
+        {
+            tthis->flush();
+
+            delay(TASK_PERIOD);
+        }
+
+        (void)xSemaphoreGive(tthis->m_xSemaphore);
+    }
+
+    vTaskDelete(nullptr);
+}
+
+void LogRing::flush()
+{
+    bool        isPending   = true;
+    uint32_t    pending     = m_writePos.load(std::memory_order_relaxed) - m_readPos;
+    uint32_t    dropped     = m_dropped.load(std::memory_order_relaxed);
+
+    if (m_pendingMax < pending)
+    {
+        m_pendingMax = static_cast<uint8_t>((RING_SIZE < pending) ? RING_SIZE : pending);
+    }
+
+    /* Forward all published log messages in one batch. A slot, which is
+     * reserved but not published yet, stops the batch to keep the order.
+     */
+    while(true == isPending)
+    {
+        Slot& slot = m_ring[m_readPos % RING_SIZE];
+
+        if ((m_readPos + 1U) != slot.sequence.load(std::memory_order_acquire))
+        {
+            isPending = false;
+        }
+        else
+        {
+            const Entry&    entry   = slot.entry;
+            LogSink*        sink    = Logging::getInstance().getSelectedSink();
+
+            if (nullptr != sink)
+            {
+                Logging::Msg msg;
+
+                msg.timestamp   = entry.timestamp;
+                msg.level       = entry.level;
+                msg.filename    = entry.filename;
+                msg.line        = entry.line;
+                msg.str         = entry.str;
+
+                sink->send(msg);
+            }
+
+            /* Give the slot free for the producer in the next round. */
+            slot.sequence.store(m_readPos + RING_SIZE, std::memory_order_release);
+            ++m_readPos;
+        }
+    }
+
+    /* Report dropped log messages, after the pending ones are out. */
+    if (m_droppedReported != dropped)
+    {
+        LogSink* sink = Logging::getInstance().getSelectedSink();
+
+        if (nullptr != sink)
+        {
+            char            buffer[Logging::MESSAGE_BUFFER_SIZE];
+            Logging::Msg    msg;
+
+            (void)snprintf(buffer, sizeof(buffer), "%u log messages dropped.", dropped - m_droppedReported);
+
+            msg.timestamp   = esp_log_timestamp();
+            msg.level       = Logging::LOG_LEVEL_WARNING;
+            msg.filename    = "LogRing";
+            msg.line        = 0;
+            msg.str         = buffer;
+
+            sink->send(msg);
+        }
+
+        m_droppedReported = dropped;
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,256 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Log message ring buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup common
+ *
+ * @{
+ */
+
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Arduino.h>
+#include <Logging.h>
+#include <atomic>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The log ring decouples the log message producers from the log sink output.
+ * It is set as deferring sink in the logging, which copies every log message
+ * into a ring buffer. A low priority task takes them out in batches and
+ * forwards them to the selected log sink, e.g. serial or websocket.
+ *
+ * This way time critical tasks, like the display update, are never blocked
+ * by a slow log sink. If the ring buffer is full, the log message is dropped
+ * and counted instead of blocking the caller.
+ *
+ * The ring buffer is lock-free: several tasks log concurrently, but only the
+ * log ring task reads. Every producer reserves its slot by an atomic increment
+ * of the write position and publishes the slot via its sequence number, after
+ * the message is copied. The consumer takes slots in order, as long as their
+ * sequence number shows them published.
+ */
+class LogRing : public LogSink
+{
+public:
+
+    /**
+     * Get log ring instance.
+     *
+     * @return Log ring instance
+     */
+    static LogRing& getInstance()
+    {
+        static LogRing instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Start the log ring task and set the log ring as deferring sink.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool begin();
+
+    /**
+     * Flush all pending log messages, stop the log ring task and
+     * remove the log ring as deferring sink.
+     */
+    void end();
+
+    /**
+     * Get sink name.
+     *
+     * @return Name of the sink.
+     */
+    const String& getName() const final
+    {
+        return m_name;
+    }
+
+    /**
+     * Copy the log message into the ring buffer.
+     * If the ring buffer is full, the log message will be dropped.
+     *
+     * @param[in] msg   Log message
+     */
+    void send(const Logging::Msg& msg) final;
+
+    /**
+     * Get number of dropped log messages, because the ring buffer was full.
+     *
+     * @return Number of dropped log messages
+     */
+    uint32_t getDropped() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get max. number of log messages, which were pending at the same time.
+     * It is sampled by the log ring task, whenever it forwards the messages.
+     *
+     * @return Max. number of pending log messages
+     */
+    uint8_t getPendingMax() const
+    {
+        return m_pendingMax;
+    }
+
+    /**
+     * Number of log messages, which can be stored in the ring buffer.
+     * Must be a power of two, because the positions wrap around at 2^32.
+     */
+    static const uint8_t    RING_SIZE       = 16U;
+
+    /** Max. filename/logger name length in byte, incl. string termination. */
+    static const size_t     FILENAME_SIZE   = 24U;
+
+private:
+
+    /**
+     * A log message in the ring buffer.
+     */
+    struct Entry
+    {
+        uint32_t            timestamp;                              /**< Timestamp in ms */
+        Logging::LogLevel   level;                                  /**< Log level */
+        int                 line;                                   /**< Line number */
+        char                filename[FILENAME_SIZE];                /**< Filename or logger name */
+        char                str[Logging::MESSAGE_BUFFER_SIZE];      /**< Message text */
+    };
+
+    /**
+     * A slot in the ring buffer.
+     *
+     * The sequence number shows the slot state, related to a position:
+     * - sequence == position: Free for the producer, which writes at this position.
+     * - sequence == position + 1: Published, ready for the consumer.
+     */
+    struct Slot
+    {
+        std::atomic<uint32_t>   sequence;   /**< Sequence number */
+        Entry                   entry;      /**< Log message */
+    };
+
+    /** Log ring task stack size in bytes */
+    static const uint32_t       TASK_STACK_SIZE     = 4096U;
+
+    /** Log ring task should run on the APP MCU core. */
+    static const BaseType_t     TASK_RUN_CORE       = APP_CPU_NUM;
+
+    /** Log ring task priority, lower than all others except idle. */
+    static const UBaseType_t    TASK_PRIORITY       = 1U;
+
+    /** Period in ms, after which the pending log messages are forwarded. */
+    static const uint32_t       TASK_PERIOD         = 20U;
+
+    const String            m_name;             /**< Sink name */
+    Slot                    m_ring[RING_SIZE];  /**< Ring buffer */
+    std::atomic<uint32_t>   m_writePos;         /**< Next write position, shared by all producers */
+    uint32_t                m_readPos;          /**< Next read position, only used by the consumer */
+    uint8_t                 m_pendingMax;       /**< Max. number of pending log messages */
+    std::atomic<uint32_t>   m_dropped;          /**< Number of dropped log messages */
+    uint32_t                m_droppedReported;  /**< Number of dropped log messages, which were already reported. */
+    TaskHandle_t            m_taskHandle;       /**< Task handle */
+    bool                    m_taskExit;         /**< Flag to signal the task to exit. */
+    SemaphoreHandle_t       m_xSemaphore;       /**< Binary semaphore used to signal the task exit. */
+
+    /**
+     * Constructs the log ring.
+     */
+    LogRing() :
+        m_name("Ring"),
+        m_ring(),
+        m_writePos(0U),
+        m_readPos(0U),
+        m_pendingMax(0U),
+        m_dropped(0U),
+        m_droppedReported(0U),
+        m_taskHandle(nullptr),
+        m_taskExit(false),
+        m_xSemaphore(nullptr)
+    {
+        uint8_t idx = 0U;
+
+        /* Every slot is free for the first producer, which writes at its position. */
+        for(idx = 0U; idx < RING_SIZE; ++idx)
+        {
+            m_ring[idx].sequence.store(idx, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Destroys the log ring.
+     */
+    ~LogRing()
+    {
+        /* Will never be called. */
+    }
+
+    LogRing(const LogRing& ring);
+    LogRing& operator=(const LogRing& ring);
+
+    /**
+     * Log ring task, which forwards the log messages periodically.
+     *
+     * @param[in] parameters    Task parameters
+     */
+    static void processTask(void* parameters);
+
+    /**
+     * Forward all pending log messages to the selected log sink.
+     */
+    void flush();
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* LOG_RING_H */
+
+/** @} */
@@ -35,6 +35,11 @@
 #include "MemMon.h"
 
 #include <Logging.h>
+#include <JsonDocPool.h>
+#include <AllocTracker.h>
+#include <ObjectPool.hpp>
+#include <CanvasPool.h>
+#include <esp_heap_caps.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -77,25 +82,35 @@ void MemMon::process()
 
     if (true == isProcessingTime)
     {
-        uint32_t availableHeap          = ESP.getFreeHeap();        /* Current available heap memory. */
-        uint32_t lowestAvailableHeap    = ESP.getMinFreeHeap();     /* Lowest level of available heap since boot. */
-        uint32_t largestHeapBlock       = ESP.getMaxAllocHeap();    /* Largest block of heap that can be allocated at once. */
+        HeapInfo heapInfo;
 
-        if (MIN_HEAP_MEMORY >= availableHeap)
+        getHeapInfo(heapInfo);
+
+        if (MIN_HEAP_MEMORY >= heapInfo.freeBytes)
         {
-            LOG_WARNING("Current available heap: %u byte.", availableHeap);
+            LOG_WARNING("Current available heap: %u byte.", heapInfo.freeBytes);
         }
 
-        if (LOWEST_HEAP_MEMORY >= lowestAvailableHeap)
+        if (LOWEST_HEAP_MEMORY >= heapInfo.minFreeBytes)
         {
-            LOG_WARNING("Lowest available heap: %u byte.", lowestAvailableHeap);
+            LOG_WARNING("Lowest available heap: %u byte.", heapInfo.minFreeBytes);
         }
 
-        if (LARGEST_HEAP_BLOCK_MEMORY > largestHeapBlock)
+        if (LARGEST_HEAP_BLOCK_MEMORY > heapInfo.largestFreeBlock)
         {
-            LOG_WARNING("Largest heap block which can be allocated: %u byte.", largestHeapBlock);
+            LOG_WARNING("Largest heap block which can be allocated: %u byte.", heapInfo.largestFreeBlock);
         }
 
+        if (MAX_HEAP_FRAGMENTATION < heapInfo.fragmentation)
+        {
+            LOG_WARNING("Heap fragmentation: %u %% (%u free blocks).", heapInfo.fragmentation, heapInfo.freeBlocks);
+        }
+
+        logJsonDocPoolStatistics();
+        logAllocTrackerStatistics();
+        logObjectPoolStatistics();
+        logCanvasPoolStatistics();
+
         /* Any heap corrupt? */
         if (false == heap_caps_check_integrity_all(true))
         {
@@ -104,6 +119,25 @@ void MemMon::process()
     }
 }
 
+void MemMon::getHeapInfo(HeapInfo& info)
+{
+    multi_heap_info_t heapInfo;
+
+    heap_caps_get_info(&heapInfo, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    info.freeBytes          = heapInfo.total_free_bytes;
+    info.minFreeBytes       = heapInfo.minimum_free_bytes;
+    info.largestFreeBlock   = heapInfo.largest_free_block;
+    info.allocatedBlocks    = heapInfo.allocated_blocks;
+    info.freeBlocks         = heapInfo.free_blocks;
+    info.fragmentation      = 0U;
+
+    if (0U < info.freeBytes)
+    {
+        info.fragmentation = 100U - ((100U * info.largestFreeBlock) / info.freeBytes);
+    }
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -112,6 +146,113 @@ void MemMon::process()
  * Private Methods
  *****************************************************************************/
 
+void MemMon::logJsonDocPoolStatistics()
+{
+    JsonDocPool&    jsonDocPool = JsonDocPool::getInstance();
+    uint8_t         siteCount   = jsonDocPool.getSiteCount();
+    uint8_t         idx         = 0U;
+    uint32_t        fallbacks   = 0U;
+
+    for(idx = 0U; idx < siteCount; ++idx)
+    {
+        JsonDocPool::SiteStatistics stats;
+
+        if (true == jsonDocPool.getSiteStatistics(idx, stats))
+        {
+            LOG_DEBUG("JSON doc %s: hwm %u byte, %u leases, %u fallbacks.", stats.name, stats.highWaterMark, stats.leases, stats.fallbacks);
+
+            fallbacks += stats.fallbacks;
+        }
+    }
+
+    /* Warn only if the pool was exhausted since the last check. */
+    if (m_jsonDocPoolFallbacks != fallbacks)
+    {
+        LOG_WARNING("JSON document pool exhausted %u times (max. %u leased).", fallbacks - m_jsonDocPoolFallbacks, jsonDocPool.getLeasedMax());
+
+        m_jsonDocPoolFallbacks = fallbacks;
+    }
+}
+
+void MemMon::logAllocTrackerStatistics()
+{
+    AllocTracker&   allocTracker    = AllocTracker::getInstance();
+    uint8_t         idx             = 0U;
+    uint32_t        failures        = 0U;
+
+    for(idx = 0U; idx < AllocTracker::TAG_COUNT; ++idx)
+    {
+        AllocTracker::Tag           tag = static_cast<AllocTracker::Tag>(idx);
+        AllocTracker::Statistics    stats;
+
+        if (true == allocTracker.getStatistics(tag, stats))
+        {
+            LOG_DEBUG("Heap %s: %u byte (peak %u byte) in %u blocks, %u allocations, %u failed.",
+                AllocTracker::tagToStr(tag), stats.liveBytes, stats.peakBytes, stats.liveBlocks, stats.allocations, stats.failures);
+
+            failures += stats.failures;
+        }
+    }
+
+    /* Warn only if allocations failed since the last check. */
+    if (m_allocFailures != failures)
+    {
+        LOG_WARNING("%u tracked heap allocations failed.", failures - m_allocFailures);
+
+        m_allocFailures = failures;
+    }
+}
+
+void MemMon::logObjectPoolStatistics()
+{
+    const ObjectPoolBase*   pool        = ObjectPoolBase::getFirst();
+    uint32_t                fallbacks   = 0U;
+
+    while(nullptr != pool)
+    {
+        LOG_DEBUG("Pool %s: %u of %u used (peak %u), %u fallbacks.",
+            pool->getName(), pool->getUsed(), pool->getCapacity(), pool->getPeak(), pool->getFallbacks());
+
+        fallbacks += pool->getFallbacks();
+
+        pool = pool->getNext();
+    }
+
+    /* Warn only if a pool was exhausted since the last check. */
+    if (m_objectPoolFallbacks != fallbacks)
+    {
+        LOG_WARNING("Object pools exhausted %u times.", fallbacks - m_objectPoolFallbacks);
+
+        m_objectPoolFallbacks = fallbacks;
+    }
+}
+
+void MemMon::logCanvasPoolStatistics()
+{
+    CanvasPool& canvasPool  = CanvasPool::getInstance();
+    uint32_t    fallbacks   = canvasPool.getFallbacks();
+    uint8_t     idx         = 0U;
+
+    for(idx = 0U; idx < CanvasPool::BUCKET_COUNT; ++idx)
+    {
+        CanvasPool::BucketStatistics stats;
+
+        if (true == canvasPool.getBucketStatistics(idx, stats))
+        {
+            LOG_DEBUG("Canvas pool %u byte: %u of %u used (peak %u), %u preserved.",
+                stats.capacity, stats.used, stats.canvases, stats.peakUsed, stats.preserved);
+        }
+    }
+
+    /* Warn only if the pool was exhausted since the last check. */
+    if (m_canvasPoolFallbacks != fallbacks)
+    {
+        LOG_WARNING("Canvas pool exhausted %u times.", fallbacks - m_canvasPoolFallbacks);
+
+        m_canvasPoolFallbacks = fallbacks;
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
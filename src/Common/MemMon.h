@@ -62,6 +62,32 @@ class MemMon
 {
 public:
 
+    /**
+     * Heap information, used to detect fragmentation.
+     */
+    struct HeapInfo
+    {
+        uint32_t    freeBytes;          /**< Current available heap in byte */
+        uint32_t    minFreeBytes;       /**< Lowest available heap since boot in byte */
+        uint32_t    largestFreeBlock;   /**< Largest block which can be allocated at once in byte */
+        uint32_t    allocatedBlocks;    /**< Number of allocated blocks */
+        uint32_t    freeBlocks;         /**< Number of free blocks */
+        uint8_t     fragmentation;      /**< Fragmentation in percent */
+
+        /**
+         * Initializes empty heap information.
+         */
+        HeapInfo() :
+            freeBytes(0U),
+            minFreeBytes(0U),
+            largestFreeBlock(0U),
+            allocatedBlocks(0U),
+            freeBlocks(0U),
+            fragmentation(0U)
+        {
+        }
+    };
+
     /**
      * Get memory monitor instance.
      *
@@ -79,6 +105,15 @@ public:
      */
     void process();
 
+    /**
+     * Get information about the internal heap.
+     * The fragmentation is the part of the available heap, which can not be
+     * allocated at once.
+     *
+     * @param[out] info Heap information
+     */
+    static void getHeapInfo(HeapInfo& info);
+
     /** Processing cycle in ms. */
     static const uint32_t   PROCESSING_CYCLE            = 60U * 1000U;
 
@@ -99,14 +134,28 @@ public:
      */
     static const size_t     LARGEST_HEAP_BLOCK_MEMORY   = CONFIG_MBEDTLS_SSL_MAX_CONTENT_LEN;
 
+    /**
+     * Heap fragmentation in percent, the monitor starts to warn.
+     */
+    static const uint8_t    MAX_HEAP_FRAGMENTATION      = 50U;
+
 private:
 
-    SimpleTimer m_timer;    /**< Timer used for cyclic processing. */
+    SimpleTimer m_timer;                    /**< Timer used for cyclic processing. */
+    uint32_t    m_jsonDocPoolFallbacks;     /**< Number of JSON document pool fallbacks at the last check. */
+    uint32_t    m_allocFailures;            /**< Number of failed tracked allocations at the last check. */
+    uint32_t    m_objectPoolFallbacks;      /**< Number of object pool fallbacks at the last check. */
+    uint32_t    m_canvasPoolFallbacks;      /**< Number of canvas pool fallbacks at the last check. */
 
     /**
      * Constructs the memory monitor.
      */
-    MemMon()
+    MemMon() :
+        m_timer(),
+        m_jsonDocPoolFallbacks(0U),
+        m_allocFailures(0U),
+        m_objectPoolFallbacks(0U),
+        m_canvasPoolFallbacks(0U)
     {
     }
 
@@ -120,6 +169,29 @@ private:
 
     MemMon(const MemMon& taskMon);
     MemMon& operator=(const MemMon& taskMon);
+
+    /**
+     * Log the JSON document pool statistics per lease site and warn if the
+     * pool was exhausted.
+     */
+    void logJsonDocPoolStatistics();
+
+    /**
+     * Log the heap usage per allocation tracker tag and warn if tracked
+     * allocations failed.
+     */
+    void logAllocTrackerStatistics();
+
+    /**
+     * Log the occupancy of all object pools and warn if a pool was exhausted.
+     */
+    void logObjectPoolStatistics();
+
+    /**
+     * Log the canvas pool utilisation per size class and warn if canvases
+     * were served by the heap.
+     */
+    void logCanvasPoolStatistics();
 };
 
 /******************************************************************************
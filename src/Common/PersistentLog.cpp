@@ -0,0 +1,361 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Persistent log
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PersistentLog.h"
+#include "FileSystem.h"
+
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <OverwritingRing.hpp>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Ring buffer in the RTC memory, which survives a reset.
+ * Its read entries are the flushed ones.
+ */
+typedef OverwritingRing<PersistentLog::Entry, PersistentLog::RTC_ENTRIES> RtcBuffer;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize static members */
+const char* PersistentLog::FILE_NAME        = "/persistentLog.bin";
+const char* PersistentLog::FILE_NAME_OLD    = "/persistentLog.old.bin";
+
+/** Magic pattern of a valid RTC memory buffer. */
+static const uint32_t   RTC_BUFFER_MAGIC    = 0x504c4f47U; /* "PLOG" */
+
+/** Ring buffer in the RTC memory, which is not initialized at startup. */
+static RTC_NOINIT_ATTR RtcBuffer    gRtcBuffer;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void PersistentLog::begin()
+{
+    Entry entry = {};
+
+    {
+        CriticalSectionGuard guard(m_critSec);
+
+        /* Content invalid, e.g. after power on? */
+        if (false == gRtcBuffer.isValid(RTC_BUFFER_MAGIC))
+        {
+            gRtcBuffer.clear(RTC_BUFFER_MAGIC);
+        }
+
+        /* Mark the begin of the new session. */
+        entry.timestamp = esp_log_timestamp();
+        entry.fileId    = 0U;
+        entry.line      = static_cast<uint16_t>(esp_reset_reason());
+        entry.level     = LEVEL_BOOT;
+        entry.length    = 0U;
+
+        gRtcBuffer.write(entry);
+    }
+
+    Logging::getInstance().setMirrorSink(this);
+}
+
+void PersistentLog::enableFlush()
+{
+    m_isFlushEnabled = true;
+
+    /* Flush the entries of the previous session with the next processing. */
+    m_timer.start(0U);
+}
+
+void PersistentLog::end()
+{
+    if (true == m_isFlushEnabled)
+    {
+        flush();
+
+        m_isFlushEnabled = false;
+        m_timer.stop();
+    }
+}
+
+void PersistentLog::process()
+{
+    if (true == m_isFlushEnabled)
+    {
+        if ((true == m_timer.isTimeout()) ||
+            ((RTC_ENTRIES / 2U) <= getPendingCount()))
+        {
+            flush();
+            m_timer.start(FLUSH_PERIOD);
+        }
+    }
+}
+
+void PersistentLog::send(const Logging::Msg& msg)
+{
+    Entry   entry   = {};
+    size_t  length  = 0U;
+
+    entry.timestamp = msg.timestamp;
+    entry.fileId    = getFileId(msg.filename);
+    entry.line      = static_cast<uint16_t>(msg.line);
+    entry.level     = static_cast<uint8_t>(msg.level);
+
+    if (nullptr != msg.str)
+    {
+        while((PAYLOAD_SIZE > length) && ('\0' != msg.str[length]))
+        {
+            entry.payload[length] = msg.str[length];
+            ++length;
+        }
+    }
+
+    entry.length = static_cast<uint8_t>(length);
+
+    /* The entry is prepared completely in advance, to keep the critical
+     * section as short as the copy into the ring buffer.
+     */
+    {
+        CriticalSectionGuard guard(m_critSec);
+
+        gRtcBuffer.write(entry);
+    }
+}
+
+uint32_t PersistentLog::getPendingCount()
+{
+    CriticalSectionGuard guard(m_critSec);
+
+    return gRtcBuffer.getPendingCount();
+}
+
+bool PersistentLog::getPendingEntry(uint32_t idx, Entry& entry)
+{
+    CriticalSectionGuard guard(m_critSec);
+
+    return gRtcBuffer.peek(idx, entry);
+}
+
+const char* PersistentLog::getFileName(uint16_t fileId) const
+{
+    const char* name    = nullptr;
+    uint8_t     count   = m_fileNameCount.load(std::memory_order_acquire);
+    uint8_t     idx     = 0U;
+
+    if (MAX_FILE_NAMES < count)
+    {
+        count = MAX_FILE_NAMES;
+    }
+
+    while((count > idx) && (nullptr == name))
+    {
+        const FileName& fileName = m_fileNames[idx];
+
+        /* A reserved file name may not be published yet. */
+        if ((true == fileName.isValid.load(std::memory_order_acquire)) &&
+            (fileId == fileName.id))
+        {
+            name = fileName.name;
+        }
+
+        ++idx;
+    }
+
+    return name;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+uint16_t PersistentLog::getFileId(const char* filename)
+{
+    uint16_t fileId = 0U;
+
+    if (nullptr != filename)
+    {
+        /* 16-bit FNV-1a hash of the filename, folded from 32-bit. */
+        const uint32_t  FNV_OFFSET_BASIS    = 2166136261U;
+        const uint32_t  FNV_PRIME           = 16777619U;
+        uint32_t        hash                = FNV_OFFSET_BASIS;
+        size_t          idx                 = 0U;
+
+        while('\0' != filename[idx])
+        {
+            hash ^= static_cast<uint8_t>(filename[idx]);
+            hash *= FNV_PRIME;
+            ++idx;
+        }
+
+        fileId = static_cast<uint16_t>((hash >> 16U) ^ (hash & 0xffffU));
+
+        /* Learn the filename, to be able to decode the id later. */
+        if (nullptr == getFileName(fileId))
+        {
+            uint8_t count = m_fileNameCount.load(std::memory_order_relaxed);
+
+            /* Reserve a slot. If it is learned concurrently in several
+             * contexts, it may be known twice, which is harmless.
+             */
+            while((MAX_FILE_NAMES > count) &&
+                  (false == m_fileNameCount.compare_exchange_weak(count, count + 1U, std::memory_order_relaxed)))
+            {
+                ;
+            }
+
+            if (MAX_FILE_NAMES > count)
+            {
+                FileName& fileName = m_fileNames[count];
+
+                fileName.id = fileId;
+                strncpy(fileName.name, filename, FILENAME_SIZE - 1U);
+                fileName.name[FILENAME_SIZE - 1U] = '\0';
+
+                /* Publish it. */
+                fileName.isValid.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+    return fileId;
+}
+
+void PersistentLog::flush()
+{
+    Entry       entries[FLUSH_CHUNK];
+    uint32_t    count       = 0U;
+    uint32_t    overwritten = 0U;
+    File        fd;
+
+    rotate();
+
+    fd = FILESYSTEM.open(FILE_NAME, "a");
+
+    if (false == fd)
+    {
+        LOG_WARNING("Couldn't open %s.", FILE_NAME);
+    }
+    else
+    {
+        do
+        {
+            /* Take the entries out of the RTC memory in chunks, to keep the
+             * critical section short.
+             */
+            {
+                CriticalSectionGuard guard(m_critSec);
+
+                count = gRtcBuffer.read(entries, FLUSH_CHUNK);
+            }
+
+            if (0U < count)
+            {
+                const void*     vEntries    = entries;
+                const uint8_t*  data        = static_cast<const uint8_t*>(vEntries);
+
+                (void)fd.write(data, count * sizeof(Entry));
+            }
+        }
+        while(0U < count);
+
+        fd.close();
+
+        /* Taken once after all chunks, because entries may be overwritten
+         * while a chunk is written.
+         */
+        {
+            CriticalSectionGuard guard(m_critSec);
+
+            overwritten = gRtcBuffer.takeOverwritten();
+        }
+
+        if (0U < overwritten)
+        {
+            LOG_WARNING("%u persistent log entries lost.", overwritten);
+        }
+    }
+}
+
+void PersistentLog::rotate()
+{
+    bool isFull = false;
+
+    if (true == FILESYSTEM.exists(FILE_NAME))
+    {
+        File fd = FILESYSTEM.open(FILE_NAME, "r");
+
+        if (true == fd)
+        {
+            isFull = (MAX_FILE_SIZE <= fd.size());
+            fd.close();
+        }
+    }
+
+    if (true == isFull)
+    {
+        if (true == FILESYSTEM.exists(FILE_NAME_OLD))
+        {
+            (void)FILESYSTEM.remove(FILE_NAME_OLD);
+        }
+
+        (void)FILESYSTEM.rename(FILE_NAME, FILE_NAME_OLD);
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,275 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Persistent log
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup common
+ *
+ * @{
+ */
+
+#ifndef PERSISTENT_LOG_H
+#define PERSISTENT_LOG_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Arduino.h>
+#include <Logging.h>
+#include <SimpleTimer.hpp>
+#include <CriticalSection.hpp>
+#include <atomic>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The persistent log keeps the latest log messages over a reset, to have
+ * some context after a device reset in the field.
+ *
+ * It is set as mirror sink in the logging. Every log message is stored in
+ * a compact binary entry in a ring buffer in the RTC memory, which survives
+ * a reset (but not a power loss). Periodically the entries are appended to a
+ * file in the filesystem, which is rotated if it exceeds its max. size.
+ * After a reset, the entries which were not flushed yet are written first.
+ *
+ * Storing a log message costs just a copy of a few bytes. The filesystem is
+ * only accessed in process(), which shall be called in the main loop.
+ */
+class PersistentLog : public LogSink
+{
+public:
+
+    /** Max. number of payload characters of a log message. */
+    static const size_t PAYLOAD_SIZE    = 22U;
+
+    /** Level of the boot marker entry, which is written after every reset. */
+    static const uint8_t LEVEL_BOOT     = 0xFFU;
+
+    /**
+     * A single binary log entry, 32 bytes in size.
+     */
+    struct Entry
+    {
+        uint32_t    timestamp;              /**< Timestamp in ms since boot */
+        uint16_t    fileId;                 /**< Id of the file, which issued the message. */
+        uint16_t    line;                   /**< Line number in the file. In the boot marker entry, it is the reset reason. */
+        uint8_t     level;                  /**< Log level or LEVEL_BOOT */
+        uint8_t     length;                 /**< Payload length in byte */
+        char        payload[PAYLOAD_SIZE];  /**< Beginning of the log message, not terminated. */
+    };
+
+    /**
+     * Get persistent log instance.
+     *
+     * @return Persistent log instance
+     */
+    static PersistentLog& getInstance()
+    {
+        static PersistentLog instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Start the persistent log as early as possible. The entries of the
+     * previous session, which were not flushed yet, are kept.
+     */
+    void begin();
+
+    /**
+     * Enable flushing the entries to the filesystem. The filesystem must be
+     * mounted already.
+     */
+    void enableFlush();
+
+    /**
+     * Flush all pending entries to the filesystem and disable flushing.
+     * Call it before the filesystem is unmounted. The log messages are still
+     * stored in the RTC memory and flushed after the next reset.
+     */
+    void end();
+
+    /**
+     * Flush the pending entries to the filesystem periodically or if the
+     * ring buffer is half full.
+     */
+    void process();
+
+    /**
+     * Get sink name.
+     *
+     * @return Name of the sink.
+     */
+    const String& getName() const final
+    {
+        return m_name;
+    }
+
+    /**
+     * Store the log message in the ring buffer in the RTC memory.
+     *
+     * @param[in] msg   Log message
+     */
+    void send(const Logging::Msg& msg) final;
+
+    /**
+     * Get the number of entries in the ring buffer, which are not flushed yet.
+     *
+     * @return Number of pending entries
+     */
+    uint32_t getPendingCount();
+
+    /**
+     * Get a pending entry, which was not flushed yet.
+     *
+     * @param[in]   idx     Index of the pending entry [0; getPendingCount() - 1]
+     * @param[out]  entry   Entry
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool getPendingEntry(uint32_t idx, Entry& entry);
+
+    /**
+     * Get the name of the file by its id.
+     * Only files, which issued a log message since boot are known.
+     * It can be called from any context, because the known files are
+     * written only once and published afterwards.
+     *
+     * @param[in] fileId    File id
+     *
+     * @return If known, it will return the filename otherwise nullptr.
+     */
+    const char* getFileName(uint16_t fileId) const;
+
+    /** Number of entries in the RTC memory ring buffer. */
+    static const uint32_t   RTC_ENTRIES         = 64U;
+
+    /** Max. file size in byte, before it is rotated. */
+    static const size_t     MAX_FILE_SIZE       = 16U * 1024U;
+
+    /** Period in ms, after which the pending entries are flushed. */
+    static const uint32_t   FLUSH_PERIOD        = 30U * 1000U;
+
+    /** Full path of the current log file. */
+    static const char*      FILE_NAME;
+
+    /** Full path of the rotated log file. */
+    static const char*      FILE_NAME_OLD;
+
+private:
+
+    /** Max. filename length, incl. string termination. */
+    static const size_t     FILENAME_SIZE       = 24U;
+
+    /**
+     * Known file.
+     */
+    struct FileName
+    {
+        uint16_t            id;                     /**< File id */
+        char                name[FILENAME_SIZE];    /**< Filename */
+        std::atomic<bool>   isValid;                /**< Is the known file completely written? */
+    };
+
+    /** Max. number of known files. */
+    static const uint8_t    MAX_FILE_NAMES      = 32U;
+
+    /** Max. number of entries, which are written to the filesystem at once. */
+    static const uint32_t   FLUSH_CHUNK         = 8U;
+
+    const String            m_name;                         /**< Sink name */
+    CriticalSection         m_critSec;                      /**< Protects the ring buffer against concurrent access. */
+    SimpleTimer             m_timer;                        /**< Timer used for periodic flush. */
+    bool                    m_isFlushEnabled;               /**< Is the filesystem ready for flushing? */
+    FileName                m_fileNames[MAX_FILE_NAMES];    /**< Known files, written only once. */
+    std::atomic<uint8_t>    m_fileNameCount;                /**< Number of reserved known files */
+
+    /**
+     * Constructs the persistent log.
+     */
+    PersistentLog() :
+        m_name("Persistent"),
+        m_critSec(),
+        m_timer(),
+        m_isFlushEnabled(false),
+        m_fileNames(),
+        m_fileNameCount(0U)
+    {
+    }
+
+    /**
+     * Destroys the persistent log.
+     */
+    ~PersistentLog()
+    {
+        /* Will never be called. */
+    }
+
+    PersistentLog(const PersistentLog& log);
+    PersistentLog& operator=(const PersistentLog& log);
+
+    /**
+     * Get the file id by the filename and learn unknown files.
+     * It doesn't need the critical section, because a known file slot is
+     * reserved atomically and published after it is written.
+     *
+     * @param[in] filename  Filename
+     *
+     * @return File id
+     */
+    uint16_t getFileId(const char* filename);
+
+    /**
+     * Write all pending entries to the filesystem.
+     */
+    void flush();
+
+    /**
+     * Rotate the log file, if it exceeds its max. size.
+     */
+    void rotate();
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* PERSISTENT_LOG_H */
+
+/** @} */
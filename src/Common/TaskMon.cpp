@@ -65,6 +65,13 @@ void TaskMon::process()
 #if configUSE_TRACE_FACILITY
     bool isProcessingTime = false;
 
+    if ((false == m_sampleTimer.isTimerRunning()) ||
+        (true == m_sampleTimer.isTimeout()))
+    {
+        sample();
+        m_sampleTimer.start(SAMPLE_PERIOD);
+    }
+
     if (false == m_timer.isTimerRunning())
     {
         m_timer.start(PROCESSING_CYCLE);
@@ -78,73 +85,34 @@ void TaskMon::process()
 
     if (true == isProcessingTime)
     {
-        UBaseType_t     numOfTasks      = uxTaskGetNumberOfTasks();
-        TaskStatus_t*   taskStatus      = new(std::nothrow) TaskStatus_t[numOfTasks];
-
-        if (nullptr != taskStatus)
-        {
-            uint32_t    totalRunTime    = 0U;
-            UBaseType_t index           = 0U;
-            size_t      taskNameMaxLen  = 0U;
-            size_t      taskStateMaxLen = 0U;
-
-            numOfTasks = uxTaskGetSystemState(taskStatus, numOfTasks, &totalRunTime);
-
-            /* Determine the length of the longest task name and the longest task state name. */
-            for(index = 0U; index < numOfTasks; ++index)
-            {
-                size_t taskNameLen  = strlen(taskStatus[index].pcTaskName);
-                size_t taskStateLen = taskState2Str(taskStatus[index].eCurrentState).length();
-
-                if (taskNameMaxLen < taskNameLen)
-                {
-                    taskNameMaxLen = taskNameLen;
-                }
-
-                if (taskStateMaxLen < taskStateLen)
-                {
-                    taskStateMaxLen = taskStateLen;
-                }
-            }
-
-            /* Show task informations */
-            for(index = 0U; index < numOfTasks; ++index)
-            {
-                uint32_t statsAsPercentage = 0U;
+        log();
+    }
+#endif  /* configUSE_TRACE_FACILITY */
+}
 
-                /* Calculate task load in percent, if total run time is available.
-                 * Note, this depends on how FreeRTOS is configured.
-                 */
-                if (0U < totalRunTime)
-                {
-                    statsAsPercentage = taskStatus[index].ulRunTimeCounter / (totalRunTime / 100U);
-                }
+uint8_t TaskMon::getTasks(TaskInfo* tasks, uint8_t maxCount) const
+{
+    uint8_t count = 0U;
 
-#if configTASKLIST_INCLUDE_COREID
-                LOG_DEBUG("Task \"%s\": c %d, p %2u, %s, %3u%%, stack high water mark: %u",
-                    fillUpSpaces(taskStatus[index].pcTaskName, taskNameMaxLen).c_str(),
-                    taskStatus[index].xCoreID,
-                    taskStatus[index].uxCurrentPriority,
-                    fillUpSpaces(taskState2Str(taskStatus[index].eCurrentState).c_str(), taskStateMaxLen).c_str(),
-                    statsAsPercentage,
-                    taskStatus[index].usStackHighWaterMark);
-    #else
-                LOG_DEBUG("Task \"%s\": p %2u, %s, %3u%%, stack high water mark: %u",
-                    fillUpSpaces(taskStatus[index].pcTaskName, taskNameMaxLen).c_str(),
-                    taskStatus[index].uxCurrentPriority,
-                    fillUpSpaces(taskState2Str(taskStatus[index].eCurrentState).c_str(), taskStateMaxLen).c_str(),
-                    statsAsPercentage,
-                    taskStatus[index].usStackHighWaterMark);
-#endif
-            }
+    if (nullptr != tasks)
+    {
+        MutexGuard<Mutex> guard(m_mutex);
 
-            delete[] taskStatus;
+        for(count = 0U; (count < maxCount) && (count < m_taskCnt); ++count)
+        {
+            tasks[count] = m_tasks[count];
         }
     }
-#endif  /* configUSE_TRACE_FACILITY */
+
+    return count;
 }
 
-#if configUSE_TRACE_FACILITY
+bool TaskMon::isLoadAvailable() const
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    return (0U < m_totalRunTime);
+}
 
 const char* TaskMon::taskState2Str(eTaskState state)
 {
@@ -153,27 +121,27 @@ const char* TaskMon::taskState2Str(eTaskState state)
     switch(state)
     {
     /* A task is querying the state of itself, so must be running. */
-	case eRunning:
+    case eRunning:
         name = "Running";
         break;
 
     /* The task being queried is in a read or pending ready list. */
-	case eReady:
+    case eReady:
         name = "Ready";
         break;
 
     /* The task being queried is in the Blocked state. */
-	case eBlocked:
+    case eBlocked:
         name = "Blocked";
         break;
 
     /* The task being queried is in the Suspended state, or is in the Blocked state with an infinite time out. */
-	case eSuspended:
+    case eSuspended:
         name = "Suspended";
         break;
 
     /* The task being queried has been deleted, but its TCB has not yet been freed. */
-	case eDeleted:
+    case eDeleted:
         name = "Deleted";
         break;
 
@@ -184,6 +152,146 @@ const char* TaskMon::taskState2Str(eTaskState state)
     return name;
 }
 
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+#if configUSE_TRACE_FACILITY
+
+void TaskMon::sample()
+{
+    UBaseType_t     numOfTasks  = uxTaskGetNumberOfTasks();
+    TaskStatus_t*   taskStatus  = new(std::nothrow) TaskStatus_t[numOfTasks];
+    TaskInfo*       tasks       = new(std::nothrow) TaskInfo[MAX_TASKS];
+
+    if ((nullptr != taskStatus) &&
+        (nullptr != tasks))
+    {
+        MutexGuard<Mutex>   guard(m_mutex);
+        uint32_t            totalRunTime        = 0U;
+        uint32_t            totalRunTimeDelta   = 0U;
+        UBaseType_t         index               = 0U;
+
+        numOfTasks          = uxTaskGetSystemState(taskStatus, numOfTasks, &totalRunTime);
+        totalRunTimeDelta   = totalRunTime - m_totalRunTime;
+
+        if (MAX_TASKS < numOfTasks)
+        {
+            numOfTasks = MAX_TASKS;
+        }
+
+        for(index = 0U; index < numOfTasks; ++index)
+        {
+            TaskInfo&   task            = tasks[index];
+            uint32_t    runTimeDelta    = taskStatus[index].ulRunTimeCounter;
+            uint8_t     prevIndex       = 0U;
+
+            strncpy(task.name, taskStatus[index].pcTaskName, sizeof(task.name) - 1U);
+            task.name[sizeof(task.name) - 1U] = '\0';
+
+            task.handle             = taskStatus[index].xHandle;
+#if configTASKLIST_INCLUDE_COREID
+            task.coreId             = taskStatus[index].xCoreID;
+#else
+            task.coreId             = tskNO_AFFINITY;
+#endif
+            task.priority           = taskStatus[index].uxCurrentPriority;
+            task.state              = taskStatus[index].eCurrentState;
+            task.runTime            = taskStatus[index].ulRunTimeCounter;
+            task.stackHighWaterMark = taskStatus[index].usStackHighWaterMark;
+            task.load               = 0U;
+
+            /* Consider only the run time since the last sample. */
+            for(prevIndex = 0U; prevIndex < m_taskCnt; ++prevIndex)
+            {
+                if (m_tasks[prevIndex].handle == task.handle)
+                {
+                    runTimeDelta = task.runTime - m_tasks[prevIndex].runTime;
+                    break;
+                }
+            }
+
+            /* Calculate task load in percent, if total run time is available.
+             * Note, this depends on how FreeRTOS is configured.
+             */
+            if (0U < (totalRunTimeDelta / 100U))
+            {
+                task.load = static_cast<uint8_t>(runTimeDelta / (totalRunTimeDelta / 100U));
+            }
+        }
+
+        for(index = 0U; index < numOfTasks; ++index)
+        {
+            m_tasks[index] = tasks[index];
+        }
+
+        m_taskCnt       = numOfTasks;
+        m_totalRunTime  = totalRunTime;
+    }
+
+    if (nullptr != taskStatus)
+    {
+        delete[] taskStatus;
+    }
+
+    if (nullptr != tasks)
+    {
+        delete[] tasks;
+    }
+}
+
+void TaskMon::log()
+{
+    MutexGuard<Mutex>   guard(m_mutex);
+    uint8_t             index           = 0U;
+    size_t              taskNameMaxLen  = 0U;
+    size_t              taskStateMaxLen = 0U;
+
+    /* Determine the length of the longest task name and the longest task state name. */
+    for(index = 0U; index < m_taskCnt; ++index)
+    {
+        size_t taskNameLen  = strlen(m_tasks[index].name);
+        size_t taskStateLen = strlen(taskState2Str(m_tasks[index].state));
+
+        if (taskNameMaxLen < taskNameLen)
+        {
+            taskNameMaxLen = taskNameLen;
+        }
+
+        if (taskStateMaxLen < taskStateLen)
+        {
+            taskStateMaxLen = taskStateLen;
+        }
+    }
+
+    /* Show task informations */
+    for(index = 0U; index < m_taskCnt; ++index)
+    {
+        const TaskInfo& task = m_tasks[index];
+
+#if configTASKLIST_INCLUDE_COREID
+        LOG_DEBUG("Task \"%s\": c %d, p %2u, %s, %3u%%, stack high water mark: %u",
+            fillUpSpaces(task.name, taskNameMaxLen).c_str(),
+            task.coreId,
+            task.priority,
+            fillUpSpaces(taskState2Str(task.state), taskStateMaxLen).c_str(),
+            task.load,
+            task.stackHighWaterMark);
+#else
+        LOG_DEBUG("Task \"%s\": p %2u, %s, %3u%%, stack high water mark: %u",
+            fillUpSpaces(task.name, taskNameMaxLen).c_str(),
+            task.priority,
+            fillUpSpaces(taskState2Str(task.state), taskStateMaxLen).c_str(),
+            task.load,
+            task.stackHighWaterMark);
+#endif
+    }
+}
+
 String TaskMon::fillUpSpaces(const char* str, size_t len)
 {
     String  result      = str;
@@ -204,14 +312,6 @@ String TaskMon::fillUpSpaces(const char* str, size_t len)
 
 #endif  /* configUSE_TRACE_FACILITY */
 
-/******************************************************************************
- * Protected Methods
- *****************************************************************************/
-
-/******************************************************************************
- * Private Methods
- *****************************************************************************/
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -46,6 +46,8 @@
 #include <stdint.h>
 #include <SysMsgPlugin.h>
 #include <WString.h>
+#include <SimpleTimer.hpp>
+#include <Mutex.hpp>
 
 /******************************************************************************
  * Macros
@@ -57,11 +59,29 @@
 
 /**
  * Task monitor
+ *
+ * It samples the properties of all tasks periodically, which are provided
+ * e.g. via REST API. Additional they are logged in a longer period.
  */
 class TaskMon
 {
 public:
 
+    /**
+     * Properties of a single task.
+     */
+    struct TaskInfo
+    {
+        char            name[configMAX_TASK_NAME_LEN];  /**< Task name */
+        TaskHandle_t    handle;                         /**< Task handle, used to identify the task in the next sample. */
+        int32_t         coreId;                         /**< Id of the core, the task is pinned to. */
+        uint32_t        priority;                       /**< Current task priority */
+        eTaskState      state;                          /**< Task state */
+        uint32_t        runTime;                        /**< Absolute run time counter */
+        uint8_t         load;                           /**< Task load in percent since the last sample */
+        uint32_t        stackHighWaterMark;             /**< Min. free stack in byte since task start */
+    };
+
     /**
      * Get task monitor instance.
      *
@@ -79,18 +99,62 @@ public:
      */
     void process();
 
-    /** Processing cycle in ms. */
-    static const uint32_t PROCESSING_CYCLE  = 60U * 1000U;
+    /**
+     * Get the properties of all tasks from the last sample.
+     *
+     * @param[out] tasks    Array, where to copy the task properties to.
+     * @param[in]  maxCount Max. number of elements in the array.
+     *
+     * @return Number of tasks, copied to the array.
+     */
+    uint8_t getTasks(TaskInfo* tasks, uint8_t maxCount) const;
+
+    /**
+     * Is the task load available? This depends on how FreeRTOS is configured.
+     *
+     * @return If available, it will return true otherwise false.
+     */
+    bool isLoadAvailable() const;
+
+    /**
+     * Get task state as user friendly string.
+     *
+     * @param[in] state Task state
+     *
+     * @return Task state name
+     */
+    static const char* taskState2Str(eTaskState state);
+
+    /** Processing cycle in ms, used for logging. */
+    static const uint32_t   PROCESSING_CYCLE    = 60U * 1000U;
+
+    /** Sample period in ms. */
+    static const uint32_t   SAMPLE_PERIOD       = 2U * 1000U;
+
+    /** Max. number of tasks, which are sampled. */
+    static const uint8_t    MAX_TASKS           = 24U;
 
 private:
 
-    SimpleTimer m_timer;    /**< Timer used for cyclic processing. */
+    SimpleTimer     m_timer;                /**< Timer used for cyclic processing. */
+    SimpleTimer     m_sampleTimer;          /**< Timer used for cyclic sampling. */
+    mutable Mutex   m_mutex;                /**< Protects the samples against concurrent access. */
+    TaskInfo        m_tasks[MAX_TASKS];     /**< Task properties of the last sample */
+    uint8_t         m_taskCnt;              /**< Number of tasks in the last sample */
+    uint32_t        m_totalRunTime;         /**< Total run time of the last sample */
 
     /**
      * Constructs the task monitor.
      */
-    TaskMon()
+    TaskMon() :
+        m_timer(),
+        m_sampleTimer(),
+        m_mutex(),
+        m_tasks(),
+        m_taskCnt(0U),
+        m_totalRunTime(0U)
     {
+        (void)m_mutex.create();
     }
 
     /**
@@ -107,11 +171,14 @@ private:
 #if configUSE_TRACE_FACILITY
 
     /**
-     * Get task state as user friendly string.
-     *
-     * @return Task state name
+     * Sample the properties of all tasks.
+     */
+    void sample();
+
+    /**
+     * Log the properties of all tasks from the last sample.
      */
-    const char* taskState2Str(eTaskState state);
+    void log();
 
     /**
      * Fill string up with spaces until given length is reached.
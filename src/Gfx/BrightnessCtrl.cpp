@@ -104,7 +104,7 @@ bool BrightnessCtrl::enable(bool state)
     /* Disable automatic brightness adjustment? */
     if (false == state)
     {
-        m_autoBrightnessTimer.stop();
+        m_isAutoAdjustEnabled = false;
         m_lightSensorDebounceTimer.stop();
     }
     /* Enable automatic brightness adjustment */
@@ -127,7 +127,7 @@ bool BrightnessCtrl::enable(bool state)
             updateBrightnessGoal();
 
             /* Display brightness will be automatically adjusted in the process() method. */
-            m_autoBrightnessTimer.start(AUTO_ADJUST_PERIOD);
+            m_isAutoAdjustEnabled = true;
 
             /* Start debouncing the ambient light sensor */
             if (AMBIENT_LIGHT_DIRECTION_BRIGHTER == m_direction)
@@ -151,21 +151,13 @@ bool BrightnessCtrl::enable(bool state)
  */
 bool BrightnessCtrl::isEnabled() const
 {
-    bool isEnabled = false;
-
-    if (m_autoBrightnessTimer.isTimerRunning())
-    {
-        isEnabled = true;
-    }
-
-    return isEnabled;
+    return m_isAutoAdjustEnabled;
 }
 
 void BrightnessCtrl::process()
 {
     /* Ambient light sensor available for automatic brightness adjustment? */
-    if ((true == m_autoBrightnessTimer.isTimerRunning()) &&
-        (true == m_autoBrightnessTimer.isTimeout()))
+    if (true == m_isAutoAdjustEnabled)
     {
         float lightNormalized = getNormalizedLight();
 
@@ -216,8 +208,6 @@ void BrightnessCtrl::process()
                 ;
             }
         }
-
-        m_autoBrightnessTimer.restart();
     }
 }
 
@@ -252,7 +242,7 @@ void BrightnessCtrl::setBrightness(uint8_t level)
 BrightnessCtrl::BrightnessCtrl() :
     m_display(nullptr),
     m_illuminanceChannel(nullptr),
-    m_autoBrightnessTimer(),
+    m_isAutoAdjustEnabled(false),
     m_brightness(0U),
     m_minBrightness(0U),
     m_maxBrightness(0U),
@@ -194,6 +194,8 @@ public:
 
     /**
      * Process brightness controller.
+     * If automatic brightness adjustment is enabled, call it periodically
+     * in the AUTO_ADJUST_PERIOD.
      */
     void process();
 
@@ -276,8 +278,8 @@ private:
     /** Channel where to get current illuminance values. */
     SensorChannelFloat32*       m_illuminanceChannel;
 
-    /** Timer, used for automatic brightness adjustment. */
-    SimpleTimer                 m_autoBrightnessTimer;
+    /** Is automatic brightness adjustment enabled? */
+    bool                        m_isAutoAdjustEnabled;
 
     /** Display brightness in digits [0; 255]. */
     uint8_t                     m_brightness;
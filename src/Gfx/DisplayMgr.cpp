@@ -41,10 +41,9 @@
 #include <ArduinoJson.h>
 #include <Util.h>
 #include <SettingsService.h>
-
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-#include <StatisticValue.hpp>
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+#include <Profiler.hpp>
+#include <YAGfxContext.h>
+#include <FrameClock.hpp>
 
 /******************************************************************************
  * Compiler Switches
@@ -58,21 +57,6 @@
  * Types and classes
  *****************************************************************************/
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-
-/**
- * A collection of statistics, which are interesting for debugging purposes.
- */
-struct Statistics
-{
-    StatisticValue<uint32_t, 0U, 10U>   pluginProcessing;
-    StatisticValue<uint32_t, 0U, 10U>   displayUpdate;
-    StatisticValue<uint32_t, 0U, 10U>   total;
-    StatisticValue<uint32_t, 0U, 10U>   refreshPeriod;
-};
-
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
-
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
@@ -137,14 +121,32 @@ bool DisplayMgr::begin()
 
     if (false == isError)
     {
-        uint8_t idx = 0U;
+        uint8_t     idx     = 0U;
+        uint16_t    width   = Display::getInstance().getWidth();
+        uint16_t    height  = Display::getInstance().getHeight();
 
-        /* Allocate framebuffer memory. */
+        /* The display size is the largest canvas size class. Without pool
+         * the canvases are allocated from the heap.
+         */
+        (void)CanvasPool::getInstance().begin(width, height);
+
+        /* Every slot processes its plugin with its own job in the plugin specific period. */
+        for(idx = 0U; idx < m_slotList.getMaxSlots(); ++idx)
+        {
+            Slot* slot = m_slotList.getSlot(idx);
+
+            if (nullptr != slot)
+            {
+                slot->getProcessJob().setup([this, idx]() { processPlugin(idx); }, 0U, PLUGIN_PROCESS_JITTER);
+            }
+        }
+
+        /* Borrow framebuffer memory. */
         for(idx = 0U; idx < UTIL_ARRAY_NUM(m_framebuffers); ++idx)
         {
-            if (false == m_framebuffers[idx].isAllocated())
+            if (false == m_framebuffers[idx].isBorrowed())
             {
-                if (false == m_framebuffers[idx].create(Display::getInstance().getWidth(), Display::getInstance().getHeight()))
+                if (false == m_framebuffers[idx].borrow(width, height))
                 {
                     isError = true;
 
@@ -238,10 +240,23 @@ void DisplayMgr::end()
 
     m_selectedFrameBuffer = nullptr;
 
-    /* Release framebuffer memory. */
+    /* Give framebuffer memory back. */
     for(idx = 0U; idx < UTIL_ARRAY_NUM(m_framebuffers); ++idx)
     {
-        m_framebuffers[idx].release();
+        m_framebuffers[idx].giveBack();
+    }
+
+    CanvasPool::getInstance().end();
+
+    /* The slot process jobs must not be scheduled anymore, before the slots are destroyed. */
+    for(idx = 0U; idx < m_slotList.getMaxSlots(); ++idx)
+    {
+        Slot* slot = m_slotList.getSlot(idx);
+
+        if (nullptr != slot)
+        {
+            m_jobScheduler.stop(slot->getProcessJob());
+        }
     }
 
     m_slotList.destroy();
@@ -256,6 +271,20 @@ bool DisplayMgr::setAutoBrightnessAdjustment(bool enable)
 
     status = BrightnessCtrl::getInstance().enable(enable);
 
+    /* If the job runs right now, it waits for the lock and finds the adjustment disabled. */
+    if (false == BrightnessCtrl::getInstance().isEnabled())
+    {
+        m_jobScheduler.stop(m_brightnessJob);
+    }
+    else if (false == m_brightnessJob.isScheduled())
+    {
+        startJob(m_brightnessJob, BrightnessCtrl::AUTO_ADJUST_PERIOD);
+    }
+    else
+    {
+        ;
+    }
+
     return status;
 }
 
@@ -323,8 +352,21 @@ uint8_t DisplayMgr::installPlugin(IPluginMaintenance* plugin, uint8_t slotId)
             }
             else
             {
-                LOG_INFO("Start plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
-                plugin->start(Display::getInstance().getWidth(), Display::getInstance().getHeight());
+                /* The plugin is started deferred, which avoids that all plugins
+                 * access the filesystem at once, before anything is shown.
+                 */
+                LOG_INFO("Plugin %s (UID %u) in slot %u will be started deferred.", plugin->getName(), plugin->getUID(), slotId);
+
+                /* The slot profile belongs to the new plugin. */
+                Profiler::getInstance().resetPlugin(slotId);
+
+                /* The plugin start job runs only while there are plugins to start. */
+                if (false == m_pluginStartJob.isScheduled())
+                {
+                    startJob(m_pluginStartJob, 0U);
+                }
+
+                requestProcess();
             }
         }
         else
@@ -367,14 +409,25 @@ bool DisplayMgr::uninstallPlugin(IPluginMaintenance* plugin)
                     m_selectedPlugin = nullptr;
                 }
 
-                LOG_INFO("Stop plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
-                plugin->stop();
+                if (true == m_slotList.getSlot(slotId)->isPluginStarted())
+                {
+                    LOG_INFO("Stop plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
+                    plugin->stop();
+                }
+
+                /* If the process job is running right now, it waits for the lock
+                 * and will find the slot empty afterwards.
+                 */
+                m_jobScheduler.stop(m_slotList.getSlot(slotId)->getProcessJob());
+
                 if (false == m_slotList.setPlugin(slotId, nullptr))
                 {
                     LOG_FATAL("Internal error.");
                 }
                 else
                 {
+                    Profiler::getInstance().resetPlugin(slotId);
+                    requestProcess();
                     status = true;
                 }
             }
@@ -463,6 +516,8 @@ bool DisplayMgr::setSlotSticky(uint8_t slotId)
 
     if (true == isSuccessful)
     {
+        requestProcess();
+
         if (SlotList::SLOT_ID_INVALID == slotId)
         {
             LOG_INFO("Sticky flag cleared.");
@@ -492,10 +547,12 @@ void DisplayMgr::clearSticky()
         if ((0U != duration) &&
             (false == m_slotTimer.isTimerRunning()))
         {
-            m_slotTimer.start(duration);
+            startSlotTimer(duration);
         }
     }
 
+    requestProcess();
+
     LOG_INFO("Sticky flag cleared.");
 }
 
@@ -525,6 +582,11 @@ bool DisplayMgr::activateSlot(uint8_t slotId)
         }
     }
 
+    if (true == isSuccessful)
+    {
+        requestProcess();
+    }
+
     return isSuccessful;
 }
 
@@ -564,6 +626,8 @@ void DisplayMgr::activateNextFadeEffect(FadeEffect fadeEffect)
     }
 
     m_fadeEffectUpdate = true;
+
+    requestProcess();
 }
 
 DisplayMgr::FadeEffect DisplayMgr::getFadeEffect()
@@ -597,15 +661,41 @@ bool DisplayMgr::movePluginToSlot(IPluginMaintenance* plugin, uint8_t slotId)
             {
                 if (false == dstSlot->isLocked())
                 {
+                    bool        isSrcStarted        = srcSlot->isPluginStarted();
+                    uint32_t    srcStartDuration    = srcSlot->getStartDuration();
+                    bool        isDstStarted        = dstSlot->isPluginStarted();
+                    uint32_t    dstStartDuration    = dstSlot->getStartDuration();
+
                     srcSlot->setPlugin(dstSlot->getPlugin());
                     dstSlot->setPlugin(plugin);
 
+                    /* The start state moves together with the plugin. */
+                    if (true == isDstStarted)
+                    {
+                        srcSlot->setPluginStarted(dstStartDuration);
+                    }
+
+                    if (true == isSrcStarted)
+                    {
+                        dstSlot->setPluginStarted(srcStartDuration);
+                    }
+
+                    Profiler::getInstance().resetPlugin(srcSlotId);
+                    Profiler::getInstance().resetPlugin(slotId);
+
+                    /* The process jobs belong to the slots. Run both once, they
+                     * continue in the period of the moved plugins.
+                     */
+                    startJob(srcSlot->getProcessJob(), 0U);
+                    startJob(dstSlot->getProcessJob(), 0U);
+
                     /* Is one of the moved plugins selected at the moment? */
                     if ((m_selectedPlugin == srcSlot->getPlugin()) ||
                         (m_selectedPlugin == dstSlot->getPlugin()))
                     {
                         /* Remove selection */
                         m_selectedPlugin = nullptr;
+                        requestProcess();
                     }
 
                     status = true;
@@ -666,6 +756,34 @@ bool DisplayMgr::setSlotDuration(uint8_t slotId, uint32_t duration, bool store)
     return status;
 }
 
+bool DisplayMgr::isPluginStarted(uint8_t slotId)
+{
+    bool                        isStarted   = false;
+    MutexGuard<MutexRecursive>  guard(m_mutexInterf);
+    Slot*                       slot        = m_slotList.getSlot(slotId);
+
+    if (nullptr != slot)
+    {
+        isStarted = slot->isPluginStarted();
+    }
+
+    return isStarted;
+}
+
+uint32_t DisplayMgr::getPluginStartDuration(uint8_t slotId)
+{
+    uint32_t                    startDuration   = 0U;
+    MutexGuard<MutexRecursive>  guard(m_mutexInterf);
+    Slot*                       slot            = m_slotList.getSlot(slotId);
+
+    if (nullptr != slot)
+    {
+        startDuration = slot->getStartDuration();
+    }
+
+    return startDuration;
+}
+
 void DisplayMgr::getFBCopy(uint32_t* fb, size_t length, uint8_t* slotId)
 {
     if ((nullptr != fb) &&
@@ -741,6 +859,40 @@ bool DisplayMgr::isDisplayOn() const
     return isDisplayOn;
 }
 
+void DisplayMgr::startJob(JobScheduler::Job& job, uint32_t delay)
+{
+    m_jobScheduler.start(job, millis(), delay);
+
+    /* Wake up the process task, because the job may be due earlier than
+     * the one it is sleeping for.
+     */
+    if ((nullptr != m_processTaskHandle) &&
+        (xTaskGetCurrentTaskHandle() != m_processTaskHandle))
+    {
+        (void)xTaskNotifyGive(m_processTaskHandle);
+    }
+}
+
+void DisplayMgr::stopJob(JobScheduler::Job& job)
+{
+    bool isWaiting = false;
+
+    do
+    {
+        m_jobScheduler.stop(job);
+
+        /* A job function, which stops its own job, must not wait for itself. */
+        isWaiting = (true == m_jobScheduler.isRunning(job)) &&
+                    (xTaskGetCurrentTaskHandle() != m_processTaskHandle);
+
+        if (true == isWaiting)
+        {
+            delay(1U);
+        }
+    }
+    while(true == isWaiting);
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -762,7 +914,13 @@ DisplayMgr::DisplayMgr() :
     m_selectedSlotId(SlotList::SLOT_ID_INVALID),
     m_selectedPlugin(nullptr),
     m_requestedPlugin(nullptr),
+    m_jobSchedulerLock(),
+    m_jobScheduler(&m_jobSchedulerLock),
+    m_processJob(),
+    m_pluginStartJob(),
     m_slotTimer(),
+    m_slotJob(),
+    m_brightnessJob(),
     m_displayFadeState(FADE_IN),
     m_selectedFrameBuffer(nullptr),
     m_framebuffers(),
@@ -772,8 +930,30 @@ DisplayMgr::DisplayMgr() :
     m_fadeEffect(&m_fadeLinearEffect),
     m_fadeEffectIndex(FADE_EFFECT_LINEAR),
     m_fadeEffectUpdate(false),
-    m_isNetworkConnected(false)
+    m_isFullCopyRequired(true),
+    m_isNetworkConnected(false),
+    m_isFirstFrameShown(false)
 {
+    m_processJob.setup([this]() { process(); }, PROCESS_TASK_PERIOD, PROCESS_JOB_JITTER);
+    m_pluginStartJob.setup(
+        [this]()
+        {
+            MutexGuard<MutexRecursive> guard(m_mutexInterf);
+
+            startNextPlugin();
+        },
+        PLUGIN_START_PERIOD,
+        PLUGIN_START_JITTER);
+    m_slotJob.setup([this]() { process(); }, 0U, PROCESS_JOB_JITTER);
+    m_brightnessJob.setup(
+        [this]()
+        {
+            MutexGuard<MutexRecursive> guard(m_mutexInterf);
+
+            BrightnessCtrl::getInstance().process();
+        },
+        BrightnessCtrl::AUTO_ADJUST_PERIOD,
+        PROCESS_JOB_JITTER);
 }
 
 DisplayMgr::~DisplayMgr()
@@ -887,6 +1067,123 @@ uint8_t DisplayMgr::previousSlot(uint8_t slotId)
     return slotId;
 }
 
+void DisplayMgr::startPlugin(uint8_t slotId)
+{
+    Slot* slot = m_slotList.getSlot(slotId);
+
+    if ((nullptr != slot) &&
+        (false == slot->isEmpty()) &&
+        (false == slot->isPluginStarted()))
+    {
+        IPluginMaintenance* plugin      = slot->getPlugin();
+        uint32_t            timestamp   = millis();
+        uint32_t            duration    = 0U;
+
+        plugin->start(Display::getInstance().getWidth(), Display::getInstance().getHeight());
+
+        duration = millis() - timestamp;
+        slot->setPluginStarted(duration);
+
+        /* Its topics can be accessed now, because its configuration is loaded. */
+        PluginMgr::getInstance().onPluginStarted(plugin);
+
+        /* Only plugins with cyclic stuff to do are processed. */
+        if (0U != plugin->getProcessPeriod())
+        {
+            startJob(slot->getProcessJob(), 0U);
+        }
+
+        LOG_INFO("Plugin %s (UID %u) in slot %u started in %u ms.", plugin->getName(), plugin->getUID(), slotId, duration);
+    }
+}
+
+void DisplayMgr::startNextPlugin()
+{
+    uint8_t maxSlots    = m_slotList.getMaxSlots();
+    uint8_t slotId      = m_selectedSlotId;
+    uint8_t count       = 0U;
+    bool    isStarted   = false;
+
+    while((maxSlots > count) && (false == isStarted))
+    {
+        Slot* slot = nullptr;
+
+        if (maxSlots <= slotId)
+        {
+            slotId = 0U;
+        }
+        else
+        {
+            ++slotId;
+            slotId %= maxSlots;
+        }
+
+        slot = m_slotList.getSlot(slotId);
+
+        if ((nullptr != slot) &&
+            (false == slot->isEmpty()) &&
+            (false == slot->isPluginStarted()))
+        {
+            startPlugin(slotId);
+            isStarted = true;
+        }
+
+        ++count;
+    }
+
+    /* All plugins are started, the job is started again by the next plugin installation. */
+    if (false == isStarted)
+    {
+        m_jobScheduler.stop(m_pluginStartJob);
+        PluginMgr::getInstance().onAllPluginsStarted();
+    }
+}
+
+void DisplayMgr::processPlugin(uint8_t slotId)
+{
+    MutexGuard<MutexRecursive>  guardInterf(m_mutexInterf);
+    MutexGuard<MutexRecursive>  guardUpdate(m_mutexUpdate);
+    Slot*                       slot = m_slotList.getSlot(slotId);
+
+    /* The plugin may be removed or moved, while the job waited for the lock. */
+    if ((nullptr != slot) &&
+        (false == slot->isEmpty()) &&
+        (true == slot->isPluginStarted()))
+    {
+        IPluginMaintenance* plugin      = slot->getPlugin();
+        uint32_t            period      = plugin->getProcessPeriod();
+        uint32_t            timestamp   = micros();
+
+        plugin->process(m_isNetworkConnected);
+
+        Profiler::getInstance().recordPluginProcess(slotId, micros() - timestamp);
+
+        if (0U != period)
+        {
+            m_jobScheduler.start(slot->getProcessJob(), millis(), period);
+        }
+    }
+}
+
+void DisplayMgr::requestProcess()
+{
+    startJob(m_processJob, 0U);
+}
+
+void DisplayMgr::startSlotTimer(uint32_t duration)
+{
+    /* The job is started after the timer, so the timer is timed out when the job runs. */
+    m_slotTimer.start(duration);
+    startJob(m_slotJob, duration);
+}
+
+void DisplayMgr::stopSlotTimer()
+{
+    /* A job which runs right now, finds the timer stopped. */
+    m_slotTimer.stop();
+    m_jobScheduler.stop(m_slotJob);
+}
+
 void DisplayMgr::startFadeOut()
 {
     /* Select next framebuffer and keep old content, until
@@ -901,7 +1198,8 @@ void DisplayMgr::startFadeOut()
         m_selectedFrameBuffer = &m_framebuffers[FB_ID_0];
     }
 
-    m_displayFadeState = FADE_OUT;
+    m_displayFadeState      = FADE_OUT;
+    m_isFullCopyRequired    = true;
 
     if (nullptr != m_fadeEffect)
     {
@@ -914,7 +1212,8 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
     if ((nullptr != m_selectedFrameBuffer) &&
         (nullptr != m_fadeEffect))
     {
-        YAGfxBitmap* prevFb = nullptr;
+        YAGfxBitmap*    prevFb  = nullptr;
+        YAGfxDamage     damage;
 
         /* Determine previous frame buffer */
         if (m_selectedFrameBuffer == &m_framebuffers[FB_ID_0])
@@ -929,7 +1228,11 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
         /* Continuously update the current canvas with its framebuffer. */
         if (nullptr != m_selectedPlugin)
         {
-            m_selectedPlugin->update(*m_selectedFrameBuffer);
+            uint32_t timestamp = micros();
+
+            m_selectedPlugin->updateDamaged(*m_selectedFrameBuffer, damage);
+
+            Profiler::getInstance().recordPluginUpdate(m_selectedSlotId, micros() - timestamp);
         }
 
         /* Handle fading */
@@ -937,14 +1240,36 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
         {
         /* No fading at all */
         case FADE_IDLE:
-            dst.drawBitmap(0, 0, *m_selectedFrameBuffer);
+            if (true == m_isFullCopyRequired)
+            {
+                dst.drawBitmap(0, 0, *m_selectedFrameBuffer);
+                m_isFullCopyRequired = false;
+            }
+            else
+            {
+                uint8_t index = 0U;
+
+                /* Copy only the damaged regions, the rest of the display is up to date. */
+                for(index = 0U; index < damage.getCount(); ++index)
+                {
+                    const YAGfxDamage::Rect&    rect    = damage.getRect(index);
+                    YAGfxContext                context(dst, 0, 0, dst.getWidth(), dst.getHeight());
+
+                    context.clip(rect.x, rect.y, rect.width, rect.height);
+                    context.drawBitmap(0, 0, *m_selectedFrameBuffer);
+                }
+            }
             break;
 
         /* Fade new display content in */
         case FADE_IN:
             if (true == m_fadeEffect->fadeIn(dst, *prevFb, *m_selectedFrameBuffer))
             {
-                m_displayFadeState = FADE_IDLE;
+                m_displayFadeState      = FADE_IDLE;
+                m_isFullCopyRequired    = true;
+
+                /* Handle slot changes, which waited for the end of fading. */
+                requestProcess();
             }
             break;
 
@@ -965,13 +1290,9 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
 void DisplayMgr::process()
 {
     IDisplay&                   display     = Display::getInstance();
-    uint8_t                     index       = 0U;
     uint8_t                     stickySlot  = SlotList::SLOT_ID_INVALID;
     MutexGuard<MutexRecursive>  guardInterf(m_mutexInterf);
 
-    /* Handle display brightness */
-    BrightnessCtrl::getInstance().process();
-
     /* Check whether a different slot got sticky and it shall be activated. */
     stickySlot = m_slotList.getStickySlot();
     if (SlotList::SLOT_ID_INVALID != stickySlot)
@@ -979,7 +1300,7 @@ void DisplayMgr::process()
         /* If slot is set sticky which is active, the slot timer will be stopped to prevent scheduling of other slots. */
         if (m_selectedSlotId == stickySlot)
         {
-            m_slotTimer.stop();
+            stopSlotTimer();
         }
         else
         {
@@ -1017,11 +1338,11 @@ void DisplayMgr::process()
                 /* If plugin shall not be infinite active, start the slot timer. */
                 if (0U == duration)
                 {
-                    m_slotTimer.stop();
+                    stopSlotTimer();
                 }
                 else
                 {
-                    m_slotTimer.start(duration);
+                    startSlotTimer(duration);
                 }
             }
             else
@@ -1054,7 +1375,7 @@ void DisplayMgr::process()
         {
             m_selectedPlugin->inactive();
             m_selectedPlugin = nullptr;
-            m_slotTimer.stop();
+            stopSlotTimer();
 
             /* Fade old display content out */
             startFadeOut();
@@ -1070,16 +1391,22 @@ void DisplayMgr::process()
              */
             if (m_selectedSlotId == slotId)
             {
-                if (true == m_slotTimer.isTimerRunning())
+                uint32_t duration = m_slotList.getDuration(m_selectedSlotId);
+
+                if (0U == duration)
+                {
+                    stopSlotTimer();
+                }
+                else
                 {
-                    m_slotTimer.restart();
+                    startSlotTimer(duration);
                 }
             }
             else
             {
                 m_selectedPlugin->inactive();
                 m_selectedPlugin = nullptr;
-                m_slotTimer.stop();
+                stopSlotTimer();
 
                 /* Fade old display content out */
                 startFadeOut();
@@ -1116,15 +1443,18 @@ void DisplayMgr::process()
 
             m_selectedPlugin = m_slotList.getPlugin(m_selectedSlotId);
 
+            /* Plugin not started in the background yet? */
+            startPlugin(m_selectedSlotId);
+
             /* If plugin shall be infinite active or is in a sticky slot, the slot timer will be stopped otherwise started. */
             if ((0U == duration) ||
                 (m_selectedSlotId == m_slotList.getStickySlot()))
             {
-                m_slotTimer.stop();
+                stopSlotTimer();
             }
             else
             {
-                m_slotTimer.start(duration);
+                startSlotTimer(duration);
             }
 
             if (nullptr != m_selectedFrameBuffer)
@@ -1146,6 +1476,7 @@ void DisplayMgr::process()
                 m_selectedFrameBuffer->fillScreen(ColorDef::BLACK);
             }
             display.clear();
+            m_isFullCopyRequired = true;
         }
     }
 
@@ -1174,18 +1505,6 @@ void DisplayMgr::process()
 
         m_fadeEffectUpdate = false;
     }
-
-    /* Process all installed plugins. */
-    for(index = 0U; index < m_slotList.getMaxSlots(); ++index)
-    {
-        MutexGuard<MutexRecursive>  guard(m_mutexUpdate);
-        IPluginMaintenance*         plugin = m_slotList.getPlugin(index);
-
-        if (nullptr != plugin)
-        {
-            plugin->process(m_isNetworkConnected);
-        }
-    }
 }
 
 void DisplayMgr::update()
@@ -1193,6 +1512,9 @@ void DisplayMgr::update()
     IDisplay&                   display = Display::getInstance();
     MutexGuard<MutexRecursive>  guard(m_mutexUpdate);
 
+    /* All animations of this frame are based on the same frame time. */
+    FrameClock::getInstance().tick();
+
     /* Update display (main canvas available) */
     if (nullptr != m_selectedFrameBuffer)
     {
@@ -1201,7 +1523,11 @@ void DisplayMgr::update()
     /* Update display (main canvas not available) */
     else if (nullptr != m_selectedPlugin)
     {
+        uint32_t timestamp = micros();
+
         m_selectedPlugin->update(display);
+
+        Profiler::getInstance().recordPluginUpdate(m_selectedSlotId, micros() - timestamp);
     }
     /* No plugin selected. */
     else
@@ -1211,6 +1537,17 @@ void DisplayMgr::update()
     }
 
     display.show();
+
+    /* Measure the time from power-on till the first frame of a slot plugin,
+     * the sticky system message slot is not considered.
+     */
+    if ((false == m_isFirstFrameShown) &&
+        (SlotList::SLOT_ID_INVALID != m_selectedSlotId) &&
+        (m_slotList.getStickySlot() != m_selectedSlotId))
+    {
+        LOG_INFO("Time to first frame: %u ms", millis());
+        m_isFirstFrameShown = true;
+    }
 }
 
 bool DisplayMgr::createProcessTask()
@@ -1264,6 +1601,7 @@ void DisplayMgr::destroyProcessTask()
     {
         /* Request task to exit and wait until its done. */
         m_processTaskExit = true;
+        (void)xTaskNotifyGive(m_processTaskHandle);
         (void)xSemaphoreTake(m_processTaskSemaphore, portMAX_DELAY);
         m_processTaskHandle = nullptr;
 
@@ -1344,30 +1682,44 @@ void DisplayMgr::processTask(void* parameters)
     if ((nullptr != tthis) &&
         (nullptr != tthis->m_processTaskSemaphore))
     {
+        JobScheduler&   scheduler   = tthis->m_jobScheduler;
+        uint32_t        timestamp   = millis();
+
         (void)xSemaphoreTake(tthis->m_processTaskSemaphore, portMAX_DELAY);
 
+        /* Process all slot related stuff and start the remaining plugins
+         * staggered in the background. The plugins and the brightness
+         * control have their own jobs.
+         */
+        scheduler.start(tthis->m_processJob, timestamp, 0U);
+        scheduler.start(tthis->m_pluginStartJob, timestamp, 0U);
+
         while(false == tthis->m_processTaskExit)
         {
-            uint32_t    timestamp   = millis();
-            uint32_t    duration    = 0U;
-
-            /* Process all slot and plugin related stuff. */
-            tthis->process();
-
-            /* Calculate overall duration */
-            duration = millis() - timestamp;
+            /* Run all due jobs. The task sleeps until the next job is due. A new
+             * job or a task exit request wakes it up earlier.
+             */
+            uint32_t waitTime = scheduler.process(millis());
 
             /* Give other tasks a chance. */
-            if (PROCESS_TASK_PERIOD <= duration)
+            if (0U == waitTime)
             {
                 delay(1U);
             }
+            else if (JobScheduler::WAIT_FOREVER == waitTime)
+            {
+                (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            }
             else
             {
-                delay(PROCESS_TASK_PERIOD - duration);
+                (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitTime));
             }
         }
 
+        scheduler.stop(tthis->m_slotJob);
+        scheduler.stop(tthis->m_pluginStartJob);
+        scheduler.stop(tthis->m_processJob);
+
         (void)xSemaphoreGive(tthis->m_processTaskSemaphore);
     }
 
@@ -1381,18 +1733,13 @@ void DisplayMgr::updateTask(void* parameters)
     if ((nullptr != tthis) &&
         (nullptr != tthis->m_updateTaskSemaphore))
     {
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-        Statistics      statistics;
-        SimpleTimer     statisticsLogTimer;
-        const uint32_t  STATISTICS_LOG_PERIOD   = 4000U;    /* [ms] */
-        uint32_t        timestampLastUpdate     = millis();
-
-        statisticsLogTimer.start(STATISTICS_LOG_PERIOD);
-
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+        Profiler&   profiler            = Profiler::getInstance();
+        uint32_t    timestampLastUpdate = 0U;
 
         (void)xSemaphoreTake(tthis->m_updateTaskSemaphore, portMAX_DELAY);
 
+        timestampLastUpdate = micros();
+
         while(false == tthis->m_updateTaskExit)
         {
             uint32_t    timestamp           = millis();
@@ -1407,10 +1754,6 @@ void DisplayMgr::updateTask(void* parameters)
             /* Refresh display content periodically */
             tthis->update();
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-            statistics.pluginProcessing.update(millis() - timestamp);
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
-
             /* Wait until the physical update is ready to avoid flickering
              * and artifacts on the display, because of e.g. webserver flash
              * access.
@@ -1426,40 +1769,6 @@ void DisplayMgr::updateTask(void* parameters)
                 }
             }
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-            statistics.displayUpdate.update(durationPhyUpdate);
-            statistics.total.update(statistics.pluginProcessing.getCurrent() + statistics.displayUpdate.getCurrent());
-
-            if (true == statisticsLogTimer.isTimeout())
-            {
-                LOG_DEBUG("[ %2u, %2u, %2u ]", 
-                    statistics.refreshPeriod.getMin(),
-                    statistics.refreshPeriod.getAvg(),
-                    statistics.refreshPeriod.getMax()
-                );
-                
-                LOG_DEBUG("[ %2u, %2u, %2u ] [ %2u, %2u, %2u ] [ %2u, %2u, %2u ]",
-                    statistics.pluginProcessing.getMin(),
-                    statistics.pluginProcessing.getAvg(),
-                    statistics.pluginProcessing.getMax(),
-                    statistics.displayUpdate.getMin(),
-                    statistics.displayUpdate.getAvg(),
-                    statistics.displayUpdate.getMax(),
-                    statistics.total.getMin(),
-                    statistics.total.getAvg(),
-                    statistics.total.getMax()
-                );
-
-                /* Reset the statistics to get a new min./max. determination. */
-                statistics.pluginProcessing.reset();
-                statistics.displayUpdate.reset();
-                statistics.total.reset();
-                statistics.refreshPeriod.reset();
-
-                statisticsLogTimer.restart();
-            }
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
-
             /* Calculate overall duration */
             duration = millis() - timestamp;
 
@@ -1473,10 +1782,17 @@ void DisplayMgr::updateTask(void* parameters)
                 delay(UPDATE_TASK_PERIOD - duration);
             }
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-            statistics.refreshPeriod.update(millis() - timestampLastUpdate);
-            timestampLastUpdate = millis();
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+            /* Profile the display refresh period and its deviation. */
+            {
+                uint32_t    timestampUpdate = micros();
+                uint32_t    period          = timestampUpdate - timestampLastUpdate;
+                uint32_t    expectedPeriod  = UPDATE_TASK_PERIOD * 1000U;
+
+                profiler.getFramePeriod().record(period);
+                profiler.getFrameJitter().record((expectedPeriod < period) ? (period - expectedPeriod) : (expectedPeriod - period));
+
+                timestampLastUpdate = timestampUpdate;
+            }
         }
 
         (void)xSemaphoreGive(tthis->m_updateTaskSemaphore);
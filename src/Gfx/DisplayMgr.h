@@ -47,11 +47,15 @@
 #include <Board.h>
 #include <TextWidget.h>
 #include <SimpleTimer.hpp>
+#include <JobScheduler.h>
 #include <FadeLinear.h>
 #include <FadeMoveX.h>
 #include <FadeMoveY.h>
 #include <Mutex.hpp>
+#include <CriticalSection.hpp>
 #include <YAGfxBitmap.h>
+#include <CanvasPool.h>
+#include <YAGfxDamage.h>
 
 #include "IPluginMaintenance.hpp"
 #include "SlotList.h"
@@ -306,6 +310,26 @@ public:
      */
     bool setSlotDuration(uint8_t slotId, uint32_t duration, bool store = true);
 
+    /**
+     * Is the plugin in the given slot started?
+     * Plugins are started deferred, either on their first activation or in
+     * the background.
+     *
+     * @param[in] slotId    Slot id
+     *
+     * @return If started, it will return true otherwise false.
+     */
+    bool isPluginStarted(uint8_t slotId);
+
+    /**
+     * Get duration in ms, the plugin in the given slot needed to start.
+     *
+     * @param[in] slotId    Slot id
+     *
+     * @return Start duration in ms
+     */
+    uint32_t getPluginStartDuration(uint8_t slotId);
+
     /**
      * Get access to copy of framebuffer.
      *
@@ -346,13 +370,89 @@ public:
      */
     bool isDisplayOn() const;
 
+    /**
+     * Start a job in the display manager process task. If the job is already
+     * scheduled, it will be restarted. It can be called by any task. The
+     * process task sleeps until the next job is due, therefore use a job
+     * instead of polling a timer.
+     *
+     * @param[in] job   Job, which must be set up before.
+     * @param[in] delay Delay in ms until the first deadline.
+     */
+    void startJob(JobScheduler::Job& job, uint32_t delay);
+
+    /**
+     * Stop a job in the display manager process task. It can be called by any
+     * task. If the job function is running at the moment, it waits until it
+     * is finished, so the job can be destroyed afterwards. Therefore don't
+     * hold a lock, which the job function takes too.
+     *
+     * @param[in] job   Job
+     */
+    void stopJob(JobScheduler::Job& job);
+
 private:
 
+    /**
+     * Lock of the job scheduler, because the jobs are started and stopped
+     * by different tasks.
+     */
+    class JobSchedulerLock : public JobScheduler::ILock
+    {
+    public:
+
+        /**
+         * Constructs the lock.
+         */
+        JobSchedulerLock() :
+            JobScheduler::ILock(),
+            m_criticalSection()
+        {
+        }
+
+        /**
+         * Destroys the lock.
+         */
+        ~JobSchedulerLock()
+        {
+        }
+
+        /**
+         * Enter the locked section.
+         */
+        void enter() final
+        {
+            m_criticalSection.enter();
+        }
+
+        /**
+         * Exit the locked section.
+         */
+        void exit() final
+        {
+            m_criticalSection.exit();
+        }
+
+    private:
+
+        CriticalSection m_criticalSection;  /**< Critical section, which protects the scheduler. */
+
+        JobSchedulerLock(const JobSchedulerLock& lock);
+        JobSchedulerLock& operator=(const JobSchedulerLock& lock);
+    };
+
     /** The process task stack size in bytes */
     static const uint32_t       PROCESS_TASK_STACK_SIZE = 4096U;
 
-    /** The process task period in ms. */
-    static const uint32_t       PROCESS_TASK_PERIOD     = 100U;
+    /**
+     * The period in ms of the slot processing. Every change of the slots
+     * requests the processing immediately, therefore the period is only a
+     * fallback, e.g. for a plugin which is enabled or disabled.
+     */
+    static const uint32_t       PROCESS_TASK_PERIOD     = 1000U;
+
+    /** The jitter tolerance of the periodic processing in ms. */
+    static const uint32_t       PROCESS_JOB_JITTER      = 10U;
 
     /** The process task shall run on the APP MCU core. */
     static const BaseType_t     PROCESS_TASK_RUN_CORE   = APP_CPU_NUM;
@@ -372,6 +472,24 @@ private:
     /** The update task priority shall be higher than the other application tasks. */
     static const UBaseType_t    UPDATE_TASK_PRIORITY    = 4U;
 
+    /**
+     * Period in ms between two plugin starts in the background. It spreads the
+     * filesystem access of the plugin starts over time.
+     */
+    static const uint32_t       PLUGIN_START_PERIOD     = 200U;
+
+    /**
+     * The jitter tolerance of the plugin start in ms. It is large enough to
+     * run the plugin start together with the plugin processing.
+     */
+    static const uint32_t       PLUGIN_START_JITTER     = 100U;
+
+    /**
+     * The jitter tolerance of the plugin processing in ms. It allows to
+     * process several plugins with one wake-up of the process task.
+     */
+    static const uint32_t       PLUGIN_PROCESS_JITTER   = 20U;
+
     /** Mutex to protect concurrent access through the public interface. */
     mutable MutexRecursive      m_mutexInterf;
 
@@ -408,9 +526,27 @@ private:
     /** Plugin which is requested to be activated immediately. */
     IPluginMaintenance*         m_requestedPlugin;
 
+    /** Lock of the job scheduler. */
+    JobSchedulerLock            m_jobSchedulerLock;
+
+    /** Scheduler of all jobs of the process task. */
+    JobScheduler                m_jobScheduler;
+
+    /** Job, which processes the slots on request and periodically as fallback. */
+    JobScheduler::Job           m_processJob;
+
+    /** Job, which starts the plugins staggered in the background. It runs only while a plugin is not started. */
+    JobScheduler::Job           m_pluginStartJob;
+
     /** Timer, used for changing the slot after a specific duration. */
     SimpleTimer                 m_slotTimer;
 
+    /** One-shot job, which processes the slots when the slot timer times out. */
+    JobScheduler::Job           m_slotJob;
+
+    /** Job, which adjusts the display brightness periodically. It runs only while automatic adjustment is enabled. */
+    JobScheduler::Job           m_brightnessJob;
+
     /** Display fade state */
     enum FadeState
     {
@@ -433,14 +569,16 @@ private:
      */
     FadeState           m_displayFadeState;
     YAGfxBitmap*        m_selectedFrameBuffer;          /**< Points to the current framebuffer, used to update the display. */
-    YAGfxDynamicBitmap  m_framebuffers[FB_ID_MAX];      /**< Two framebuffers, which will contain the old and the new plugin content. */
+    PooledCanvas        m_framebuffers[FB_ID_MAX];      /**< Two framebuffers, which will contain the old and the new plugin content. */
     FadeLinear          m_fadeLinearEffect;             /**< Linear fade effect. */
     FadeMoveX           m_fadeMoveXEffect;              /**< Moving along x-axis fade effect. */
     FadeMoveY           m_fadeMoveYEffect;              /**< Moving along y-axis fade effect. */
     IFadeEffect*        m_fadeEffect;                   /**< The fade effect itself. */
     FadeEffect          m_fadeEffectIndex;              /**< Fade effect index to determine the next fade effect. */
     bool                m_fadeEffectUpdate;             /**< Flag to indicate that the fadeEffect was updated. */
+    bool                m_isFullCopyRequired;           /**< Shall the whole framebuffer be copied to the display instead of only the damaged regions? */
     bool                m_isNetworkConnected;           /**< Is a network connection established? */
+    bool                m_isFirstFrameShown;            /**< Is the first frame of a slot plugin shown? Used to measure the boot time. */
 
     /**
      * Constructs the display manager.
@@ -474,6 +612,47 @@ private:
      */
     uint8_t previousSlot(uint8_t slotId);
 
+    /**
+     * Start the plugin in the given slot, if its not started yet.
+     *
+     * @param[in] slotId    Slot id
+     */
+    void startPlugin(uint8_t slotId);
+
+    /**
+     * Start the next plugin, which is not started yet, in the background.
+     * The search begins with the slot after the selected one, which is
+     * usually the next one to be shown. This way its started ahead of its turn.
+     */
+    void startNextPlugin();
+
+    /**
+     * Process the plugin in the given slot and schedule its next processing
+     * according to its process period. Its the function of the slot process job.
+     *
+     * @param[in] slotId    Slot id
+     */
+    void processPlugin(uint8_t slotId);
+
+    /**
+     * Request to process the slots as soon as possible, e.g. after a slot
+     * change. It can be called by any task.
+     */
+    void requestProcess();
+
+    /**
+     * Start the slot timer. If it is already running, it will be restarted.
+     * The slots are processed on its timeout.
+     *
+     * @param[in] duration  Slot duration in ms
+     */
+    void startSlotTimer(uint32_t duration);
+
+    /**
+     * Stop the slot timer.
+     */
+    void stopSlotTimer();
+
     /**
      * Start fade effect.
      */
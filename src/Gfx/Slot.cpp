@@ -61,7 +61,10 @@
 Slot::Slot() :
     m_plugin(nullptr),
     m_duration(DURATION_DEFAULT),
-    m_isLocked(false)
+    m_isLocked(false),
+    m_isPluginStarted(false),
+    m_startDuration(0U),
+    m_processJob()
 {
 }
 
@@ -72,7 +75,10 @@ Slot::~Slot()
 Slot::Slot(const Slot& slot) :
     m_plugin(slot.m_plugin),
     m_duration(slot.m_duration),
-    m_isLocked(slot.m_isLocked)
+    m_isLocked(slot.m_isLocked),
+    m_isPluginStarted(slot.m_isPluginStarted),
+    m_startDuration(slot.m_startDuration),
+    m_processJob()
 {
 }
 
@@ -80,9 +86,11 @@ Slot& Slot::operator=(const Slot& slot)
 {
     if (this != (&slot))
     {
-        m_plugin    = slot.m_plugin;
-        m_duration  = slot.m_duration;
-        m_isLocked  = slot.m_isLocked;
+        m_plugin            = slot.m_plugin;
+        m_duration          = slot.m_duration;
+        m_isLocked          = slot.m_isLocked;
+        m_isPluginStarted   = slot.m_isPluginStarted;
+        m_startDuration     = slot.m_startDuration;
     }
 
     return *this;
@@ -104,7 +112,9 @@ bool Slot::setPlugin(IPluginMaintenance* plugin)
             m_plugin->setSlot(nullptr);
         }
 
-        m_plugin = plugin;
+        m_plugin            = plugin;
+        m_isPluginStarted   = false;
+        m_startDuration     = 0U;
 
         if (nullptr != m_plugin)
         {
@@ -147,6 +157,30 @@ bool Slot::isLocked() const
     return m_isLocked;
 }
 
+bool Slot::isPluginStarted() const
+{
+    return m_isPluginStarted;
+}
+
+void Slot::setPluginStarted(uint32_t startDuration)
+{
+    if (nullptr != m_plugin)
+    {
+        m_isPluginStarted   = true;
+        m_startDuration     = startDuration;
+    }
+}
+
+uint32_t Slot::getStartDuration() const
+{
+    return m_startDuration;
+}
+
+JobScheduler::Job& Slot::getProcessJob()
+{
+    return m_processJob;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "IPluginMaintenance.hpp"
 #include "ISlotPlugin.hpp"
+#include <JobScheduler.h>
 
 /******************************************************************************
  * Macros
@@ -142,14 +143,47 @@ public:
      */
     bool isLocked() const;
 
+    /**
+     * Is the plugin in the slot started?
+     *
+     * @return If started, it will return true otherwise false.
+     */
+    bool isPluginStarted() const;
+
+    /**
+     * Mark the plugin in the slot as started.
+     * Setting a different plugin resets it.
+     *
+     * @param[in] startDuration Duration in ms, the plugin needed to start.
+     */
+    void setPluginStarted(uint32_t startDuration);
+
+    /**
+     * Get duration in ms, the plugin needed to start.
+     *
+     * @return Start duration in ms
+     */
+    uint32_t getStartDuration() const;
+
+    /**
+     * Get the job, which processes the plugin in the slot.
+     * The job is not copied together with the slot.
+     *
+     * @return Process job
+     */
+    JobScheduler::Job& getProcessJob();
+
     /** Default duration in ms */
     static const uint32_t DURATION_DEFAULT  = 30000U;
 
 private:
 
-    IPluginMaintenance* m_plugin;   /**< Plugged in slot */
-    uint32_t            m_duration; /**< Duration in ms, how long the plugin shall be active. */
-    bool                m_isLocked; /**< Is slot locked or not. */
+    IPluginMaintenance* m_plugin;           /**< Plugged in slot */
+    uint32_t            m_duration;         /**< Duration in ms, how long the plugin shall be active. */
+    bool                m_isLocked;         /**< Is slot locked or not. */
+    bool                m_isPluginStarted;  /**< Is the plugin started? */
+    uint32_t            m_startDuration;    /**< Duration in ms, the plugin needed to start. */
+    JobScheduler::Job   m_processJob;       /**< Job, which processes the plugin. */
 };
 
 /******************************************************************************
@@ -50,7 +50,7 @@
  * Macros
  *****************************************************************************/
 
-#define SENSOR_TOPICS_COUNT (4U)
+#define SENSOR_TOPICS_COUNT (5U)
 
 /******************************************************************************
  * Types and classes
@@ -150,6 +150,22 @@ static const SensorTopic gSensorTopics[SENSOR_TOPICS_COUNT] =
             "}"                                                 \
         "}",
         10000U
+    },
+    {
+        ISensorChannel::TYPE_CURRENT_MILLIAMPERE,
+        "{"                                                     \
+            "\"ha\": {"                                         \
+                "\"component\": \"sensor\","                    \
+                "\"discovery\": {"                              \
+                    "\"name\": \"Display current\","            \
+                    "\"unit_of_meas\": \"mA\","                 \
+                    "\"ic\": \"mdi:current-dc\","               \
+                    "\"dev_cla\": \"current\","                 \
+                    "\"val_tpl\": \"{{ value_json.value }}\""   \
+                "}"                                             \
+            "}"                                                 \
+        "}",
+        10000U
     }
 };
 
@@ -159,6 +175,7 @@ static SensorTopicRunData gSensorLastValue[SENSOR_TOPICS_COUNT] =
     {   String(), 0U    },
     {   String(), 0U    },
     {   String(), 0U    },
+    {   String(), 0U    },
     {   String(), 0U    }
 };
 
@@ -0,0 +1,385 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Boot snapshot of the slot and plugin configuration
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "BootSnapshot.h"
+#include "FileSystem.h"
+#include "Plugin.hpp"
+#include "JsonFile.h"
+#include "JsonDocPool.h"
+
+#include <Logging.h>
+#include <BootSnapshotFormat.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize static members */
+const char* BootSnapshot::FILE_NAME             = "/configuration/bootSnapshot.bin";
+const char* BootSnapshot::FILE_NAME_TMP         = "/configuration/bootSnapshot.tmp";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool BootSnapshot::open(JsonDocument& jsonDoc)
+{
+    bool isValid    = false;
+    bool isPending  = false;
+
+    close();
+
+    {
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
+        isValid     = read(jsonDoc);
+        isPending   = (0U < m_pendingRecordCnt);
+
+        if (false == isPending)
+        {
+            release();
+        }
+    }
+
+    /* Registered outside of the snapshot mutex, because the notifier calls
+     * the provider with its own mutex taken. Otherwise the lock order would
+     * be inverted.
+     */
+    if (true == isPending)
+    {
+        PluginConfigNotifier::getInstance().setProvider(this);
+    }
+
+    return isValid;
+}
+
+void BootSnapshot::close()
+{
+    /* Unregister first, outside of the snapshot mutex (see open()). */
+    PluginConfigNotifier::getInstance().setProvider(nullptr);
+
+    {
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
+        release();
+    }
+}
+
+bool BootSnapshot::save(const JsonDocument& jsonDoc)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    bool                        isSuccessful    = false;
+    JsonArrayConst              jsonSlots       = jsonDoc["slotConfiguration"].as<JsonArrayConst>();
+    uint16_t                    recordCnt       = 1U; /* Slot configuration */
+    size_t                      slotCfgSize     = measureMsgPack(jsonDoc);
+    File                        fd;
+
+    /* Count the plugins with a configuration file. */
+    for(JsonVariantConst jsonSlot: jsonSlots)
+    {
+        uint16_t uid = jsonSlot["uid"].as<uint16_t>();
+
+        if ((0U != uid) &&
+            (true == FILESYSTEM.exists(PluginConfigFsHandler::generateFullPath(uid, ".json"))))
+        {
+            ++recordCnt;
+        }
+    }
+
+    if (UINT16_MAX >= slotCfgSize)
+    {
+        fd = FILESYSTEM.open(FILE_NAME_TMP, "w");
+    }
+
+    if (true == fd)
+    {
+        BootSnapshotFormat::Writer  writer(fd);
+        JsonFile                    jsonFile(FILESYSTEM);
+        uint16_t                    writtenRecordCnt    = 1U;
+
+        writer.writeHeader(recordCnt);
+        writer.writeRecordHeader(BootSnapshotFormat::RECORD_TYPE_SLOTS, 0U, static_cast<uint16_t>(slotCfgSize));
+        (void)serializeMsgPack(jsonDoc, writer);
+
+        for(JsonVariantConst jsonSlot: jsonSlots)
+        {
+            uint16_t    uid         = jsonSlot["uid"].as<uint16_t>();
+            String      fullPath    = PluginConfigFsHandler::generateFullPath(uid, ".json");
+
+            if ((0U != uid) &&
+                (true == FILESYSTEM.exists(fullPath)))
+            {
+                const size_t    JSON_DOC_SIZE   = 1024U;
+                JsonDocLease    jsonDocLease("BootSnapshot::save", JSON_DOC_SIZE);
+                size_t          pluginCfgSize   = 0U;
+
+                if (false == jsonDocLease.isValid())
+                {
+                    break;
+                }
+                else if (false == jsonFile.load(fullPath, *jsonDocLease))
+                {
+                    break;
+                }
+                else
+                {
+                    pluginCfgSize = measureMsgPack(*jsonDocLease);
+                }
+
+                if (UINT16_MAX < pluginCfgSize)
+                {
+                    break;
+                }
+
+                writer.writeRecordHeader(BootSnapshotFormat::RECORD_TYPE_PLUGIN, uid, static_cast<uint16_t>(pluginCfgSize));
+                (void)serializeMsgPack(*jsonDocLease, writer);
+
+                ++writtenRecordCnt;
+            }
+        }
+
+        if (recordCnt == writtenRecordCnt)
+        {
+            writer.writeTrailer();
+
+            if (false == writer.isError())
+            {
+                isSuccessful = true;
+            }
+        }
+
+        fd.close();
+
+        /* Replace the old snapshot only with a complete one. */
+        if (true == isSuccessful)
+        {
+            (void)FILESYSTEM.remove(FILE_NAME);
+
+            if (false == FILESYSTEM.rename(FILE_NAME_TMP, FILE_NAME))
+            {
+                isSuccessful = false;
+            }
+        }
+
+        if (false == isSuccessful)
+        {
+            (void)FILESYSTEM.remove(FILE_NAME_TMP);
+        }
+    }
+
+    if (false == isSuccessful)
+    {
+        LOG_WARNING("Couldn't save boot snapshot.");
+    }
+
+    /* A failed write may leave a removed or no snapshot, which is fine. */
+    m_isAvailable = isSuccessful;
+
+    return isSuccessful;
+}
+
+void BootSnapshot::onConfigurationChanged()
+{
+    /* The snapshot content is outdated now. */
+    close();
+
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* Remove the snapshot only once, to avoid unnecessary filesystem access. */
+    if (true == m_isAvailable)
+    {
+        (void)FILESYSTEM.remove(FILE_NAME);
+        m_isAvailable = false;
+
+        LOG_INFO("Boot snapshot invalidated.");
+    }
+}
+
+bool BootSnapshot::getConfiguration(uint16_t uid, JsonDocument& jsonDoc)
+{
+    bool isAvailable    = false;
+    bool isConsumed     = false;
+
+    {
+        MutexGuard<MutexRecursive>  guard(m_mutex);
+        BootSnapshotFormat::Reader  reader(m_buffer, m_size);
+        size_t                      payloadIdx  = 0U;
+        size_t                      payloadSize = 0U;
+
+        if (true == reader.findRecord(BootSnapshotFormat::RECORD_TYPE_PLUGIN, uid, payloadIdx, payloadSize))
+        {
+            /* The configuration is copied into the JSON document, therefore it
+             * stays valid after the snapshot memory is released below.
+             */
+            isAvailable = reader.deserialize(payloadIdx, payloadSize, jsonDoc);
+
+            /* Provide it only once, a later reload shall use the configuration file. */
+            reader.markConsumed(payloadIdx);
+
+            if (0U < m_pendingRecordCnt)
+            {
+                --m_pendingRecordCnt;
+            }
+
+            isConsumed = (0U == m_pendingRecordCnt);
+        }
+    }
+
+    /* Release the memory, after the last plugin got its configuration. */
+    if (true == isConsumed)
+    {
+        close();
+    }
+
+    return isAvailable;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool BootSnapshot::read(JsonDocument& jsonDoc)
+{
+    bool    isValid = false;
+    File    fd;
+
+    if (true == m_isAvailable)
+    {
+        fd = FILESYSTEM.open(FILE_NAME, "r");
+    }
+
+    if (true == fd)
+    {
+        size_t fileSize = fd.size();
+
+        if (((BootSnapshotFormat::HEADER_SIZE + BootSnapshotFormat::TRAILER_SIZE) <= fileSize) &&
+            (MAX_FILE_SIZE >= fileSize))
+        {
+            m_buffer = new(std::nothrow) uint8_t[fileSize];
+
+            if (nullptr != m_buffer)
+            {
+                /* Read the whole snapshot at once. */
+                if (fileSize == fd.read(m_buffer, fileSize))
+                {
+                    m_size = fileSize;
+                }
+            }
+        }
+
+        fd.close();
+    }
+
+    if (0U < m_size)
+    {
+        BootSnapshotFormat::Reader          reader(m_buffer, m_size);
+        BootSnapshotFormat::Reader::Result  result      = reader.verify();
+        size_t                              payloadIdx  = 0U;
+        size_t                              payloadSize = 0U;
+
+        if (BootSnapshotFormat::Reader::RESULT_OUTDATED == result)
+        {
+            LOG_INFO("Boot snapshot version is outdated.");
+        }
+        else if (BootSnapshotFormat::Reader::RESULT_CORRUPT == result)
+        {
+            LOG_WARNING("Boot snapshot is corrupt.");
+        }
+        else if (BootSnapshotFormat::Reader::RESULT_OK != result)
+        {
+            LOG_WARNING("Boot snapshot is invalid.");
+        }
+        else if (false == reader.findRecord(BootSnapshotFormat::RECORD_TYPE_SLOTS, 0U, payloadIdx, payloadSize))
+        {
+            LOG_WARNING("Boot snapshot has no slot configuration.");
+        }
+        else if (false == reader.deserialize(payloadIdx, payloadSize, jsonDoc))
+        {
+            LOG_WARNING("Boot snapshot slot configuration is invalid.");
+        }
+        else
+        {
+            /* All records except the slot configuration are plugin configurations.
+             * The slot configuration is copied into the JSON document, therefore
+             * the snapshot memory can be released, if there are no plugin
+             * configurations.
+             */
+            m_pendingRecordCnt = reader.getRecordCount() - 1U;
+
+            isValid = true;
+        }
+    }
+
+    return isValid;
+}
+
+void BootSnapshot::release()
+{
+    if (nullptr != m_buffer)
+    {
+        delete[] m_buffer;
+        m_buffer = nullptr;
+    }
+
+    m_size              = 0U;
+    m_pendingRecordCnt  = 0U;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,184 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Boot snapshot of the slot and plugin configuration
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup plugin
+ *
+ * @{
+ */
+
+#ifndef BOOT_SNAPSHOT_H
+#define BOOT_SNAPSHOT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include <Mutex.hpp>
+#include <PluginConfigNotifier.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The boot snapshot contains the slot configuration and all plugin
+ * configurations in a single binary file. During boot it is read with a
+ * single sequential read, instead of opening and parsing every JSON
+ * configuration file separately.
+ *
+ * The JSON configuration files stay the source of truth. Every change of
+ * them invalidates the snapshot, which will be written again with the next
+ * slot configuration save.
+ *
+ * See BootSnapshotFormat for the file format.
+ */
+class BootSnapshot : public PluginConfigNotifier::Listener, public PluginConfigNotifier::Provider
+{
+public:
+
+    /**
+     * Constructs the boot snapshot.
+     */
+    BootSnapshot() :
+        m_mutex(),
+        m_buffer(nullptr),
+        m_size(0U),
+        m_pendingRecordCnt(0U),
+        m_isAvailable(true)
+    {
+        (void)m_mutex.create();
+    }
+
+    /**
+     * Destroys the boot snapshot.
+     */
+    ~BootSnapshot()
+    {
+        close();
+        m_mutex.destroy();
+    }
+
+    /**
+     * Read the snapshot from the filesystem and verify it. If successful,
+     * it will provide every plugin configuration once. After the last one
+     * was taken or if any configuration changes, it will be closed
+     * automatically. Otherwise close it after the plugins are started.
+     *
+     * @param[out] jsonDoc  JSON document, which will contain the slot configuration.
+     *
+     * @return If a valid snapshot is available, it will return true otherwise false.
+     */
+    bool open(JsonDocument& jsonDoc);
+
+    /**
+     * Close the snapshot and release its memory.
+     */
+    void close();
+
+    /**
+     * Write the snapshot with the slot configuration and the configuration
+     * files of all plugins in the slot configuration.
+     *
+     * @param[in] jsonDoc   JSON document, which contains the slot configuration.
+     *
+     * @return If successful written, it will return true otherwise false.
+     */
+    bool save(const JsonDocument& jsonDoc);
+
+    /**
+     * A plugin configuration or the slot configuration changed in the
+     * filesystem. The snapshot is invalidated and closed.
+     */
+    void onConfigurationChanged() final;
+
+    /**
+     * Get the configuration of a plugin from the snapshot.
+     * The configuration is provided only once, because later the plugin
+     * shall read its configuration file.
+     *
+     * @param[in]   uid     Plugin UID
+     * @param[out]  jsonDoc JSON document, which will contain the configuration.
+     *
+     * @return If the configuration is available, it will return true otherwise false.
+     */
+    bool getConfiguration(uint16_t uid, JsonDocument& jsonDoc) final;
+
+    /** Max. snapshot file size in byte. */
+    static const size_t     MAX_FILE_SIZE   = 32U * 1024U;
+
+private:
+
+    /** Filename of the snapshot */
+    static const char*      FILE_NAME;
+
+    /** Filename of the snapshot, used during writing. */
+    static const char*      FILE_NAME_TMP;
+
+    MutexRecursive  m_mutex;            /**< Protects the snapshot against concurrent access. */
+    uint8_t*        m_buffer;           /**< Snapshot content, only available while opened. */
+    size_t          m_size;             /**< Snapshot content size in byte */
+    uint16_t        m_pendingRecordCnt; /**< Number of plugin configurations, which are not provided yet. */
+    bool            m_isAvailable;      /**< Is a snapshot file maybe available? */
+
+    BootSnapshot(const BootSnapshot& snapshot);
+    BootSnapshot& operator=(const BootSnapshot& snapshot);
+
+    /**
+     * Read the snapshot from the filesystem into the memory and verify it.
+     * The mutex must be taken!
+     *
+     * @param[out] jsonDoc  JSON document, which will contain the slot configuration.
+     *
+     * @return If a valid snapshot is available, it will return true otherwise false.
+     */
+    bool read(JsonDocument& jsonDoc);
+
+    /**
+     * Release the snapshot memory. The mutex must be taken!
+     */
+    void release();
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* BOOT_SNAPSHOT_H */
+
+/** @} */
@@ -36,6 +36,8 @@
 #include "PluginList.h"
 
 #include <Logging.h>
+#include <ObjectPool.hpp>
+#include <CriticalSection.hpp>
 
 /******************************************************************************
  * Compiler Switches
@@ -49,10 +51,18 @@
  * Types and classes
  *****************************************************************************/
 
+/** Max. number of pooled plugin list elements, which is the max. number of display slots. */
+static const size_t PLUGIN_LIST_POOL_SIZE   = 16U;
+
+/** Pool of the plugin list elements. */
+typedef ObjectPool<ListElement<IPluginMaintenance*>, PLUGIN_LIST_POOL_SIZE, CriticalSection> PluginInstanceListPool;
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
 
+static PluginInstanceListPool& getPluginInstanceListPool();
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -61,6 +71,16 @@
  * Public Methods
  *****************************************************************************/
 
+ListElement<IPluginMaintenance*>* PluginInstanceListAllocator::create(IPluginMaintenance*& element, ListElement<IPluginMaintenance*>* prev, ListElement<IPluginMaintenance*>* next)
+{
+    return getPluginInstanceListPool().create(element, prev, next);
+}
+
+void PluginInstanceListAllocator::destroy(ListElement<IPluginMaintenance*>* listElement)
+{
+    getPluginInstanceListPool().destroy(listElement);
+}
+
 IPluginMaintenance* PluginFactory::createPlugin(const String& name)
 {
     return createPlugin(name, generateUID());
@@ -81,8 +101,23 @@ IPluginMaintenance* PluginFactory::createPlugin(const String& name, uint16_t uid
         /* Plugin type found? */
         if (name == elem->name)
         {
+            /* Prefer a slot of the static plugin arena, if available. */
+            void* slot = PluginList::allocateSlot();
+
             /* Produce the plugin object. */
-            plugin = elem->createFunc(elem->name, uid);
+            if (nullptr != slot)
+            {
+                plugin = elem->createInPlaceFunc(slot, elem->name, uid);
+            }
+            else
+            {
+                if (0U < CONFIG_PLUGIN_ARENA_SLOTS)
+                {
+                    LOG_WARNING("Plugin arena exhausted, %s (%u byte) is allocated on the heap.", elem->name, elem->size);
+                }
+
+                plugin = elem->createFunc(elem->name, uid);
+            }
 
             if (nullptr != plugin)
             {
@@ -100,7 +135,7 @@ void PluginFactory::destroyPlugin(IPluginMaintenance* plugin)
 {
     if (nullptr != plugin)
     {
-        DLinkedListIterator<IPluginMaintenance*> it(m_plugins);
+        DLinkedListIterator<IPluginMaintenance*, PluginInstanceListAllocator> it(m_plugins);
 
         if (false == it.find(plugin))
         {
@@ -109,7 +144,12 @@ void PluginFactory::destroyPlugin(IPluginMaintenance* plugin)
         else
         {
             it.remove();
-            delete plugin;
+
+            /* A plugin in the static plugin arena is destroyed there, otherwise it is on the heap. */
+            if (false == PluginList::releaseSlot(plugin))
+            {
+                delete plugin;
+            }
         }
     }
 }
@@ -124,9 +164,9 @@ void PluginFactory::destroyPlugin(IPluginMaintenance* plugin)
 
 uint16_t PluginFactory::generateUID()
 {
-    uint16_t                                        uid;
-    bool                                            isFound;
-    DLinkedListConstIterator<IPluginMaintenance*>   it(m_plugins);
+    uint16_t                                                                    uid;
+    bool                                                                        isFound;
+    DLinkedListConstIterator<IPluginMaintenance*, PluginInstanceListAllocator>  it(m_plugins);
 
     do
     {
@@ -167,3 +207,15 @@ uint16_t PluginFactory::generateUID()
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Get the pool of the plugin list elements.
+ *
+ * @return Plugin list element pool
+ */
+static PluginInstanceListPool& getPluginInstanceListPool()
+{
+    static PluginInstanceListPool pool("plugin list"); /* singleton idiom to force initialization in the first usage. */
+
+    return pool;
+}
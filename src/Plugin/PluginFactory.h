@@ -56,6 +56,33 @@
  * Types and Classes
  *****************************************************************************/
 
+/**
+ * Allocator of the plugin list elements. The list elements are taken from a
+ * pool, which has room for the plugins of all display slots.
+ */
+class PluginInstanceListAllocator
+{
+public:
+
+    /**
+     * Create a plugin list element.
+     *
+     * @param[in] element   Plugin
+     * @param[in] prev      Previous list element
+     * @param[in] next      Next list element
+     *
+     * @return If successful, it will return the list element otherwise nullptr.
+     */
+    static ListElement<IPluginMaintenance*>* create(IPluginMaintenance*& element, ListElement<IPluginMaintenance*>* prev, ListElement<IPluginMaintenance*>* next);
+
+    /**
+     * Destroy a plugin list element.
+     *
+     * @param[in] listElement   List element
+     */
+    static void destroy(ListElement<IPluginMaintenance*>* listElement);
+};
+
 /**
  * The plugin factory produces plugin object of a given type.
  * All plugin types, which shall be produced, must be registered
@@ -112,7 +139,10 @@ public:
 
 private:
 
-    DLinkedList<IPluginMaintenance*>    m_plugins;  /**< List with all produced plugin objects. */
+    /** List of plugins, with pooled list elements. */
+    typedef DLinkedList<IPluginMaintenance*, PluginInstanceListAllocator> PluginInstanceList;
+
+    PluginInstanceList  m_plugins;  /**< List with all produced plugin objects. */
 
     PluginFactory(const PluginFactory& factory);
     PluginFactory& operator=(const PluginFactory& factory);
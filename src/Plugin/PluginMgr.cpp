@@ -37,6 +37,7 @@
 #include "FileSystem.h"
 #include "Plugin.hpp"
 #include "JsonFile.h"
+#include "JsonDocPool.h"
 
 #include <Logging.h>
 #include <ArduinoJson.h>
@@ -88,6 +89,9 @@ void PluginMgr::begin()
     }
 
     createPluginConfigDirectory();
+
+    /* Any configuration change invalidates the boot snapshot. */
+    PluginConfigNotifier::getInstance().setListener(&m_bootSnapshot);
 }
 
 IPluginMaintenance* PluginMgr::install(const String& name, uint8_t slotId)
@@ -116,7 +120,13 @@ bool PluginMgr::uninstall(IPluginMaintenance* plugin)
 
         if (true == status)
         {
-            TopicHandlerService::getInstance().unregisterTopics(m_deviceId, plugin);
+            MutexGuard<MutexRecursive> guard(m_mutex);
+
+            /* Topics of a plugin, which was not started, are not registered. */
+            if (false == removePendingPlugin(plugin))
+            {
+                TopicHandlerService::getInstance().unregisterTopics(m_deviceId, plugin);
+            }
 
             m_pluginFactory.destroyPlugin(plugin);
         }
@@ -125,6 +135,41 @@ bool PluginMgr::uninstall(IPluginMaintenance* plugin)
     return status;
 }
 
+void PluginMgr::process()
+{
+    MutexGuard<MutexRecursive>              guard(m_mutex);
+    std::vector<PendingPlugin>::iterator    it = m_pendingPlugins.begin();
+
+    while(m_pendingPlugins.end() != it)
+    {
+        if (true == it->isStarted)
+        {
+            TopicHandlerService::getInstance().registerTopics(m_deviceId, it->plugin);
+
+            it = m_pendingPlugins.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void PluginMgr::onPluginStarted(IPluginMaintenance* plugin)
+{
+    MutexGuard<MutexRecursive>              guard(m_mutex);
+    std::vector<PendingPlugin>::iterator    it;
+
+    for(it = m_pendingPlugins.begin(); it != m_pendingPlugins.end(); ++it)
+    {
+        if (plugin == it->plugin)
+        {
+            it->isStarted = true;
+            break;
+        }
+    }
+}
+
 bool PluginMgr::setPluginAliasName(IPluginMaintenance* plugin, const String& alias)
 {
     bool isSuccessful = false;
@@ -133,14 +178,24 @@ bool PluginMgr::setPluginAliasName(IPluginMaintenance* plugin, const String& ali
         (plugin->getAlias() != alias) &&
         (true == isPluginAliasValid(alias)))
     {
-        /* First remove current registered topics. */
-        TopicHandlerService::getInstance().unregisterTopics(m_deviceId, plugin);
+        MutexGuard<MutexRecursive> guard(m_mutex);
 
-        /* Set new alias */
-        plugin->setAlias(alias);
+        /* The topics of a pending plugin will be registered with the new alias later. */
+        if (true == isPendingPlugin(plugin))
+        {
+            plugin->setAlias(alias);
+        }
+        else
+        {
+            /* First remove current registered topics. */
+            TopicHandlerService::getInstance().unregisterTopics(m_deviceId, plugin);
+
+            /* Set new alias */
+            plugin->setAlias(alias);
 
-        /* Register web API, based on new alias. */
-        TopicHandlerService::getInstance().registerTopics(m_deviceId, plugin);
+            /* Register web API, based on new alias. */
+            TopicHandlerService::getInstance().registerTopics(m_deviceId, plugin);
+        }
 
         isSuccessful = true;
     }
@@ -155,33 +210,58 @@ void PluginMgr::unregisterAllPluginTopics()
 
     for(slotId = 0U; slotId < maxSlots; ++slotId)
     {
-        IPluginMaintenance* plugin = DisplayMgr::getInstance().getPluginInSlot(slotId);
+        IPluginMaintenance*         plugin = DisplayMgr::getInstance().getPluginInSlot(slotId);
+        MutexGuard<MutexRecursive>  guard(m_mutex);
 
-        TopicHandlerService::getInstance().unregisterTopics(m_deviceId, plugin);
+        /* Topics of a plugin, which was not started, are not registered. */
+        if (false == isPendingPlugin(plugin))
+        {
+            TopicHandlerService::getInstance().unregisterTopics(m_deviceId, plugin);
+        }
     }
 }
 
 bool PluginMgr::load()
 {
     bool                isSuccessful            = true;
+    bool                isSnapshotUsed          = false;
+    uint32_t            timestamp               = millis();
     JsonFile            jsonFile(FILESYSTEM);
     const size_t        JSON_DOC_SIZE           = 4096U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+    JsonDocLease        jsonDocLease("PluginMgr::load", JSON_DOC_SIZE);
     String              fullConfigFileName      = PluginConfigFsHandler::CONFIG_PATH;
 
     fullConfigFileName += "/";
     fullConfigFileName += CONFIG_FILE_NAME;
 
-    if (false == jsonFile.load(fullConfigFileName, jsonDoc))
+    if (false == jsonDocLease.isValid())
+    {
+        LOG_ERROR("No JSON document available to load %s.", fullConfigFileName.c_str());
+        isSuccessful = false;
+    }
+    /* The boot snapshot is preferred, because it avoids to open and parse
+     * every single JSON configuration file.
+     */
+    else if (true == m_bootSnapshot.open(*jsonDocLease))
+    {
+        isSnapshotUsed = true;
+    }
+    else if (false == jsonFile.load(fullConfigFileName, *jsonDocLease))
     {
         LOG_WARNING("Failed to load file %s.", fullConfigFileName.c_str());
         isSuccessful = false;
     }
     else
     {
-        JsonArray       jsonSlots   = jsonDoc["slotConfiguration"].as<JsonArray>();
-        uint8_t         slotId      = 0;
-        const uint8_t   MAX_SLOTS   = DisplayMgr::getInstance().getMaxSlots();
+        ;
+    }
+
+    if (true == isSuccessful)
+    {
+        DynamicJsonDocument&    jsonDoc     = *jsonDocLease;
+        JsonArray               jsonSlots   = jsonDoc["slotConfiguration"].as<JsonArray>();
+        uint8_t                 slotId      = 0;
+        const uint8_t           MAX_SLOTS   = DisplayMgr::getInstance().getMaxSlots();
 
         checkJsonDocOverflow(jsonDoc, __LINE__);
 
@@ -195,6 +275,32 @@ bool PluginMgr::load()
                 break;
             }
         }
+
+        /* The plugins are started deferred and take their configuration
+         * from the boot snapshot, which is closed after all of them are
+         * started. Without a valid snapshot, it is a good moment to create
+         * it for the next boot.
+         */
+        if (false == isSnapshotUsed)
+        {
+            (void)m_bootSnapshot.save(jsonDoc);
+        }
+        else
+        {
+            m_isBootStarting = true;
+
+            /* The plugin start job stops after the last plugin is started and
+             * may have finished already, before the boot start phase began.
+             */
+            if (true == areAllPluginsStarted())
+            {
+                onAllPluginsStarted();
+            }
+        }
+
+        LOG_INFO("Slot configuration loaded from %s in %u ms.",
+            (true == isSnapshotUsed) ? "boot snapshot" : "JSON files",
+            millis() - timestamp);
     }
 
     return isSuccessful;
@@ -202,45 +308,69 @@ bool PluginMgr::load()
 
 void PluginMgr::save()
 {
-    String              installation;
-    uint8_t             slotId              = 0;
     const size_t        JSON_DOC_SIZE       = 4096U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-    JsonArray           jsonSlots           = jsonDoc.createNestedArray("slotConfiguration");
-    JsonFile            jsonFile(FILESYSTEM);
+    JsonDocLease        jsonDocLease("PluginMgr::save", JSON_DOC_SIZE);
     String              fullConfigFileName  = PluginConfigFsHandler::CONFIG_PATH;
 
     fullConfigFileName += "/";
     fullConfigFileName += CONFIG_FILE_NAME;
 
-    for(slotId = 0; slotId < DisplayMgr::getInstance().getMaxSlots(); ++slotId)
+    if (false == jsonDocLease.isValid())
+    {
+        LOG_ERROR("No JSON document available to save %s.", fullConfigFileName.c_str());
+    }
+    else
     {
-        IPluginMaintenance* plugin      = DisplayMgr::getInstance().getPluginInSlot(slotId);
-        JsonObject          jsonSlot    = jsonSlots.createNestedObject();
+        uint8_t                 slotId      = 0;
+        DynamicJsonDocument&    jsonDoc     = *jsonDocLease;
+        JsonArray               jsonSlots   = jsonDoc.createNestedArray("slotConfiguration");
+        JsonFile                jsonFile(FILESYSTEM);
 
-        if (nullptr == plugin)
+        for(slotId = 0; slotId < DisplayMgr::getInstance().getMaxSlots(); ++slotId)
         {
-            jsonSlot["name"]        = "";
-            jsonSlot["uid"]         = 0;
-            jsonSlot["alias"]       = "";
-            jsonSlot["fontType"]    = Fonts::fontTypeToStr(Fonts::FONT_TYPE_DEFAULT);
-            jsonSlot["duration"]    = DisplayMgr::getInstance().getSlotDuration(slotId);
+            IPluginMaintenance* plugin      = DisplayMgr::getInstance().getPluginInSlot(slotId);
+            JsonObject          jsonSlot    = jsonSlots.createNestedObject();
+
+            if (nullptr == plugin)
+            {
+                jsonSlot["name"]        = "";
+                jsonSlot["uid"]         = 0;
+                jsonSlot["alias"]       = "";
+                jsonSlot["fontType"]    = Fonts::fontTypeToStr(Fonts::FONT_TYPE_DEFAULT);
+                jsonSlot["duration"]    = DisplayMgr::getInstance().getSlotDuration(slotId);
+            }
+            else
+            {
+                jsonSlot["name"]        = plugin->getName();
+                jsonSlot["uid"]         = plugin->getUID();
+                jsonSlot["alias"]       = plugin->getAlias();
+                jsonSlot["fontType"]    = Fonts::fontTypeToStr(plugin->getFontType());
+                jsonSlot["duration"]    = DisplayMgr::getInstance().getSlotDuration(slotId);
+            }
+        }
+
+        checkJsonDocOverflow(jsonDoc, __LINE__);
+
+        if (false == jsonFile.save(fullConfigFileName, jsonDoc))
+        {
+            LOG_ERROR("Couldn't save slot configuration.");
         }
         else
         {
-            jsonSlot["name"]        = plugin->getName();
-            jsonSlot["uid"]         = plugin->getUID();
-            jsonSlot["alias"]       = plugin->getAlias();
-            jsonSlot["fontType"]    = Fonts::fontTypeToStr(plugin->getFontType());
-            jsonSlot["duration"]    = DisplayMgr::getInstance().getSlotDuration(slotId);
+            (void)m_bootSnapshot.save(jsonDoc);
         }
     }
+}
 
-    checkJsonDocOverflow(jsonDoc, __LINE__);
-
-    if (false == jsonFile.save(fullConfigFileName, jsonDoc))
+void PluginMgr::onAllPluginsStarted()
+{
+    /* Release the snapshot memory, because no plugin will take its
+     * configuration from it anymore. Before the slot configuration is
+     * loaded completely, not all plugins are installed yet.
+     */
+    if (true == m_isBootStarting.exchange(false))
     {
-        LOG_ERROR("Couldn't save slot configuration.");
+        m_bootSnapshot.close();
     }
 }
 
@@ -271,6 +401,27 @@ void PluginMgr::checkJsonDocOverflow(const DynamicJsonDocument& jsonDoc, int lin
     }
 }
 
+bool PluginMgr::areAllPluginsStarted()
+{
+    bool            isStarted   = true;
+    DisplayMgr&     displayMgr  = DisplayMgr::getInstance();
+    const uint8_t   MAX_SLOTS   = displayMgr.getMaxSlots();
+    uint8_t         slotId      = 0U;
+
+    while((true == isStarted) && (MAX_SLOTS > slotId))
+    {
+        if ((nullptr != displayMgr.getPluginInSlot(slotId)) &&
+            (false == displayMgr.isPluginStarted(slotId)))
+        {
+            isStarted = false;
+        }
+
+        ++slotId;
+    }
+
+    return isStarted;
+}
+
 void PluginMgr::createPluginConfigDirectory()
 {
     if (false == FILESYSTEM.exists(PluginConfigFsHandler::CONFIG_PATH))
@@ -378,6 +529,18 @@ bool PluginMgr::install(IPluginMaintenance* plugin, uint8_t slotId)
 
     if (nullptr != plugin)
     {
+        PendingPlugin pendingPlugin = { plugin, false };
+
+        /* Pending before the installation, because the display manager may
+         * start the plugin immediately afterwards. Its topics are registered
+         * after it is started.
+         */
+        {
+            MutexGuard<MutexRecursive> guard(m_mutex);
+
+            m_pendingPlugins.push_back(pendingPlugin);
+        }
+
         if (SlotList::SLOT_ID_INVALID == slotId)
         {
             isSuccessful = installToAutoSlot(plugin);
@@ -387,15 +550,58 @@ bool PluginMgr::install(IPluginMaintenance* plugin, uint8_t slotId)
             isSuccessful = installToSlot(plugin, slotId);
         }
 
-        if (true == isSuccessful)
+        if (false == isSuccessful)
         {
-            TopicHandlerService::getInstance().registerTopics(m_deviceId, plugin);
+            MutexGuard<MutexRecursive> guard(m_mutex);
+
+            (void)removePendingPlugin(plugin);
         }
     }
 
     return isSuccessful;
 }
 
+bool PluginMgr::isPendingPlugin(IPluginMaintenance* plugin)
+{
+    bool                                    isPending   = false;
+    std::vector<PendingPlugin>::iterator    it          = m_pendingPlugins.begin();
+
+    while((m_pendingPlugins.end() != it) && (false == isPending))
+    {
+        if (plugin == it->plugin)
+        {
+            isPending = true;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return isPending;
+}
+
+bool PluginMgr::removePendingPlugin(IPluginMaintenance* plugin)
+{
+    bool                                    isRemoved   = false;
+    std::vector<PendingPlugin>::iterator    it          = m_pendingPlugins.begin();
+
+    while((m_pendingPlugins.end() != it) && (false == isRemoved))
+    {
+        if (plugin == it->plugin)
+        {
+            (void)m_pendingPlugins.erase(it);
+            isRemoved = true;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return isRemoved;
+}
+
 bool PluginMgr::installToAutoSlot(IPluginMaintenance* plugin)
 {
     bool status = false;
@@ -46,8 +46,12 @@
 #include <stdint.h>
 #include "SlotList.h"
 #include "PluginFactory.h"
+#include "BootSnapshot.h"
 
 #include <IPluginMaintenance.hpp>
+#include <Mutex.hpp>
+#include <vector>
+#include <atomic>
 
 /******************************************************************************
  * Macros
@@ -60,6 +64,11 @@
 /**
  * The plugin manager installs a plugin in a display slot and register its web pages.
  * Or uninstalls a plugin and unregister its web pages.
+ *
+ * The plugins are started deferred by the display manager. Their topics are
+ * registered only after they are started, because before the plugin
+ * configuration is not loaded yet. Otherwise a topic access would read or
+ * overwrite the configuration with the default values.
  */
 class PluginMgr
 {
@@ -103,6 +112,21 @@ public:
      */
     bool uninstall(IPluginMaintenance* plugin);
 
+    /**
+     * Register the topics of all installed plugins, which were started in
+     * the meantime. Call it periodically in the same context as the topic
+     * handler service.
+     */
+    void process();
+
+    /**
+     * A plugin was started. Its topics will be registered with the next
+     * process() call. It can be called from any context.
+     *
+     * @param[in] plugin    Started plugin
+     */
+    void onPluginStarted(IPluginMaintenance* plugin);
+
     /**
      * Set the alias name of a plugin.
      * If the plugin has registered a topic handler, the corresponding URIs will be updated.
@@ -135,6 +159,14 @@ public:
      */
     void save();
 
+    /**
+     * All installed plugins are started. After the slot configuration is
+     * loaded, this ends the boot start phase. The boot snapshot is closed
+     * then, even if not every plugin took its configuration from it, e.g.
+     * because its installation failed.
+     */
+    void onAllPluginsStarted();
+
     /**
      * Filename of slot configuration.
      */
@@ -145,16 +177,34 @@ private:
     /** MQTT special characters, which shall not be part of a plugin alias. */
     static const char*  MQTT_SPECIAL_CHARACTERS;
 
-    PluginFactory   m_pluginFactory;    /**< The plugin factory with the plugin type registry. */
-    String          m_deviceId;         /**< Device id, used for topic registration. */
+    /**
+     * An installed plugin, which topics are not registered yet.
+     */
+    struct PendingPlugin
+    {
+        IPluginMaintenance* plugin;     /**< Installed plugin */
+        bool                isStarted;  /**< Is the plugin started? */
+    };
+
+    PluginFactory               m_pluginFactory;    /**< The plugin factory with the plugin type registry. */
+    String                      m_deviceId;         /**< Device id, used for topic registration. */
+    BootSnapshot                m_bootSnapshot;     /**< Boot snapshot of the slot and plugin configuration */
+    std::atomic<bool>           m_isBootStarting;   /**< Are the plugins of the loaded slot configuration not all started yet? */
+    MutexRecursive              m_mutex;            /**< Protects the pending plugins against concurrent access. */
+    std::vector<PendingPlugin>  m_pendingPlugins;   /**< Installed plugins, which topics are not registered yet. */
 
     /**
      * Constructs the plugin manager.
      */
     PluginMgr() :
         m_pluginFactory(),
-        m_deviceId()
+        m_deviceId(),
+        m_bootSnapshot(),
+        m_isBootStarting(false),
+        m_mutex(),
+        m_pendingPlugins()
     {
+        (void)m_mutex.create();
     }
 
     /**
@@ -177,6 +227,13 @@ private:
      */
     void checkJsonDocOverflow(const DynamicJsonDocument& jsonDoc, int line);
 
+    /**
+     * Are all installed plugins started?
+     *
+     * @return If all are started, it will return true otherwise false.
+     */
+    bool areAllPluginsStarted();
+
     /**
      * If configuration directory doesn't exists, it will be created.
      * Otherwise nothing happens.
@@ -202,6 +259,26 @@ private:
      */
     bool install(IPluginMaintenance* plugin, uint8_t slotId);
 
+    /**
+     * Is the plugin pending, which means its topics are not registered yet?
+     * The mutex must be taken!
+     *
+     * @param[in] plugin    Plugin
+     *
+     * @return If the plugin is pending, it will return true otherwise false.
+     */
+    bool isPendingPlugin(IPluginMaintenance* plugin);
+
+    /**
+     * Remove a plugin from the pending plugins.
+     * The mutex must be taken!
+     *
+     * @param[in] plugin    Plugin
+     *
+     * @return If the plugin was pending, it will return true otherwise false.
+     */
+    bool removePendingPlugin(IPluginMaintenance* plugin);
+
     /**
      * Install plugin to any available display slot.
      *
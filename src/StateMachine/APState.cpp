@@ -37,6 +37,7 @@
 #include "SysMsg.h"
 #include "MyWebServer.h"
 #include "CaptivePortal.h"
+#include "WebSocket.h"
 
 #include "ErrorState.h"
 #include "RestartState.h"
@@ -196,6 +197,7 @@ void APState::entry(StateMachine& sm)
 void APState::process(StateMachine& sm)
 {
     m_dnsServer.processNextRequest();
+    WebSocketSrv::getInstance().process();
 
     if (true == CaptivePortal::isRestartRequested())
     {
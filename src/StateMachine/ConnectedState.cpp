@@ -45,6 +45,7 @@
 #include "RestartState.h"
 #include "ErrorState.h"
 #include "HttpStatus.h"
+#include "WebSocket.h"
 
 #include <Arduino.h>
 #include <WiFi.h>
@@ -161,7 +162,9 @@ void ConnectedState::process(StateMachine& sm)
     }
 
     Services::processAll();
+    PluginMgr::getInstance().process();
     SensorDataProvider::getInstance().process();
+    WebSocketSrv::getInstance().process();
 }
 
 void ConnectedState::exit(StateMachine& sm)
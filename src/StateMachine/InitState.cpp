@@ -53,6 +53,8 @@
 #include "WebConfig.h"
 #include "FileSystem.h"
 #include "JsonFile.h"
+#include "JsonDocPool.h"
+#include "PersistentLog.h"
 #include "Version.h"
 #include "Services.h"
 #include "WiFiUtil.h"
@@ -124,6 +126,15 @@ void InitState::entry(StateMachine& sm)
     /* Show as soon as possible the user on the serial console that the system is booting. */
     showStartupInfoOnSerial();
 
+    /* Allocate the pooled JSON documents as early as possible, to get them
+     * from a not fragmented heap. If it fails, the JSON documents will be
+     * allocated on demand.
+     */
+    if (false == JsonDocPool::getInstance().begin())
+    {
+        LOG_WARNING("JSON document pool not available.");
+    }
+
     /* To avoid name clashes, add a unqiue id to some of the default values. */
     WiFiUtil::addDeviceUniqueId(uniqueId);
     settings.getWifiApSSID().setUniqueId(uniqueId);
@@ -175,6 +186,9 @@ void InitState::entry(StateMachine& sm)
     }
     else
     {
+        /* The filesystem is mounted, the persistent log can be written. */
+        PersistentLog::getInstance().enableFlush();
+
         /* Initialize clock driver */
         ClockDrv::getInstance().init(&m_rtcDrv);
 
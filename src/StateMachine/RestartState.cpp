@@ -38,6 +38,8 @@
 #include "UpdateMgr.h"
 #include "FileSystem.h"
 #include "Services.h"
+#include "LogRing.h"
+#include "PersistentLog.h"
 
 #include <Board.h>
 #include <Display.h>
@@ -94,6 +96,9 @@ void RestartState::process(StateMachine& sm)
         UpdateMgr::getInstance().end();
         MDNS.end();
 
+        /* Write the persistent log messages, before the filesystem is unmounted. */
+        PersistentLog::getInstance().end();
+
         /* Unmount filesystem */
         FILESYSTEM.end();
 
@@ -111,6 +116,9 @@ void RestartState::process(StateMachine& sm)
             ;
         }
 
+        /* Forward all pending log messages, before they get lost. */
+        LogRing::getInstance().end();
+
         /* Reset */
         Board::reset();
     }
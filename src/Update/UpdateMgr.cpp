@@ -43,6 +43,7 @@
 #include "MyWebServer.h"
 #include "DisplayMgr.h"
 #include "SysMsg.h"
+#include "PersistentLog.h"
 #include "PluginMgr.h"
 
 #include "TextWidget.h"
@@ -184,6 +185,7 @@ void UpdateMgr::updateProgress(uint8_t progress)
         /* Update display manually. Note, that this must be done to avoid
          * artifacts on the display, caused by long flash write cycles.
          */
+        FrameClock::getInstance().tick();
         Display::getInstance().clear();
         m_progressBar.update(Display::getInstance()); // Draw the progress bar in the background
         m_textWidget.update(Display::getInstance());  // Overlay with the text
@@ -247,6 +249,9 @@ void UpdateMgr::onStart()
     /* Stop webserver, before filesystem may be unmounted. */
     MyWebServer::end();
 
+    /* Stop writing the persistent log to the filesystem during the update. */
+    PersistentLog::getInstance().end();
+
     /* Shall the firmware be updated? */
     if (U_FLASH == ArduinoOTA.getCommand())
     {
@@ -336,6 +341,8 @@ void UpdateMgr::onError(ota_error_t error)
     }
     else
     {
+        PersistentLog::getInstance().enableFlush();
+
         getInstance().endProgress();
 
         /* Reset only if the error happened during update.
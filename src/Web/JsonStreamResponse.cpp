@@ -0,0 +1,322 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Streamed JSON response
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "JsonStreamResponse.h"
+
+#include <Logging.h>
+#include <AllocTracker.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+size_t JsonStreamFragment::write(uint8_t data)
+{
+    return write(&data, 1U);
+}
+
+size_t JsonStreamFragment::write(const uint8_t* buffer, size_t size)
+{
+    size_t written = 0U;
+
+    if (nullptr != buffer)
+    {
+        if (SIZE > m_length)
+        {
+            written = SIZE - m_length;
+
+            if (size < written)
+            {
+                written = size;
+            }
+
+            memcpy(&m_buffer[m_length], buffer, written);
+            m_length += written;
+        }
+
+        /* Carry the remaining bytes over in the spill memory. */
+        if (size > written)
+        {
+            size_t remaining = size - written;
+
+            if (false == reserveSpill(remaining))
+            {
+                m_isOverflow = true;
+            }
+            else
+            {
+                memcpy(&m_spill[m_length - SIZE], &buffer[written], remaining);
+                m_length    += remaining;
+                written     += remaining;
+            }
+        }
+    }
+
+    return written;
+}
+
+void JsonStreamFragment::writeString(const char* str)
+{
+    /* The string is only linked, not copied. Therefore the document is small. */
+    StaticJsonDocument<16U> jsonDoc;
+
+    jsonDoc.set(str);
+    (void)serializeJson(jsonDoc, *this);
+}
+
+void JsonStreamFragment::writeJson(const JsonDocument& jsonDoc)
+{
+    if (true == jsonDoc.overflowed())
+    {
+        LOG_ERROR("JSON document has less memory available.");
+    }
+
+    (void)serializeJson(jsonDoc, *this);
+}
+
+size_t JsonStreamFragment::read(uint8_t* buffer, size_t size)
+{
+    size_t read = 0U;
+
+    if (nullptr != buffer)
+    {
+        while((size > read) && (m_length > m_readIdx))
+        {
+            const uint8_t*  src         = nullptr;
+            size_t          available   = 0U;
+
+            if (SIZE > m_readIdx)
+            {
+                src         = &m_buffer[m_readIdx];
+                available   = ((SIZE < m_length) ? SIZE : m_length) - m_readIdx;
+            }
+            else
+            {
+                src         = &m_spill[m_readIdx - SIZE];
+                available   = m_length - m_readIdx;
+            }
+
+            if ((size - read) < available)
+            {
+                available = size - read;
+            }
+
+            memcpy(&buffer[read], src, available);
+            m_readIdx   += available;
+            read        += available;
+        }
+    }
+
+    return read;
+}
+
+void JsonStreamFragment::clear()
+{
+    if (nullptr != m_spill)
+    {
+        AllocTracker::getInstance().deleteArray(m_spill);
+        m_spill = nullptr;
+    }
+
+    m_spillSize     = 0U;
+    m_length        = 0U;
+    m_readIdx       = 0U;
+    m_isOverflow    = false;
+}
+
+JsonStreamResponse::JsonStreamResponse(AsyncClient* client, JsonStreamSource* source, uint32_t httpStatusCode, bool isChunked) :
+    AsyncAbstractResponse(),
+    m_client(client),
+    m_source(source),
+    m_fragment(),
+    m_isLast(false)
+{
+    _code               = httpStatusCode;
+    _contentType        = "application/json";
+    _contentLength      = 0U;
+    _sendContentLength  = false;
+    _chunked            = isChunked;
+}
+
+JsonStreamResponse::~JsonStreamResponse()
+{
+    if (nullptr != m_source)
+    {
+        delete m_source;
+        m_source = nullptr;
+    }
+}
+
+size_t JsonStreamResponse::_fillBuffer(uint8_t* buffer, size_t maxLen)
+{
+    size_t  written = 0U;
+    bool    isEnd   = false;
+
+    while((maxLen > written) && (false == isEnd))
+    {
+        if (false == m_fragment.isEmpty())
+        {
+            written += m_fragment.read(&buffer[written], maxLen - written);
+        }
+        else if ((true == m_isLast) ||
+                 (nullptr == m_source))
+        {
+            isEnd = true;
+        }
+        else
+        {
+            m_fragment.clear();
+            m_isLast = (false == m_source->next(m_fragment));
+
+            if (true == m_fragment.isOverflow())
+            {
+                LOG_ERROR("JSON stream fragment lost, response aborted.");
+
+                /* The status line is already sent, therefore the only way
+                 * to signal the error is to abort the connection.
+                 */
+                if (nullptr != m_client)
+                {
+                    m_client->close();
+                }
+
+                m_fragment.clear();
+                m_isLast    = true;
+                isEnd       = true;
+            }
+        }
+    }
+
+    return written;
+}
+
+bool JsonStreamResponse::send(AsyncWebServerRequest* request, JsonStreamSource* source, uint32_t httpStatusCode)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != request) &&
+        (nullptr != source))
+    {
+        /* Chunked transfer encoding is supported since HTTP/1.1. */
+        bool                isChunked   = (0U != request->version());
+        JsonStreamResponse* response    = new(std::nothrow) JsonStreamResponse(request->client(), source, httpStatusCode, isChunked);
+
+        if (nullptr == response)
+        {
+            delete source;
+        }
+        else
+        {
+            request->send(response);
+            isSuccessful = true;
+        }
+    }
+    else if (nullptr != source)
+    {
+        delete source;
+    }
+    else
+    {
+        ;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool JsonStreamFragment::reserveSpill(size_t size)
+{
+    bool    isSuccessful    = true;
+    size_t  required        = m_length + size - SIZE;
+
+    if (m_spillSize < required)
+    {
+        /* Grow in steps of the fragment size to avoid frequent reallocations. */
+        size_t      spillSize   = ((required + SIZE - 1U) / SIZE) * SIZE;
+        uint8_t*    spill       = AllocTracker::getInstance().newArray<uint8_t>(AllocTracker::TAG_JSON, spillSize);
+
+        if (nullptr == spill)
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            if (nullptr != m_spill)
+            {
+                memcpy(spill, m_spill, m_length - SIZE);
+                AllocTracker::getInstance().deleteArray(m_spill);
+            }
+
+            m_spill     = spill;
+            m_spillSize = spillSize;
+        }
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,302 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Streamed JSON response
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup web
+ *
+ * @{
+ */
+
+#ifndef JSON_STREAM_RESPONSE_H
+#define JSON_STREAM_RESPONSE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Print.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A fragment of the JSON stream.
+ * The JSON stream source writes its next part into it. A part, which exceeds
+ * the fixed capacity, is carried over in spill memory on the heap, which is
+ * released as soon as the fragment is cleared.
+ */
+class JsonStreamFragment : public Print
+{
+public:
+
+    /**
+     * Constructs an empty fragment.
+     */
+    JsonStreamFragment() :
+        Print(),
+        m_buffer(),
+        m_length(0U),
+        m_readIdx(0U),
+        m_spill(nullptr),
+        m_spillSize(0U),
+        m_isOverflow(false)
+    {
+    }
+
+    /**
+     * Destroys the fragment.
+     */
+    ~JsonStreamFragment()
+    {
+        clear();
+    }
+
+    /**
+     * Write a single byte to the fragment.
+     *
+     * @param[in] data  Byte to write
+     *
+     * @return Number of written bytes.
+     */
+    size_t write(uint8_t data) final;
+
+    /**
+     * Write a buffer to the fragment.
+     *
+     * @param[in] buffer    Buffer to write
+     * @param[in] size      Buffer size in byte
+     *
+     * @return Number of written bytes.
+     */
+    size_t write(const uint8_t* buffer, size_t size) final;
+
+    /**
+     * Write a JSON string value (escaped and quoted) to the fragment.
+     *
+     * @param[in] str   String
+     */
+    void writeString(const char* str);
+
+    /**
+     * Write a JSON document compact serialized to the fragment.
+     *
+     * @param[in] jsonDoc   JSON document
+     */
+    void writeJson(const JsonDocument& jsonDoc);
+
+    /**
+     * Read data from the fragment, which was not read yet.
+     *
+     * @param[out]  buffer  Destination buffer
+     * @param[in]   size    Destination buffer size in byte
+     *
+     * @return Number of read bytes.
+     */
+    size_t read(uint8_t* buffer, size_t size);
+
+    /**
+     * Is the whole fragment read?
+     *
+     * @return If completely read, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return (m_readIdx >= m_length);
+    }
+
+    /**
+     * Is the fragment overflowed, because the spill memory for the data,
+     * which exceeds the fixed capacity, could not be allocated?
+     *
+     * @return If overflowed, it will return true otherwise false.
+     */
+    bool isOverflow() const
+    {
+        return m_isOverflow;
+    }
+
+    /**
+     * Clear the fragment and release the spill memory.
+     */
+    void clear();
+
+    /** Fixed fragment capacity in byte. */
+    static const size_t SIZE    = 512U;
+
+private:
+
+    uint8_t     m_buffer[SIZE]; /**< Fragment buffer */
+    size_t      m_length;       /**< Number of written bytes, including the spilled ones */
+    size_t      m_readIdx;      /**< Read index */
+    uint8_t*    m_spill;        /**< Spill memory for the bytes, which exceed the fragment buffer */
+    size_t      m_spillSize;    /**< Spill memory size in byte */
+    bool        m_isOverflow;   /**< Overflow flag */
+
+    JsonStreamFragment(const JsonStreamFragment& fragment);
+    JsonStreamFragment& operator=(const JsonStreamFragment& fragment);
+
+    /**
+     * Ensure that the spill memory can take the given number of bytes
+     * additionally.
+     *
+     * @param[in] size  Number of additional bytes
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool reserveSpill(size_t size);
+};
+
+/**
+ * Source of a JSON stream. It provides the JSON response fragment by fragment,
+ * e.g. one fragment per array element. This way the whole JSON response is
+ * never in memory at once.
+ */
+class JsonStreamSource
+{
+public:
+
+    /**
+     * Destroys the JSON stream source.
+     */
+    virtual ~JsonStreamSource()
+    {
+    }
+
+    /**
+     * Write the next fragment of the JSON response.
+     * Note, a fragment which exceeds the JsonStreamFragment::SIZE costs
+     * additional heap memory.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more fragments will follow, it will return true otherwise false.
+     */
+    virtual bool next(JsonStreamFragment& fragment) = 0;
+
+protected:
+
+    /**
+     * Constructs the JSON stream source.
+     */
+    JsonStreamSource()
+    {
+    }
+};
+
+/**
+ * Streamed JSON response, which serializes the JSON response incremental from
+ * the JSON stream source into the TCP send buffer. If the client supports HTTP/1.1
+ * the response is sent chunked, otherwise the connection is closed after the
+ * last byte.
+ */
+class JsonStreamResponse : public AsyncAbstractResponse
+{
+public:
+
+    /**
+     * Constructs the streamed JSON response.
+     * The response takes the ownership of the source.
+     *
+     * @param[in] client            Client connection, used to abort the response.
+     * @param[in] source            JSON stream source
+     * @param[in] httpStatusCode    HTTP status code
+     * @param[in] isChunked         Use chunked transfer encoding or not
+     */
+    JsonStreamResponse(AsyncClient* client, JsonStreamSource* source, uint32_t httpStatusCode, bool isChunked);
+
+    /**
+     * Destroys the streamed JSON response and its source.
+     */
+    ~JsonStreamResponse();
+
+    /**
+     * Is the source valid?
+     *
+     * @return If valid, it will return true otherwise false.
+     */
+    bool _sourceValid() const final
+    {
+        return (nullptr != m_source);
+    }
+
+    /**
+     * Fill the buffer with the next part of the JSON response.
+     *
+     * @param[out]  buffer  Buffer to fill
+     * @param[in]   maxLen  Buffer size in byte
+     *
+     * @return Number of bytes in the buffer. If 0, the response is complete.
+     *          If a fragment is lost, the connection is closed, because
+     *          the client would receive invalid JSON otherwise.
+     */
+    size_t _fillBuffer(uint8_t* buffer, size_t maxLen) final;
+
+    /**
+     * Send a streamed JSON response to the client.
+     * The response takes the ownership of the source, it will be destroyed
+     * after the response is complete.
+     *
+     * @param[in] request           Client request
+     * @param[in] source            JSON stream source
+     * @param[in] httpStatusCode    HTTP status code
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    static bool send(AsyncWebServerRequest* request, JsonStreamSource* source, uint32_t httpStatusCode);
+
+private:
+
+    AsyncClient*        m_client;       /**< Client connection */
+    JsonStreamSource*   m_source;       /**< JSON stream source */
+    JsonStreamFragment  m_fragment;     /**< Current fragment */
+    bool                m_isLast;       /**< Is the current fragment the last one? */
+
+    JsonStreamResponse();
+    JsonStreamResponse(const JsonStreamResponse& rsp);
+    JsonStreamResponse& operator=(const JsonStreamResponse& rsp);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* JSON_STREAM_RESPONSE_H */
+
+/** @} */
@@ -43,6 +43,12 @@
 #include "RestUtil.h"
 #include "SlotList.h"
 #include "ButtonActions.h"
+#include "JsonStreamResponse.h"
+#include "PersistentLog.h"
+#include "TaskMon.h"
+#include "MemMon.h"
+#include "WebSocket.h"
+#include "WebConfig.h"
 
 #include <Util.h>
 #include <WiFi.h>
@@ -51,6 +57,11 @@
 #include <Logging.h>
 #include <SensorDataProvider.h>
 #include <SettingsService.h>
+#include <PluginConfigNotifier.h>
+#include <Profiler.hpp>
+#include <AllocTracker.h>
+#include <ObjectPool.hpp>
+#include <CanvasPool.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -108,6 +119,1295 @@ private:
 
 };
 
+/**
+ * Base class for the streamed REST API responses. Every response contains
+ * the data and the status. The data part is provided fragment by fragment
+ * by the derived class.
+ */
+class RestApiJsonSource : public JsonStreamSource
+{
+public:
+
+    /**
+     * Destroys the REST API JSON source.
+     */
+    virtual ~RestApiJsonSource()
+    {
+    }
+
+    /**
+     * Write the next fragment of the JSON response.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more fragments will follow, it will return true otherwise false.
+     */
+    bool next(JsonStreamFragment& fragment) final
+    {
+        bool isPending = true;
+
+        switch(m_phase)
+        {
+        case PHASE_BEGIN:
+            fragment.print("{\"data\":");
+            m_phase = PHASE_DATA;
+            break;
+
+        case PHASE_DATA:
+            if (false == nextData(fragment))
+            {
+                m_phase = PHASE_END;
+            }
+            break;
+
+        case PHASE_END:
+            /* fallthrough */
+        default:
+            fragment.print(",\"status\":\"ok\"}");
+            isPending = false;
+            break;
+        }
+
+        return isPending;
+    }
+
+protected:
+
+    /**
+     * Constructs the REST API JSON source.
+     */
+    RestApiJsonSource() :
+        JsonStreamSource(),
+        m_phase(PHASE_BEGIN)
+    {
+    }
+
+    /**
+     * Write the next fragment of the data part.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more data fragments will follow, it will return true otherwise false.
+     */
+    virtual bool nextData(JsonStreamFragment& fragment) = 0;
+
+private:
+
+    /**
+     * Response phases.
+     */
+    enum Phase
+    {
+        PHASE_BEGIN = 0,    /**< Begin of the response */
+        PHASE_DATA,         /**< Data part */
+        PHASE_END           /**< End of the response */
+    };
+
+    Phase   m_phase;    /**< Current response phase */
+};
+
+/**
+ * Streamed response of the slots request.
+ */
+class SlotsJsonSource : public RestApiJsonSource
+{
+public:
+
+    /**
+     * Constructs the slots JSON source.
+     */
+    SlotsJsonSource() :
+        RestApiJsonSource(),
+        m_slotId(0U),
+        m_isBegin(true)
+    {
+    }
+
+    /**
+     * Destroys the slots JSON source.
+     */
+    ~SlotsJsonSource()
+    {
+    }
+
+private:
+
+    uint8_t m_slotId;   /**< Id of the next slot */
+    bool    m_isBegin;  /**< Is data part begin? */
+
+    /**
+     * Write the next fragment of the data part.
+     * One fragment per slot.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more data fragments will follow, it will return true otherwise false.
+     */
+    bool nextData(JsonStreamFragment& fragment) final
+    {
+        bool        isPending   = true;
+        DisplayMgr& displayMgr  = DisplayMgr::getInstance();
+
+        if (true == m_isBegin)
+        {
+            fragment.print("{\"maxSlots\":");
+            fragment.print(displayMgr.getMaxSlots());
+            fragment.print(",\"slots\":[");
+
+            m_isBegin = false;
+        }
+        else if (displayMgr.getMaxSlots() <= m_slotId)
+        {
+            fragment.print("]}");
+            isPending = false;
+        }
+        else
+        {
+            const size_t                        JSON_DOC_SIZE   = 256U;
+            StaticJsonDocument<JSON_DOC_SIZE>   jsonDoc;
+            IPluginMaintenance*                 plugin          = displayMgr.getPluginInSlot(m_slotId);
+
+            if (nullptr == plugin)
+            {
+                jsonDoc["name"]     = "";
+                jsonDoc["uid"]      = 0U;
+                jsonDoc["alias"]    = "";
+            }
+            else
+            {
+                jsonDoc["name"]     = plugin->getName();
+                jsonDoc["uid"]      = plugin->getUID();
+                jsonDoc["alias"]    = plugin->getAlias();
+            }
+
+            jsonDoc["isSticky"]         = (displayMgr.getStickySlot() == m_slotId);
+            jsonDoc["isLocked"]         = displayMgr.isSlotLocked(m_slotId);
+            jsonDoc["duration"]         = displayMgr.getSlotDuration(m_slotId);
+            jsonDoc["isStarted"]        = displayMgr.isPluginStarted(m_slotId);
+            jsonDoc["startDuration"]    = displayMgr.getPluginStartDuration(m_slotId);
+
+            if (0U < m_slotId)
+            {
+                fragment.print(",");
+            }
+
+            fragment.writeJson(jsonDoc);
+
+            ++m_slotId;
+        }
+
+        return isPending;
+    }
+
+    SlotsJsonSource(const SlotsJsonSource& source);
+    SlotsJsonSource& operator=(const SlotsJsonSource& source);
+};
+
+/**
+ * Streamed response of the plugins request.
+ */
+class PluginsJsonSource : public RestApiJsonSource
+{
+public:
+
+    /**
+     * Constructs the plugins JSON source.
+     */
+    PluginsJsonSource() :
+        RestApiJsonSource(),
+        m_idx(0U),
+        m_isBegin(true)
+    {
+    }
+
+    /**
+     * Destroys the plugins JSON source.
+     */
+    ~PluginsJsonSource()
+    {
+    }
+
+private:
+
+    uint8_t m_idx;      /**< Index of the next plugin type */
+    bool    m_isBegin;  /**< Is data part begin? */
+
+    /**
+     * Write the next fragment of the data part.
+     * One fragment per plugin type.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more data fragments will follow, it will return true otherwise false.
+     */
+    bool nextData(JsonStreamFragment& fragment) final
+    {
+        bool                        isPending               = true;
+        uint8_t                     pluginTypeListLength    = 0U;
+        const PluginList::Element*  pluginTypeList          = PluginList::getList(pluginTypeListLength);
+
+        if (true == m_isBegin)
+        {
+            fragment.print("{\"plugins\":[");
+            m_isBegin = false;
+        }
+        else if (pluginTypeListLength <= m_idx)
+        {
+            fragment.print("]}");
+            isPending = false;
+        }
+        else
+        {
+            if (0U < m_idx)
+            {
+                fragment.print(",");
+            }
+
+            fragment.writeString(pluginTypeList[m_idx].name);
+
+            ++m_idx;
+        }
+
+        return isPending;
+    }
+
+    PluginsJsonSource(const PluginsJsonSource& source);
+    PluginsJsonSource& operator=(const PluginsJsonSource& source);
+};
+
+/**
+ * Streamed response of the settings request.
+ */
+class SettingsJsonSource : public RestApiJsonSource
+{
+public:
+
+    /**
+     * Constructs the settings JSON source.
+     */
+    SettingsJsonSource() :
+        RestApiJsonSource(),
+        m_idx(0U),
+        m_isBegin(true),
+        m_isFirst(true)
+    {
+    }
+
+    /**
+     * Destroys the settings JSON source.
+     */
+    ~SettingsJsonSource()
+    {
+    }
+
+private:
+
+    size_t  m_idx;      /**< Index of the next setting */
+    bool    m_isBegin;  /**< Is data part begin? */
+    bool    m_isFirst;  /**< Is first setting key? */
+
+    /**
+     * Write the next fragment of the data part.
+     * One fragment per setting key.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more data fragments will follow, it will return true otherwise false.
+     */
+    bool nextData(JsonStreamFragment& fragment) final
+    {
+        bool        isPending       = true;
+        size_t      settingsCount   = 0U;
+        KeyValue**  settings        = SettingsService::getInstance().getList(settingsCount);
+
+        if (true == m_isBegin)
+        {
+            fragment.print("{\"settings\":[");
+            m_isBegin = false;
+        }
+        else if (settingsCount <= m_idx)
+        {
+            fragment.print("]}");
+            isPending = false;
+        }
+        else
+        {
+            KeyValue* setting = settings[m_idx];
+
+            if (nullptr != setting)
+            {
+                if (false == m_isFirst)
+                {
+                    fragment.print(",");
+                }
+
+                fragment.writeString(setting->getKey());
+                m_isFirst = false;
+            }
+
+            ++m_idx;
+        }
+
+        return isPending;
+    }
+
+    SettingsJsonSource(const SettingsJsonSource& source);
+    SettingsJsonSource& operator=(const SettingsJsonSource& source);
+};
+
+/**
+ * Streamed response of the status request.
+ */
+class StatusJsonSource : public RestApiJsonSource
+{
+public:
+
+    /**
+     * Constructs the status JSON source.
+     */
+    StatusJsonSource() :
+        RestApiJsonSource(),
+        m_part(PART_HARDWARE),
+        m_clientIdx(0U),
+        m_isFirstClient(true)
+    {
+    }
+
+    /**
+     * Destroys the status JSON source.
+     */
+    ~StatusJsonSource()
+    {
+    }
+
+private:
+
+    /**
+     * The parts of the status.
+     */
+    enum Part
+    {
+        PART_HARDWARE = 0,  /**< Hardware information */
+        PART_SOFTWARE,      /**< Software information */
+        PART_WIFI,          /**< Wifi information */
+        PART_WEBSOCKET      /**< Websocket client statistics */
+    };
+
+    Part    m_part;             /**< Next part of the status */
+    uint8_t m_clientIdx;        /**< Index of the next websocket client */
+    bool    m_isFirstClient;    /**< Is the next websocket client the first one in the list? */
+
+    /**
+     * Write the next fragment of the data part.
+     * One fragment per status part and one per websocket client.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more data fragments will follow, it will return true otherwise false.
+     */
+    bool nextData(JsonStreamFragment& fragment) final
+    {
+        bool                                isPending       = true;
+        const size_t                        JSON_DOC_SIZE   = 256U;
+        StaticJsonDocument<JSON_DOC_SIZE>   jsonDoc;
+
+        switch(m_part)
+        {
+        case PART_HARDWARE:
+            jsonDoc["chipRev"]      = ESP.getChipRevision();
+            jsonDoc["cpuFreqMhz"]   = ESP.getCpuFreqMHz();
+
+            fragment.print("{\"hardware\":");
+            fragment.writeJson(jsonDoc);
+
+            m_part = PART_SOFTWARE;
+            break;
+
+        case PART_SOFTWARE:
+            {
+                JsonObject internalRamObj = jsonDoc.createNestedObject("internalRam");
+
+                jsonDoc["version"]              = Version::SOFTWARE_VER;
+                jsonDoc["revision"]             = Version::SOFTWARE_REV;
+                jsonDoc["espSdkVersion"]        = ESP.getSdkVersion();
+
+                internalRamObj["heapSize"]      = ESP.getHeapSize();
+                internalRamObj["availableHeap"] = ESP.getFreeHeap();
+
+                fragment.print(",\"software\":");
+                fragment.writeJson(jsonDoc);
+
+                m_part = PART_WIFI;
+            }
+            break;
+
+        case PART_WIFI:
+            {
+                String              ssid;
+                int8_t              rssi        = -100; // dbm
+                SettingsService&    settings    = SettingsService::getInstance();
+
+                /* Only in station mode it makes sense to retrieve the RSSI.
+                 * Otherwise keep it -100 dbm.
+                 */
+                if (WIFI_MODE_STA == WiFi.getMode())
+                {
+                    rssi = WiFi.RSSI();
+                }
+
+                if (true == settings.open(true))
+                {
+                    ssid = settings.getWifiSSID().getValue();
+                    settings.close();
+                }
+
+                jsonDoc["ssid"]     = ssid;
+                jsonDoc["rssi"]     = rssi;                             // dBm
+                jsonDoc["quality"]  = WiFiUtil::getSignalQuality(rssi); // percent
+
+                fragment.print(",\"wifi\":");
+                fragment.writeJson(jsonDoc);
+                fragment.print(",\"websocket\":[");
+
+                m_part = PART_WEBSOCKET;
+            }
+            break;
+
+        case PART_WEBSOCKET:
+            /* fallthrough */
+        default:
+            if (WebConfig::WEBSOCKET_MAX_CLIENTS <= m_clientIdx)
+            {
+                fragment.print("]}");
+
+                isPending = false;
+            }
+            else
+            {
+                WebSocketSrv::ClientStatistics stats;
+
+                if (true == WebSocketSrv::getInstance().getClientStatistics(m_clientIdx, stats))
+                {
+                    jsonDoc["id"]           = stats.id;
+                    jsonDoc["sent"]         = stats.sent;
+                    jsonDoc["dropped"]      = stats.dropped;
+                    jsonDoc["isCongested"]  = stats.isCongested;
+
+                    if (false == m_isFirstClient)
+                    {
+                        fragment.print(",");
+                    }
+
+                    fragment.writeJson(jsonDoc);
+
+                    m_isFirstClient = false;
+                }
+
+                ++m_clientIdx;
+            }
+            break;
+        }
+
+        return isPending;
+    }
+
+    StatusJsonSource(const StatusJsonSource& source);
+    StatusJsonSource& operator=(const StatusJsonSource& source);
+};
+
+/**
+ * Streamed response of the filesystem directory listing request.
+ * The directory is iterated while the response is sent, therefore
+ * the directory stays open until the response is complete.
+ */
+class FilesystemJsonSource : public JsonStreamSource
+{
+public:
+
+    /**
+     * Constructs the filesystem JSON source.
+     *
+     * @param[in] path      Path of the directory
+     * @param[in] preCount  Number of files/directories which to skip
+     * @param[in] count     Max. number of files/directories which to list
+     */
+    FilesystemJsonSource(const String& path, uint32_t preCount, uint32_t count) :
+        JsonStreamSource(),
+        m_dir(FILESYSTEM.open(path, "r")),
+        m_preCount(preCount),
+        m_count(count),
+        m_isBegin(true),
+        m_isFirst(true)
+    {
+        if (false == m_dir)
+        {
+            LOG_WARNING("Invalid path.");
+        }
+        else if (false == m_dir.isDirectory())
+        {
+            LOG_WARNING("Requested path is not a directory.");
+            m_dir.close();
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    /**
+     * Destroys the filesystem JSON source.
+     */
+    ~FilesystemJsonSource()
+    {
+        if (true == m_dir)
+        {
+            m_dir.close();
+        }
+    }
+
+    /**
+     * Write the next fragment of the JSON response.
+     * One fragment per file/directory.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more fragments will follow, it will return true otherwise false.
+     */
+    bool next(JsonStreamFragment& fragment) final
+    {
+        bool isPending = true;
+
+        if (true == m_isBegin)
+        {
+            fragment.print("{\"data\":[");
+            m_isBegin = false;
+        }
+        else
+        {
+            File fd;
+
+            if ((true == m_dir) &&
+                (0U < m_count))
+            {
+                fd = m_dir.openNextFile();
+
+                /* Skip the first number of files. */
+                while((true == fd) && (0U < m_preCount))
+                {
+                    --m_preCount;
+                    fd.close();
+                    fd = m_dir.openNextFile();
+                }
+            }
+
+            if (false == fd)
+            {
+                fragment.print("],\"status\":\"ok\"}");
+                isPending = false;
+            }
+            else
+            {
+                const size_t                        JSON_DOC_SIZE   = 128U;
+                StaticJsonDocument<JSON_DOC_SIZE>   jsonDoc;
+                const char*                         path            = fd.path();
+
+                /* The path is linked only, which is fine, because the
+                 * file descriptor is closed after serialization.
+                 */
+                jsonDoc["name"] = path;
+                jsonDoc["size"] = fd.size();
+                jsonDoc["type"] = (true == fd.isDirectory()) ? "dir" : "file";
+
+                if (false == m_isFirst)
+                {
+                    fragment.print(",");
+                }
+
+                fragment.writeJson(jsonDoc);
+                fd.close();
+
+                m_isFirst = false;
+                --m_count;
+            }
+        }
+
+        return isPending;
+    }
+
+private:
+
+    File        m_dir;      /**< Directory which is listed */
+    uint32_t    m_preCount; /**< Number of files/directories which still to skip */
+    uint32_t    m_count;    /**< Number of files/directories which still to list */
+    bool        m_isBegin;  /**< Is response begin? */
+    bool        m_isFirst;  /**< Is first file/directory? */
+
+    FilesystemJsonSource();
+    FilesystemJsonSource(const FilesystemJsonSource& source);
+    FilesystemJsonSource& operator=(const FilesystemJsonSource& source);
+};
+
+/**
+ * Provides the decoded persistent log as JSON stream.
+ * The entries are read from the rotated log file, the current log file and
+ * at last the pending entries in the RTC memory, which are not flushed yet.
+ */
+class PersistentLogJsonSource : public JsonStreamSource
+{
+public:
+
+    /**
+     * Constructs the persistent log JSON source.
+     */
+    PersistentLogJsonSource() :
+        JsonStreamSource(),
+        m_phase(PHASE_BEGIN),
+        m_fd(),
+        m_pendingIdx(0U),
+        m_isFirst(true)
+    {
+    }
+
+    /**
+     * Destroys the persistent log JSON source.
+     */
+    ~PersistentLogJsonSource()
+    {
+        if (true == m_fd)
+        {
+            m_fd.close();
+        }
+    }
+
+    /**
+     * Write the next fragment of the JSON response.
+     * One fragment per log entry.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more fragments will follow, it will return true otherwise false.
+     */
+    bool next(JsonStreamFragment& fragment) final
+    {
+        bool                    isPending   = true;
+        bool                    isAvailable = false;
+        PersistentLog::Entry    entry;
+
+        while((false == isAvailable) && (true == isPending))
+        {
+            switch(m_phase)
+            {
+            case PHASE_BEGIN:
+                fragment.print("{\"data\":[");
+                openFile(PersistentLog::FILE_NAME_OLD);
+                m_phase = PHASE_FILE_OLD;
+                break;
+
+            case PHASE_FILE_OLD:
+                isAvailable = readFile(entry);
+
+                if (false == isAvailable)
+                {
+                    openFile(PersistentLog::FILE_NAME);
+                    m_phase = PHASE_FILE;
+                }
+                break;
+
+            case PHASE_FILE:
+                isAvailable = readFile(entry);
+
+                if (false == isAvailable)
+                {
+                    m_phase = PHASE_RTC;
+                }
+                break;
+
+            case PHASE_RTC:
+                isAvailable = PersistentLog::getInstance().getPendingEntry(m_pendingIdx, entry);
+
+                if (false == isAvailable)
+                {
+                    m_phase = PHASE_END;
+                }
+                else
+                {
+                    ++m_pendingIdx;
+                }
+                break;
+
+            case PHASE_END:
+                /* fallthrough */
+            default:
+                fragment.print("],\"status\":\"ok\"}");
+                isPending = false;
+                break;
+            }
+        }
+
+        if (true == isAvailable)
+        {
+            if (false == m_isFirst)
+            {
+                fragment.print(",");
+            }
+
+            writeEntry(fragment, entry);
+            m_isFirst = false;
+        }
+
+        return isPending;
+    }
+
+private:
+
+    /**
+     * Phases of the JSON stream.
+     */
+    enum Phase
+    {
+        PHASE_BEGIN = 0,    /**< Begin of the response */
+        PHASE_FILE_OLD,     /**< Entries of the rotated log file */
+        PHASE_FILE,         /**< Entries of the current log file */
+        PHASE_RTC,          /**< Pending entries in the RTC memory */
+        PHASE_END           /**< End of the response */
+    };
+
+    Phase       m_phase;        /**< Current phase */
+    File        m_fd;           /**< Current log file */
+    uint32_t    m_pendingIdx;   /**< Index of the next pending entry */
+    bool        m_isFirst;      /**< Is first entry? */
+
+    PersistentLogJsonSource(const PersistentLogJsonSource& source);
+    PersistentLogJsonSource& operator=(const PersistentLogJsonSource& source);
+
+    /**
+     * Open a log file. A previous opened file is closed.
+     *
+     * @param[in] fileName  Full path of the log file
+     */
+    void openFile(const char* fileName)
+    {
+        if (true == m_fd)
+        {
+            m_fd.close();
+        }
+
+        if (true == FILESYSTEM.exists(fileName))
+        {
+            m_fd = FILESYSTEM.open(fileName, "r");
+        }
+    }
+
+    /**
+     * Read the next entry from the current log file.
+     *
+     * @param[out] entry    Entry
+     *
+     * @return If an entry is available, it will return true otherwise false.
+     */
+    bool readFile(PersistentLog::Entry& entry)
+    {
+        bool isAvailable = false;
+
+        if (true == m_fd)
+        {
+            void*       vEntry  = &entry;
+            uint8_t*    data    = static_cast<uint8_t*>(vEntry);
+
+            if (sizeof(entry) == m_fd.read(data, sizeof(entry)))
+            {
+                isAvailable = true;
+            }
+            else
+            {
+                m_fd.close();
+            }
+        }
+
+        return isAvailable;
+    }
+
+    /**
+     * Write the decoded entry to the fragment.
+     *
+     * @param[out]  fragment    Fragment where to write to.
+     * @param[in]   entry       Entry
+     */
+    void writeEntry(JsonStreamFragment& fragment, const PersistentLog::Entry& entry)
+    {
+        const size_t                        JSON_DOC_SIZE   = 256U;
+        StaticJsonDocument<JSON_DOC_SIZE>   jsonDoc;
+        const char*                         LEVELS[]        = { "FATAL", "ERROR", "WARNING", "INFO", "DEBUG", "TRACE" };
+
+        jsonDoc["ts"] = entry.timestamp;
+
+        if (PersistentLog::LEVEL_BOOT == entry.level)
+        {
+            jsonDoc["level"]        = "BOOT";
+            jsonDoc["resetReason"]  = entry.line;
+        }
+        else
+        {
+            const char* fileName = PersistentLog::getInstance().getFileName(entry.fileId);
+            size_t      length   = entry.length;
+
+            if (UTIL_ARRAY_NUM(LEVELS) > entry.level)
+            {
+                jsonDoc["level"] = LEVELS[entry.level];
+            }
+            else
+            {
+                jsonDoc["level"] = entry.level;
+            }
+
+            /* Filenames are only known, if they issued a log message since boot. */
+            if (nullptr != fileName)
+            {
+                jsonDoc["file"] = fileName;
+            }
+            else
+            {
+                jsonDoc["file"] = String("#") + Util::uint32ToHex(entry.fileId);
+            }
+
+            jsonDoc["line"] = entry.line;
+
+            if (PersistentLog::PAYLOAD_SIZE < length)
+            {
+                length = PersistentLog::PAYLOAD_SIZE;
+            }
+
+            /* The payload is not terminated. */
+            jsonDoc["msg"] = String(entry.payload, length);
+        }
+
+        fragment.writeJson(jsonDoc);
+    }
+};
+
+/**
+ * Streamed response of the profiler request.
+ * All durations are in us.
+ */
+class ProfilerJsonSource : public RestApiJsonSource
+{
+public:
+
+    /**
+     * Constructs the profiler JSON source.
+     * The task properties are taken from the last task monitor sample.
+     */
+    ProfilerJsonSource() :
+        RestApiJsonSource(),
+        m_part(PART_FRAME),
+        m_tasks(),
+        m_taskCnt(0U),
+        m_idx(0U),
+        m_isSlotWritten(false)
+    {
+        m_taskCnt = TaskMon::getInstance().getTasks(m_tasks, TaskMon::MAX_TASKS);
+    }
+
+    /**
+     * Destroys the profiler JSON source.
+     */
+    ~ProfilerJsonSource()
+    {
+    }
+
+private:
+
+    /**
+     * The parts of the profiler response.
+     */
+    enum Part
+    {
+        PART_FRAME = 0,     /**< Bucket limits and display refresh */
+        PART_NETWORK,       /**< Network communication */
+        PART_TASKS,         /**< Task properties */
+        PART_SLOTS,         /**< Plugin durations per slot */
+        PART_END            /**< End of data */
+    };
+
+    Part                m_part;                         /**< Next part of the response */
+    TaskMon::TaskInfo   m_tasks[TaskMon::MAX_TASKS];    /**< Task properties */
+    uint8_t             m_taskCnt;                      /**< Number of tasks */
+    uint8_t             m_idx;                          /**< Index of the next task or slot */
+    bool                m_isSlotWritten;                /**< Is any slot already written? */
+
+    /**
+     * Write the next fragment of the data part.
+     * One fragment per part, task and slot.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more data fragments will follow, it will return true otherwise false.
+     */
+    bool nextData(JsonStreamFragment& fragment) final
+    {
+        bool                                isPending       = true;
+        const size_t                        JSON_DOC_SIZE   = 768U;
+        StaticJsonDocument<JSON_DOC_SIZE>   jsonDoc;
+        Profiler&                           profiler        = Profiler::getInstance();
+
+        switch(m_part)
+        {
+        case PART_FRAME:
+            {
+                uint8_t idx = 0U;
+
+                /* The last bucket has no upper limit. */
+                fragment.print("{\"bucketLimits\":[");
+                for(idx = 0U; idx < (DurationHistogram::BUCKET_COUNT - 1U); ++idx)
+                {
+                    if (0U < idx)
+                    {
+                        fragment.print(",");
+                    }
+
+                    fragment.print(DurationHistogram::getBucketLimit(idx));
+                }
+                fragment.print("]");
+
+                histogramToJson(profiler.getFramePeriod(), jsonDoc.createNestedObject("period"));
+                histogramToJson(profiler.getFrameJitter(), jsonDoc.createNestedObject("jitter"));
+
+                fragment.print(",\"frame\":");
+                fragment.writeJson(jsonDoc);
+
+                m_part = PART_NETWORK;
+            }
+            break;
+
+        case PART_NETWORK:
+            histogramToJson(profiler.getHttpClientQueue(), jsonDoc.createNestedObject("httpClientQueue"));
+            histogramToJson(profiler.getMqttDispatch(), jsonDoc.createNestedObject("mqttDispatch"));
+
+            fragment.print(",\"network\":");
+            fragment.writeJson(jsonDoc);
+            fragment.print(",\"isLoadAvailable\":");
+            fragment.print((true == TaskMon::getInstance().isLoadAvailable()) ? "true" : "false");
+            fragment.print(",\"tasks\":[");
+
+            m_part = PART_TASKS;
+            break;
+
+        case PART_TASKS:
+            if (m_taskCnt <= m_idx)
+            {
+                fragment.print("],\"slots\":[");
+
+                m_part  = PART_SLOTS;
+                m_idx   = 0U;
+            }
+            else
+            {
+                const TaskMon::TaskInfo& task = m_tasks[m_idx];
+
+                jsonDoc["name"]                 = task.name;
+                jsonDoc["coreId"]               = task.coreId;
+                jsonDoc["priority"]             = task.priority;
+                jsonDoc["state"]                = TaskMon::taskState2Str(task.state);
+                jsonDoc["load"]                 = task.load;
+                jsonDoc["stackHighWaterMark"]   = task.stackHighWaterMark;
+
+                if (0U < m_idx)
+                {
+                    fragment.print(",");
+                }
+
+                fragment.writeJson(jsonDoc);
+
+                ++m_idx;
+            }
+            break;
+
+        case PART_SLOTS:
+            nextSlot(fragment, jsonDoc);
+            break;
+
+        case PART_END:
+            /* fallthrough */
+        default:
+            fragment.print("]}");
+            isPending = false;
+            break;
+        }
+
+        return isPending;
+    }
+
+    /**
+     * Write the plugin durations of the next non-empty slot.
+     * If there are no more slots, the part will be finished.
+     *
+     * @param[out] fragment Fragment where to write to.
+     * @param[in]  jsonDoc  Empty JSON document, used for serialization.
+     */
+    void nextSlot(JsonStreamFragment& fragment, JsonDocument& jsonDoc)
+    {
+        DisplayMgr&         displayMgr  = DisplayMgr::getInstance();
+        Profiler&           profiler    = Profiler::getInstance();
+        IPluginMaintenance* plugin      = nullptr;
+        uint8_t             maxSlots    = displayMgr.getMaxSlots();
+
+        if (Profiler::MAX_SLOTS < maxSlots)
+        {
+            maxSlots = Profiler::MAX_SLOTS;
+        }
+
+        /* Skip empty slots. */
+        while((maxSlots > m_idx) && (nullptr == plugin))
+        {
+            plugin = displayMgr.getPluginInSlot(m_idx);
+
+            if (nullptr == plugin)
+            {
+                ++m_idx;
+            }
+        }
+
+        if (nullptr == plugin)
+        {
+            m_part = PART_END;
+        }
+        else
+        {
+            jsonDoc["slotId"]   = m_idx;
+            jsonDoc["name"]     = plugin->getName();
+            jsonDoc["uid"]      = plugin->getUID();
+
+            histogramToJson(*profiler.getPluginProcess(m_idx), jsonDoc.createNestedObject("process"));
+            histogramToJson(*profiler.getPluginUpdate(m_idx), jsonDoc.createNestedObject("update"));
+
+            if (true == m_isSlotWritten)
+            {
+                fragment.print(",");
+            }
+
+            fragment.writeJson(jsonDoc);
+
+            m_isSlotWritten = true;
+            ++m_idx;
+        }
+    }
+
+    /**
+     * Write the counters of a duration histogram to a JSON object.
+     *
+     * @param[in]   histogram   Duration histogram
+     * @param[out]  jsonObj     JSON object
+     */
+    static void histogramToJson(const DurationHistogram& histogram, JsonObject jsonObj)
+    {
+        JsonArray   jsonBuckets = jsonObj.createNestedArray("buckets");
+        uint8_t     idx         = 0U;
+
+        jsonObj["count"]    = histogram.getCount();
+        jsonObj["sum"]      = histogram.getSum();
+        jsonObj["max"]      = histogram.getMax();
+
+        for(idx = 0U; idx < DurationHistogram::BUCKET_COUNT; ++idx)
+        {
+            (void)jsonBuckets.add(histogram.getBucket(idx));
+        }
+    }
+
+    ProfilerJsonSource(const ProfilerJsonSource& source);
+    ProfilerJsonSource& operator=(const ProfilerJsonSource& source);
+};
+
+/**
+ * Streamed response of the memory request.
+ */
+class MemoryJsonSource : public RestApiJsonSource
+{
+public:
+
+    /**
+     * Constructs the memory JSON source.
+     */
+    MemoryJsonSource() :
+        RestApiJsonSource(),
+        m_part(PART_HEAP),
+        m_tagIdx(0U),
+        m_pool(ObjectPoolBase::getFirst()),
+        m_bucketIdx(0U)
+    {
+    }
+
+    /**
+     * Destroys the memory JSON source.
+     */
+    ~MemoryJsonSource()
+    {
+    }
+
+private:
+
+    /**
+     * The parts of the memory response.
+     */
+    enum Part
+    {
+        PART_HEAP = 0,  /**< Heap and fragmentation */
+        PART_TAGS,      /**< Heap usage per allocation tracker tag */
+        PART_POOLS,     /**< Object pool occupancy */
+        PART_CANVASES,  /**< Canvas pool occupancy per bucket */
+        PART_END        /**< End of data */
+    };
+
+    Part                    m_part;         /**< Next part of the response */
+    uint8_t                 m_tagIdx;       /**< Index of the next allocation tracker tag */
+    const ObjectPoolBase*   m_pool;         /**< Next object pool */
+    uint8_t                 m_bucketIdx;    /**< Index of the next canvas pool bucket */
+
+    /**
+     * Write the next fragment of the data part.
+     * One fragment for the heap, one per allocation tracker tag, one
+     * per object pool and one per canvas pool bucket.
+     *
+     * @param[out] fragment Fragment where to write to.
+     *
+     * @return If more data fragments will follow, it will return true otherwise false.
+     */
+    bool nextData(JsonStreamFragment& fragment) final
+    {
+        bool                                isPending       = true;
+        const size_t                        JSON_DOC_SIZE   = 256U;
+        StaticJsonDocument<JSON_DOC_SIZE>   jsonDoc;
+
+        switch(m_part)
+        {
+        case PART_HEAP:
+            {
+                MemMon::HeapInfo heapInfo;
+
+                MemMon::getHeapInfo(heapInfo);
+
+                jsonDoc["heapSize"]         = ESP.getHeapSize();
+                jsonDoc["freeBytes"]        = heapInfo.freeBytes;
+                jsonDoc["minFreeBytes"]     = heapInfo.minFreeBytes;
+                jsonDoc["largestFreeBlock"] = heapInfo.largestFreeBlock;
+                jsonDoc["allocatedBlocks"]  = heapInfo.allocatedBlocks;
+                jsonDoc["freeBlocks"]       = heapInfo.freeBlocks;
+                jsonDoc["fragmentation"]    = heapInfo.fragmentation;
+
+                fragment.print("{\"heap\":");
+                fragment.writeJson(jsonDoc);
+                fragment.print(",\"allocTracker\":");
+                fragment.print((true == AllocTracker::IS_ENABLED) ? "true" : "false");
+                fragment.print(",\"sampleRate\":");
+                fragment.print(AllocTracker::SAMPLE_RATE);
+                fragment.print(",\"tags\":[");
+
+                m_part = PART_TAGS;
+            }
+            break;
+
+        case PART_TAGS:
+            {
+                AllocTracker::Tag           tag     = static_cast<AllocTracker::Tag>(m_tagIdx);
+                AllocTracker::Statistics    stats;
+
+                if (false == AllocTracker::getInstance().getStatistics(tag, stats))
+                {
+                    fragment.print("],\"pools\":[");
+
+                    m_part = PART_POOLS;
+                }
+                else
+                {
+                    jsonDoc["name"]         = AllocTracker::tagToStr(tag);
+                    jsonDoc["liveBytes"]    = stats.liveBytes;
+                    jsonDoc["peakBytes"]    = stats.peakBytes;
+                    jsonDoc["liveBlocks"]   = stats.liveBlocks;
+                    jsonDoc["allocations"]  = stats.allocations;
+                    jsonDoc["failures"]     = stats.failures;
+
+                    if (0U < m_tagIdx)
+                    {
+                        fragment.print(",");
+                    }
+
+                    fragment.writeJson(jsonDoc);
+
+                    ++m_tagIdx;
+                }
+            }
+            break;
+
+        case PART_POOLS:
+            if (nullptr == m_pool)
+            {
+                fragment.print("],\"canvasPool\":{\"fallbacks\":");
+                fragment.print(CanvasPool::getInstance().getFallbacks());
+                fragment.print(",\"buckets\":[");
+
+                m_part = PART_CANVASES;
+            }
+            else
+            {
+                jsonDoc["name"]         = m_pool->getName();
+                jsonDoc["capacity"]     = m_pool->getCapacity();
+                jsonDoc["used"]         = m_pool->getUsed();
+                jsonDoc["peak"]         = m_pool->getPeak();
+                jsonDoc["fallbacks"]    = m_pool->getFallbacks();
+
+                if (ObjectPoolBase::getFirst() != m_pool)
+                {
+                    fragment.print(",");
+                }
+
+                fragment.writeJson(jsonDoc);
+
+                m_pool = m_pool->getNext();
+            }
+            break;
+
+        case PART_CANVASES:
+            {
+                CanvasPool::BucketStatistics stats;
+
+                if (false == CanvasPool::getInstance().getBucketStatistics(m_bucketIdx, stats))
+                {
+                    m_part = PART_END;
+                }
+                else
+                {
+                    jsonDoc["capacity"]     = stats.capacity;
+                    jsonDoc["canvases"]     = stats.canvases;
+                    jsonDoc["used"]         = stats.used;
+                    jsonDoc["peak"]         = stats.peakUsed;
+                    jsonDoc["preserved"]    = stats.preserved;
+
+                    if (0U < m_bucketIdx)
+                    {
+                        fragment.print(",");
+                    }
+
+                    fragment.writeJson(jsonDoc);
+
+                    ++m_bucketIdx;
+                }
+            }
+            break;
+
+        case PART_END:
+            /* fallthrough */
+        default:
+            fragment.print("]}}");
+            isPending = false;
+            break;
+        }
+
+        return isPending;
+    }
+
+    MemoryJsonSource(const MemoryJsonSource& source);
+    MemoryJsonSource& operator=(const MemoryJsonSource& source);
+};
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
@@ -124,14 +1424,17 @@ static void handleSettings(AsyncWebServerRequest* request);
 static void handleSetting(AsyncWebServerRequest* request);
 static bool storeSetting(KeyValue* parameter, const String& value, String& error);
 static void handleStatus(AsyncWebServerRequest* request);
-static void getFiles(File& dir, JsonArray& files, uint32_t& preCount, uint32_t& count, bool isRecursive);
 static void handleFilesystem(AsyncWebServerRequest* request);
+static void handlePersistentLog(AsyncWebServerRequest* request);
+static void handleProfiler(AsyncWebServerRequest* request);
+static void handleMemory(AsyncWebServerRequest* request);
 static void handleFileGet(AsyncWebServerRequest* request);
 static const char* getContentType(const String& filename);
 static void handleFilePost(AsyncWebServerRequest* request);
 static void uploadHandler(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final);
 static void handleFileDelete(AsyncWebServerRequest* request);
 static bool isValidHostname(const String& hostname);
+static void sendJsonStreamRsp(AsyncWebServerRequest* request, JsonStreamSource* source);
 
 /******************************************************************************
  * Local Variables
@@ -187,6 +1490,9 @@ void RestApi::init(AsyncWebServer& srv)
     (void)srv.on("/rest/api/v1/fs/file", HTTP_POST, handleFilePost, uploadHandler);
     (void)srv.on("/rest/api/v1/fs/file", HTTP_DELETE, handleFileDelete);
     (void)srv.on("/rest/api/v1/fs", handleFilesystem);
+    (void)srv.on("/rest/api/v1/log", handlePersistentLog);
+    (void)srv.on("/rest/api/v1/profiler", handleProfiler);
+    (void)srv.on("/rest/api/v1/memory", handleMemory);
 }
 
 /**
@@ -329,10 +1635,6 @@ static void handleFadeEffect(AsyncWebServerRequest* request)
  */
 static void handleSlots(AsyncWebServerRequest* request)
 {
-    uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
-    const size_t        JSON_DOC_SIZE   = 4096U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-
     if (nullptr == request)
     {
         return;
@@ -340,52 +1642,16 @@ static void handleSlots(AsyncWebServerRequest* request)
 
     if (HTTP_GET != request->method())
     {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
         RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
-        httpStatusCode = HttpStatus::STATUS_CODE_NOT_FOUND;
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
     }
     else
     {
-        JsonVariant dataObj     = RestUtil::prepareRspSuccess(jsonDoc);
-        JsonArray   slotArray   = dataObj.createNestedArray("slots");
-        uint8_t     slotId      = 0U;
-        DisplayMgr& displayMgr  = DisplayMgr::getInstance();
-        uint8_t     stickySlot  = displayMgr.getStickySlot();
-
-        /* Add max. number of slots */
-        dataObj["maxSlots"] = displayMgr.getMaxSlots();
-
-        /* Add which plugin's are installed. */
-        for(slotId = 0U; slotId < displayMgr.getMaxSlots(); ++slotId)
-        {
-            IPluginMaintenance* plugin      = displayMgr.getPluginInSlot(slotId);
-            const char*         name        = (nullptr != plugin) ? plugin->getName() : "";
-            uint16_t            uid         = (nullptr != plugin) ? plugin->getUID() : 0U;
-            String              alias       = (nullptr != plugin) ? plugin->getAlias() : "";
-            bool                isLocked    = displayMgr.isSlotLocked(slotId);
-            uint32_t            duration    = displayMgr.getSlotDuration(slotId);
-            JsonObject          slot        = slotArray.createNestedObject();
-
-            slot["name"]        = name;
-            slot["uid"]         = uid;
-            slot["alias"]       = alias;
-
-            if (stickySlot != slotId)
-            {
-                slot["isSticky"] = false;
-            }
-            else
-            {
-                slot["isSticky"] = true;
-            }
-
-            slot["isLocked"]    = isLocked;
-            slot["duration"]    = duration;
-        }
-
-        httpStatusCode = HttpStatus::STATUS_CODE_OK;
+        sendJsonStreamRsp(request, new(std::nothrow) SlotsJsonSource());
     }
-
-    RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
 }
 
 /**
@@ -661,10 +1927,6 @@ static void handlePluginUninstall(AsyncWebServerRequest* request)
  */
 static void handlePlugins(AsyncWebServerRequest* request)
 {
-    const size_t        JSON_DOC_SIZE   = 512U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-    uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
-
     if (nullptr == request)
     {
         return;
@@ -672,28 +1934,16 @@ static void handlePlugins(AsyncWebServerRequest* request)
 
     if (HTTP_GET != request->method())
     {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
         RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
-        httpStatusCode = HttpStatus::STATUS_CODE_NOT_FOUND;
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
     }
     else
     {
-        JsonVariant                 dataObj                 = RestUtil::prepareRspSuccess(jsonDoc);
-        JsonArray                   pluginArray             = dataObj.createNestedArray("plugins");
-        uint8_t                     pluginTypeListLength    = 0U;
-        const PluginList::Element*  pluginTypeList          = PluginList::getList(pluginTypeListLength);
-        uint8_t                     idx                     = 0U;
-
-        while(pluginTypeListLength > idx)
-        {
-            pluginArray.add(pluginTypeList[idx].name);
-            
-            ++idx;
-        }
-
-        httpStatusCode = HttpStatus::STATUS_CODE_OK;
+        sendJsonStreamRsp(request, new(std::nothrow) PluginsJsonSource());
     }
-
-    RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
 }
 
 /**
@@ -774,10 +2024,6 @@ static void handleSensors(AsyncWebServerRequest* request)
  */
 static void handleSettings(AsyncWebServerRequest* request)
 {
-    const size_t        JSON_DOC_SIZE   = 1024U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-    uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
-
     if (nullptr == request)
     {
         return;
@@ -785,31 +2031,16 @@ static void handleSettings(AsyncWebServerRequest* request)
 
     if (HTTP_GET != request->method())
     {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
         RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
-        httpStatusCode = HttpStatus::STATUS_CODE_NOT_FOUND;
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
     }
     else
     {
-        JsonVariant dataObj         = RestUtil::prepareRspSuccess(jsonDoc);
-        JsonArray   settingsArray   = dataObj.createNestedArray("settings");
-        size_t      settingIdx      = 0U;
-        size_t      settingsCount   = 0U;
-        KeyValue**  settings        = SettingsService::getInstance().getList(settingsCount);
-
-        for(settingIdx = 0; settingIdx < settingsCount; ++settingIdx)
-        {
-            KeyValue*   setting = settings[settingIdx];
-
-            if (nullptr != setting)
-            {
-                (void)settingsArray.add(setting->getKey());
-            }
-        }
-
-        httpStatusCode = HttpStatus::STATUS_CODE_OK;
+        sendJsonStreamRsp(request, new(std::nothrow) SettingsJsonSource());
     }
-
-    RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
 }
 
 /**
@@ -1232,10 +2463,6 @@ static bool storeSetting(KeyValue* parameter, const String& value, String& error
  */
 static void handleStatus(AsyncWebServerRequest* request)
 {
-    uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
-    const size_t        JSON_DOC_SIZE   = 512U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-
     if (nullptr == request)
     {
         return;
@@ -1243,124 +2470,15 @@ static void handleStatus(AsyncWebServerRequest* request)
 
     if (HTTP_GET != request->method())
     {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
         RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
-        httpStatusCode = HttpStatus::STATUS_CODE_NOT_FOUND;
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
     }
     else
     {
-        String              ssid;
-        int8_t              rssi            = -100; // dbm
-        JsonVariant         dataObj         = RestUtil::prepareRspSuccess(jsonDoc);
-        JsonObject          hwObj           = dataObj.createNestedObject("hardware");
-        JsonObject          swObj           = dataObj.createNestedObject("software");
-        JsonObject          internalRamObj  = swObj.createNestedObject("internalRam");
-        JsonObject          wifiObj         = dataObj.createNestedObject("wifi");
-        SettingsService&    settings        = SettingsService::getInstance();
-
-        /* Only in station mode it makes sense to retrieve the RSSI.
-         * Otherwise keep it -100 dbm.
-         */
-        if (WIFI_MODE_STA == WiFi.getMode())
-        {
-            rssi = WiFi.RSSI();
-        }
-
-        if (true == settings.open(true))
-        {
-            ssid = settings.getWifiSSID().getValue();
-            settings.close();
-        }
-
-        /* Prepare response */
-        hwObj["chipRev"]        = ESP.getChipRevision();
-        hwObj["cpuFreqMhz"]     = ESP.getCpuFreqMHz();
-
-        swObj["version"]        = Version::SOFTWARE_VER;
-        swObj["revision"]       = Version::SOFTWARE_REV;
-        swObj["espSdkVersion"]  = ESP.getSdkVersion();
-
-        internalRamObj["heapSize"]      = ESP.getHeapSize();
-        internalRamObj["availableHeap"] = ESP.getFreeHeap();
-
-        wifiObj["ssid"]         = ssid;
-        wifiObj["rssi"]         = rssi;                             // dBm
-        wifiObj["quality"]      = WiFiUtil::getSignalQuality(rssi); // percent
-
-        httpStatusCode          = HttpStatus::STATUS_CODE_OK;
-    }
-
-    RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
-}
-
-/**
- * Get the files in the directory (optional: recursively) and fill the JSON array flat.
- * It will start to collect the files/directories after "preCount" were found.
- * It will stop to collect after "count" files.
- * 
- * @param[in]       dir         The directory to start with.
- * @param[out]      files       JSON array for collecting the files.
- * @param[in,out]   preCount    This amount of files will be skipped.
- * @param[in,out]   count       Amount of files which max. to collect.
- * @param[in]       isRecursive If true, it will get all files recursive from root to all leafs.
- */
-static void getFiles(File& dir, JsonArray& files, uint32_t& preCount, uint32_t& count, bool isRecursive)
-{
-    File fd = dir.openNextFile();
-
-    while((true == fd) && (0U < count))
-    {
-        /* Skip the first number of files. */
-        if (0U < preCount)
-        {
-            /* One file/directory skipped. */
-            --preCount;
-
-            /* Dive into every directory recursively. */
-            if ((true == isRecursive) &&
-                (true == fd.isDirectory()))
-            {
-                getFiles(fd, files, preCount, count, isRecursive);
-            }
-        }
-        else
-        {
-            JsonObject jsonFile = files.createNestedObject();
-
-            /* One file/directory collected. */
-            --count;
-
-            jsonFile["name"] = String(fd.path());
-            jsonFile["size"] = fd.size();
-
-            if (true == fd.isDirectory())
-            {
-                jsonFile["type"] = "dir";
-
-                if (true == isRecursive)
-                {
-                    /* Dive into every directory recursively. */
-                    getFiles(fd, files, preCount, count, isRecursive);
-                }
-            }
-            else
-            {
-                jsonFile["type"] = "file";
-            }
-        }
-
-        fd.close();
-
-        /* Still possible to collect more? */
-        if (0U < count)
-        {
-            fd = dir.openNextFile();
-        }
-    }
-    
-    /* Cleanup */
-    if (true == fd)
-    {
-        fd.close();
+        sendJsonStreamRsp(request, new(std::nothrow) StatusJsonSource());
     }
 }
 
@@ -1373,11 +2491,6 @@ static void getFiles(File& dir, JsonArray& files, uint32_t& preCount, uint32_t&
  */
 static void handleFilesystem(AsyncWebServerRequest* request)
 {
-    String              content;
-    uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
-    const size_t        JSON_DOC_SIZE   = 2048U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-
     if (nullptr == request)
     {
         return;
@@ -1385,15 +2498,16 @@ static void handleFilesystem(AsyncWebServerRequest* request)
 
     if (HTTP_GET != request->method())
     {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
         RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
-        httpStatusCode = HttpStatus::STATUS_CODE_NOT_FOUND;
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
     }
     else
     {
         const String&   path                = request->arg("dir");
         const String&   pageStr             = request->arg("page");
-        File            fdRoot              = FILESYSTEM.open(path, "r");
-        JsonArray       jsonData            = jsonDoc.createNestedArray("data");
         const uint32_t  DEFAULT_MAX_FILES   = 15U;
         uint32_t        count               = DEFAULT_MAX_FILES;
         uint32_t        page                = 0U;
@@ -1407,32 +2521,94 @@ static void handleFilesystem(AsyncWebServerRequest* request)
             }
         }
 
-        if (false == fdRoot)
-        {
-            LOG_WARNING("Invalid path.");
-        }
-        else
-        {
-            if (false == fdRoot.isDirectory())
-            {
-                LOG_WARNING("Requested path is not a directory.");
-            }
-            else
-            {
-                LOG_INFO("List %s (page = %u)", path.c_str(), page);
-                getFiles(fdRoot, jsonData, preCount, count, false);
-            }
+        LOG_INFO("List %s (page = %u)", path.c_str(), page);
 
-            fdRoot.close();
-        }
+        sendJsonStreamRsp(request, new(std::nothrow) FilesystemJsonSource(path, preCount, count));
+    }
+}
+
+/**
+ * Get the decoded persistent log.
+ * The raw log files can be downloaded via the filesystem file API.
+ *
+ * GET \c "/api/v1/log"
+ *
+ * @param[in] request   HTTP request
+ */
+static void handlePersistentLog(AsyncWebServerRequest* request)
+{
+    if (nullptr == request)
+    {
+        return;
+    }
 
-        /* Prepare response */
-        jsonDoc["status"]   = "ok";
+    if (HTTP_GET != request->method())
+    {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
 
-        httpStatusCode      = HttpStatus::STATUS_CODE_OK;
+        RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
+    }
+    else
+    {
+        sendJsonStreamRsp(request, new(std::nothrow) PersistentLogJsonSource());
     }
+}
 
-    RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
+/**
+ * Get the profiler counters.
+ * GET \c "/api/v1/profiler"
+ *
+ * @param[in] request   HTTP request
+ */
+static void handleProfiler(AsyncWebServerRequest* request)
+{
+    if (nullptr == request)
+    {
+        return;
+    }
+
+    if (HTTP_GET != request->method())
+    {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
+        RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
+    }
+    else
+    {
+        sendJsonStreamRsp(request, new(std::nothrow) ProfilerJsonSource());
+    }
+}
+
+/**
+ * Get the heap fragmentation, the heap usage per allocation tracker tag and
+ * the object pool occupancy.
+ * GET \c "/api/v1/memory"
+ *
+ * @param[in] request   HTTP request
+ */
+static void handleMemory(AsyncWebServerRequest* request)
+{
+    if (nullptr == request)
+    {
+        return;
+    }
+
+    if (HTTP_GET != request->method())
+    {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
+        RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_NOT_FOUND);
+    }
+    else
+    {
+        sendJsonStreamRsp(request, new(std::nothrow) MemoryJsonSource());
+    }
 }
 
 /**
@@ -1581,6 +2757,9 @@ static void uploadHandler(AsyncWebServerRequest *request, const String& filename
         LOG_INFO("File %s successful written.", filename.c_str());
 
         request->_tempFile.close();
+
+        /* If its a plugin configuration, the plugin shall reload it. */
+        PluginConfigNotifier::getInstance().notifyFileUpdated(filename);
     }
     else if (true == isError)
     {
@@ -1632,6 +2811,8 @@ static void handleFileDelete(AsyncWebServerRequest* request)
         }
         else
         {
+            PluginConfigNotifier::getInstance().notifyFileUpdated(path);
+
             (void)RestUtil::prepareRspSuccess(jsonDoc);
             httpStatusCode = HttpStatus::STATUS_CODE_OK;
         }
@@ -1640,6 +2821,25 @@ static void handleFileDelete(AsyncWebServerRequest* request)
     RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
 }
 
+/**
+ * Send a streamed JSON response. If the response can't be created, a error
+ * response will be sent instead.
+ *
+ * @param[in] request   HTTP request
+ * @param[in] source    JSON stream source, may be nullptr in case of a failed allocation.
+ */
+static void sendJsonStreamRsp(AsyncWebServerRequest* request, JsonStreamSource* source)
+{
+    if (false == JsonStreamResponse::send(request, source, HttpStatus::STATUS_CODE_OK))
+    {
+        const size_t        JSON_DOC_SIZE   = 256U;
+        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+
+        RestUtil::prepareRspError(jsonDoc, "Out of memory.");
+        RestUtil::sendJsonRsp(request, jsonDoc, HttpStatus::STATUS_CODE_INTERNAL_SERVER_ERROR);
+    }
+}
+
 /**
  * Check the given hostname and returns whether it is valid or not.
  * Validation is according to RFC952.
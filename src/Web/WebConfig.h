@@ -67,6 +67,12 @@ static const uint32_t   WEBSOCKET_PORT          = 80U;
 /** Websocket path */
 static const char       WEBSOCKET_PATH[]        = "/ws";
 
+/** Max. number of concurrent websocket clients. */
+static const uint8_t    WEBSOCKET_MAX_CLIENTS   = 4U;
+
+/** Max. number of pending events per websocket client, whose send queue is full. */
+static const uint8_t    WEBSOCKET_MAX_PENDING   = 2U;
+
 /** Arduino OTA port */
 static const uint32_t   ARDUINO_OTA_PORT        = 3232U;
 
@@ -163,6 +163,11 @@ void WebSocketSrv::init(AsyncWebServer& srv)
         settings.close();
     }
 
+    if (false == m_mutex.create())
+    {
+        LOG_ERROR("Couldn't create websocket mutex.");
+    }
+
     /* Register websocket event handler */
     m_webSocket.onEvent(onEvent);
 
@@ -173,6 +178,54 @@ void WebSocketSrv::init(AsyncWebServer& srv)
     srv.addHandler(&m_webSocket);
 }
 
+bool WebSocketSrv::getClientStatistics(uint8_t idx, ClientStatistics& stats)
+{
+    bool isSuccessful = false;
+
+    if ((WebConfig::WEBSOCKET_MAX_CLIENTS > idx) &&
+        (true == m_mutex.isAllocated()))
+    {
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
+        if (CLIENT_ID_INVALID != m_clients[idx].id)
+        {
+            AsyncWebSocketClient* client = m_webSocket.client(m_clients[idx].id);
+
+            if (nullptr != client)
+            {
+                m_clients[idx].isCongested = client->queueIsFull();
+            }
+
+            stats           = m_clients[idx];
+            isSuccessful    = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void WebSocketSrv::process()
+{
+    if (true == m_mutex.isAllocated())
+    {
+        MutexGuard<MutexRecursive>  guard(m_mutex);
+        uint8_t                     idx     = 0U;
+
+        for(idx = 0U; idx < WebConfig::WEBSOCKET_MAX_CLIENTS; ++idx)
+        {
+            if (CLIENT_ID_INVALID != m_clients[idx].id)
+            {
+                AsyncWebSocketClient* client = m_webSocket.client(m_clients[idx].id);
+
+                if (nullptr != client)
+                {
+                    sendPendingMsgs(idx, *client);
+                }
+            }
+        }
+    }
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -223,14 +276,78 @@ void WebSocketSrv::onEvent(AsyncWebSocket* server, AsyncWebSocketClient* client,
 
 void WebSocketSrv::onConnect(AsyncWebSocket* server, AsyncWebSocketClient* client, AsyncWebServerRequest* request)
 {
+    bool isRegistered = false;
+
     UTIL_NOT_USED(request);
 
-    LOG_INFO("ws[%s][%u] Client connected.", server->url(), client->id());
+    if (true == m_mutex.isAllocated())
+    {
+        MutexGuard<MutexRecursive>  guard(m_mutex);
+        uint8_t                     idx     = 0U;
+
+        while((WebConfig::WEBSOCKET_MAX_CLIENTS > idx) && (false == isRegistered))
+        {
+            if (CLIENT_ID_INVALID == m_clients[idx].id)
+            {
+                m_clients[idx]      = ClientStatistics();
+                m_clients[idx].id   = client->id();
+                isRegistered        = true;
+            }
+
+            ++idx;
+        }
+    }
+
+    if (false == isRegistered)
+    {
+        LOG_WARNING("ws[%s][%u] Too many clients.", server->url(), client->id());
+        client->close(0U, "Too many clients.");
+    }
+    else
+    {
+        LOG_INFO("ws[%s][%u] Client connected.", server->url(), client->id());
+    }
 }
 
 void WebSocketSrv::onDisconnect(AsyncWebSocket* server, AsyncWebSocketClient* client)
 {
-    LOG_INFO("ws[%s][%u] Client disconnected.", server->url(), client->id());
+    ClientStatistics    stats;
+    bool                isRegistered    = false;
+
+    if (true == m_mutex.isAllocated())
+    {
+        MutexGuard<MutexRecursive>  guard(m_mutex);
+        uint8_t                     idx     = 0U;
+
+        while((WebConfig::WEBSOCKET_MAX_CLIENTS > idx) && (false == isRegistered))
+        {
+            if (client->id() == m_clients[idx].id)
+            {
+                uint8_t pendingIdx  = 0U;
+
+                stats               = m_clients[idx];
+                m_clients[idx].id   = CLIENT_ID_INVALID;
+                isRegistered        = true;
+
+                /* Release the memory of the pending messages. */
+                for(pendingIdx = 0U; pendingIdx < WebConfig::WEBSOCKET_MAX_PENDING; ++pendingIdx)
+                {
+                    m_pendingMsgs[idx][pendingIdx] = PendingMsg();
+                }
+            }
+
+            ++idx;
+        }
+    }
+
+    if (true == isRegistered)
+    {
+        LOG_INFO("ws[%s][%u] Client disconnected (sent: %u, dropped: %u).", server->url(), client->id(), stats.sent, stats.dropped);
+    }
+    else
+    {
+        LOG_INFO("ws[%s][%u] Client disconnected.", server->url(), client->id());
+    }
 }
 
 void WebSocketSrv::onPong(AsyncWebSocket* server, AsyncWebSocketClient* client, uint8_t* data, size_t len)
@@ -267,8 +384,9 @@ void WebSocketSrv::onData(AsyncWebSocket* server, AsyncWebSocketClient* client,
         LOG_ERROR("ws[%s][%u] Frame info is missing.", server->url(), client->id());
         server->close(client->id(), 0U, "Frame info is missing.");
     }
-    /* No text frame? */
-    else if (WS_TEXT != info->opcode)
+    /* Neither text nor binary frame? */
+    else if ((WS_TEXT != info->opcode) &&
+             (WS_BINARY != info->opcode))
     {
         LOG_ERROR("ws[%s][%u] Not supported message type received: %u", server->url(), client->id(), info->opcode);
         server->close(client->id(), 0U, "Not supported message type.");
@@ -278,12 +396,17 @@ void WebSocketSrv::onData(AsyncWebSocket* server, AsyncWebSocketClient* client,
              (0U == info->index) &&
              (len == info->len ))
     {
-        /* Empty text message? */
+        /* Empty message? */
         if ((nullptr == data) ||
             (0U == len))
         {
             LOG_WARNING("ws[%s][%u] Message: -", server->url(), client->id());
         }
+        /* Handle binary message */
+        else if (WS_BINARY == info->opcode)
+        {
+            handleBinaryMsg(server, client, data, len);
+        }
         /* Handle text message */
         else
         {
@@ -334,19 +457,8 @@ void WebSocketSrv::handleMsg(AsyncWebSocket* server, AsyncWebSocketClient* clien
     /* Command string not empty? */
     if (0 < cmdLength)
     {
-        uint8_t index = 0U;
-
         /* Find command object */
-        while((nullptr == wsCmd) && (index < UTIL_ARRAY_NUM(gWsCommands)))
-        {
-            /* Note, cmd is NOT terminated! */
-            if (0 == strncmp(gWsCommands[index]->getCmd(), cmd, cmdLength))
-            {
-                wsCmd = gWsCommands[index];
-            }
-
-            ++index;
-        }
+        wsCmd = findCmd(cmd, cmdLength);
 
         /* Command not found? */
         if (nullptr == wsCmd)
@@ -397,6 +509,260 @@ void WebSocketSrv::handleMsg(AsyncWebSocket* server, AsyncWebSocketClient* clien
     }
 }
 
+void WebSocketSrv::handleBinaryMsg(AsyncWebSocket* server, AsyncWebSocketClient* client, const uint8_t* msg, size_t msgLen)
+{
+    size_t      msgIndex    = 0U;
+    const char* field       = nullptr;
+    size_t      fieldLength = 0U;
+    bool        isValid     = true;
+
+    if ((nullptr == server) ||
+        (nullptr == client) ||
+        (nullptr == msg) ||
+        (0 == msgLen))
+    {
+        return;
+    }
+
+    /* Validate the whole message first, because a command shall only get
+     * its parameters if it will be executed afterwards.
+     */
+    while((msgLen > msgIndex) && (true == isValid))
+    {
+        isValid = getBinaryField(msg, msgLen, msgIndex, field, fieldLength);
+    }
+
+    if (false == isValid)
+    {
+        client->text("NACK;\"Invalid message.\"");
+    }
+    else
+    {
+        WsCmd* wsCmd = nullptr;
+
+        /* Get command string */
+        msgIndex = 0U;
+        (void)getBinaryField(msg, msgLen, msgIndex, field, fieldLength);
+
+        /* Find command object */
+        if (0U < fieldLength)
+        {
+            wsCmd = findCmd(field, fieldLength);
+        }
+
+        /* Command not found? */
+        if (nullptr == wsCmd)
+        {
+            client->text("NACK;\"Command unknown.\"");
+        }
+        else
+        {
+            /* Determine parameters. They are '\0' terminated in the frame,
+             * therefore they are passed without copy.
+             */
+            while(msgLen > msgIndex)
+            {
+                (void)getBinaryField(msg, msgLen, msgIndex, field, fieldLength);
+                wsCmd->setPar(field);
+            }
+
+            /* Execute command (attention, its called in callback context). */
+            wsCmd->execute(server, client);
+        }
+    }
+}
+
+bool WebSocketSrv::getBinaryField(const uint8_t* msg, size_t msgLen, size_t& msgIndex, const char*& field, size_t& fieldLen)
+{
+    bool            isValid     = false;
+    const size_t    LENGTH_SIZE = 2U;
+
+    /* Field length, data and terminator must fit into the message. */
+    if ((msgLen > msgIndex) &&
+        ((msgLen - msgIndex) > LENGTH_SIZE))
+    {
+        size_t length = static_cast<size_t>(msg[msgIndex]) |
+                        (static_cast<size_t>(msg[msgIndex + 1U]) << 8U);
+
+        if ((msgLen - msgIndex - LENGTH_SIZE) > length)
+        {
+            const uint8_t*  data        = &msg[msgIndex + LENGTH_SIZE];
+            const void*     vData       = data;
+
+            /* Field must be terminated and shall not contain a terminator. */
+            if (('\0' == data[length]) &&
+                (nullptr == memchr(data, '\0', length)))
+            {
+                field       = static_cast<const char*>(vData);
+                fieldLen    = length;
+                msgIndex   += LENGTH_SIZE + length + 1U;
+                isValid     = true;
+            }
+        }
+    }
+
+    return isValid;
+}
+
+WsCmd* WebSocketSrv::findCmd(const char* cmd, size_t cmdLen)
+{
+    WsCmd*  wsCmd   = nullptr;
+    uint8_t index   = 0U;
+
+    while((nullptr == wsCmd) && (index < UTIL_ARRAY_NUM(gWsCommands)))
+    {
+        const char* wsCmdStr = gWsCommands[index]->getCmd();
+
+        /* Note, cmd is NOT terminated! The length check avoids that a
+         * command matches only by its prefix, e.g. "SLOT" and "SLOTS".
+         */
+        if ((cmdLen == strlen(wsCmdStr)) &&
+            (0 == strncmp(wsCmdStr, cmd, cmdLen)))
+        {
+            wsCmd = gWsCommands[index];
+        }
+
+        ++index;
+    }
+
+    return wsCmd;
+}
+
+size_t WebSocketSrv::write(const uint8_t* buffer, size_t size)
+{
+    if ((nullptr != buffer) &&
+        (0U < size) &&
+        (true == m_mutex.isAllocated()))
+    {
+        MutexGuard<MutexRecursive>  guard(m_mutex);
+        uint8_t                     idx     = 0U;
+
+        for(idx = 0U; idx < WebConfig::WEBSOCKET_MAX_CLIENTS; ++idx)
+        {
+            if (CLIENT_ID_INVALID != m_clients[idx].id)
+            {
+                AsyncWebSocketClient* client = m_webSocket.client(m_clients[idx].id);
+
+                if (nullptr != client)
+                {
+                    /* Older pending messages first, to keep the order. */
+                    sendPendingMsgs(idx, *client);
+
+                    /* Slow clients get only the newest message per type, instead of buffering without limit. */
+                    if (true == client->queueIsFull())
+                    {
+                        m_clients[idx].isCongested = true;
+                        addPendingMsg(idx, buffer, size);
+                    }
+                    else
+                    {
+                        m_clients[idx].isCongested = false;
+                        ++m_clients[idx].sent;
+
+                        client->text(const_cast<uint8_t*>(buffer), size);
+                    }
+                }
+            }
+        }
+    }
+
+    return size;
+}
+
+void WebSocketSrv::sendPendingMsgs(uint8_t idx, AsyncWebSocketClient& client)
+{
+    uint8_t pendingIdx = 0U;
+
+    while((WebConfig::WEBSOCKET_MAX_PENDING > pendingIdx) && (false == client.queueIsFull()))
+    {
+        PendingMsg& pendingMsg = m_pendingMsgs[idx][pendingIdx];
+
+        if (0U < pendingMsg.msg.length())
+        {
+            client.text(pendingMsg.msg);
+            ++m_clients[idx].sent;
+
+            /* Release its memory. */
+            pendingMsg = PendingMsg();
+        }
+
+        ++pendingIdx;
+    }
+}
+
+void WebSocketSrv::addPendingMsg(uint8_t idx, const uint8_t* buffer, size_t size)
+{
+    const void*     vBuffer     = buffer;
+    const char*     msg         = static_cast<const char*>(vBuffer);
+    size_t          typeLen     = getMsgTypeLength(buffer, size);
+    PendingMsg*     freeMsg     = nullptr;
+    PendingMsg*     sameTypeMsg = nullptr;
+    uint8_t         pendingIdx  = 0U;
+
+    while((WebConfig::WEBSOCKET_MAX_PENDING > pendingIdx) && (nullptr == sameTypeMsg))
+    {
+        PendingMsg& pendingMsg = m_pendingMsgs[idx][pendingIdx];
+
+        if (0U == pendingMsg.msg.length())
+        {
+            if (nullptr == freeMsg)
+            {
+                freeMsg = &pendingMsg;
+            }
+        }
+        else if ((typeLen == pendingMsg.typeLen) &&
+                 (0 == strncmp(pendingMsg.msg.c_str(), msg, typeLen)))
+        {
+            sameTypeMsg = &pendingMsg;
+        }
+        else
+        {
+            ;
+        }
+
+        ++pendingIdx;
+    }
+
+    /* The older message of the same type is replaced by the newest one. */
+    if (nullptr != sameTypeMsg)
+    {
+        sameTypeMsg->msg = String(msg, size);
+        ++m_clients[idx].dropped;
+    }
+    else if (nullptr != freeMsg)
+    {
+        freeMsg->msg        = String(msg, size);
+        freeMsg->typeLen    = typeLen;
+    }
+    else
+    {
+        ++m_clients[idx].dropped;
+    }
+}
+
+size_t WebSocketSrv::getMsgTypeLength(const uint8_t* buffer, size_t size)
+{
+    const char      DELIMITER   = ';';
+    const uint8_t   TYPE_FIELDS = 2U; /* Event and its kind, e.g. "EVT;LOG" */
+    uint8_t         fields      = 0U;
+    size_t          typeLen     = 0U;
+
+    while((size > typeLen) && (TYPE_FIELDS > fields))
+    {
+        if (DELIMITER == buffer[typeLen])
+        {
+            ++fields;
+        }
+
+        if (TYPE_FIELDS > fields)
+        {
+            ++typeLen;
+        }
+    }
+
+    return typeLen;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
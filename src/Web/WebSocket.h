@@ -46,8 +46,10 @@
 #include <ESPAsyncWebServer.h>
 #include <stdint.h>
 #include <Print.h>
+#include <Mutex.hpp>
 
 #include "WebConfig.h"
+#include "WsCmd.h"
 
 /******************************************************************************
  * Macros
@@ -59,11 +61,47 @@
 
 /**
  * Websocket server
+ *
+ * It supports two kind of command messages:
+ * - Text: "<command>;<par1>;<par2>;..."
+ * - Binary: A sequence of length-prefixed fields, where the first field is the
+ *   command and all following fields are the parameters. Each field consists
+ *   of its length (uint16_t, little endian, without terminator), the field
+ *   data and a '\0' terminator. The parameters are passed to the command
+ *   directly out of the frame, without any copy.
+ *
+ * Broadcasted messages, e.g. the log messages, are not sent to clients which
+ * send queue is full. Instead the newest message per event type (e.g.
+ * "EVT;LOG") is kept pending for this client and replaces an older pending
+ * one of the same type. This avoids that slow clients buffer without limit.
+ * The pending messages are sent as soon as the send queue has space again.
  */
 class WebSocketSrv : public Print
 {
 public:
 
+    /**
+     * Statistics per connected client.
+     */
+    struct ClientStatistics
+    {
+        uint32_t    id;             /**< Client id */
+        uint32_t    sent;           /**< Number of broadcasted messages, which were sent to the client. */
+        uint32_t    dropped;        /**< Number of broadcasted messages, which were dropped or replaced by a newer one for the client. */
+        bool        isCongested;    /**< Is the client send queue full? */
+
+        /**
+         * Initializes empty client statistics.
+         */
+        ClientStatistics() :
+            id(0U),
+            sent(0U),
+            dropped(0U),
+            isCongested(false)
+        {
+        }
+    };
+
     /**
      * Get websocket server instance.
      *
@@ -83,15 +121,60 @@ public:
      */
     void init(AsyncWebServer& srv);
 
+    /**
+     * Get statistics of a connected client.
+     *
+     * @param[in]   idx     Client index [0; WebConfig::WEBSOCKET_MAX_CLIENTS - 1]
+     * @param[out]  stats   Client statistics
+     *
+     * @return If a client is connected at this index, it will return true otherwise false.
+     */
+    bool getClientStatistics(uint8_t idx, ClientStatistics& stats);
+
+    /**
+     * Send the pending broadcasted messages to the clients, which send queue
+     * has space again. Call it periodically.
+     */
+    void process();
+
 private:
 
-    AsyncWebSocket  m_webSocket;    /**< Websocket */
+    /**
+     * A broadcasted message, which is pending for a client.
+     */
+    struct PendingMsg
+    {
+        String  msg;        /**< Message, empty if not used. */
+        size_t  typeLen;    /**< Length of the message type at the begin of the message. */
+
+        /**
+         * Initializes an unused pending message.
+         */
+        PendingMsg() :
+            msg(),
+            typeLen(0U)
+        {
+        }
+    };
+
+    /** Client id, which marks a not used client entry. */
+    static const uint32_t   CLIENT_ID_INVALID   = 0U;
+
+    AsyncWebSocket      m_webSocket;                                    /**< Websocket */
+    MutexRecursive      m_mutex;                                        /**< Protects the client statistics and pending messages. */
+    ClientStatistics    m_clients[WebConfig::WEBSOCKET_MAX_CLIENTS];    /**< Statistics per connected client */
+
+    /** Pending broadcasted messages per connected client */
+    PendingMsg          m_pendingMsgs[WebConfig::WEBSOCKET_MAX_CLIENTS][WebConfig::WEBSOCKET_MAX_PENDING];
 
     /**
      * Constructs the websocket server.
      */
     WebSocketSrv() :
-        m_webSocket(WebConfig::WEBSOCKET_PATH)
+        m_webSocket(WebConfig::WEBSOCKET_PATH),
+        m_mutex(),
+        m_clients(),
+        m_pendingMsgs()
     {
     }
 
@@ -173,6 +256,71 @@ private:
      */
     void handleMsg(AsyncWebSocket* server, AsyncWebSocketClient* client, const char* msg, size_t msgLen);
 
+    /**
+     * Handle a binary websocket message.
+     *
+     * @param[in] server    Websocket server
+     * @param[in] client    Weboscket client
+     * @param[in] msg       Websocket message
+     * @param[in] msgLen    Websocket message length
+     */
+    void handleBinaryMsg(AsyncWebSocket* server, AsyncWebSocketClient* client, const uint8_t* msg, size_t msgLen);
+
+    /**
+     * Get next field of a binary websocket message.
+     *
+     * @param[in]       msg         Websocket message
+     * @param[in]       msgLen      Websocket message length
+     * @param[in,out]   msgIndex    Index in the message, where the field starts. After the call it points to the next field.
+     * @param[out]      field       Field data, which is '\0' terminated
+     * @param[out]      fieldLen    Field length without terminator
+     *
+     * @return If a valid field is available, it will return true otherwise false.
+     */
+    bool getBinaryField(const uint8_t* msg, size_t msgLen, size_t& msgIndex, const char*& field, size_t& fieldLen);
+
+    /**
+     * Find the command object by its command string.
+     * The whole command string must match, not only a prefix.
+     *
+     * @param[in] cmd       Command string (not '\0' terminated)
+     * @param[in] cmdLen    Command string length
+     *
+     * @return If found, it will return the command object otherwise nullptr.
+     */
+    WsCmd* findCmd(const char* cmd, size_t cmdLen);
+
+    /**
+     * Send the pending broadcasted messages of a client, as long as its send
+     * queue has space.
+     *
+     * @param[in] idx       Client index
+     * @param[in] client    Websocket client
+     */
+    void sendPendingMsgs(uint8_t idx, AsyncWebSocketClient& client);
+
+    /**
+     * Keep a broadcasted message pending for a client, whose send queue is
+     * full. An older pending message of the same type is replaced.
+     * If no pending message is free, the message is dropped.
+     *
+     * @param[in] idx       Client index
+     * @param[in] buffer    Message buffer
+     * @param[in] size      Message size in byte
+     */
+    void addPendingMsg(uint8_t idx, const uint8_t* buffer, size_t size);
+
+    /**
+     * Get the length of the message type at the begin of a broadcasted
+     * message, e.g. "EVT;LOG" of a log event.
+     *
+     * @param[in] buffer    Message buffer
+     * @param[in] size      Message size in byte
+     *
+     * @return Length of the message type
+     */
+    static size_t getMsgTypeLength(const uint8_t* buffer, size_t size);
+
     /**
      * Write single data byte to all clients.
      *
@@ -182,23 +330,20 @@ private:
      */
     size_t write(uint8_t data) final
     {
-        m_webSocket.textAll(&data, 1);
-        return 1;
+        return write(&data, 1U);
     }
 
     /**
-     * Write data to all clients.
+     * Write data to all clients, which are able to receive it.
+     * If the send queue of a client is full, the data will be kept pending
+     * for it.
      *
      * @param[in] buffer    Data buffer
      * @param[in] size      Data buffer size
      *
      * @return Number of written bytes.
      */
-    size_t write(const uint8_t* buffer, size_t size) final
-    {
-        m_webSocket.textAll(const_cast<uint8_t*>(buffer), size);
-        return size;
-    }
+    size_t write(const uint8_t* buffer, size_t size) final;
 };
 
 /******************************************************************************
@@ -113,6 +113,9 @@ protected:
     /** Negative response code. */
     static const char*    NACK;
 
+    /** Reserved response size in byte for the response code and the leading fix parameters. */
+    static const size_t   RSP_HEADER_SIZE   = 32U;
+
     /**
      * Prepare a positive response message.
      * The last added element will always be a delimiter.
@@ -91,9 +91,16 @@ void WsCmdGetDisp::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
             uint32_t    index       = 0U;
             String      msg;
             uint8_t     slotId      = SlotList::SLOT_ID_INVALID;
+            char        hexBuffer[9U];  /* Contains a 32-bit value in hex */
 
             DisplayMgr::getInstance().getFBCopy(framebuffer, fbLength, &slotId);
 
+            /* Reserve the memory for the whole response at once, to avoid
+             * a reallocation per color. A color needs up to 8 hex digits
+             * and the delimiter.
+             */
+            (void)msg.reserve(RSP_HEADER_SIZE + fbLength * (1U + 8U));
+
             preparePositiveResponse(msg);
 
             msg += slotId;
@@ -104,8 +111,10 @@ void WsCmdGetDisp::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
 
             for(index = 0U; index <  fbLength; ++index)
             {
+                (void)snprintf(hexBuffer, sizeof(hexBuffer), "%x", framebuffer[index]);
+
                 msg += DELIMITER;
-                msg += Util::uint32ToHex(framebuffer[index]);
+                msg += hexBuffer;
             }
 
             delete[] framebuffer;
@@ -80,9 +80,21 @@ void WsCmdPlugins::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
         uint8_t                     pluginTypeListLength    = 0U;
         const PluginList::Element*  pluginTypeList          = PluginList::getList(pluginTypeListLength);
         uint8_t                     idx                     = 0U;
+        size_t                      msgSize                 = RSP_HEADER_SIZE;
+
+        /* Reserve the memory for the whole response at once, to avoid
+         * a reallocation per plugin type. Each name is quoted and delimited.
+         */
+        for(idx = 0U; idx < pluginTypeListLength; ++idx)
+        {
+            msgSize += strlen(pluginTypeList[idx].name) + 3U;
+        }
+
+        (void)msg.reserve(msgSize);
 
         preparePositiveResponse(msg);
 
+        idx = 0U;
         while(pluginTypeListLength > idx)
         {
             if (0 < idx)
@@ -82,6 +82,11 @@ void WsCmdSlots::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
         uint8_t     slotId      = SlotList::SLOT_ID_INVALID;
         uint8_t     stickySlot  = displayMgr.getStickySlot();
 
+        /* Reserve the memory for the whole response at once, to avoid
+         * a reallocation per slot.
+         */
+        (void)msg.reserve(RSP_HEADER_SIZE + displayMgr.getMaxSlots() * RSP_SLOT_SIZE);
+
         preparePositiveResponse(msg);
 
         msg += displayMgr.getMaxSlots();
@@ -93,6 +93,12 @@ public:
 
 private:
 
+    /**
+     * Estimated response size in byte per slot: plugin name, UID, alias,
+     * lock/sticky flag and duration with its delimiters.
+     */
+    static const size_t RSP_SLOT_SIZE = 80U;
+
     bool    m_isError;  /**< Any error happened during parameter reception? */
 
     WsCmdSlots(const WsCmdSlots& cmd);
@@ -36,6 +36,8 @@
 #include <Logging.h>
 #include <LogSinkPrinter.h>
 #include "LogSinkWebsocket.h"
+#include "LogRing.h"
+#include "PersistentLog.h"
 #include <StateMachine.hpp>
 #include <Board.h>
 
@@ -179,6 +181,17 @@ void setup()
     /* Set severity for Pixelix logging system. */
     Logging::getInstance().setLogLevel(CONFIG_LOG_SEVERITY);
 
+    /* Forward the log messages out of a low priority task to the selected
+     * sink, to avoid that the caller is blocked by a slow sink.
+     */
+    if (false == LogRing::getInstance().begin())
+    {
+        LOG_WARNING("Log messages are not deferred.");
+    }
+
+    /* Keep the latest log messages over a reset. */
+    PersistentLog::getInstance().begin();
+
     /* The setup routine shall handle only the initialization state.
      * All other states are handled in the loop routine.
      */
@@ -211,6 +224,9 @@ void loop()
     /* Memory monitor */
     MemMon::getInstance().process();
 
+    /* Write the persistent log messages to the filesystem. */
+    PersistentLog::getInstance().process();
+
     /* Process terminal */
     gTerminal.process();
 
@@ -44,6 +44,7 @@
  * Includes
  *****************************************************************************/
 #include <Widget.hpp>
+#include <Util.h>
 
 /******************************************************************************
  * Macros
@@ -95,10 +96,26 @@ public:
      */
     void setPenColor(const Color& color)
     {
-        m_color = color;
+        m_color     = color;
+        m_isDirty   = true;
         return;
     }
 
+    /**
+     * Get the bounding box of the widget in the canvas.
+     *
+     * @param[in]   canvasWidth     Canvas width in pixel
+     * @param[in]   canvasHeight    Canvas height in pixel
+     * @param[out]  box             Bounding box
+     */
+    void getBoundingBox(uint16_t canvasWidth, uint16_t canvasHeight, YAGfxDamage::Rect& box) const override
+    {
+        UTIL_NOT_USED(canvasWidth);
+        UTIL_NOT_USED(canvasHeight);
+
+        box = YAGfxDamage::Rect(m_posX, m_posY, WIDTH, HEIGHT);
+    }
+
     static const uint16_t           WIDTH       = 10U;  /**< Widget width in pixel */
     static const uint16_t           HEIGHT      = 5U;   /**< Widget height in pixel */
     static constexpr const char*    WIDGET_TYPE = "test";   /**< Widget type string */
@@ -0,0 +1,301 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test heap allocation tracker.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <AllocTracker.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Test class, which counts its living instances.
+ */
+class TestElement
+{
+public:
+
+    /**
+     * Constructs the test element.
+     */
+    TestElement() :
+        m_value(0x12345678U)
+    {
+        ++m_instances;
+    }
+
+    /**
+     * Destroys the test element.
+     */
+    ~TestElement()
+    {
+        --m_instances;
+    }
+
+    uint32_t        m_value;        /**< Value, which shall be initialized. */
+
+    static int32_t  m_instances;    /**< Number of living instances */
+};
+
+/**
+ * Test class, whose instances are tracked.
+ */
+class TestTracked : public AllocTracked<AllocTracker::TAG_PLUGIN>
+{
+public:
+
+    /**
+     * Constructs the test instance.
+     */
+    TestTracked() :
+        AllocTracked<AllocTracker::TAG_PLUGIN>(),
+        m_data()
+    {
+    }
+
+    /**
+     * Destroys the test instance.
+     */
+    virtual ~TestTracked()
+    {
+    }
+
+    uint8_t m_data[100U];   /**< Some data */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testAllocTracker();
+static void testAllocTrackerArray();
+static void testAllocTracked();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+int32_t TestElement::m_instances = 0;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testAllocTracker);
+    RUN_TEST(testAllocTrackerArray);
+    RUN_TEST(testAllocTracked);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test allocation and release.
+ */
+static void testAllocTracker()
+{
+    AllocTracker&               tracker = AllocTracker::getInstance();
+    AllocTracker::Statistics    stats;
+    uint8_t*                    ptr1    = nullptr;
+    uint8_t*                    ptr2    = nullptr;
+
+    /* Initial all counters are cleared. */
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_GFX, stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.peakBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBlocks);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.allocations);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.failures);
+
+    /* Invalid tag */
+    TEST_ASSERT_FALSE(tracker.getStatistics(AllocTracker::TAG_COUNT, stats));
+    TEST_ASSERT_NULL(tracker.allocate(AllocTracker::TAG_COUNT, 10U));
+
+    /* Allocate two blocks. */
+    ptr1 = static_cast<uint8_t*>(tracker.allocate(AllocTracker::TAG_GFX, 100U));
+    TEST_ASSERT_NOT_NULL(ptr1);
+    TEST_ASSERT_EQUAL(100U, AllocTracker::getSize(ptr1));
+    ptr1[99] = 0xAAU;
+
+    ptr2 = static_cast<uint8_t*>(tracker.allocate(AllocTracker::TAG_GFX, 50U));
+    TEST_ASSERT_NOT_NULL(ptr2);
+    TEST_ASSERT_EQUAL(50U, AllocTracker::getSize(ptr2));
+
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_GFX, stats));
+    TEST_ASSERT_EQUAL_UINT32(150U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(150U, stats.peakBytes);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.liveBlocks);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.allocations);
+
+    /* Other tags are not affected. */
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_HTTP, stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.allocations);
+
+    /* Release one block, the peak remains. */
+    tracker.release(ptr1);
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_GFX, stats));
+    TEST_ASSERT_EQUAL_UINT32(50U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(150U, stats.peakBytes);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.liveBlocks);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.allocations);
+
+    tracker.release(ptr2);
+    tracker.release(nullptr);
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_GFX, stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBlocks);
+
+    /* Allocations done by third party code. */
+    tracker.notifyAllocation(AllocTracker::TAG_JSON, 1024U);
+    tracker.notifyFailure(AllocTracker::TAG_JSON);
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_JSON, stats));
+    TEST_ASSERT_EQUAL_UINT32(1024U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.liveBlocks);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.failures);
+
+    tracker.notifyRelease(AllocTracker::TAG_JSON, 1024U);
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_JSON, stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(1024U, stats.peakBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBlocks);
+
+    TEST_ASSERT_EQUAL_STRING("gfx", AllocTracker::tagToStr(AllocTracker::TAG_GFX));
+    TEST_ASSERT_EQUAL_STRING("plugin", AllocTracker::tagToStr(AllocTracker::TAG_PLUGIN));
+    TEST_ASSERT_EQUAL_STRING("unknown", AllocTracker::tagToStr(AllocTracker::TAG_COUNT));
+}
+
+/**
+ * Test array allocation and release.
+ */
+static void testAllocTrackerArray()
+{
+    AllocTracker&               tracker = AllocTracker::getInstance();
+    AllocTracker::Statistics    stats;
+    TestElement*                array   = tracker.newArray<TestElement>(AllocTracker::TAG_HTTP, 10U);
+    uint8_t                     idx     = 0U;
+
+    TEST_ASSERT_NOT_NULL(array);
+    TEST_ASSERT_EQUAL_INT32(10, TestElement::m_instances);
+
+    for(idx = 0U; idx < 10U; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0x12345678U, array[idx].m_value);
+    }
+
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_HTTP, stats));
+    TEST_ASSERT_EQUAL_UINT32(10U * sizeof(TestElement), stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.liveBlocks);
+
+    tracker.deleteArray(array);
+    TEST_ASSERT_EQUAL_INT32(0, TestElement::m_instances);
+
+    TEST_ASSERT_TRUE(tracker.getStatistics(AllocTracker::TAG_HTTP, stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBlocks);
+}
+
+/**
+ * Test tracked class instances.
+ */
+static void testAllocTracked()
+{
+    AllocTracker::Statistics    stats;
+    TestTracked*                instance = new(std::nothrow) TestTracked();
+
+    TEST_ASSERT_NOT_NULL(instance);
+
+    TEST_ASSERT_TRUE(AllocTracker::getInstance().getStatistics(AllocTracker::TAG_PLUGIN, stats));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(TestTracked), stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.liveBlocks);
+
+    delete instance;
+
+    TEST_ASSERT_TRUE(AllocTracker::getInstance().getStatistics(AllocTracker::TAG_PLUGIN, stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.liveBlocks);
+}
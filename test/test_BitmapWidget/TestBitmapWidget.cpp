@@ -55,6 +55,7 @@
  *****************************************************************************/
 
 static void testBitmapWidget();
+static void testGiveBack();
 
 /******************************************************************************
  * Local Variables
@@ -90,6 +91,7 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testBitmapWidget);
+    RUN_TEST(testGiveBack);
 
     return UNITY_END();
 }
@@ -173,7 +175,8 @@ static void testBitmapWidget()
     {
         for(x = 0; x < BITMAP_WIDTH; ++x)
         {
-            TEST_ASSERT_EQUAL_UINT32(bitmap.getColor(x, y), bitmapWidget.get().getColor(x, y));
+            /* The widget stores the bitmap in RGB565 format. */
+            TEST_ASSERT_EQUAL_UINT16(Rgb565(bitmap.getColor(x, y)).to565(), bitmapWidget.get().getColor(x, y).to565());
         }
     }
 
@@ -185,9 +188,58 @@ static void testBitmapWidget()
     {
         for(x = 0; x < BITMAP_WIDTH; ++x)
         {
-            TEST_ASSERT_EQUAL_UINT16(x + y * BITMAP_WIDTH, displayBuffer[x + y * YAGfxTest::WIDTH]);
+            TEST_ASSERT_EQUAL_UINT32(Color(Rgb565(bitmap.getColor(x, y))), displayBuffer[x + y * YAGfxTest::WIDTH]);
         }
     }
 
     return;
 }
+
+/**
+ * Test that a bitmap, loaded from a file, can be given back to the canvas
+ * pool and is reloaded, if its content got lost.
+ */
+static void testGiveBack()
+{
+    const char*     FILE_NAME   = "./test/test_BmpImgLoader/test24bpp.bmp";
+    CanvasPool&     pool        = CanvasPool::getInstance();
+    FS              localFileSystem;
+    BitmapWidget    bitmapWidget;
+    BitmapWidget    other;
+
+    TEST_ASSERT_TRUE(pool.begin(YAGfxTest::WIDTH, YAGfxTest::HEIGHT));
+
+    /* Load test image: 2x2 pixels, (0, 0) blue, (1, 1) white */
+    TEST_ASSERT_TRUE(bitmapWidget.load(localFileSystem, FILE_NAME));
+    TEST_ASSERT_EQUAL_UINT16(2U, bitmapWidget.get().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(Rgb565(0x0000ffU).to565(), bitmapWidget.get().getColor(0, 0).to565());
+
+    /* Given back, the widget shows nothing. */
+    bitmapWidget.giveBack();
+    TEST_ASSERT_EQUAL_UINT16(0U, bitmapWidget.get().getWidth());
+
+    /* The preserved content is used again. */
+    bitmapWidget.borrow();
+    TEST_ASSERT_EQUAL_UINT16(2U, bitmapWidget.get().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(Rgb565(0x0000ffU).to565(), bitmapWidget.get().getColor(0, 0).to565());
+    TEST_ASSERT_EQUAL_UINT16(Rgb565(0xffffffU).to565(), bitmapWidget.get().getColor(1, 1).to565());
+
+    /* Another bitmap takes the pixel buffer, the content is reloaded from the file. */
+    bitmapWidget.giveBack();
+    TEST_ASSERT_TRUE(other.load(localFileSystem, FILE_NAME));
+    other.clear(ColorDef::RED);
+
+    bitmapWidget.borrow();
+    TEST_ASSERT_EQUAL_UINT16(2U, bitmapWidget.get().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(Rgb565(0x0000ffU).to565(), bitmapWidget.get().getColor(0, 0).to565());
+    TEST_ASSERT_EQUAL_UINT16(Rgb565(0xffffffU).to565(), bitmapWidget.get().getColor(1, 1).to565());
+
+    /* A bitmap, which differs from its file, is not given back. */
+    other.giveBack();
+    TEST_ASSERT_EQUAL_UINT16(2U, other.get().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(Rgb565(ColorDef::RED).to565(), other.get().getColor(0, 0).to565());
+
+    bitmapWidget.clear(ColorDef::BLACK);
+    other.clear(ColorDef::BLACK);
+    pool.end();
+}
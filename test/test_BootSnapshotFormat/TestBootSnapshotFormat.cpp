@@ -0,0 +1,302 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test boot snapshot file format.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <BootSnapshotFormat.h>
+#include <string.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Output, which stores everything in memory.
+ */
+class TestOutput : public Print
+{
+public:
+
+    /**
+     * Constructs the test output.
+     */
+    TestOutput() :
+        Print(),
+        m_buffer(),
+        m_size(0U)
+    {
+    }
+
+    /**
+     * Write a single byte.
+     *
+     * @param[in] data  Byte to write
+     *
+     * @return Number of written bytes.
+     */
+    size_t write(uint8_t data) final
+    {
+        return write(&data, 1U);
+    }
+
+    /**
+     * Write a buffer.
+     *
+     * @param[in] buffer    Buffer to write
+     * @param[in] size      Buffer size in byte
+     *
+     * @return Number of written bytes.
+     */
+    size_t write(const uint8_t* buffer, size_t size) final
+    {
+        size_t written = sizeof(m_buffer) - m_size;
+
+        if (size < written)
+        {
+            written = size;
+        }
+
+        memcpy(&m_buffer[m_size], buffer, written);
+        m_size += written;
+
+        return written;
+    }
+
+    uint8_t m_buffer[512U]; /**< Written data */
+    size_t  m_size;         /**< Number of written bytes */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void writeSnapshot(TestOutput& output);
+static void testLoad();
+static void testVerify();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Plugin UID in the test snapshot */
+static const uint16_t   PLUGIN_UID  = 42U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testLoad);
+    RUN_TEST(testVerify);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Write a snapshot with a slot configuration and one plugin configuration.
+ *
+ * @param[out] output   Output, where to write to.
+ */
+static void writeSnapshot(TestOutput& output)
+{
+    const size_t                JSON_DOC_SIZE   = 256U;
+    DynamicJsonDocument         slotDoc(JSON_DOC_SIZE);
+    DynamicJsonDocument         pluginDoc(JSON_DOC_SIZE);
+    BootSnapshotFormat::Writer  writer(output);
+    JsonArray                   jsonSlots       = slotDoc.createNestedArray("slotConfiguration");
+    JsonObject                  jsonSlot        = jsonSlots.createNestedObject();
+
+    jsonSlot["name"]        = "JustTextPlugin";
+    jsonSlot["uid"]         = PLUGIN_UID;
+    pluginDoc["text"]       = "Hello World";
+
+    writer.writeHeader(2U);
+    writer.writeRecordHeader(BootSnapshotFormat::RECORD_TYPE_SLOTS, 0U, static_cast<uint16_t>(measureMsgPack(slotDoc)));
+    (void)serializeMsgPack(slotDoc, writer);
+    writer.writeRecordHeader(BootSnapshotFormat::RECORD_TYPE_PLUGIN, PLUGIN_UID, static_cast<uint16_t>(measureMsgPack(pluginDoc)));
+    (void)serializeMsgPack(pluginDoc, writer);
+    writer.writeTrailer();
+
+    TEST_ASSERT_FALSE(writer.isError());
+}
+
+/**
+ * Test loading the slot and plugin configuration from a snapshot.
+ */
+static void testLoad()
+{
+    const size_t        JSON_DOC_SIZE   = 256U;
+    TestOutput          output;
+    DynamicJsonDocument slotDoc(JSON_DOC_SIZE);
+    DynamicJsonDocument pluginDoc(JSON_DOC_SIZE);
+    uint8_t*            buffer          = nullptr;
+    size_t              payloadIdx      = 0U;
+    size_t              payloadSize     = 0U;
+
+    writeSnapshot(output);
+
+    /* The snapshot is read into a dynamic buffer, like from the filesystem. */
+    buffer = new uint8_t[output.m_size];
+    memcpy(buffer, output.m_buffer, output.m_size);
+
+    {
+        BootSnapshotFormat::Reader reader(buffer, output.m_size);
+
+        TEST_ASSERT_EQUAL(BootSnapshotFormat::Reader::RESULT_OK, reader.verify());
+        TEST_ASSERT_EQUAL_UINT16(2U, reader.getRecordCount());
+
+        /* Slot configuration */
+        TEST_ASSERT_TRUE(reader.findRecord(BootSnapshotFormat::RECORD_TYPE_SLOTS, 0U, payloadIdx, payloadSize));
+        TEST_ASSERT_TRUE(reader.deserialize(payloadIdx, payloadSize, slotDoc));
+
+        /* Plugin configuration, which is provided only once. */
+        TEST_ASSERT_FALSE(reader.findRecord(BootSnapshotFormat::RECORD_TYPE_PLUGIN, PLUGIN_UID + 1U, payloadIdx, payloadSize));
+        TEST_ASSERT_TRUE(reader.findRecord(BootSnapshotFormat::RECORD_TYPE_PLUGIN, PLUGIN_UID, payloadIdx, payloadSize));
+        TEST_ASSERT_TRUE(reader.deserialize(payloadIdx, payloadSize, pluginDoc));
+        reader.markConsumed(payloadIdx);
+        TEST_ASSERT_FALSE(reader.findRecord(BootSnapshotFormat::RECORD_TYPE_PLUGIN, PLUGIN_UID, payloadIdx, payloadSize));
+    }
+
+    /* Release the snapshot memory, the JSON documents must still be valid. */
+    memset(buffer, 0, output.m_size);
+    delete[] buffer;
+    buffer = nullptr;
+
+    TEST_ASSERT_EQUAL_STRING("JustTextPlugin", slotDoc["slotConfiguration"][0]["name"].as<const char*>());
+    TEST_ASSERT_EQUAL_UINT16(PLUGIN_UID, slotDoc["slotConfiguration"][0]["uid"].as<uint16_t>());
+    TEST_ASSERT_EQUAL_STRING("Hello World", pluginDoc["text"].as<const char*>());
+}
+
+/**
+ * Test the snapshot verification.
+ */
+static void testVerify()
+{
+    TestOutput output;
+
+    writeSnapshot(output);
+
+    /* No snapshot */
+    {
+        BootSnapshotFormat::Reader reader(nullptr, 0U);
+
+        TEST_ASSERT_EQUAL(BootSnapshotFormat::Reader::RESULT_INVALID, reader.verify());
+    }
+
+    /* Too small */
+    {
+        BootSnapshotFormat::Reader reader(output.m_buffer, BootSnapshotFormat::HEADER_SIZE);
+
+        TEST_ASSERT_EQUAL(BootSnapshotFormat::Reader::RESULT_INVALID, reader.verify());
+    }
+
+    /* Corrupt payload */
+    {
+        BootSnapshotFormat::Reader reader(output.m_buffer, output.m_size);
+
+        output.m_buffer[BootSnapshotFormat::HEADER_SIZE + BootSnapshotFormat::RECORD_HEADER_SIZE] ^= 0xffU;
+        TEST_ASSERT_EQUAL(BootSnapshotFormat::Reader::RESULT_CORRUPT, reader.verify());
+        output.m_buffer[BootSnapshotFormat::HEADER_SIZE + BootSnapshotFormat::RECORD_HEADER_SIZE] ^= 0xffU;
+        TEST_ASSERT_EQUAL(BootSnapshotFormat::Reader::RESULT_OK, reader.verify());
+    }
+
+    /* Other format version */
+    {
+        BootSnapshotFormat::Reader reader(output.m_buffer, output.m_size);
+
+        output.m_buffer[4U] ^= 0xffU;
+        TEST_ASSERT_EQUAL(BootSnapshotFormat::Reader::RESULT_OUTDATED, reader.verify());
+        output.m_buffer[4U] ^= 0xffU;
+    }
+
+    /* Wrong magic */
+    {
+        BootSnapshotFormat::Reader reader(output.m_buffer, output.m_size);
+
+        output.m_buffer[0U] ^= 0xffU;
+        TEST_ASSERT_EQUAL(BootSnapshotFormat::Reader::RESULT_INVALID, reader.verify());
+    }
+}
@@ -0,0 +1,406 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test canvas pool.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <CanvasPool.h>
+#include <AllocTracker.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testSizeClasses();
+static void testRgb565();
+static void testPreservedContent();
+static void testContentLost();
+static void testFallback();
+static void testEndWhileBorrowed();
+
+static uint32_t getLiveBlocks();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Display width in pixels */
+static const uint16_t   DISPLAY_WIDTH   = 64U;
+
+/** Display height in pixels */
+static const uint16_t   DISPLAY_HEIGHT  = 32U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testSizeClasses);
+    RUN_TEST(testRgb565);
+    RUN_TEST(testPreservedContent);
+    RUN_TEST(testContentLost);
+    RUN_TEST(testFallback);
+    RUN_TEST(testEndWhileBorrowed);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    TEST_ASSERT_TRUE(CanvasPool::getInstance().begin(DISPLAY_WIDTH, DISPLAY_HEIGHT));
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    CanvasPool::getInstance().end();
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get the number of currently allocated graphic buffers.
+ *
+ * @return Number of allocated blocks
+ */
+static uint32_t getLiveBlocks()
+{
+    AllocTracker::Statistics stats;
+
+    (void)AllocTracker::getInstance().getStatistics(AllocTracker::TAG_GFX, stats);
+
+    return stats.liveBlocks;
+}
+
+/**
+ * A borrow is served from the smallest size class, which fits.
+ */
+static void testSizeClasses()
+{
+    CanvasPool&                     pool        = CanvasPool::getInstance();
+    const uint32_t                  FALLBACKS   = pool.getFallbacks();
+    PooledCanvas                    icon;
+    PooledCanvas                    largeIcon;
+    PooledCanvas                    fullScreen;
+    CanvasPool::BucketStatistics    stats;
+
+    TEST_ASSERT_FALSE(icon.isBorrowed());
+    TEST_ASSERT_EQUAL_UINT16(0U, icon.getWidth());
+
+    TEST_ASSERT_TRUE(icon.borrow(8U, 8U));
+    TEST_ASSERT_TRUE(largeIcon.borrow(10U, 10U));
+    TEST_ASSERT_TRUE(fullScreen.borrow(DISPLAY_WIDTH, DISPLAY_HEIGHT));
+
+    TEST_ASSERT_TRUE(icon.isBorrowed());
+    TEST_ASSERT_FALSE(icon.isContentPreserved());
+    TEST_ASSERT_EQUAL_UINT16(8U, icon.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(8U, icon.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0U, icon.getColor(7, 7));
+
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT32(64U * sizeof(Color), stats.capacity);
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.canvases);
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.used);
+
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(1U, stats));
+    TEST_ASSERT_EQUAL_UINT32(256U * sizeof(Color), stats.capacity);
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.used);
+
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(2U, stats));
+    TEST_ASSERT_EQUAL_UINT32(1024U * sizeof(Color), stats.capacity);
+    TEST_ASSERT_EQUAL_UINT8(0U, stats.canvases);
+
+    /* The largest size class is the display size. */
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(CanvasPool::BUCKET_COUNT - 1U, stats));
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(Color), stats.capacity);
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.used);
+
+    TEST_ASSERT_FALSE(pool.getBucketStatistics(CanvasPool::BUCKET_COUNT, stats));
+
+    /* A borrow with a different size gives the old pixel buffer back. */
+    TEST_ASSERT_TRUE(icon.borrow(16U, 16U));
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT8(0U, stats.used);
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(1U, stats));
+    TEST_ASSERT_EQUAL_UINT8(2U, stats.used);
+    TEST_ASSERT_EQUAL_UINT8(2U, stats.peakUsed);
+
+    TEST_ASSERT_EQUAL_UINT32(FALLBACKS, pool.getFallbacks());
+
+    icon.giveBack();
+    largeIcon.giveBack();
+    fullScreen.giveBack();
+
+    /* Only one spare canvas is kept per bucket. */
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(1U, stats));
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.canvases);
+    TEST_ASSERT_EQUAL_UINT8(0U, stats.used);
+}
+
+/**
+ * The size classes are in byte, therefore a RGB565 canvas needs less space.
+ */
+static void testRgb565()
+{
+    CanvasPool&                     pool        = CanvasPool::getInstance();
+    const uint32_t                  FALLBACKS   = pool.getFallbacks();
+    PooledCanvasRgb565              icon;
+    CanvasPool::BucketStatistics    stats;
+
+    /* Twice the pixels of a 8x8 canvas with concrete color still fit into the smallest size class. */
+    TEST_ASSERT_TRUE(icon.borrow(16U, 8U));
+    TEST_ASSERT_EQUAL_UINT16(16U, icon.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(8U, icon.getHeight());
+    TEST_ASSERT_EQUAL_UINT16(0U, icon.getColor(15, 7).to565());
+
+    icon.drawPixel(15, 7, Rgb565(255U, 0U, 0U));
+    TEST_ASSERT_EQUAL_UINT16(0xf800U, icon.getColor(15, 7).to565());
+
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.used);
+    TEST_ASSERT_EQUAL_UINT32(FALLBACKS, pool.getFallbacks());
+
+    /* The content is preserved for the same owner. */
+    icon.giveBack(true);
+    TEST_ASSERT_TRUE(icon.borrow(16U, 8U));
+    TEST_ASSERT_TRUE(icon.isContentPreserved());
+    TEST_ASSERT_EQUAL_UINT16(0xf800U, icon.getColor(15, 7).to565());
+
+    icon.giveBack();
+}
+
+/**
+ * A preserved pixel buffer is given back to the same owner with its content.
+ */
+static void testPreservedContent()
+{
+    CanvasPool&                     pool    = CanvasPool::getInstance();
+    PooledCanvas                    canvas;
+    CanvasPool::BucketStatistics    stats;
+
+    TEST_ASSERT_TRUE(canvas.borrow(8U, 8U));
+    canvas.drawPixel(3, 4, 0x123456U);
+    canvas.giveBack(true);
+
+    TEST_ASSERT_FALSE(canvas.isBorrowed());
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.canvases);
+    TEST_ASSERT_EQUAL_UINT8(0U, stats.used);
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.preserved);
+
+    TEST_ASSERT_TRUE(canvas.borrow(8U, 8U));
+    TEST_ASSERT_TRUE(canvas.isContentPreserved());
+    TEST_ASSERT_EQUAL_UINT32(0x123456U, canvas.getColor(3, 4));
+
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.canvases);
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.used);
+    TEST_ASSERT_EQUAL_UINT8(0U, stats.preserved);
+
+    canvas.giveBack();
+}
+
+/**
+ * The preserved content is lost, if another owner takes the pixel buffer.
+ */
+static void testContentLost()
+{
+    CanvasPool&                     pool    = CanvasPool::getInstance();
+    PooledCanvas                    canvas;
+    PooledCanvas                    other;
+    CanvasPool::BucketStatistics    stats;
+
+    TEST_ASSERT_TRUE(canvas.borrow(8U, 8U));
+    canvas.drawPixel(0, 0, 0x123456U);
+    canvas.giveBack(true);
+
+    /* No spare canvas left, so the preserved one is taken over. */
+    TEST_ASSERT_TRUE(other.borrow(8U, 8U));
+    TEST_ASSERT_FALSE(other.isContentPreserved());
+    TEST_ASSERT_EQUAL_UINT32(0U, other.getColor(0, 0));
+
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT8(1U, stats.canvases);
+    TEST_ASSERT_EQUAL_UINT8(0U, stats.preserved);
+
+    other.drawPixel(0, 0, 0xabcdefU);
+    other.giveBack();
+
+    TEST_ASSERT_TRUE(canvas.borrow(8U, 8U));
+    TEST_ASSERT_FALSE(canvas.isContentPreserved());
+    TEST_ASSERT_EQUAL_UINT32(0U, canvas.getColor(0, 0));
+
+    /* A destroyed owner releases its preserved content. */
+    {
+        PooledCanvas temporary;
+
+        TEST_ASSERT_TRUE(temporary.borrow(8U, 8U));
+        temporary.giveBack(true);
+
+        TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+        TEST_ASSERT_EQUAL_UINT8(1U, stats.preserved);
+    }
+
+    TEST_ASSERT_TRUE(pool.getBucketStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT8(0U, stats.preserved);
+
+    canvas.giveBack();
+}
+
+/**
+ * Requests, which the pool can't serve, are served by the heap and counted.
+ */
+static void testFallback()
+{
+    CanvasPool&     pool        = CanvasPool::getInstance();
+    const uint32_t  FALLBACKS   = pool.getFallbacks();
+    const uint32_t  LIVE_BLOCKS = getLiveBlocks();
+    PooledCanvas    canvases[CanvasPool::MAX_CANVASES + 1U];
+    PooledCanvas    tooLarge;
+    uint8_t         idx         = 0U;
+
+    /* Larger than the display. */
+    TEST_ASSERT_TRUE(tooLarge.borrow(DISPLAY_WIDTH + 1U, DISPLAY_HEIGHT));
+    TEST_ASSERT_EQUAL_UINT32(FALLBACKS + 1U, pool.getFallbacks());
+    TEST_ASSERT_EQUAL_UINT32(0U, tooLarge.getColor(DISPLAY_WIDTH, 0));
+
+    tooLarge.giveBack(true);
+    TEST_ASSERT_EQUAL_UINT32(LIVE_BLOCKS, getLiveBlocks());
+
+    /* Pool exhausted. */
+    for(idx = 0U; idx < CanvasPool::MAX_CANVASES; ++idx)
+    {
+        TEST_ASSERT_TRUE(canvases[idx].borrow(8U, 8U));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(FALLBACKS + 1U, pool.getFallbacks());
+
+    TEST_ASSERT_TRUE(canvases[CanvasPool::MAX_CANVASES].borrow(8U, 8U));
+    TEST_ASSERT_EQUAL_UINT32(FALLBACKS + 2U, pool.getFallbacks());
+
+    for(idx = 0U; idx <= CanvasPool::MAX_CANVASES; ++idx)
+    {
+        canvases[idx].giveBack();
+    }
+
+    /* A empty canvas needs no pixel buffer. */
+    TEST_ASSERT_FALSE(tooLarge.borrow(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(FALLBACKS + 2U, pool.getFallbacks());
+}
+
+/**
+ * The pool stays available, as long as canvases are borrowed.
+ */
+static void testEndWhileBorrowed()
+{
+    CanvasPool&     pool        = CanvasPool::getInstance();
+    PooledCanvas    canvas;
+    PooledCanvas    spare;
+    uint32_t        fallbacks   = 0U;
+
+    /* Release all spare canvases of the other tests. */
+    pool.end();
+    TEST_ASSERT_TRUE(pool.begin(DISPLAY_WIDTH, DISPLAY_HEIGHT));
+    TEST_ASSERT_EQUAL_UINT32(0U, getLiveBlocks());
+
+    TEST_ASSERT_TRUE(canvas.borrow(8U, 8U));
+    TEST_ASSERT_TRUE(spare.borrow(16U, 16U));
+    spare.giveBack();
+    TEST_ASSERT_EQUAL_UINT32(2U, getLiveBlocks());
+
+    /* The spare canvas is released, the borrowed one is kept. */
+    pool.end();
+    TEST_ASSERT_EQUAL_UINT32(1U, getLiveBlocks());
+    TEST_ASSERT_TRUE(canvas.isBorrowed());
+    canvas.drawPixel(1, 1, 0x123456U);
+    TEST_ASSERT_EQUAL_UINT32(0x123456U, canvas.getColor(1, 1));
+
+    /* Still served by the pool. */
+    fallbacks = pool.getFallbacks();
+    TEST_ASSERT_TRUE(spare.borrow(16U, 16U));
+    TEST_ASSERT_EQUAL_UINT32(fallbacks, pool.getFallbacks());
+    spare.giveBack();
+
+    canvas.giveBack();
+    pool.end();
+    TEST_ASSERT_EQUAL_UINT32(0U, getLiveBlocks());
+
+    /* Without pool, the heap is used. */
+    TEST_ASSERT_TRUE(canvas.borrow(8U, 8U));
+    TEST_ASSERT_EQUAL_UINT32(fallbacks + 1U, pool.getFallbacks());
+    canvas.giveBack();
+    TEST_ASSERT_EQUAL_UINT32(0U, getLiveBlocks());
+}
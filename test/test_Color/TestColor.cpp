@@ -34,6 +34,8 @@
  *****************************************************************************/
 #include <unity.h>
 #include <YAColor.h>
+#include <YAGfxBitmap.h>
+#include <YAGfxBlit.h>
 #include <Util.h>
 
 /******************************************************************************
@@ -53,6 +55,8 @@
  *****************************************************************************/
 
 static void testColor();
+static void testPixelFormats();
+static void testBlit();
 
 /******************************************************************************
  * Local Variables
@@ -88,6 +92,8 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testColor);
+    RUN_TEST(testPixelFormats);
+    RUN_TEST(testBlit);
 
     return UNITY_END();
 }
@@ -182,3 +188,93 @@ static void testColor()
 
     return;
 }
+
+/**
+ * Test the compact pixel formats.
+ */
+static void testPixelFormats()
+{
+    Color           color(0xffU, 0x80U, 0x00U);
+    Rgb565          rgb565(color);
+    Rgb888Packed    rgb888Packed(color);
+    Color           result;
+
+    /* Compact formats need less memory per pixel. */
+    TEST_ASSERT_EQUAL(2U, sizeof(Rgb565));
+    TEST_ASSERT_EQUAL(3U, sizeof(Rgb888Packed));
+
+    /* Full bright stays full bright, lost bits are replicated. */
+    TEST_ASSERT_EQUAL_UINT16(0xfc00U, rgb565.to565());
+    result = rgb565;
+    TEST_ASSERT_EQUAL_UINT8(0xffU, result.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x82U, result.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x00U, result.getBlue());
+
+    /* Packed RGB888 is lossless. */
+    result = rgb888Packed;
+    TEST_ASSERT_EQUAL_UINT32(0xff8000U, static_cast<uint32_t>(result));
+
+    /* The intensity is applied on conversion. */
+    color = 0xc8c8c8U;
+    color.setIntensity(192U);
+    rgb888Packed = color;
+    TEST_ASSERT_EQUAL_UINT8(0x96U, rgb888Packed.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x96U, rgb888Packed.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x96U, rgb888Packed.getBlue());
+
+    return;
+}
+
+/**
+ * Test the blit and convert kernels.
+ */
+static void testBlit()
+{
+    YAGfxStaticBitmap<4U, 4U>               canvas;
+    YAGfxStaticBitmapRgb565<2U, 2U>         bitmapRgb565;
+    YAGfxStaticBitmapRgb888Packed<2U, 2U>   bitmapRgb888Packed;
+    YAGfxStaticBitmapPalette8<2U, 2U>       bitmapPalette8;
+    YAGfxPalette                            palette;
+
+    /* Convert RGB565 to packed RGB888 and blit it partly outside the canvas. */
+    bitmapRgb565.fillScreen(Rgb565(0xffU, 0xffU, 0xffU));
+    bitmapRgb565.drawPixel(1, 1, Rgb565(0xffU, 0x00U, 0x00U));
+    YAGfxBlit::blit(bitmapRgb888Packed, 0, 0, bitmapRgb565);
+    TEST_ASSERT_EQUAL_UINT8(0xffU, bitmapRgb888Packed.getColor(1, 1).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x00U, bitmapRgb888Packed.getColor(1, 1).getGreen());
+
+    canvas.fillScreen(ColorDef::BLACK);
+    YAGfxBlit::blit(canvas, 3, -1, bitmapRgb888Packed);
+    TEST_ASSERT_EQUAL_UINT32(0x000000U, static_cast<uint32_t>(canvas.getColor(2, 0)));
+    TEST_ASSERT_EQUAL_UINT32(0xffffffU, static_cast<uint32_t>(canvas.getColor(3, 0)));
+    TEST_ASSERT_EQUAL_UINT32(0x000000U, static_cast<uint32_t>(canvas.getColor(3, 1)));
+
+    /* Quantize to a palette and resolve it again. */
+    TEST_ASSERT_TRUE(palette.create(3U));
+    palette.setColor(0U, ColorDef::BLACK);
+    palette.setColor(1U, ColorDef::RED);
+    palette.setColor(2U, ColorDef::WHITE);
+    TEST_ASSERT_EQUAL_UINT8(1U, palette.findNearest(Color(0xe0U, 0x10U, 0x10U)));
+
+    YAGfxBlit::quantize(bitmapPalette8, 0, 0, bitmapRgb565, palette);
+    TEST_ASSERT_EQUAL_UINT8(2U, bitmapPalette8.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT8(1U, bitmapPalette8.getColor(1, 1));
+
+    canvas.fillScreen(ColorDef::BLACK);
+    YAGfxBlit::blit(canvas, 0, 0, bitmapPalette8, palette);
+    TEST_ASSERT_EQUAL_UINT32(0xffffffU, static_cast<uint32_t>(canvas.getColor(0, 0)));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, static_cast<uint32_t>(canvas.getColor(1, 1)));
+    TEST_ASSERT_EQUAL_UINT32(0x000000U, static_cast<uint32_t>(canvas.getColor(2, 2)));
+
+    /* Dim globally 25% darker, the source keeps unchanged. */
+    canvas.fillScreen(ColorDef::BLACK);
+    YAGfxBlit::blitDimmed(canvas, 0, 0, bitmapRgb888Packed, 192U);
+    TEST_ASSERT_EQUAL_UINT32(0xc0c0c0U, static_cast<uint32_t>(canvas.getColor(0, 0)));
+    TEST_ASSERT_EQUAL_UINT32(0xc00000U, static_cast<uint32_t>(canvas.getColor(1, 1)));
+    TEST_ASSERT_EQUAL_UINT8(0xffU, bitmapRgb888Packed.getColor(0, 0).getRed());
+
+    palette.release();
+    TEST_ASSERT_EQUAL_UINT16(0U, palette.getSize());
+
+    return;
+}
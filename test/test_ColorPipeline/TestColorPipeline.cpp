@@ -0,0 +1,272 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color pipeline tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <ColorPipeline.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint32_t sumOverDitherCycle(ColorPipeline& pipeline, uint32_t index, uint8_t value);
+static void testIdentity();
+static void testLuminance();
+static void testDithering();
+static void testGamma();
+static void testWhiteBalance();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testIdentity);
+    RUN_TEST(testLuminance);
+    RUN_TEST(testDithering);
+    RUN_TEST(testGamma);
+    RUN_TEST(testWhiteBalance);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Convert a gray pixel over a whole dither cycle and sum up the red output.
+ *
+ * @param[in] pipeline  Color pipeline
+ * @param[in] index     Pixel index
+ * @param[in] value     Value of every color channel
+ *
+ * @return Sum of the red channel output
+ */
+static uint32_t sumOverDitherCycle(ColorPipeline& pipeline, uint32_t index, uint8_t value)
+{
+    uint32_t    sum     = 0U;
+    uint8_t     frame   = 0U;
+
+    for(frame = 0U; frame < (1U << ColorPipeline::FRACTION_BITS); ++frame)
+    {
+        uint8_t red     = value;
+        uint8_t green   = value;
+        uint8_t blue    = value;
+
+        pipeline.beginFrame();
+        pipeline.apply(index, red, green, blue);
+
+        sum += red;
+    }
+
+    return sum;
+}
+
+/**
+ * Without calibration and with full luminance, the colors are not changed.
+ */
+static void testIdentity()
+{
+    ColorPipeline   pipeline;
+    uint16_t        value       = 0U;
+    uint8_t         frame       = 0U;
+
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, pipeline.getLuminance());
+
+    for(frame = 0U; frame < (1U << ColorPipeline::FRACTION_BITS); ++frame)
+    {
+        pipeline.beginFrame();
+
+        for(value = 0U; value <= UINT8_MAX; ++value)
+        {
+            uint8_t red     = static_cast<uint8_t>(value);
+            uint8_t green   = static_cast<uint8_t>(value);
+            uint8_t blue    = static_cast<uint8_t>(value);
+
+            pipeline.apply(value, red, green, blue);
+
+            TEST_ASSERT_EQUAL_UINT8(value, red);
+            TEST_ASSERT_EQUAL_UINT8(value, green);
+            TEST_ASSERT_EQUAL_UINT8(value, blue);
+        }
+    }
+}
+
+/**
+ * The luminance is applied with internal precision, but is not part of the
+ * lookup table.
+ */
+static void testLuminance()
+{
+    ColorPipeline pipeline;
+
+    pipeline.setLuminance(128U);
+    TEST_ASSERT_EQUAL_UINT8(128U, pipeline.getLuminance());
+
+    TEST_ASSERT_EQUAL_UINT16(ColorPipeline::PRECISE_VALUE_MAX, pipeline.getPreciseValue(0U, UINT8_MAX));
+    TEST_ASSERT_EQUAL_UINT16(16U, pipeline.getPreciseValue(0U, 1U));
+    TEST_ASSERT_EQUAL_UINT16(0U, pipeline.getPreciseValue(0U, 0U));
+
+    /* Full white at half luminance needs no dithering. */
+    TEST_ASSERT_EQUAL_UINT32(128U * 16U, sumOverDitherCycle(pipeline, 0U, UINT8_MAX));
+
+    /* No luminance, no light. */
+    pipeline.setLuminance(0U);
+    TEST_ASSERT_EQUAL_UINT32(0U, sumOverDitherCycle(pipeline, 0U, UINT8_MAX));
+
+    /* Full luminance again. */
+    pipeline.setLuminance(UINT8_MAX);
+    TEST_ASSERT_EQUAL_UINT32(UINT8_MAX * 16U, sumOverDitherCycle(pipeline, 0U, UINT8_MAX));
+    TEST_ASSERT_EQUAL_UINT32(16U, sumOverDitherCycle(pipeline, 0U, 1U));
+}
+
+/**
+ * Values between two output levels are dithered over time.
+ */
+static void testDithering()
+{
+    ColorPipeline   pipeline;
+    uint32_t        index       = 0U;
+
+    pipeline.setLuminance(128U);
+
+    /* A value of 1 at half luminance is 0.5 output levels. */
+    for(index = 0U; index < 16U; ++index)
+    {
+        TEST_ASSERT_EQUAL_UINT32(8U, sumOverDitherCycle(pipeline, index, 1U));
+    }
+
+    /* A value of 3 at 10% luminance is 0.3 output levels: 4.7/16 rounded to 5/16. */
+    pipeline.setLuminance(25U);
+    TEST_ASSERT_EQUAL_UINT16(48U, pipeline.getPreciseValue(0U, 3U));
+    TEST_ASSERT_EQUAL_UINT32(5U, sumOverDitherCycle(pipeline, 0U, 3U));
+}
+
+/**
+ * The gamma correction is part of the lookup table.
+ */
+static void testGamma()
+{
+    ColorPipeline pipeline;
+
+    pipeline.setCalibration(2.2F, UINT8_MAX, UINT8_MAX, UINT8_MAX);
+
+    TEST_ASSERT_EQUAL_UINT16(0U, pipeline.getPreciseValue(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT16(4080U, pipeline.getPreciseValue(0U, UINT8_MAX));
+    TEST_ASSERT_EQUAL_UINT16(896U, pipeline.getPreciseValue(0U, 128U));
+
+    /* Low values are below one output level, but not lost: 15/16 by dithering. */
+    TEST_ASSERT_EQUAL_UINT16(15U, pipeline.getPreciseValue(0U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(15U, sumOverDitherCycle(pipeline, 0U, 20U));
+}
+
+/**
+ * The white balance scales every channel separately.
+ */
+static void testWhiteBalance()
+{
+    ColorPipeline   pipeline;
+    uint8_t         red         = UINT8_MAX;
+    uint8_t         green       = UINT8_MAX;
+    uint8_t         blue        = UINT8_MAX;
+
+    pipeline.setCalibration(1.0F, UINT8_MAX, 200U, 128U);
+
+    TEST_ASSERT_EQUAL_UINT16(4080U, pipeline.getPreciseValue(0U, UINT8_MAX));
+    TEST_ASSERT_EQUAL_UINT16(3200U, pipeline.getPreciseValue(1U, UINT8_MAX));
+    TEST_ASSERT_EQUAL_UINT16(2048U, pipeline.getPreciseValue(2U, UINT8_MAX));
+
+    pipeline.apply(0U, red, green, blue);
+
+    TEST_ASSERT_EQUAL_UINT8(255U, red);
+    TEST_ASSERT_EQUAL_UINT8(200U, green);
+    TEST_ASSERT_EQUAL_UINT8(128U, blue);
+}
@@ -34,6 +34,7 @@
  *****************************************************************************/
 #include <unity.h>
 #include <LinkedList.hpp>
+#include <ObjectPool.hpp>
 #include <Util.h>
 
 /******************************************************************************
@@ -48,11 +49,59 @@
  * Types and classes
  *****************************************************************************/
 
+/**
+ * Allocator, which takes the list elements from a small pool.
+ */
+class TestListAllocator
+{
+public:
+
+    /** Pool of list elements */
+    typedef ObjectPool<ListElement<uint32_t>, 4U> Pool;
+
+    /**
+     * Get the pool of list elements.
+     *
+     * @return Pool of list elements
+     */
+    static Pool& getPool()
+    {
+        static Pool pool("test"); /* singleton idiom to force initialization in the first usage. */
+
+        return pool;
+    }
+
+    /**
+     * Create a list element.
+     *
+     * @param[in] element   Element
+     * @param[in] prev      Previous list element
+     * @param[in] next      Next list element
+     *
+     * @return If successful, it will return the list element otherwise nullptr.
+     */
+    static ListElement<uint32_t>* create(uint32_t& element, ListElement<uint32_t>* prev, ListElement<uint32_t>* next)
+    {
+        return getPool().create(element, prev, next);
+    }
+
+    /**
+     * Destroy a list element.
+     *
+     * @param[in] listElement   List element
+     */
+    static void destroy(ListElement<uint32_t>* listElement)
+    {
+        getPool().destroy(listElement);
+    }
+};
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
 
 static void testDoublyLinkedList();
+static void testPooledDoublyLinkedList();
 
 /******************************************************************************
  * Local Variables
@@ -88,6 +137,7 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testDoublyLinkedList);
+    RUN_TEST(testPooledDoublyLinkedList);
 
     return UNITY_END();
 }
@@ -270,3 +320,74 @@ static void testDoublyLinkedList()
 
     return;
 }
+
+/**
+ * Doubly linked list tests, with list elements from a pool.
+ */
+static void testPooledDoublyLinkedList()
+{
+    TestListAllocator::Pool&                                pool    = TestListAllocator::getPool();
+    DLinkedList<uint32_t, TestListAllocator>                list;
+    DLinkedListIterator<uint32_t, TestListAllocator>        it(list);
+    uint32_t                                                index   = 0U;
+    const uint32_t                                          max     = 6U;
+
+    TEST_ASSERT_EQUAL(4U, pool.getCapacity());
+    TEST_ASSERT_EQUAL(0U, pool.getUsed());
+
+    /* More elements than the pool capacity, the remaining ones are allocated on the heap. */
+    for(index = 1U; index <= max; ++index)
+    {
+        TEST_ASSERT_TRUE(list.append(index));
+    }
+
+    TEST_ASSERT_EQUAL(max, list.getNumOfElements());
+    TEST_ASSERT_EQUAL(4U, pool.getUsed());
+    TEST_ASSERT_EQUAL(4U, pool.getPeak());
+    TEST_ASSERT_EQUAL(2U, pool.getFallbacks());
+
+    /* Check content */
+    TEST_ASSERT_TRUE(it.first());
+    for(index = 1U; index <= max; ++index)
+    {
+        TEST_ASSERT_EQUAL(index, *it.current());
+        (void)it.next();
+    }
+
+    /* Remove a pooled element, it shall be given back to the pool. */
+    TEST_ASSERT_TRUE(it.first());
+    it.remove();
+    TEST_ASSERT_EQUAL(max - 1U, list.getNumOfElements());
+    TEST_ASSERT_EQUAL(3U, pool.getUsed());
+
+    /* The free slot is used again. */
+    TEST_ASSERT_TRUE(list.append(index));
+    TEST_ASSERT_EQUAL(4U, pool.getUsed());
+    TEST_ASSERT_EQUAL(2U, pool.getFallbacks());
+
+    /* Copy it, the pool is exhausted. */
+    {
+        DLinkedList<uint32_t, TestListAllocator>                copyOfList  = list;
+        DLinkedListConstIterator<uint32_t, TestListAllocator>   itListCopy(copyOfList);
+
+        TEST_ASSERT_EQUAL(list.getNumOfElements(), copyOfList.getNumOfElements());
+        TEST_ASSERT_EQUAL(4U, pool.getUsed());
+
+        TEST_ASSERT_TRUE(it.first());
+        TEST_ASSERT_TRUE(itListCopy.first());
+        for(index = 0U; index < list.getNumOfElements(); ++index)
+        {
+            TEST_ASSERT_EQUAL_INT(*it.current(), *itListCopy.current());
+            (void)it.next();
+            (void)itListCopy.next();
+        }
+    }
+
+    /* All elements are given back. */
+    list.clear();
+    TEST_ASSERT_EQUAL(0U, list.getNumOfElements());
+    TEST_ASSERT_EQUAL(0U, pool.getUsed());
+    TEST_ASSERT_EQUAL(4U, pool.getPeak());
+
+    return;
+}
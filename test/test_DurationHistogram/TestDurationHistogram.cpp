@@ -0,0 +1,175 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test duration histogram.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <DurationHistogram.hpp>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testDurationHistogram();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testDurationHistogram);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test duration histogram.
+ */
+static void testDurationHistogram()
+{
+    DurationHistogram   histogram;
+    uint8_t             idx         = 0U;
+
+    /* All counters must be cleared. */
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getSum());
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getMax());
+
+    for(idx = 0U; idx < DurationHistogram::BUCKET_COUNT; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0U, histogram.getBucket(idx));
+    }
+
+    /* Invalid bucket */
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getBucket(DurationHistogram::BUCKET_COUNT));
+
+    /* Bucket limits double, the last bucket has no limit. */
+    TEST_ASSERT_EQUAL_UINT32(250U, DurationHistogram::getBucketLimit(0U));
+    TEST_ASSERT_EQUAL_UINT32(500U, DurationHistogram::getBucketLimit(1U));
+    TEST_ASSERT_EQUAL_UINT32(32000U, DurationHistogram::getBucketLimit(DurationHistogram::BUCKET_COUNT - 2U));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, DurationHistogram::getBucketLimit(DurationHistogram::BUCKET_COUNT - 1U));
+
+    /* Record durations at the bucket borders. */
+    histogram.record(0U);
+    histogram.record(249U);
+    histogram.record(250U);
+    histogram.record(499U);
+    histogram.record(1000U);
+    histogram.record(100000U);
+
+    TEST_ASSERT_EQUAL_UINT32(6U, histogram.getCount());
+    TEST_ASSERT_EQUAL_UINT32(101998U, histogram.getSum());
+    TEST_ASSERT_EQUAL_UINT32(100000U, histogram.getMax());
+    TEST_ASSERT_EQUAL_UINT32(2U, histogram.getBucket(0U));
+    TEST_ASSERT_EQUAL_UINT32(2U, histogram.getBucket(1U));
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getBucket(2U));
+    TEST_ASSERT_EQUAL_UINT32(1U, histogram.getBucket(3U));
+    TEST_ASSERT_EQUAL_UINT32(1U, histogram.getBucket(DurationHistogram::BUCKET_COUNT - 1U));
+
+    /* A smaller duration doesn't change the max. duration. */
+    histogram.record(10U);
+    TEST_ASSERT_EQUAL_UINT32(100000U, histogram.getMax());
+
+    /* Reset clears all counters. */
+    histogram.reset();
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getSum());
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getMax());
+
+    for(idx = 0U; idx < DurationHistogram::BUCKET_COUNT; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0U, histogram.getBucket(idx));
+    }
+
+    return;
+}
@@ -35,6 +35,12 @@
 #include <unity.h>
 #include <Util.h>
 
+#include <YAGfxContext.h>
+#include <YAGfxAA.h>
+#include <YAGfxBitmap.h>
+#include <YAScaledFont.h>
+#include <YAGfxSubPixel.h>
+
 #include "../common/YAGfxTest.hpp"
 
 /******************************************************************************
@@ -54,6 +60,10 @@
  *****************************************************************************/
 
 static void testGfx();
+static void testContext();
+static void testAntiAliasing();
+static void testScaledFont();
+static void testSubPixel();
 
 /******************************************************************************
  * Local Variables
@@ -89,6 +99,10 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testGfx);
+    RUN_TEST(testContext);
+    RUN_TEST(testAntiAliasing);
+    RUN_TEST(testScaledFont);
+    RUN_TEST(testSubPixel);
 
     return UNITY_END();
 }
@@ -234,5 +248,355 @@ static void testGfx()
     testGfx.fillScreen(0U);
     TEST_ASSERT_TRUE(testGfx.verify(0, 0, YAGfxTest::WIDTH, YAGfxTest::HEIGHT, 0U));
 
+    /* Test drawing a bitmap partly outside, only the visible part shall be drawn. */
+    testGfx.setCallCounterDrawPixel(0U);
+    testGfx.drawBitmap(YAGfxTest::WIDTH / 2, -1, bitmap);
+    TEST_ASSERT_EQUAL_UINT32((YAGfxTest::WIDTH / 2U) * (YAGfxTest::HEIGHT - 1U), testGfx.getCallCounterDrawPixel());
+    TEST_ASSERT_EQUAL_UINT16(bitmap.getColor(0, 1), testGfx.getColor(YAGfxTest::WIDTH / 2, 0));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, YAGfxTest::WIDTH / 2U, YAGfxTest::HEIGHT, 0U));
+
+    /* Clear screen */
+    testGfx.fillScreen(0U);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, YAGfxTest::WIDTH, YAGfxTest::HEIGHT, 0U));
+
+    return;
+}
+
+/**
+ * Test the translated and clipped drawing context.
+ */
+static void testContext()
+{
+    const Color                 COLOR   = 0x1234;
+    const Color                 COLOR2  = 0x5678;
+    YAGfxTest                   testGfx;
+    YAGfxStaticBitmap<8U, 4U>   bitmap;
+    YAGfxStaticBitmap<2U, 2U>   icon;
+    uint16_t                    stride  = 0U;
+
+    /* Context over a canvas without direct pixel buffer access. */
+    {
+        YAGfxContext context(testGfx, 2, 3, 4U, 4U);
+
+        TEST_ASSERT_EQUAL_UINT16(4U, context.getWidth());
+        TEST_ASSERT_EQUAL_UINT16(4U, context.getHeight());
+        TEST_ASSERT_NULL(context.getSpan(0, 0, stride));
+
+        /* Only the window shall be drawn, with clipping done once. */
+        testGfx.setCallCounterDrawPixel(0U);
+        context.fillRect(-2, -2, 10U, 10U, COLOR);
+        TEST_ASSERT_EQUAL_UINT32(16U, testGfx.getCallCounterDrawPixel());
+        TEST_ASSERT_TRUE(testGfx.verify(2, 3, 4U, 4U, COLOR));
+        TEST_ASSERT_TRUE(testGfx.verify(0, 0, YAGfxTest::WIDTH, 3U, 0U));
+        TEST_ASSERT_TRUE(testGfx.verify(0, 3, 2U, 4U, 0U));
+        TEST_ASSERT_TRUE(testGfx.verify(6, 3, YAGfxTest::WIDTH - 6U, 4U, 0U));
+
+        /* Pixels outside the window are not drawn. */
+        testGfx.setCallCounterDrawPixel(0U);
+        context.drawPixel(-1, 0, COLOR2);
+        context.drawPixel(4, 0, COLOR2);
+        TEST_ASSERT_EQUAL_UINT32(0U, testGfx.getCallCounterDrawPixel());
+
+        context.drawPixel(0, 0, COLOR2);
+        TEST_ASSERT_EQUAL_UINT16(COLOR2, testGfx.getColor(2, 3));
+        TEST_ASSERT_EQUAL_UINT16(COLOR2, context.getColor(0, 0));
+    }
+
+    /* Context over a bitmap, which is partly outside the bitmap. */
+    bitmap.fillScreen(0U);
+    icon.fillScreen(COLOR2);
+
+    {
+        YAGfxContext    context(bitmap, 6, -1, 4U, 4U);
+        int16_t         x1  = 0;
+        int16_t         y1  = 0;
+        int16_t         x2  = 0;
+        int16_t         y2  = 0;
+
+        /* The clipping rectangle is in context coordinates. */
+        context.getClipRect(x1, y1, x2, y2);
+        TEST_ASSERT_EQUAL_INT16(0, x1);
+        TEST_ASSERT_EQUAL_INT16(1, y1);
+        TEST_ASSERT_EQUAL_INT16(2, x2);
+        TEST_ASSERT_EQUAL_INT16(4, y2);
+
+        /* Pixels are written directly into the bitmap. */
+        TEST_ASSERT_EQUAL_PTR(&bitmap.getColor(6, 0), context.getSpan(0, 1, stride));
+        TEST_ASSERT_EQUAL_UINT16(8U, stride);
+        TEST_ASSERT_NULL(context.getSpan(0, 0, stride));
+
+        context.fillScreen(COLOR);
+
+        /* Nested context shall be clipped by its parent too. */
+        {
+            YAGfxContext subContext(context, 1, 1, 4U, 4U);
+
+            subContext.drawPixel(0, 0, COLOR2);
+            subContext.drawPixel(1, 0, COLOR2);
+            TEST_ASSERT_EQUAL_PTR(&bitmap.getColor(7, 0), subContext.getSpan(0, 0, stride));
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(COLOR, bitmap.getColor(6, 0));
+    TEST_ASSERT_EQUAL_UINT16(COLOR2, bitmap.getColor(7, 0));
+    TEST_ASSERT_EQUAL_UINT16(COLOR, bitmap.getColor(6, 2));
+    TEST_ASSERT_EQUAL_UINT16(COLOR, bitmap.getColor(7, 2));
+    TEST_ASSERT_EQUAL_UINT16(0U, bitmap.getColor(6, 3));
+    TEST_ASSERT_EQUAL_UINT16(0U, bitmap.getColor(5, 0));
+
+    /* Bitmaps are copied row by row, with clipping. */
+    {
+        YAGfxContext context(bitmap, 1, 1, 2U, 2U);
+
+        context.drawBitmap(1, 1, icon);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(COLOR2, bitmap.getColor(2, 2));
+    TEST_ASSERT_EQUAL_UINT16(0U, bitmap.getColor(3, 2));
+    TEST_ASSERT_EQUAL_UINT16(0U, bitmap.getColor(2, 3));
+    TEST_ASSERT_EQUAL_UINT16(0U, bitmap.getColor(1, 1));
+}
+
+/**
+ * Test the anti-aliased primitives.
+ */
+static void testAntiAliasing()
+{
+    const Color                     WHITE   = 0xFFFFFF;
+    YAGfxStaticBitmap<16U, 16U>     bitmap;
+    YAGfxAA::Point                  square[4U];
+
+    /* Fixed-point maths */
+    TEST_ASSERT_EQUAL_INT32(0, YAGfxAA::sinDeg(0));
+    TEST_ASSERT_EQUAL_INT32(YAGfxAA::TRIGO_ONE, YAGfxAA::sinDeg(90));
+    TEST_ASSERT_EQUAL_INT32(-YAGfxAA::TRIGO_ONE, YAGfxAA::sinDeg(-90));
+    TEST_ASSERT_EQUAL_INT32(YAGfxAA::TRIGO_ONE / 2, YAGfxAA::sinDeg(390));
+    TEST_ASSERT_EQUAL_INT32(-YAGfxAA::TRIGO_ONE, YAGfxAA::cosDeg(180));
+    TEST_ASSERT_EQUAL_UINT32(0U, YAGfxAA::sqrtInt(0U));
+    TEST_ASSERT_EQUAL_UINT32(3U, YAGfxAA::sqrtInt(15U));
+    TEST_ASSERT_EQUAL_UINT32(4U, YAGfxAA::sqrtInt(16U));
+    TEST_ASSERT_EQUAL_UINT32(65535U, YAGfxAA::sqrtInt(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, YAGfxAA::sqrtInt(UINT64_MAX));
+    TEST_ASSERT_EQUAL_INT32(YAGfxAA::toFixed(8), YAGfxAA::pointOnCircle(YAGfxAA::toFixed(8), YAGfxAA::toFixed(8), YAGfxAA::toFixed(4), 0).x);
+    TEST_ASSERT_EQUAL_INT32(YAGfxAA::toFixed(4), YAGfxAA::pointOnCircle(YAGfxAA::toFixed(8), YAGfxAA::toFixed(8), 4 * YAGfxAA::FIXED_ONE, 0).y);
+
+    /* Line through pixel centers: full coverage on the line, half coverage at the end points. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::drawLine(bitmap, YAGfxAA::toFixed(1), YAGfxAA::toFixed(2), YAGfxAA::toFixed(5), YAGfxAA::toFixed(2), WHITE);
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(1, 2).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(3, 2).getRed());
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(5, 2).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(3, 1).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(3, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(6, 2).getRed());
+
+    /* Steep line between two pixel columns: both are half covered. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::drawLine(bitmap, YAGfxAA::toFixed(2) + YAGfxAA::FIXED_HALF, YAGfxAA::toFixed(1), YAGfxAA::toFixed(2) + YAGfxAA::FIXED_HALF, YAGfxAA::toFixed(6), WHITE);
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(2, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(3, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(1, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(4, 3).getRed());
+
+    /* Line outside is clipped. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::drawLine(bitmap, YAGfxAA::toFixed(-100), YAGfxAA::toFixed(-10), YAGfxAA::toFixed(100), YAGfxAA::toFixed(-10), WHITE);
+    YAGfxAA::drawLine(bitmap, YAGfxAA::toFixed(-100), YAGfxAA::toFixed(15), YAGfxAA::toFixed(100), YAGfxAA::toFixed(15), WHITE);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(0, 15).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(15, 15).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(0, 0).getRed());
+
+    /* Filled circle: inside full, outside untouched, edge partly covered. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::fillCircle(bitmap, 8 * YAGfxAA::FIXED_ONE, 8 * YAGfxAA::FIXED_ONE, 4 * YAGfxAA::FIXED_ONE, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(8, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(5, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(3, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(4, 4).getRed());
+    TEST_ASSERT_TRUE(0U < bitmap.getColor(5, 5).getRed());
+    TEST_ASSERT_TRUE(255U > bitmap.getColor(5, 5).getRed());
+
+    /* Ring: the center stays untouched. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::drawRing(bitmap, 8 * YAGfxAA::FIXED_ONE, 8 * YAGfxAA::FIXED_ONE, 6 * YAGfxAA::FIXED_ONE, 2 * YAGfxAA::FIXED_ONE, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(8, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(3, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(12, 8).getRed());
+
+    /* Ring with a large radius, whose squared distances don't fit into 32 bit. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::drawRing(bitmap, -992 * YAGfxAA::FIXED_ONE, 8 * YAGfxAA::FIXED_ONE, 1000 * YAGfxAA::FIXED_ONE, 16 * YAGfxAA::FIXED_ONE, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(0, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(15, 8).getRed());
+
+    /* Arc over the right half. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::drawArc(bitmap, 8 * YAGfxAA::FIXED_ONE, 8 * YAGfxAA::FIXED_ONE, 6 * YAGfxAA::FIXED_ONE, 2 * YAGfxAA::FIXED_ONE, 0, 180, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(12, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(3, 8).getRed());
+
+    /* Arc over three quarters, only the upper left quarter is missing. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::drawArc(bitmap, 8 * YAGfxAA::FIXED_ONE, 8 * YAGfxAA::FIXED_ONE, 6 * YAGfxAA::FIXED_ONE, 2 * YAGfxAA::FIXED_ONE, 0, 270, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(12, 8).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(3, 10).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(4, 4).getRed());
+
+    /* Polygon with edges on pixel borders and polygon with edges through pixel centers. */
+    bitmap.fillScreen(0U);
+    square[0U].x = 1 * YAGfxAA::FIXED_ONE;
+    square[0U].y = 1 * YAGfxAA::FIXED_ONE;
+    square[1U].x = 3 * YAGfxAA::FIXED_ONE;
+    square[1U].y = 1 * YAGfxAA::FIXED_ONE;
+    square[2U].x = 3 * YAGfxAA::FIXED_ONE;
+    square[2U].y = 3 * YAGfxAA::FIXED_ONE;
+    square[3U].x = 1 * YAGfxAA::FIXED_ONE;
+    square[3U].y = 3 * YAGfxAA::FIXED_ONE;
+    YAGfxAA::fillPolygon(bitmap, square, 4U, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(1, 1).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(2, 2).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(0, 1).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(3, 2).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(1, 3).getRed());
+
+    bitmap.fillScreen(0U);
+    square[0U].x = YAGfxAA::toFixed(5);
+    square[0U].y = YAGfxAA::toFixed(5);
+    square[1U].x = YAGfxAA::toFixed(8);
+    square[1U].y = YAGfxAA::toFixed(5);
+    square[2U].x = YAGfxAA::toFixed(8);
+    square[2U].y = YAGfxAA::toFixed(8);
+    square[3U].x = YAGfxAA::toFixed(5);
+    square[3U].y = YAGfxAA::toFixed(8);
+    YAGfxAA::fillPolygon(bitmap, square, 4U, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(6, 6).getRed());
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(5, 6).getRed());
+    TEST_ASSERT_EQUAL_UINT8(63U, bitmap.getColor(5, 5).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(4, 6).getRed());
+
+    /* Too less vertices are ignored. */
+    bitmap.fillScreen(0U);
+    YAGfxAA::fillPolygon(bitmap, square, 2U, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(6, 6).getRed());
+}
+
+/**
+ * Test the scaled font with its glyph cache.
+ */
+static void testScaledFont()
+{
+    const Color                     WHITE       = 0xFFFFFF;
+    /* Single glyph font with a 1x1 pixel glyph. */
+    const uint8_t                   BITMAP[]    = { 0x80U };
+    GFXglyph                        glyphs[]    = { { 0U, 1U, 1U, 2U, 0, -1 } };
+    GFXfont                         gfxFont     = { const_cast<uint8_t*>(BITMAP), glyphs, 'A', 'A', 2U };
+    YAGfxStaticBitmap<16U, 16U>     bitmap;
+    YAScaledFont                    font(&gfxFont, 2U * YAScaledFont::SCALE_ONE);
+    YAGfxAA::Fixed                  cursorX     = 0;
+    YAGfxAA::Fixed                  cursorY     = 0;
+
+    TEST_ASSERT_EQUAL_INT32(4 * YAGfxAA::FIXED_ONE, font.getHeight());
+    TEST_ASSERT_EQUAL_INT32(8 * YAGfxAA::FIXED_ONE, font.getTextWidth("AAB"));
+
+    /* Pixel aligned, the glyph is a 2x2 block above the base line. */
+    bitmap.fillScreen(0U);
+    cursorX = 1 * YAGfxAA::FIXED_ONE;
+    cursorY = 4 * YAGfxAA::FIXED_ONE;
+    font.drawText(bitmap, cursorX, cursorY, "A", WHITE);
+    TEST_ASSERT_EQUAL_INT32(5 * YAGfxAA::FIXED_ONE, cursorX);
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(1, 2).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(2, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(0, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(3, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(1, 4).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(1, 1).getRed());
+
+    /* Half pixel offset, the glyph is spread over three columns. */
+    bitmap.fillScreen(0U);
+    cursorX = 1 * YAGfxAA::FIXED_ONE + YAGfxAA::FIXED_HALF;
+    cursorY = 4 * YAGfxAA::FIXED_ONE;
+    font.drawChar(bitmap, cursorX, cursorY, 'A', WHITE);
+    TEST_ASSERT_EQUAL_UINT8(128U, bitmap.getColor(1, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(2, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(128U, bitmap.getColor(3, 3).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(4, 3).getRed());
+
+    /* Newline moves the cursor to the next line. */
+    font.drawChar(bitmap, cursorX, cursorY, '\n', WHITE);
+    TEST_ASSERT_EQUAL_INT32(0, cursorX);
+    TEST_ASSERT_EQUAL_INT32(8 * YAGfxAA::FIXED_ONE, cursorY);
+
+    /* Half the size, the glyph covers a quarter of one pixel. */
+    bitmap.fillScreen(0U);
+    font.setScale(YAScaledFont::SCALE_ONE / 2U);
+    cursorX = 0;
+    cursorY = 4 * YAGfxAA::FIXED_ONE;
+    font.drawChar(bitmap, cursorX, cursorY, 'A', WHITE);
+    TEST_ASSERT_EQUAL_UINT8(63U, bitmap.getColor(0, 3).getRed());
+    TEST_ASSERT_EQUAL_INT32(YAGfxAA::FIXED_ONE, cursorX);
+
+    font.clearCache();
+}
+
+/**
+ * Test the horizontal sub-pixel drawing context.
+ */
+static void testSubPixel()
+{
+    const Color                 WHITE   = 0xFFFFFF;
+    YAGfxStaticBitmap<8U, 2U>   bitmap;
+
+    /* Without fraction, the pixels are drawn unchanged. */
+    bitmap.fillScreen(0U);
+    {
+        YAGfxSubPixel subPixelGfx(bitmap, 0U);
+
+        subPixelGfx.drawPixel(1, 0, WHITE);
+    }
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(1, 0).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(2, 0).getRed());
+
+    /* A single pixel shifted by a half pixel is split between two pixels. */
+    bitmap.fillScreen(0U);
+    {
+        YAGfxSubPixel subPixelGfx(bitmap, 128U);
+
+        subPixelGfx.drawPixel(1, 0, WHITE);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(0, 0).getRed());
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(1, 0).getRed());
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(2, 0).getRed());
+    TEST_ASSERT_EQUAL_UINT8(0U, bitmap.getColor(3, 0).getRed());
+
+    /* A solid row keeps solid, only its edges are blended. */
+    bitmap.fillScreen(0U);
+    {
+        YAGfxSubPixel subPixelGfx(bitmap, 64U);
+
+        subPixelGfx.drawPixel(1, 1, WHITE);
+        subPixelGfx.drawPixel(2, 1, WHITE);
+        subPixelGfx.drawPixel(3, 1, WHITE);
+    }
+    TEST_ASSERT_EQUAL_UINT8(191U, bitmap.getColor(1, 1).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(2, 1).getRed());
+    TEST_ASSERT_EQUAL_UINT8(255U, bitmap.getColor(3, 1).getRed());
+    TEST_ASSERT_EQUAL_UINT8(63U, bitmap.getColor(4, 1).getRed());
+
+    /* A pixel left of the canvas is partly shifted into it. */
+    bitmap.fillScreen(0U);
+    {
+        YAGfxSubPixel   subPixelGfx(bitmap, 128U);
+        int16_t         x1          = 0;
+        int16_t         y1          = 0;
+        int16_t         x2          = 0;
+        int16_t         y2          = 0;
+
+        subPixelGfx.getClipRect(x1, y1, x2, y2);
+        TEST_ASSERT_EQUAL_INT16(-1, x1);
+
+        subPixelGfx.drawPixel(-1, 0, WHITE);
+    }
+    TEST_ASSERT_EQUAL_UINT8(127U, bitmap.getColor(0, 0).getRed());
+
     return;
 }
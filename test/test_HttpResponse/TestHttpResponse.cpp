@@ -0,0 +1,357 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test HTTP response parser.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <HttpResponse.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testByteByByte();
+static void testLfOnly();
+static void testLongHeaderLine();
+static void testHeaderLookup();
+static void testCopyAndClear();
+
+static bool isEqual(const HttpStringView& view, const char* str);
+static bool parse(HttpResponse& rsp, const char* data, size_t chunkSize);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Response with CRLF line endings */
+static const char   RSP_CRLF[]  =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/json\r\n"
+    "Content-Length:  42 \r\n"
+    "Connection:close\r\n"
+    "\r\n";
+
+/** Response with LF line endings only */
+static const char   RSP_LF[]    =
+    "HTTP/1.0 404 Not Found\n"
+    "Content-Type: text/html\n"
+    "Transfer-Encoding: chunked\n"
+    "\n";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testByteByByte);
+    RUN_TEST(testLfOnly);
+    RUN_TEST(testLongHeaderLine);
+    RUN_TEST(testHeaderLookup);
+    RUN_TEST(testCopyAndClear);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test parsing a response, which is received byte by byte.
+ */
+static void testByteByByte()
+{
+    HttpResponse rsp;
+
+    TEST_ASSERT_TRUE(parse(rsp, RSP_CRLF, 1U));
+
+    TEST_ASSERT_TRUE(isEqual(rsp.getHttpVersion(), "HTTP/1.1"));
+    TEST_ASSERT_EQUAL_UINT16(200U, rsp.getStatusCode());
+    TEST_ASSERT_TRUE(isEqual(rsp.getReasonPhrase(), "OK"));
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Content-Type"), "application/json"));
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Content-Length"), "42"));
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Connection"), "close"));
+
+    /* Same result if received at once. */
+    rsp.clear();
+    TEST_ASSERT_TRUE(parse(rsp, RSP_CRLF, sizeof(RSP_CRLF)));
+    TEST_ASSERT_EQUAL_UINT16(200U, rsp.getStatusCode());
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Connection"), "close"));
+}
+
+/**
+ * Test parsing a response with LF line endings only.
+ */
+static void testLfOnly()
+{
+    HttpResponse rsp;
+
+    TEST_ASSERT_TRUE(parse(rsp, RSP_LF, 5U));
+
+    TEST_ASSERT_TRUE(isEqual(rsp.getHttpVersion(), "HTTP/1.0"));
+    TEST_ASSERT_EQUAL_UINT16(404U, rsp.getStatusCode());
+    TEST_ASSERT_TRUE(isEqual(rsp.getReasonPhrase(), "Not Found"));
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Content-Type"), "text/html"));
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Transfer-Encoding"), "chunked"));
+}
+
+/**
+ * Test that a header line, which doesn't fit into the header block, is
+ * dropped completely, without losing the other header fields.
+ */
+static void testLongHeaderLine()
+{
+    const size_t    LONG_VALUE_SIZE = HttpResponse::MAX_HEADER_BLOCK_SIZE;
+    HttpResponse    rsp;
+    size_t          index           = 0U;
+    size_t          idx             = 0U;
+    const char      STATUS_LINE[]   = "HTTP/1.1 200 OK\r\n";
+    const char      HEADER_BEGIN[]  = "Content-Type: text/plain\r\nX-Long: ";
+    const char      HEADER_END[]    = "\r\nConnection: keep-alive\r\n\r\n";
+
+    TEST_ASSERT_TRUE(rsp.parseStatusLine(STATUS_LINE, sizeof(STATUS_LINE) - 1U, index));
+
+    index = 0U;
+    TEST_ASSERT_FALSE(rsp.parseHeader(HEADER_BEGIN, sizeof(HEADER_BEGIN) - 1U, index));
+
+    for(idx = 0U; idx < LONG_VALUE_SIZE; ++idx)
+    {
+        const char  character   = 'a';
+
+        index = 0U;
+        TEST_ASSERT_FALSE(rsp.parseHeader(&character, 1U, index));
+    }
+
+    index = 0U;
+    TEST_ASSERT_TRUE(rsp.parseHeader(HEADER_END, sizeof(HEADER_END) - 1U, index));
+    TEST_ASSERT_EQUAL(sizeof(HEADER_END) - 1U, index);
+
+    TEST_ASSERT_EQUAL_UINT16(200U, rsp.getStatusCode());
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Content-Type"), "text/plain"));
+    TEST_ASSERT_TRUE(rsp.getHeader("X-Long").isEmpty());
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Connection"), "keep-alive"));
+}
+
+/**
+ * Test the case-insensitive header field lookup.
+ */
+static void testHeaderLookup()
+{
+    HttpResponse rsp;
+
+    TEST_ASSERT_TRUE(parse(rsp, RSP_CRLF, 7U));
+
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("content-type"), "application/json"));
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("CONTENT-TYPE"), "application/json"));
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("cOnNeCtIoN"), "close"));
+    TEST_ASSERT_TRUE(rsp.getHeader("Content").isEmpty());
+    TEST_ASSERT_TRUE(rsp.getHeader("Content-Type-X").isEmpty());
+    TEST_ASSERT_TRUE(rsp.getHeader("").isEmpty());
+    TEST_ASSERT_TRUE(rsp.getHeader(nullptr).isEmpty());
+}
+
+/**
+ * Test copying and clearing a response.
+ */
+static void testCopyAndClear()
+{
+    const uint8_t   PAYLOAD[]   = { 1U, 2U, 3U, 4U };
+    HttpResponse    rsp;
+    HttpResponse    other;
+    const uint8_t*  payload     = nullptr;
+    size_t          size        = 0U;
+
+    TEST_ASSERT_TRUE(parse(rsp, RSP_CRLF, 3U));
+    rsp.addPayload(PAYLOAD, sizeof(PAYLOAD));
+
+    /* Copy constructor */
+    {
+        HttpResponse copy(rsp);
+
+        TEST_ASSERT_EQUAL_UINT16(200U, copy.getStatusCode());
+        TEST_ASSERT_TRUE(isEqual(copy.getHeader("Content-Length"), "42"));
+        TEST_ASSERT_NOT_EQUAL(rsp.getHeader("Content-Length").data(), copy.getHeader("Content-Length").data());
+
+        payload = copy.getPayload(size);
+        TEST_ASSERT_EQUAL(sizeof(PAYLOAD), size);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(PAYLOAD, payload, sizeof(PAYLOAD));
+    }
+
+    /* Assignment to a response, which has a smaller header block already. */
+    TEST_ASSERT_TRUE(parse(other, RSP_LF, 1U));
+    other = rsp;
+    TEST_ASSERT_TRUE(isEqual(other.getHttpVersion(), "HTTP/1.1"));
+    TEST_ASSERT_TRUE(isEqual(other.getReasonPhrase(), "OK"));
+    TEST_ASSERT_TRUE(isEqual(other.getHeader("Connection"), "close"));
+    TEST_ASSERT_TRUE(other.getHeader("Transfer-Encoding").isEmpty());
+
+    /* The copy is independent of the original. */
+    rsp.clear();
+    TEST_ASSERT_EQUAL_UINT16(0U, rsp.getStatusCode());
+    TEST_ASSERT_TRUE(rsp.getHttpVersion().isEmpty());
+    TEST_ASSERT_TRUE(rsp.getReasonPhrase().isEmpty());
+    TEST_ASSERT_TRUE(rsp.getHeader("Connection").isEmpty());
+    TEST_ASSERT_NULL(rsp.getPayload(size));
+    TEST_ASSERT_EQUAL(0U, size);
+
+    TEST_ASSERT_TRUE(isEqual(other.getHeader("Content-Type"), "application/json"));
+    payload = other.getPayload(size);
+    TEST_ASSERT_EQUAL(sizeof(PAYLOAD), size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(PAYLOAD, payload, sizeof(PAYLOAD));
+
+    /* A cleared response can be used for the next one. */
+    TEST_ASSERT_TRUE(parse(rsp, RSP_LF, 2U));
+    TEST_ASSERT_EQUAL_UINT16(404U, rsp.getStatusCode());
+    TEST_ASSERT_TRUE(isEqual(rsp.getHeader("Transfer-Encoding"), "chunked"));
+    TEST_ASSERT_TRUE(rsp.getHeader("Connection").isEmpty());
+
+    /* Self assignment */
+    other = other;
+    TEST_ASSERT_TRUE(isEqual(other.getHeader("Connection"), "close"));
+}
+
+/**
+ * Compares a view with a string, case-sensitive.
+ *
+ * @param[in] view  View
+ * @param[in] str   Null-terminated string
+ *
+ * @return If equal, it will return true otherwise false.
+ */
+static bool isEqual(const HttpStringView& view, const char* str)
+{
+    bool    isEqual = false;
+    size_t  length  = strlen(str);
+
+    if (view.length() == length)
+    {
+        isEqual = (0 == strncmp(view.data(), str, length));
+    }
+
+    return isEqual;
+}
+
+/**
+ * Parse the status line and the header of a response, which is received
+ * in chunks.
+ *
+ * @param[in,out]   rsp         Response
+ * @param[in]       data        Null-terminated response
+ * @param[in]       chunkSize   Chunk size in byte
+ *
+ * @return If the header is complete, it will return true otherwise false.
+ */
+static bool parse(HttpResponse& rsp, const char* data, size_t chunkSize)
+{
+    bool    isStatusLineEOF = false;
+    bool    isHeaderEOF     = false;
+    size_t  length          = strlen(data);
+    size_t  offset          = 0U;
+
+    while((false == isHeaderEOF) && (length > offset))
+    {
+        size_t  size    = length - offset;
+        size_t  index   = 0U;
+
+        if (chunkSize < size)
+        {
+            size = chunkSize;
+        }
+
+        if (false == isStatusLineEOF)
+        {
+            isStatusLineEOF = rsp.parseStatusLine(&data[offset], size, index);
+        }
+
+        if (true == isStatusLineEOF)
+        {
+            isHeaderEOF = rsp.parseHeader(&data[offset], size, index);
+        }
+
+        offset += index;
+    }
+
+    return isHeaderEOF;
+}
@@ -0,0 +1,308 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test streamed indexed color animation.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <stdio.h>
+#include <FS.h>
+#include <IndexedAnimation.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testIndexedAnimation();
+static void testFileNotKeptOpen();
+static bool copyFile(const char* srcFileName, const char* dstFileName);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testIndexedAnimation);
+    RUN_TEST(testFileNotKeptOpen);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test streamed indexed color animation.
+ */
+static void testIndexedAnimation()
+{
+    IndexedAnimation    animation;
+    FS                  localFileSystem;
+
+    TEST_ASSERT_TRUE(animation.isEmpty());
+    TEST_ASSERT_FALSE(animation.load(localFileSystem, "./test/test_IndexedAnimation/notExisting.anim"));
+    TEST_ASSERT_TRUE(animation.isEmpty());
+
+    /* Load test animation, created by doc/spritesheet/create_animation.py:
+     * 3x2 pixels, 2 frames, runs just once
+     * Palette: black, red, blue
+     * Frame 0: All red, 50 ms (run-length encoded)
+     * Frame 1: Red, blue, black in every row, no delay (literal encoded)
+     */
+    TEST_ASSERT_TRUE(animation.load(localFileSystem, "./test/test_IndexedAnimation/test.anim"));
+    TEST_ASSERT_FALSE(animation.isEmpty());
+    TEST_ASSERT_EQUAL_UINT16(3U, animation.getFrameWidth());
+    TEST_ASSERT_EQUAL_UINT16(2U, animation.getFrameHeight());
+    TEST_ASSERT_EQUAL_UINT16(2U, animation.getFrameCount());
+    TEST_ASSERT_FALSE(animation.isRepeatedInfinite());
+    TEST_ASSERT_TRUE(animation.isForward());
+    TEST_ASSERT_EQUAL_UINT16(0U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT16(50U, animation.getDelay());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, animation.getFrame().getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, animation.getFrame().getColor(2, 1));
+
+    /* Without prefetching, the frame is kept. */
+    TEST_ASSERT_FALSE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(0U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, animation.getFrame().getColor(0, 0));
+
+    /* The prefetched frame is decoded, but not shown yet. */
+    animation.prefetch();
+    TEST_ASSERT_EQUAL_UINT16(0U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, animation.getFrame().getColor(0, 0));
+
+    /* Frame without delay gets the default delay. */
+    TEST_ASSERT_TRUE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(1U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT16(IndexedAnimation::DEFAULT_DELAY, animation.getDelay());
+    TEST_ASSERT_EQUAL_UINT32(0x000000U, animation.getFrame().getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, animation.getFrame().getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x0000ffU, animation.getFrame().getColor(2, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x0000ffU, animation.getFrame().getColor(2, 1));
+
+    /* Runs just once, so it stays at the last frame. */
+    animation.prefetch();
+    TEST_ASSERT_TRUE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(1U, animation.getFrameIndex());
+
+    /* Repeated infinite, it starts again. */
+    animation.repeatInfinite(true);
+    animation.prefetch();
+    TEST_ASSERT_TRUE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(0U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, animation.getFrame().getColor(0, 0));
+
+    /* Backwards it continues with the last frame. */
+    animation.setForward(false);
+    animation.prefetch();
+    TEST_ASSERT_TRUE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(1U, animation.getFrameIndex());
+
+    /* A copy has its own frame buffer. */
+    {
+        IndexedAnimation copy(animation);
+
+        TEST_ASSERT_FALSE(copy.isEmpty());
+        TEST_ASSERT_EQUAL_UINT16(1U, copy.getFrameIndex());
+        TEST_ASSERT_FALSE(copy.isForward());
+        TEST_ASSERT_EQUAL_UINT32(0x0000ffU, copy.getFrame().getColor(2, 0));
+
+        copy.prefetch();
+        TEST_ASSERT_TRUE(copy.next());
+        TEST_ASSERT_EQUAL_UINT16(0U, copy.getFrameIndex());
+        TEST_ASSERT_EQUAL_UINT16(1U, animation.getFrameIndex());
+    }
+
+    animation.reset();
+    TEST_ASSERT_EQUAL_UINT16(1U, animation.getFrameIndex());
+
+    animation.release();
+    TEST_ASSERT_TRUE(animation.isEmpty());
+    TEST_ASSERT_EQUAL_UINT16(0U, animation.getFrameCount());
+
+    return;
+}
+
+/**
+ * Test that the animation file is only opened while a frame is decoded.
+ */
+static void testFileNotKeptOpen()
+{
+    const char*         TMP_FILE_NAME   = "./test/test_IndexedAnimation/tmp.anim";
+    IndexedAnimation    animation;
+    FS                  localFileSystem;
+
+    TEST_ASSERT_TRUE(copyFile("./test/test_IndexedAnimation/test.anim", TMP_FILE_NAME));
+    TEST_ASSERT_TRUE(animation.load(localFileSystem, TMP_FILE_NAME));
+
+    /* The file is opened again for the next frame. */
+    animation.prefetch();
+    TEST_ASSERT_TRUE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(1U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT32(0x0000ffU, animation.getFrame().getColor(2, 0));
+
+    /* Without the file, the current frame is kept. */
+    TEST_ASSERT_EQUAL_INT(0, remove(TMP_FILE_NAME));
+
+    animation.repeatInfinite(true);
+    animation.prefetch();
+    TEST_ASSERT_FALSE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(1U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT32(0x0000ffU, animation.getFrame().getColor(2, 0));
+
+    /* A copy doesn't need the file. */
+    {
+        IndexedAnimation copy(animation);
+
+        TEST_ASSERT_FALSE(copy.isEmpty());
+        TEST_ASSERT_EQUAL_UINT16(2U, copy.getFrameCount());
+        TEST_ASSERT_EQUAL_UINT16(1U, copy.getFrameIndex());
+        TEST_ASSERT_EQUAL_UINT16(IndexedAnimation::DEFAULT_DELAY, copy.getDelay());
+        TEST_ASSERT_TRUE(copy.isRepeatedInfinite());
+        TEST_ASSERT_EQUAL_UINT32(0x0000ffU, copy.getFrame().getColor(2, 0));
+        TEST_ASSERT_EQUAL_UINT32(0x000000U, copy.getFrame().getColor(0, 1));
+    }
+
+    /* The file is back, the animation continues. */
+    TEST_ASSERT_TRUE(copyFile("./test/test_IndexedAnimation/test.anim", TMP_FILE_NAME));
+
+    animation.prefetch();
+    TEST_ASSERT_TRUE(animation.next());
+    TEST_ASSERT_EQUAL_UINT16(0U, animation.getFrameIndex());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000U, animation.getFrame().getColor(0, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, remove(TMP_FILE_NAME));
+}
+
+/**
+ * Copy a file.
+ *
+ * @param[in] srcFileName   Name of the source file
+ * @param[in] dstFileName   Name of the destination file
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+static bool copyFile(const char* srcFileName, const char* dstFileName)
+{
+    bool    isSuccessful    = false;
+    FILE*   src             = fopen(srcFileName, "rb");
+    FILE*   dst             = fopen(dstFileName, "wb");
+
+    if ((nullptr != src) &&
+        (nullptr != dst))
+    {
+        uint8_t buffer[64];
+        size_t  length  = 0U;
+
+        isSuccessful = true;
+
+        do
+        {
+            length = fread(buffer, 1U, sizeof(buffer), src);
+
+            if (length != fwrite(buffer, 1U, length, dst))
+            {
+                isSuccessful = false;
+            }
+        }
+        while((0U < length) && (true == isSuccessful));
+    }
+
+    if (nullptr != src)
+    {
+        (void)fclose(src);
+    }
+
+    if (nullptr != dst)
+    {
+        (void)fclose(dst);
+    }
+
+    return isSuccessful;
+}
@@ -0,0 +1,360 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Job scheduler tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <JobScheduler.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Test lock, which counts how often it is entered.
+ */
+class TestLock : public JobScheduler::ILock
+{
+public:
+
+    /**
+     * Constructs the test lock.
+     */
+    TestLock() :
+        JobScheduler::ILock(),
+        m_depth(0U),
+        m_enterCnt(0U)
+    {
+    }
+
+    /**
+     * Destroys the test lock.
+     */
+    ~TestLock()
+    {
+    }
+
+    /**
+     * Enter the locked section.
+     */
+    void enter() final
+    {
+        ++m_depth;
+        ++m_enterCnt;
+    }
+
+    /**
+     * Exit the locked section.
+     */
+    void exit() final
+    {
+        --m_depth;
+    }
+
+    uint32_t    m_depth;    /**< Current lock depth */
+    uint32_t    m_enterCnt; /**< Number of lock entries */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testOneShotJob();
+static void testPeriodicJob();
+static void testCoalescing();
+static void testStartStop();
+static void testTimestampOverflow();
+static void testLock();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testOneShotJob);
+    RUN_TEST(testPeriodicJob);
+    RUN_TEST(testCoalescing);
+    RUN_TEST(testStartStop);
+    RUN_TEST(testTimestampOverflow);
+    RUN_TEST(testLock);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test a one-shot job.
+ */
+static void testOneShotJob()
+{
+    JobScheduler        scheduler;
+    JobScheduler::Job   job;
+    uint32_t            runs    = 0U;
+
+    /* Nothing scheduled */
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(0U));
+
+    job.setup([&runs]() { ++runs; }, 0U, 0U);
+    TEST_ASSERT_FALSE(job.isScheduled());
+
+    /* Deadline beyond a complete wheel round */
+    scheduler.start(job, 0U, 1000U);
+    TEST_ASSERT_TRUE(job.isScheduled());
+    TEST_ASSERT_EQUAL_UINT32(1000U, scheduler.getWaitTime(0U));
+
+    /* Never run before the deadline. */
+    TEST_ASSERT_EQUAL_UINT32(500U, scheduler.process(500U));
+    TEST_ASSERT_EQUAL_UINT32(0U, runs);
+    TEST_ASSERT_EQUAL_UINT32(1U, scheduler.process(999U));
+    TEST_ASSERT_EQUAL_UINT32(0U, runs);
+
+    /* Run on the deadline once. */
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(1000U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runs);
+    TEST_ASSERT_FALSE(job.isScheduled());
+
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(5000U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runs);
+}
+
+/**
+ * Test a periodic job.
+ */
+static void testPeriodicJob()
+{
+    JobScheduler        scheduler;
+    JobScheduler::Job   job;
+    uint32_t            runs    = 0U;
+
+    job.setup([&runs]() { ++runs; }, 100U, 0U);
+    scheduler.start(job, 0U, 100U);
+
+    /* A late run doesn't shift the period. */
+    TEST_ASSERT_EQUAL_UINT32(95U, scheduler.process(105U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runs);
+    TEST_ASSERT_EQUAL_UINT32(100U, scheduler.process(200U));
+    TEST_ASSERT_EQUAL_UINT32(2U, runs);
+
+    /* Missed periods are skipped. */
+    TEST_ASSERT_EQUAL_UINT32(100U, scheduler.process(550U));
+    TEST_ASSERT_EQUAL_UINT32(3U, runs);
+    TEST_ASSERT_EQUAL_UINT32(50U, scheduler.process(600U));
+    TEST_ASSERT_EQUAL_UINT32(3U, runs);
+    TEST_ASSERT_EQUAL_UINT32(100U, scheduler.process(650U));
+    TEST_ASSERT_EQUAL_UINT32(4U, runs);
+    TEST_ASSERT_TRUE(job.isScheduled());
+}
+
+/**
+ * Test that due jobs are run together.
+ */
+static void testCoalescing()
+{
+    JobScheduler        scheduler;
+    JobScheduler::Job   jobA;
+    JobScheduler::Job   jobB;
+    JobScheduler::Job   jobC;
+    uint32_t            runsA   = 0U;
+    uint32_t            runsB   = 0U;
+    uint32_t            runsC   = 0U;
+
+    jobA.setup([&runsA]() { ++runsA; }, 0U, 50U);
+    jobB.setup([&runsB]() { ++runsB; }, 0U, 20U);
+    jobC.setup([&runsC]() { ++runsC; }, 0U, 0U);
+
+    scheduler.start(jobA, 0U, 100U);
+    scheduler.start(jobB, 0U, 120U);
+    scheduler.start(jobC, 0U, 200U);
+
+    /* Wakeup at the latest possible run of the earliest job. */
+    TEST_ASSERT_EQUAL_UINT32(140U, scheduler.getWaitTime(0U));
+
+    /* Both jobs are due and run with a single wakeup. */
+    TEST_ASSERT_EQUAL_UINT32(60U, scheduler.process(140U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runsA);
+    TEST_ASSERT_EQUAL_UINT32(1U, runsB);
+    TEST_ASSERT_EQUAL_UINT32(0U, runsC);
+
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(200U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runsC);
+}
+
+/**
+ * Test starting and stopping jobs, also from a job function.
+ */
+static void testStartStop()
+{
+    JobScheduler        scheduler;
+    JobScheduler::Job   jobA;
+    JobScheduler::Job   jobB;
+    uint32_t            runsA   = 0U;
+    uint32_t            runsB   = 0U;
+
+    /* Job A stops itself and job B, which is due in the same wakeup. */
+    jobA.setup([&]() { ++runsA; scheduler.stop(jobA); scheduler.stop(jobB); }, 10U, 0U);
+    jobB.setup([&runsB]() { ++runsB; }, 10U, 0U);
+
+    scheduler.start(jobA, 0U, 10U);
+    scheduler.start(jobB, 0U, 25U);
+
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(30U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runsA);
+    TEST_ASSERT_EQUAL_UINT32(0U, runsB);
+    TEST_ASSERT_FALSE(jobA.isScheduled());
+    TEST_ASSERT_FALSE(jobB.isScheduled());
+
+    /* Restart moves the deadline. */
+    runsA = 0U;
+    jobA.setup([&runsA]() { ++runsA; }, 0U, 0U);
+    scheduler.start(jobA, 30U, 30U);
+    scheduler.start(jobA, 40U, 30U);
+    TEST_ASSERT_EQUAL_UINT32(20U, scheduler.process(50U));
+    TEST_ASSERT_EQUAL_UINT32(0U, runsA);
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(70U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runsA);
+
+    /* Stopped job doesn't run. */
+    scheduler.start(jobA, 70U, 10U);
+    scheduler.stop(jobA);
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(100U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runsA);
+}
+
+/**
+ * Test the timestamp overflow.
+ */
+static void testTimestampOverflow()
+{
+    JobScheduler        scheduler;
+    JobScheduler::Job   job;
+    uint32_t            runs    = 0U;
+    const uint32_t      START   = UINT32_MAX - 55U;
+
+    job.setup([&runs]() { ++runs; }, 100U, 0U);
+    scheduler.start(job, START, 100U);
+
+    TEST_ASSERT_EQUAL_UINT32(50U, scheduler.process(START + 50U));
+    TEST_ASSERT_EQUAL_UINT32(0U, runs);
+    TEST_ASSERT_EQUAL_UINT32(100U, scheduler.process(START + 100U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runs);
+    TEST_ASSERT_EQUAL_UINT32(100U, scheduler.process(START + 200U));
+    TEST_ASSERT_EQUAL_UINT32(2U, runs);
+}
+
+/**
+ * Test the scheduler with a lock.
+ */
+static void testLock()
+{
+    TestLock            lock;
+    JobScheduler        scheduler(&lock);
+    JobScheduler::Job   jobA;
+    JobScheduler::Job   jobB;
+    uint32_t            runsA       = 0U;
+    uint32_t            runsB       = 0U;
+    uint32_t            lockDepth   = UINT32_MAX;
+    bool                isRunning   = false;
+
+    /* The job function is called outside of the lock and may use the scheduler. */
+    jobA.setup([&]() { ++runsA; lockDepth = lock.m_depth; isRunning = scheduler.isRunning(jobA); scheduler.stop(jobB); }, 0U, 0U);
+    jobB.setup([&runsB]() { ++runsB; }, 0U, 0U);
+
+    /* Job B is due in the same wakeup, but after job A. */
+    scheduler.start(jobB, 0U, 10U);
+    scheduler.start(jobA, 0U, 10U);
+    TEST_ASSERT_EQUAL_UINT32(0U, lock.m_depth);
+    TEST_ASSERT_EQUAL_UINT32(2U, lock.m_enterCnt);
+
+    TEST_ASSERT_EQUAL_UINT32(JobScheduler::WAIT_FOREVER, scheduler.process(10U));
+    TEST_ASSERT_EQUAL_UINT32(1U, runsA);
+    TEST_ASSERT_EQUAL_UINT32(0U, runsB);
+    TEST_ASSERT_EQUAL_UINT32(0U, lockDepth);
+    TEST_ASSERT_TRUE(isRunning);
+    TEST_ASSERT_FALSE(scheduler.isRunning(jobA));
+    TEST_ASSERT_EQUAL_UINT32(0U, lock.m_depth);
+}
@@ -0,0 +1,238 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test JSON document pool.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <JsonDocPool.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testJsonDocLease();
+static void testJsonDocLeaseFallback();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testJsonDocLease);
+    RUN_TEST(testJsonDocLeaseFallback);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test leasing a JSON document from the pool.
+ */
+static void testJsonDocLease()
+{
+    JsonDocPool&                pool    = JsonDocPool::getInstance();
+    JsonDocPool::SiteStatistics stats;
+
+    /* Without pool, the document is allocated on the heap. */
+    {
+        JsonDocLease lease("site", 512U);
+
+        TEST_ASSERT_TRUE(lease.isValid());
+        TEST_ASSERT_TRUE(512U <= lease->capacity());
+        TEST_ASSERT_EQUAL(0U, pool.getLeasedCount());
+    }
+
+    TEST_ASSERT_EQUAL(0U, pool.getSiteCount());
+    TEST_ASSERT_TRUE(pool.begin());
+
+    /* The smallest document, which fits, is leased. */
+    {
+        JsonDocLease lease("site", 512U);
+
+        TEST_ASSERT_TRUE(lease.isValid());
+        TEST_ASSERT_TRUE(JsonDocPool::DOC_SIZES[0] <= lease->capacity());
+        TEST_ASSERT_EQUAL(1U, pool.getLeasedCount());
+
+        (*lease)["value"] = 42;
+    }
+
+    /* Given back with the end of the scope. */
+    TEST_ASSERT_EQUAL(0U, pool.getLeasedCount());
+    TEST_ASSERT_EQUAL(1U, pool.getLeasedMax());
+
+    /* A leased document is always empty, even if it was used before. */
+    {
+        JsonDocLease lease("site", 512U);
+
+        TEST_ASSERT_TRUE(lease.isValid());
+        TEST_ASSERT_TRUE(lease->isNull());
+    }
+
+    /* Too big for the first documents, the next bigger one is leased. */
+    {
+        JsonDocLease lease("other", JsonDocPool::DOC_SIZES[0] + 1U);
+
+        TEST_ASSERT_TRUE(lease.isValid());
+        TEST_ASSERT_TRUE(JsonDocPool::DOC_SIZES[2] <= lease->capacity());
+        TEST_ASSERT_EQUAL(1U, pool.getLeasedCount());
+    }
+
+    /* Statistics per lease site */
+    TEST_ASSERT_EQUAL(2U, pool.getSiteCount());
+    TEST_ASSERT_TRUE(pool.getSiteStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_STRING("site", stats.name);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.leases);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.fallbacks);
+    TEST_ASSERT_TRUE(0U < stats.highWaterMark);
+    TEST_ASSERT_TRUE(pool.getSiteStatistics(1U, stats));
+    TEST_ASSERT_EQUAL_STRING("other", stats.name);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.leases);
+    TEST_ASSERT_FALSE(pool.getSiteStatistics(2U, stats));
+
+    pool.end();
+}
+
+/**
+ * Test the heap fallback, if the pool is exhausted.
+ */
+static void testJsonDocLeaseFallback()
+{
+    JsonDocPool&                pool        = JsonDocPool::getInstance();
+    const size_t                BIG_SIZE    = JsonDocPool::DOC_SIZES[JsonDocPool::POOL_SIZE - 1U];
+    JsonDocPool::SiteStatistics stats;
+
+    TEST_ASSERT_TRUE(pool.begin());
+
+    /* Lease all pooled documents. */
+    {
+        JsonDocLease lease1("fallback", 1U);
+        JsonDocLease lease2("fallback", 1U);
+        JsonDocLease lease3("fallback", 1U);
+        JsonDocLease lease4("fallback", 1U);
+
+        TEST_ASSERT_TRUE(lease1.isValid());
+        TEST_ASSERT_TRUE(lease2.isValid());
+        TEST_ASSERT_TRUE(lease3.isValid());
+        TEST_ASSERT_TRUE(lease4.isValid());
+        TEST_ASSERT_EQUAL(JsonDocPool::POOL_SIZE, pool.getLeasedCount());
+
+        /* Pool exhausted, the document comes from the heap. */
+        {
+            JsonDocLease lease5("fallback", 256U);
+
+            TEST_ASSERT_TRUE(lease5.isValid());
+            TEST_ASSERT_TRUE(256U <= lease5->capacity());
+            TEST_ASSERT_EQUAL(JsonDocPool::POOL_SIZE, pool.getLeasedCount());
+        }
+
+        TEST_ASSERT_EQUAL(JsonDocPool::POOL_SIZE, pool.getLeasedCount());
+    }
+
+    TEST_ASSERT_EQUAL(0U, pool.getLeasedCount());
+    TEST_ASSERT_EQUAL(JsonDocPool::POOL_SIZE, pool.getLeasedMax());
+
+    /* Bigger than every pooled document, the document comes from the heap. */
+    {
+        JsonDocLease lease("fallback", BIG_SIZE + 1U);
+
+        TEST_ASSERT_TRUE(lease.isValid());
+        TEST_ASSERT_TRUE((BIG_SIZE + 1U) <= lease->capacity());
+        TEST_ASSERT_EQUAL(0U, pool.getLeasedCount());
+    }
+
+    TEST_ASSERT_TRUE(pool.getSiteStatistics(2U, stats));
+    TEST_ASSERT_EQUAL_STRING("fallback", stats.name);
+    TEST_ASSERT_EQUAL_UINT32(6U, stats.leases);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.fallbacks);
+
+    pool.end();
+}
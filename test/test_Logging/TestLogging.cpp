@@ -125,6 +125,8 @@ static void testLogging()
 {
     TestLogger      myTestLogger;
     LogSinkPrinter  myLogSink("test", &myTestLogger);
+    TestLogger      myDeferringLogger;
+    LogSinkPrinter  myDeferringSink("deferring", &myDeferringLogger);
     const char*     printBuffer     = nullptr;
     const char*     LOG_MODULE      = strrchr(__FILE__, '\\'); /* Windows backslash */
     const char*     TEST_STRING_1   = "TestMessage";
@@ -200,6 +202,15 @@ static void testLogging()
 
     TEST_ASSERT_EQUAL_STRING(expectedLogMessage, printBuffer);
 
+    /* With a deferring sink, the message shall not be printed by the selected sink. */
+    myTestLogger.clear();
+    myDeferringLogger.clear();
+    Logging::getInstance().setDeferringSink(&myDeferringSink);
+    LOG_ERROR(TEST_STRING_1);
+    Logging::getInstance().setDeferringSink(nullptr);
+    TEST_ASSERT_EQUAL_UINT32(0, strlen(myTestLogger.getBuffer()));
+    TEST_ASSERT_NOT_EQUAL(0, strlen(myDeferringLogger.getBuffer()));
+
     /* Unregister log sink and nothing shall be printed anymore. */
     Logging::getInstance().unregisterSink(&myLogSink);
     myTestLogger.clear();
@@ -0,0 +1,283 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test object pool.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <ObjectPool.hpp>
+#include <string.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Test object, which counts its living instances.
+ */
+class TestObject
+{
+public:
+
+    /**
+     * Constructs the test object.
+     *
+     * @param[in] value Value
+     */
+    TestObject(uint32_t value) :
+        m_value(value)
+    {
+        ++m_instances;
+    }
+
+    /**
+     * Destroys the test object.
+     */
+    ~TestObject()
+    {
+        --m_instances;
+    }
+
+    uint32_t        m_value;        /**< Value */
+
+    static int32_t  m_instances;    /**< Number of living instances */
+};
+
+/**
+ * Test lock, which counts how often it was entered.
+ */
+class TestLock
+{
+public:
+
+    /**
+     * Constructs the test lock.
+     */
+    TestLock() :
+        m_isLocked(false)
+    {
+    }
+
+    /**
+     * Enter the locked section.
+     */
+    void enter()
+    {
+        TEST_ASSERT_FALSE(m_isLocked);
+        m_isLocked = true;
+        ++m_enterCnt;
+    }
+
+    /**
+     * Exit the locked section.
+     */
+    void exit()
+    {
+        TEST_ASSERT_TRUE(m_isLocked);
+        m_isLocked = false;
+    }
+
+    bool            m_isLocked; /**< Is locked? */
+
+    static uint32_t m_enterCnt; /**< How often the lock was entered */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testObjectPool();
+static void testObjectPoolRegistry();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+int32_t     TestObject::m_instances = 0;
+uint32_t    TestLock::m_enterCnt    = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testObjectPool);
+    RUN_TEST(testObjectPoolRegistry);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test object creation and destruction.
+ */
+static void testObjectPool()
+{
+    ObjectPool<TestObject, 2U, TestLock>    pool("objects");
+    TestObject*                             obj1        = nullptr;
+    TestObject*                             obj2        = nullptr;
+    TestObject*                             obj3        = nullptr;
+    TestObject*                             obj4        = nullptr;
+
+    TEST_ASSERT_EQUAL_STRING("objects", pool.getName());
+    TEST_ASSERT_EQUAL(2U, pool.getCapacity());
+    TEST_ASSERT_EQUAL(0U, pool.getUsed());
+    TEST_ASSERT_EQUAL(0U, pool.getPeak());
+    TEST_ASSERT_EQUAL_UINT32(0U, pool.getFallbacks());
+
+    /* Take all objects from the pool. */
+    obj1 = pool.create(1U);
+    TEST_ASSERT_NOT_NULL(obj1);
+    TEST_ASSERT_EQUAL_UINT32(1U, obj1->m_value);
+    TEST_ASSERT_TRUE(pool.isPooled(obj1));
+
+    obj2 = pool.create(2U);
+    TEST_ASSERT_NOT_NULL(obj2);
+    TEST_ASSERT_EQUAL_UINT32(2U, obj2->m_value);
+    TEST_ASSERT_TRUE(pool.isPooled(obj2));
+    TEST_ASSERT_TRUE(obj1 != obj2);
+
+    TEST_ASSERT_EQUAL_INT32(2, TestObject::m_instances);
+    TEST_ASSERT_EQUAL(2U, pool.getUsed());
+    TEST_ASSERT_EQUAL(2U, pool.getPeak());
+    TEST_ASSERT_EQUAL_UINT32(2U, TestLock::m_enterCnt);
+
+    /* Pool exhausted, the object is allocated on the heap. */
+    obj3 = pool.create(3U);
+    TEST_ASSERT_NOT_NULL(obj3);
+    TEST_ASSERT_EQUAL_UINT32(3U, obj3->m_value);
+    TEST_ASSERT_FALSE(pool.isPooled(obj3));
+    TEST_ASSERT_EQUAL(2U, pool.getUsed());
+    TEST_ASSERT_EQUAL_UINT32(1U, pool.getFallbacks());
+
+    /* Give back a pooled object, it will be used again. */
+    pool.destroy(obj1);
+    TEST_ASSERT_EQUAL_INT32(2, TestObject::m_instances);
+    TEST_ASSERT_EQUAL(1U, pool.getUsed());
+
+    obj4 = pool.create(4U);
+    TEST_ASSERT_EQUAL_PTR(obj1, obj4);
+    TEST_ASSERT_EQUAL_UINT32(4U, obj4->m_value);
+    TEST_ASSERT_EQUAL_UINT32(1U, pool.getFallbacks());
+
+    /* Give all back. */
+    pool.destroy(obj2);
+    pool.destroy(obj3);
+    pool.destroy(obj4);
+    pool.destroy(nullptr);
+    TEST_ASSERT_EQUAL_INT32(0, TestObject::m_instances);
+    TEST_ASSERT_EQUAL(0U, pool.getUsed());
+    TEST_ASSERT_EQUAL(2U, pool.getPeak());
+}
+
+/**
+ * Test the registry of all pools.
+ */
+static void testObjectPoolRegistry()
+{
+    const ObjectPoolBase* pool = ObjectPoolBase::getFirst();
+
+    /* No pool exists. */
+    TEST_ASSERT_NULL(pool);
+
+    {
+        ObjectPool<TestObject, 1U>  pool1("pool1");
+        ObjectPool<uint8_t, 4U>     pool2("pool2");
+
+        /* The last created pool is the first one. */
+        pool = ObjectPoolBase::getFirst();
+        TEST_ASSERT_NOT_NULL(pool);
+        TEST_ASSERT_EQUAL_STRING("pool2", pool->getName());
+        TEST_ASSERT_EQUAL(4U, pool->getCapacity());
+
+        pool = pool->getNext();
+        TEST_ASSERT_NOT_NULL(pool);
+        TEST_ASSERT_EQUAL_STRING("pool1", pool->getName());
+        TEST_ASSERT_EQUAL(1U, pool->getCapacity());
+
+        TEST_ASSERT_NULL(pool->getNext());
+    }
+
+    /* Destroyed pools are unregistered. */
+    TEST_ASSERT_NULL(ObjectPoolBase::getFirst());
+}
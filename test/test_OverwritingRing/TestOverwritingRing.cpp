@@ -0,0 +1,223 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test overwriting ring buffer.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <OverwritingRing.hpp>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/** Ring buffer size */
+static const uint32_t   RING_SIZE   = 8U;
+
+/** Ring buffer under test */
+typedef OverwritingRing<uint32_t, RING_SIZE> TestRing;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testOverwritingRing();
+static void testOverwritingRingOverflow();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Magic pattern of a valid ring buffer */
+static const uint32_t   MAGIC       = 0x12345678U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testOverwritingRing);
+    RUN_TEST(testOverwritingRingOverflow);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test writing and reading the ring buffer.
+ */
+static void testOverwritingRing()
+{
+    TestRing    ring;
+    uint32_t    buffer[RING_SIZE];
+    uint32_t    entry   = 0U;
+    uint32_t    idx     = 0U;
+
+    /* Not initialized content */
+    ring.magic      = 0U;
+    ring.writeCnt   = 10U;
+    ring.readCnt    = 0U;
+    TEST_ASSERT_FALSE(ring.isValid(MAGIC));
+
+    ring.clear(MAGIC);
+    TEST_ASSERT_TRUE(ring.isValid(MAGIC));
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.getPendingCount());
+    TEST_ASSERT_FALSE(ring.peek(0U, entry));
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.read(buffer, RING_SIZE));
+
+    for(idx = 0U; idx < 3U; ++idx)
+    {
+        ring.write(idx);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(3U, ring.getPendingCount());
+    TEST_ASSERT_TRUE(ring.peek(2U, entry));
+    TEST_ASSERT_EQUAL_UINT32(2U, entry);
+    TEST_ASSERT_FALSE(ring.peek(3U, entry));
+
+    /* Read less than pending */
+    TEST_ASSERT_EQUAL_UINT32(2U, ring.read(buffer, 2U));
+    TEST_ASSERT_EQUAL_UINT32(0U, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT32(1U, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT32(1U, ring.getPendingCount());
+
+    /* Read more than pending */
+    TEST_ASSERT_EQUAL_UINT32(1U, ring.read(buffer, RING_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(2U, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.getPendingCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.read(nullptr, RING_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.takeOverwritten());
+}
+
+/**
+ * Test filling the ring buffer past its capacity.
+ */
+static void testOverwritingRingOverflow()
+{
+    const uint32_t  LOST    = 5U;
+    const uint32_t  CHUNK   = 3U;
+    TestRing        ring;
+    uint32_t        buffer[CHUNK];
+    uint32_t        entry   = 0U;
+    uint32_t        idx     = 0U;
+    uint32_t        count   = 0U;
+    uint32_t        total   = 0U;
+
+    ring.clear(MAGIC);
+
+    for(idx = 0U; idx < (RING_SIZE + LOST); ++idx)
+    {
+        ring.write(idx);
+    }
+
+    /* The oldest entries are overwritten. */
+    TEST_ASSERT_TRUE(ring.isValid(MAGIC));
+    TEST_ASSERT_EQUAL_UINT32(RING_SIZE, ring.getPendingCount());
+    TEST_ASSERT_TRUE(ring.peek(0U, entry));
+    TEST_ASSERT_EQUAL_UINT32(LOST, entry);
+
+    /* Read in chunks, like the persistent log flushes. The overwritten
+     * entries are kept counted until they are taken.
+     */
+    do
+    {
+        count = ring.read(buffer, CHUNK);
+
+        for(idx = 0U; idx < count; ++idx)
+        {
+            TEST_ASSERT_EQUAL_UINT32(LOST + total + idx, buffer[idx]);
+        }
+
+        total += count;
+    }
+    while(0U < count);
+
+    TEST_ASSERT_EQUAL_UINT32(RING_SIZE, total);
+    TEST_ASSERT_EQUAL_UINT32(LOST, ring.takeOverwritten());
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.takeOverwritten());
+
+    /* After reading, there is space again. */
+    ring.write(100U);
+    TEST_ASSERT_EQUAL_UINT32(1U, ring.getPendingCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.takeOverwritten());
+}
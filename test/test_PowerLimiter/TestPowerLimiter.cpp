@@ -0,0 +1,290 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Power limiter tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <PowerLimiter.h>
+#include <ColorPipeline.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void addFrame(PowerLimiter& limiter, uint16_t value);
+static void testDarkContent();
+static void testBrightContent();
+static void testRelease();
+static void testBrightness();
+static void testGammaCorrectedContent();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Max. supply current in mA. */
+static const uint32_t   SUPPLY_CURRENT  = 1000U;
+
+/** Number of LEDs. */
+static const uint32_t   LED_COUNT       = 100U;
+
+/** Max. current in mA per color channel. */
+static const uint32_t   CHANNEL_CURRENT = 20U;
+
+/** Current in mA of a LED, which is off. */
+static const uint32_t   IDLE_CURRENT    = 1U;
+
+/** Full white channel value with 12 bit precision */
+static const uint16_t   WHITE           = ColorPipeline::PRECISE_VALUE_MAX;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testDarkContent);
+    RUN_TEST(testBrightContent);
+    RUN_TEST(testRelease);
+    RUN_TEST(testBrightness);
+    RUN_TEST(testGammaCorrectedContent);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Estimate a frame, where all LEDs have the same gray value.
+ *
+ * @param[in] limiter   Power limiter
+ * @param[in] value     Value of every color channel with 12 bit precision
+ */
+static void addFrame(PowerLimiter& limiter, uint16_t value)
+{
+    uint32_t idx = 0U;
+
+    limiter.beginFrame();
+
+    for(idx = 0U; idx < LED_COUNT; ++idx)
+    {
+        limiter.addPixel(value, value, value);
+    }
+
+    limiter.endFrame();
+}
+
+/**
+ * Dark content is not limited at all.
+ */
+static void testDarkContent()
+{
+    PowerLimiter limiter(SUPPLY_CURRENT, LED_COUNT, CHANNEL_CURRENT, IDLE_CURRENT);
+
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, limiter.getLuminance());
+
+    addFrame(limiter, 0U);
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, limiter.getLuminance());
+    TEST_ASSERT_EQUAL_UINT32(LED_COUNT * IDLE_CURRENT, limiter.getCurrent());
+
+    /* A few lit pixels: 10 LEDs white = 600 mA + 100 mA idle */
+    limiter.beginFrame();
+    for(uint32_t idx = 0U; idx < LED_COUNT; ++idx)
+    {
+        if (10U > idx)
+        {
+            limiter.addPixel(WHITE, WHITE, WHITE);
+        }
+        else
+        {
+            limiter.addPixel(0U, 0U, 0U);
+        }
+    }
+    limiter.endFrame();
+
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, limiter.getLuminance());
+    TEST_ASSERT_EQUAL_UINT32(700U, limiter.getCurrent());
+}
+
+/**
+ * Bright content is limited immediately to the supply current.
+ */
+static void testBrightContent()
+{
+    PowerLimiter limiter(SUPPLY_CURRENT, LED_COUNT, CHANNEL_CURRENT, IDLE_CURRENT);
+
+    /* All white would need 6000 mA + 100 mA idle. */
+    addFrame(limiter, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(38U, limiter.getLuminance());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(SUPPLY_CURRENT, limiter.getCurrent());
+    TEST_ASSERT_EQUAL_UINT32(994U, limiter.getCurrent());
+
+    /* Stays limited */
+    addFrame(limiter, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(38U, limiter.getLuminance());
+}
+
+/**
+ * After bright content, the luminance raises slowly.
+ */
+static void testRelease()
+{
+    PowerLimiter    limiter(SUPPLY_CURRENT, LED_COUNT, CHANNEL_CURRENT, IDLE_CURRENT);
+    uint32_t        frames  = 0U;
+
+    addFrame(limiter, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(38U, limiter.getLuminance());
+
+    addFrame(limiter, 0U);
+    TEST_ASSERT_EQUAL_UINT8(38U + PowerLimiter::RELEASE_STEP, limiter.getLuminance());
+
+    addFrame(limiter, 0U);
+    TEST_ASSERT_EQUAL_UINT8(38U + 2U * PowerLimiter::RELEASE_STEP, limiter.getLuminance());
+
+    while((UINT8_MAX > limiter.getLuminance()) && (100U > frames))
+    {
+        addFrame(limiter, 0U);
+        ++frames;
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, limiter.getLuminance());
+
+    /* Bright content again, reduced immediately. */
+    addFrame(limiter, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(38U, limiter.getLuminance());
+}
+
+/**
+ * The luminance never exceeds the requested brightness.
+ */
+static void testBrightness()
+{
+    PowerLimiter limiter(SUPPLY_CURRENT, LED_COUNT, CHANNEL_CURRENT, IDLE_CURRENT);
+
+    limiter.setBrightness(20U);
+    TEST_ASSERT_EQUAL_UINT8(20U, limiter.getBrightness());
+    TEST_ASSERT_EQUAL_UINT8(20U, limiter.getLuminance());
+
+    /* 6000 mA * 20 / 255 = 470 mA + 100 mA idle, no limit necessary. */
+    addFrame(limiter, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(20U, limiter.getLuminance());
+    TEST_ASSERT_EQUAL_UINT32(570U, limiter.getCurrent());
+
+    limiter.setBrightness(100U);
+    TEST_ASSERT_EQUAL_UINT8(20U, limiter.getLuminance());
+
+    addFrame(limiter, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(20U + PowerLimiter::RELEASE_STEP, limiter.getLuminance());
+}
+
+/**
+ * The current is estimated from the gamma corrected values, which drive the
+ * LEDs, and not from the framebuffer values.
+ */
+static void testGammaCorrectedContent()
+{
+    PowerLimiter    linearLimiter(SUPPLY_CURRENT, LED_COUNT, CHANNEL_CURRENT, IDLE_CURRENT);
+    PowerLimiter    gammaLimiter(SUPPLY_CURRENT, LED_COUNT, CHANNEL_CURRENT, IDLE_CURRENT);
+    ColorPipeline   pipeline;
+    uint16_t        value       = 0U;
+
+    /* Half gray without gamma correction needs 3011 mA + 100 mA idle. */
+    addFrame(linearLimiter, pipeline.getPreciseValue(ColorPipeline::CHANNEL_RED, 128U));
+    TEST_ASSERT_EQUAL_UINT8(76U, linearLimiter.getLuminance());
+
+    /* With gamma correction it needs only 1317 mA + 100 mA idle. */
+    pipeline.setCalibration(2.2F, UINT8_MAX, UINT8_MAX, UINT8_MAX);
+    value = pipeline.getPreciseValue(ColorPipeline::CHANNEL_RED, 128U);
+    TEST_ASSERT_EQUAL_UINT16(896U, value);
+
+    addFrame(gammaLimiter, value);
+    TEST_ASSERT_EQUAL_UINT8(174U, gammaLimiter.getLuminance());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(SUPPLY_CURRENT, gammaLimiter.getCurrent());
+
+    /* The luminance doesn't change the estimation base. */
+    pipeline.setLuminance(10U);
+    TEST_ASSERT_EQUAL_UINT16(value, pipeline.getPreciseValue(ColorPipeline::CHANNEL_RED, 128U));
+}
@@ -0,0 +1,550 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Tiled LED matrix tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <TiledLedMatrix.h>
+#include <YAGfxBitmap.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * LED segment mock, which stores the LED colors in RAM.
+ *
+ * @tparam length   Number of LEDs
+ */
+template < uint16_t length >
+class MockLedSegment : public ILedSegment
+{
+public:
+
+    /**
+     * Constructs the mock.
+     */
+    MockLedSegment() :
+        ILedSegment(),
+        m_leds(),
+        m_luminance(255U),
+        m_showCnt(0U)
+    {
+    }
+
+    /**
+     * Destroys the mock.
+     */
+    ~MockLedSegment()
+    {
+    }
+
+    bool begin() final
+    {
+        return true;
+    }
+
+    uint16_t getLength() const final
+    {
+        return length;
+    }
+
+    void setPixel(uint16_t index, const Color& color) final
+    {
+        TEST_ASSERT_TRUE(length > index);
+        m_leds[index] = color;
+    }
+
+    void clear() final
+    {
+        uint16_t idx = 0U;
+
+        for(idx = 0U; idx < length; ++idx)
+        {
+            m_leds[idx] = 0U;
+        }
+    }
+
+    void show() final
+    {
+        ++m_showCnt;
+    }
+
+    bool isReady() const final
+    {
+        return true;
+    }
+
+    void setLuminance(uint8_t luminance) final
+    {
+        m_luminance = luminance;
+    }
+
+    /**
+     * Get LED color.
+     *
+     * @param[in] index Index of the LED
+     *
+     * @return Color value
+     */
+    uint32_t getLed(uint16_t index) const
+    {
+        return m_leds[index];
+    }
+
+    /**
+     * Get luminance.
+     *
+     * @return Luminance
+     */
+    uint8_t getLuminance() const
+    {
+        return m_luminance;
+    }
+
+    /**
+     * Get how often show() was called.
+     *
+     * @return Number of calls
+     */
+    uint32_t getShowCnt() const
+    {
+        return m_showCnt;
+    }
+
+private:
+
+    Color       m_leds[length]; /**< LED colors */
+    uint8_t     m_luminance;    /**< Luminance */
+    uint32_t    m_showCnt;      /**< Number of show() calls */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint32_t pixelValue(uint16_t x, uint16_t y);
+static void fillFramebuffer(YAGfxBitmap& framebuffer);
+static void testLayouts();
+static void testRotations();
+static void testTiledMatrix();
+static void testRotate180();
+static void testLargeMatrix();
+static void testPowerLimiter();
+static void testColorPipeline();
+static void testPowerLimitedFrame();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testLayouts);
+    RUN_TEST(testRotations);
+    RUN_TEST(testTiledMatrix);
+    RUN_TEST(testRotate180);
+    RUN_TEST(testLargeMatrix);
+    RUN_TEST(testPowerLimiter);
+    RUN_TEST(testColorPipeline);
+    RUN_TEST(testPowerLimitedFrame);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get the unique test color value of a framebuffer pixel.
+ *
+ * @param[in] x x-coordinate
+ * @param[in] y y-coordinate
+ *
+ * @return Color value in RGB888 format
+ */
+static uint32_t pixelValue(uint16_t x, uint16_t y)
+{
+    return (static_cast<uint32_t>(x) << 8U) | static_cast<uint32_t>(y & 0xffU) | 0x010000U;
+}
+
+/**
+ * Fill every framebuffer pixel with its unique test color.
+ *
+ * @param[in] framebuffer   Framebuffer
+ */
+static void fillFramebuffer(YAGfxBitmap& framebuffer)
+{
+    uint16_t x = 0U;
+    uint16_t y = 0U;
+
+    for(y = 0U; y < framebuffer.getHeight(); ++y)
+    {
+        for(x = 0U; x < framebuffer.getWidth(); ++x)
+        {
+            framebuffer.drawPixel(x, y, pixelValue(x, y));
+        }
+    }
+}
+
+/**
+ * Test the mapping of all panel layouts.
+ */
+static void testLayouts()
+{
+    /* Panel with 4x3 LEDs */
+    LedTile rowMajor(0U, 0U, 4U, 3U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_0);
+    LedTile rowMajorAlt(0U, 0U, 4U, 3U, LedTile::LAYOUT_ROW_MAJOR_ALTERNATING, LedTile::ROTATE_0);
+    LedTile columnMajor(0U, 0U, 4U, 3U, LedTile::LAYOUT_COLUMN_MAJOR, LedTile::ROTATE_0);
+    LedTile columnMajorAlt(0U, 0U, 4U, 3U, LedTile::LAYOUT_COLUMN_MAJOR_ALTERNATING, LedTile::ROTATE_0);
+
+    TEST_ASSERT_EQUAL_UINT32(12U, rowMajor.getLength());
+    TEST_ASSERT_EQUAL_UINT16(4U, rowMajor.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(3U, rowMajor.getHeight());
+
+    TEST_ASSERT_EQUAL_UINT32(0U, rowMajor.map(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(3U, rowMajor.map(3U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(5U, rowMajor.map(1U, 1U));
+    TEST_ASSERT_EQUAL_UINT32(11U, rowMajor.map(3U, 2U));
+
+    TEST_ASSERT_EQUAL_UINT32(0U, rowMajorAlt.map(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(7U, rowMajorAlt.map(0U, 1U));
+    TEST_ASSERT_EQUAL_UINT32(4U, rowMajorAlt.map(3U, 1U));
+    TEST_ASSERT_EQUAL_UINT32(8U, rowMajorAlt.map(0U, 2U));
+
+    TEST_ASSERT_EQUAL_UINT32(0U, columnMajor.map(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(2U, columnMajor.map(0U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(3U, columnMajor.map(1U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(11U, columnMajor.map(3U, 2U));
+
+    TEST_ASSERT_EQUAL_UINT32(0U, columnMajorAlt.map(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(5U, columnMajorAlt.map(1U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(3U, columnMajorAlt.map(1U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(6U, columnMajorAlt.map(2U, 0U));
+
+    /* Outside the tile */
+    TEST_ASSERT_EQUAL_UINT32(LedTile::INVALID_INDEX, rowMajor.map(4U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(LedTile::INVALID_INDEX, rowMajor.map(0U, 3U));
+}
+
+/**
+ * Test the mapping of rotated panels.
+ */
+static void testRotations()
+{
+    /* Panel with 4x3 LEDs, wired row major. */
+    LedTile rot90(0U, 0U, 4U, 3U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_90);
+    LedTile rot180(0U, 0U, 4U, 3U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_180);
+    LedTile rot270(0U, 0U, 4U, 3U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_270);
+
+    /* Rotated by 90°/270° the tile is 3x4 in the framebuffer. */
+    TEST_ASSERT_EQUAL_UINT16(3U, rot90.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(4U, rot90.getHeight());
+    TEST_ASSERT_EQUAL_UINT16(3U, rot270.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(4U, rot270.getHeight());
+    TEST_ASSERT_EQUAL_UINT16(4U, rot180.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(3U, rot180.getHeight());
+
+    /* 90°: The first LED is at the upper right corner. */
+    TEST_ASSERT_EQUAL_UINT32(0U, rot90.map(2U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(3U, rot90.map(2U, 3U));
+    TEST_ASSERT_EQUAL_UINT32(8U, rot90.map(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(11U, rot90.map(0U, 3U));
+
+    /* 180°: The first LED is at the lower right corner. */
+    TEST_ASSERT_EQUAL_UINT32(0U, rot180.map(3U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(3U, rot180.map(0U, 2U));
+    TEST_ASSERT_EQUAL_UINT32(11U, rot180.map(0U, 0U));
+
+    /* 270°: The first LED is at the lower left corner. */
+    TEST_ASSERT_EQUAL_UINT32(0U, rot270.map(0U, 3U));
+    TEST_ASSERT_EQUAL_UINT32(3U, rot270.map(0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(11U, rot270.map(2U, 0U));
+
+    TEST_ASSERT_EQUAL_UINT32(LedTile::INVALID_INDEX, rot90.map(3U, 0U));
+}
+
+/**
+ * Test a framebuffer, which is shown on several segments.
+ */
+static void testTiledMatrix()
+{
+    YAGfxStaticBitmap<8U, 4U>   framebuffer;
+    TiledLedMatrix              matrix(framebuffer);
+    MockLedSegment<8U>          left;
+    MockLedSegment<8U>          right;
+    MockLedSegment<4U>          tooSmall;
+    LedTile                     leftTile(0U, 0U, 2U, 4U, LedTile::LAYOUT_COLUMN_MAJOR_ALTERNATING, LedTile::ROTATE_0);
+    LedTile                     rightTile(4U, 0U, 4U, 2U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_90);
+    LedTile                     outsideTile(6U, 0U, 4U, 2U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_0);
+    uint16_t                    x           = 0U;
+    uint16_t                    y           = 0U;
+
+    fillFramebuffer(framebuffer);
+
+    TEST_ASSERT_EQUAL_UINT8(0U, matrix.getSegmentCount());
+    TEST_ASSERT_FALSE(matrix.addSegment(tooSmall, leftTile));
+    TEST_ASSERT_FALSE(matrix.addSegment(left, outsideTile));
+    TEST_ASSERT_TRUE(matrix.addSegment(left, leftTile));
+    TEST_ASSERT_TRUE(matrix.addSegment(right, rightTile));
+    TEST_ASSERT_EQUAL_UINT8(2U, matrix.getSegmentCount());
+    TEST_ASSERT_TRUE(matrix.begin());
+
+    matrix.write();
+    matrix.show();
+
+    TEST_ASSERT_EQUAL_UINT32(1U, left.getShowCnt());
+    TEST_ASSERT_EQUAL_UINT32(1U, right.getShowCnt());
+    TEST_ASSERT_TRUE(matrix.isReady());
+
+    /* Every pixel of both tiles must be at its mapped LED. */
+    for(y = 0U; y < leftTile.getHeight(); ++y)
+    {
+        for(x = 0U; x < leftTile.getWidth(); ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(pixelValue(x, y), left.getLed(leftTile.map(x, y)));
+        }
+    }
+
+    for(y = 0U; y < rightTile.getHeight(); ++y)
+    {
+        for(x = 0U; x < rightTile.getWidth(); ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(pixelValue(4U + x, y), right.getLed(rightTile.map(x, y)));
+        }
+    }
+
+    /* Column major alternating: second column runs bottom to top. */
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(1U, 3U), left.getLed(4U));
+
+    matrix.setLuminance(100U);
+    TEST_ASSERT_EQUAL_UINT8(100U, left.getLuminance());
+    TEST_ASSERT_EQUAL_UINT8(100U, right.getLuminance());
+
+    matrix.clear();
+    TEST_ASSERT_EQUAL_UINT32(0U, left.getLed(0U));
+    TEST_ASSERT_EQUAL_UINT32(0U, right.getLed(7U));
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(0U, 0U), framebuffer.getColor(0, 0));
+}
+
+/**
+ * Test the whole framebuffer rotated by 180°.
+ */
+static void testRotate180()
+{
+    YAGfxStaticBitmap<4U, 2U>   framebuffer;
+    TiledLedMatrix              matrix(framebuffer);
+    MockLedSegment<8U>          segment;
+    LedTile                     tile(0U, 0U, 4U, 2U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_0);
+
+    fillFramebuffer(framebuffer);
+
+    TEST_ASSERT_TRUE(matrix.addSegment(segment, tile));
+    matrix.setRotate180(true);
+    matrix.write();
+
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(3U, 1U), segment.getLed(0U));
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(0U, 1U), segment.getLed(3U));
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(0U, 0U), segment.getLed(7U));
+}
+
+/**
+ * Test a framebuffer with dimensions beyond 255 pixels.
+ */
+static void testLargeMatrix()
+{
+    YAGfxDynamicBitmap  framebuffer(320U, 2U);
+    TiledLedMatrix      matrix(framebuffer);
+    MockLedSegment<320U>    first;
+    MockLedSegment<320U>    second;
+    LedTile             firstTile(0U, 0U, 160U, 2U, LedTile::LAYOUT_ROW_MAJOR_ALTERNATING, LedTile::ROTATE_0);
+    LedTile             secondTile(160U, 0U, 160U, 2U, LedTile::LAYOUT_ROW_MAJOR_ALTERNATING, LedTile::ROTATE_180);
+
+    fillFramebuffer(framebuffer);
+
+    TEST_ASSERT_TRUE(matrix.addSegment(first, firstTile));
+    TEST_ASSERT_TRUE(matrix.addSegment(second, secondTile));
+    matrix.write();
+
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(159U, 0U), first.getLed(159U));
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(159U, 1U), first.getLed(160U));
+
+    /* Rotated by 180°: the first LED is at the lower right corner. */
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(319U, 1U), second.getLed(0U));
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(160U, 1U), second.getLed(159U));
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(160U, 0U), second.getLed(160U));
+    TEST_ASSERT_EQUAL_UINT32(pixelValue(319U, 0U), second.getLed(319U));
+}
+
+/**
+ * Test the current estimation while writing the framebuffer.
+ */
+static void testPowerLimiter()
+{
+    YAGfxStaticBitmap<4U, 2U>   framebuffer;
+    TiledLedMatrix              matrix(framebuffer);
+    MockLedSegment<8U>          segment;
+    LedTile                     tile(0U, 0U, 4U, 2U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_0);
+    PowerLimiter                limiter(100U, 8U, 20U, 1U);
+
+    TEST_ASSERT_TRUE(matrix.addSegment(segment, tile));
+    matrix.setPowerLimiter(&limiter);
+
+    /* Black: only the idle current. */
+    framebuffer.fillScreen(0U);
+    matrix.write();
+    TEST_ASSERT_EQUAL_UINT32(8U, limiter.getCurrent());
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, limiter.getLuminance());
+
+    /* White would need 480 mA, but only 92 mA are available. */
+    framebuffer.fillScreen(0xffffffU);
+    matrix.write();
+    TEST_ASSERT_EQUAL_UINT8(48U, limiter.getLuminance());
+    TEST_ASSERT_EQUAL_UINT32(98U, limiter.getCurrent());
+}
+
+/**
+ * Test the color conversion while writing the framebuffer.
+ */
+static void testColorPipeline()
+{
+    YAGfxStaticBitmap<4U, 2U>   framebuffer;
+    TiledLedMatrix              matrix(framebuffer);
+    MockLedSegment<8U>          segment;
+    LedTile                     tile(0U, 0U, 4U, 2U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_0);
+    ColorPipeline               pipeline;
+    uint16_t                    idx         = 0U;
+
+    TEST_ASSERT_TRUE(matrix.addSegment(segment, tile));
+    matrix.setColorPipeline(&pipeline);
+
+    /* Blue white balanced to the half. */
+    pipeline.setCalibration(1.0F, UINT8_MAX, UINT8_MAX, 128U);
+
+    framebuffer.fillScreen(0xffffffU);
+    matrix.write();
+
+    for(idx = 0U; idx < 8U; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0xffff80U, segment.getLed(idx));
+    }
+
+    /* Framebuffer is not touched. */
+    TEST_ASSERT_EQUAL_UINT32(0xffffffU, framebuffer.getColor(0, 0));
+}
+
+/**
+ * Test that the luminance of the power limiter applies to the frame, which
+ * is written, and not only to the next one.
+ */
+static void testPowerLimitedFrame()
+{
+    YAGfxStaticBitmap<4U, 2U>   framebuffer;
+    TiledLedMatrix              matrix(framebuffer);
+    MockLedSegment<8U>          segment;
+    LedTile                     tile(0U, 0U, 4U, 2U, LedTile::LAYOUT_ROW_MAJOR, LedTile::ROTATE_0);
+    PowerLimiter                limiter(100U, 8U, 20U, 1U);
+    ColorPipeline               pipeline;
+    uint16_t                    idx         = 0U;
+
+    TEST_ASSERT_TRUE(matrix.addSegment(segment, tile));
+    matrix.setPowerLimiter(&limiter);
+    matrix.setColorPipeline(&pipeline);
+
+    framebuffer.fillScreen(0U);
+    matrix.write();
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, pipeline.getLuminance());
+
+    /* Jump from dark to white: already the first white frame is limited. */
+    framebuffer.fillScreen(0xffffffU);
+    matrix.write();
+    TEST_ASSERT_EQUAL_UINT8(48U, pipeline.getLuminance());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(100U, limiter.getCurrent());
+
+    for(idx = 0U; idx < 8U; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0x303030U, segment.getLed(idx));
+    }
+}
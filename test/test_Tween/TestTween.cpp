@@ -0,0 +1,368 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2023 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test frame clock, easing curves and tweens.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <FrameClock.hpp>
+#include <Easing.h>
+#include <Tween.h>
+#include <ColorTween.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void advance(uint32_t duration);
+static void testFrameClock();
+static void testFrameTimer();
+static void testEasing();
+static void testTween();
+static void testColorTween();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Simulated timestamp in ms, which is used to sample the frame clock. */
+static uint32_t gTimestamp  = 1000U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testFrameClock);
+    RUN_TEST(testFrameTimer);
+    RUN_TEST(testEasing);
+    RUN_TEST(testTween);
+    RUN_TEST(testColorTween);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Let the simulated time elapse and sample the frame clock.
+ *
+ * @param[in] duration  Elapsed time in ms
+ */
+static void advance(uint32_t duration)
+{
+    gTimestamp += duration;
+    FrameClock::getInstance().tick(gTimestamp);
+}
+
+/**
+ * Test frame clock.
+ */
+static void testFrameClock()
+{
+    FrameClock& clock   = FrameClock::getInstance();
+    uint32_t    time    = 0U;
+
+    /* The first sample starts the clock. */
+    clock.tick(gTimestamp);
+    TEST_ASSERT_EQUAL_UINT32(0U, clock.getDelta());
+    time = clock.getTime();
+
+    /* Time elapses with every sample. */
+    advance(20U);
+    TEST_ASSERT_EQUAL_UINT32(20U, clock.getDelta());
+    TEST_ASSERT_EQUAL_UINT32(time + 20U, clock.getTime());
+
+    /* Without a new sample, the time stays the same. */
+    TEST_ASSERT_EQUAL_UINT32(time + 20U, clock.getTime());
+
+    /* A long blocking doesn't lead to a time jump. */
+    advance(5000U);
+    TEST_ASSERT_EQUAL_UINT32(FrameClock::MAX_DELTA, clock.getDelta());
+    TEST_ASSERT_EQUAL_UINT32(time + 20U + FrameClock::MAX_DELTA, clock.getTime());
+
+    return;
+}
+
+/**
+ * Test frame timer.
+ */
+static void testFrameTimer()
+{
+    FrameTimer timer;
+
+    /* Timer must be stopped */
+    TEST_ASSERT_FALSE(timer.isTimerRunning());
+    TEST_ASSERT_FALSE(timer.isTimeout());
+
+    /* Start and check */
+    timer.start(100U);
+    TEST_ASSERT_TRUE(timer.isTimerRunning());
+    advance(60U);
+    TEST_ASSERT_FALSE(timer.isTimeout());
+    advance(60U);
+    TEST_ASSERT_TRUE(timer.isTimeout());
+
+    /* Continue right after the previous timeout, without drift. */
+    timer.next(100U);
+    TEST_ASSERT_FALSE(timer.isTimeout());
+    advance(80U);
+    TEST_ASSERT_TRUE(timer.isTimeout());
+
+    /* If the timer is too far behind, it is started again. */
+    advance(250U);
+    timer.next(100U);
+    TEST_ASSERT_FALSE(timer.isTimeout());
+    advance(99U);
+    TEST_ASSERT_FALSE(timer.isTimeout());
+    advance(1U);
+    TEST_ASSERT_TRUE(timer.isTimeout());
+
+    /* Stop timer and check again */
+    timer.stop();
+    TEST_ASSERT_FALSE(timer.isTimerRunning());
+    TEST_ASSERT_FALSE(timer.isTimeout());
+
+    return;
+}
+
+/**
+ * Test easing curves.
+ */
+static void testEasing()
+{
+    const Easing::Curve CURVES[] =
+    {
+        Easing::CURVE_LINEAR,
+        Easing::CURVE_IN_QUAD,
+        Easing::CURVE_OUT_QUAD,
+        Easing::CURVE_IN_OUT_QUAD,
+        Easing::CURVE_IN_CUBIC,
+        Easing::CURVE_OUT_CUBIC,
+        Easing::CURVE_IN_OUT_CUBIC,
+        Easing::CURVE_SMOOTH
+    };
+    uint8_t index = 0U;
+
+    /* Linear progress */
+    TEST_ASSERT_EQUAL_UINT16(0U, Easing::getProgress(0U, 100U));
+    TEST_ASSERT_EQUAL_UINT16(Easing::PROGRESS_HALF, Easing::getProgress(50U, 100U));
+    TEST_ASSERT_EQUAL_UINT16(Easing::PROGRESS_ONE, Easing::getProgress(100U, 100U));
+    TEST_ASSERT_EQUAL_UINT16(Easing::PROGRESS_ONE, Easing::getProgress(200U, 100U));
+    TEST_ASSERT_EQUAL_UINT16(Easing::PROGRESS_ONE, Easing::getProgress(5U, 0U));
+
+    /* Every curve starts at the begin and stops at the end. */
+    for(index = 0U; index < UTIL_ARRAY_NUM(CURVES); ++index)
+    {
+        TEST_ASSERT_EQUAL_UINT16(0U, Easing::apply(CURVES[index], 0U));
+        TEST_ASSERT_EQUAL_UINT16(Easing::PROGRESS_ONE, Easing::apply(CURVES[index], Easing::PROGRESS_ONE));
+    }
+
+    /* Progress in the middle */
+    TEST_ASSERT_EQUAL_UINT16(2048U, Easing::apply(Easing::CURVE_LINEAR, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_UINT16(1024U, Easing::apply(Easing::CURVE_IN_QUAD, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_UINT16(3072U, Easing::apply(Easing::CURVE_OUT_QUAD, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_UINT16(2048U, Easing::apply(Easing::CURVE_IN_OUT_QUAD, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_UINT16(512U, Easing::apply(Easing::CURVE_IN_CUBIC, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_UINT16(3584U, Easing::apply(Easing::CURVE_OUT_CUBIC, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_UINT16(2048U, Easing::apply(Easing::CURVE_IN_OUT_CUBIC, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_UINT16(2048U, Easing::apply(Easing::CURVE_SMOOTH, Easing::PROGRESS_HALF));
+
+    /* Progress is limited. */
+    TEST_ASSERT_EQUAL_UINT16(Easing::PROGRESS_ONE, Easing::apply(Easing::CURVE_LINEAR, Easing::PROGRESS_ONE + 1U));
+
+    /* Interpolation */
+    TEST_ASSERT_EQUAL_INT32(15, Easing::interpolate(10, 20, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_INT32(15, Easing::interpolate(20, 10, Easing::PROGRESS_HALF));
+    TEST_ASSERT_EQUAL_INT32(-50, Easing::interpolate(-100, 100, Easing::PROGRESS_ONE / 4U));
+
+    return;
+}
+
+/**
+ * Test tweens.
+ */
+static void testTween()
+{
+    Tween tween;
+
+    /* Not started tween */
+    TEST_ASSERT_FALSE(tween.isRunning());
+    TEST_ASSERT_EQUAL_INT32(0, tween.getValue());
+
+    /* Linear tween */
+    tween.start(0, 1000, 100U);
+    TEST_ASSERT_TRUE(tween.isRunning());
+    TEST_ASSERT_EQUAL_INT32(0, tween.getValue());
+    advance(50U);
+    TEST_ASSERT_EQUAL_INT32(500, tween.getValue());
+    advance(50U);
+    TEST_ASSERT_EQUAL_INT32(1000, tween.getValue());
+    TEST_ASSERT_FALSE(tween.isRunning());
+
+    /* Delayed tween */
+    tween.start(0, 100, 100U, Easing::CURVE_LINEAR, 50U);
+    advance(25U);
+    TEST_ASSERT_EQUAL_INT32(0, tween.getValue());
+    advance(75U);
+    TEST_ASSERT_EQUAL_INT32(50, tween.getValue());
+    TEST_ASSERT_TRUE(tween.isRunning());
+    advance(50U);
+    TEST_ASSERT_EQUAL_INT32(100, tween.getValue());
+    TEST_ASSERT_FALSE(tween.isRunning());
+
+    /* Eased tween */
+    tween.start(0, 100, 100U, Easing::CURVE_IN_QUAD);
+    advance(50U);
+    TEST_ASSERT_EQUAL_INT32(25, tween.getValue());
+
+    /* Looping tween */
+    tween.setRepeat(Tween::REPEAT_LOOP);
+    tween.start(0, 100, 100U);
+    advance(150U);
+    TEST_ASSERT_EQUAL_INT32(50, tween.getValue());
+    TEST_ASSERT_TRUE(tween.isRunning());
+
+    /* Ping-pong tween */
+    tween.setRepeat(Tween::REPEAT_PING_PONG);
+    tween.start(0, 100, 100U);
+    advance(150U);
+    TEST_ASSERT_EQUAL_INT32(50, tween.getValue());
+    advance(40U);
+    TEST_ASSERT_EQUAL_INT32(10, tween.getValue());
+
+    /* Stopped tween keeps its value. */
+    tween.stop();
+    TEST_ASSERT_FALSE(tween.isRunning());
+    advance(10U);
+    TEST_ASSERT_EQUAL_INT32(10, tween.getValue());
+
+    /* Move from the current value on. */
+    tween.setRepeat(Tween::REPEAT_NONE);
+    tween.moveTo(110, 100U);
+    advance(50U);
+    TEST_ASSERT_EQUAL_INT32(60, tween.getValue());
+
+    return;
+}
+
+/**
+ * Test color tweens.
+ */
+static void testColorTween()
+{
+    ColorTween  tween;
+    Color       color;
+
+    /* Not started color tween */
+    TEST_ASSERT_FALSE(tween.isRunning());
+    color = tween.getColor();
+    TEST_ASSERT_EQUAL_UINT8(0U, color.getRed());
+
+    /* Blend from black to a color. */
+    tween.start(Color(0U, 0U, 0U), Color(200U, 100U, 50U), 100U);
+    advance(50U);
+    color = tween.getColor();
+    TEST_ASSERT_EQUAL_UINT8(100U, color.getRed());
+    TEST_ASSERT_EQUAL_UINT8(50U, color.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(25U, color.getBlue());
+    TEST_ASSERT_TRUE(tween.isRunning());
+
+    advance(50U);
+    color = tween.getColor();
+    TEST_ASSERT_EQUAL_UINT8(200U, color.getRed());
+    TEST_ASSERT_EQUAL_UINT8(100U, color.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(50U, color.getBlue());
+    TEST_ASSERT_FALSE(tween.isRunning());
+
+    /* Blend to a darker color. */
+    tween.moveTo(Color(0U, 0U, 0U), 100U);
+    advance(75U);
+    color = tween.getColor();
+    TEST_ASSERT_EQUAL_UINT8(50U, color.getRed());
+
+    return;
+}
@@ -58,6 +58,8 @@
 template < typename T >
 static T getMin(const T value1, const T value2);
 static void testWidgetGroup();
+static void testDamage();
+static void testRepaintDamaged();
 
 /******************************************************************************
  * Local Variables
@@ -93,6 +95,8 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testWidgetGroup);
+    RUN_TEST(testDamage);
+    RUN_TEST(testRepaintDamaged);
 
     return UNITY_END();
 }
@@ -241,3 +245,105 @@ static void testWidgetGroup()
 
     return;
 }
+
+/**
+ * Damaged region tests.
+ */
+static void testDamage()
+{
+    YAGfxDamage damage;
+
+    /* Nothing damaged after construction. */
+    TEST_ASSERT_TRUE(damage.isEmpty());
+    TEST_ASSERT_EQUAL_UINT8(0U, damage.getCount());
+
+    /* Empty rectangles are ignored. */
+    damage.add(1, 1, 0U, 4U);
+    TEST_ASSERT_TRUE(damage.isEmpty());
+
+    /* Two separated rectangles are kept separated. */
+    damage.add(0, 0, 2U, 2U);
+    damage.add(10, 0, 2U, 2U);
+    TEST_ASSERT_EQUAL_UINT8(2U, damage.getCount());
+
+    /* A touching rectangle is merged with the first one, the merged one is the last. */
+    damage.add(2, 0, 2U, 2U);
+    TEST_ASSERT_EQUAL_UINT8(2U, damage.getCount());
+    TEST_ASSERT_EQUAL_INT16(10, damage.getRect(0U).x);
+    TEST_ASSERT_EQUAL_INT16(0, damage.getRect(1U).x);
+    TEST_ASSERT_EQUAL_UINT16(4U, damage.getRect(1U).width);
+    TEST_ASSERT_EQUAL_UINT16(2U, damage.getRect(1U).height);
+
+    /* If all slots are used, a rectangle is merged, but nothing gets lost. */
+    damage.add(20, 0, 1U, 1U);
+    damage.add(30, 0, 1U, 1U);
+    damage.add(40, 0, 1U, 1U);
+    TEST_ASSERT_EQUAL_UINT8(YAGfxDamage::MAX_RECTS, damage.getCount());
+
+    /* Clear all. */
+    damage.clear();
+    TEST_ASSERT_TRUE(damage.isEmpty());
+
+    return;
+}
+
+/**
+ * Repaint only damaged regions tests.
+ */
+static void testRepaintDamaged()
+{
+    const uint16_t  CANVAS_WIDTH    = 32U;
+    const uint16_t  CANVAS_HEIGHT   = 8U;
+    const Color     BACKGROUND      = 0x000000;
+    const Color     COLOR_1         = 0x112233;
+    const Color     COLOR_2         = 0x445566;
+    const Color     COLOR_3         = 0x778899;
+
+    YAGfxTest   testGfx;
+    WidgetGroup testWGroup(CANVAS_WIDTH, CANVAS_HEIGHT, 0, 0);
+    TestWidget  testWidget1;
+    TestWidget  testWidget2;
+    YAGfxDamage damage;
+
+    testWidget1.setPenColor(COLOR_1);
+    testWidget2.setPenColor(COLOR_2);
+    testWidget2.move(TestWidget::WIDTH + 2, 0);
+    TEST_ASSERT_TRUE(testWGroup.addWidget(testWidget1));
+    TEST_ASSERT_TRUE(testWGroup.addWidget(testWidget2));
+
+    /* First time everything is painted. */
+    testGfx.fill(COLOR_3);
+    testWGroup.repaintDamaged(testGfx, BACKGROUND, damage);
+    TEST_ASSERT_FALSE(damage.isEmpty());
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestWidget::WIDTH, TestWidget::HEIGHT, COLOR_1));
+    TEST_ASSERT_TRUE(testGfx.verify(TestWidget::WIDTH + 2, 0, TestWidget::WIDTH, TestWidget::HEIGHT, COLOR_2));
+    TEST_ASSERT_TRUE(testGfx.verify(0, TestWidget::HEIGHT, CANVAS_WIDTH, CANVAS_HEIGHT - TestWidget::HEIGHT, BACKGROUND));
+
+    /* Nothing changed, nothing shall be painted. */
+    damage.clear();
+    testGfx.setCallCounterDrawPixel(0);
+    testWGroup.repaintDamaged(testGfx, BACKGROUND, damage);
+    TEST_ASSERT_TRUE(damage.isEmpty());
+    TEST_ASSERT_EQUAL_UINT32(0, testGfx.getCallCounterDrawPixel());
+
+    /* Only the second widget changed, the first one shall be untouched. */
+    testGfx.fill(COLOR_3);
+    testWidget2.setPenColor(COLOR_1);
+    testWGroup.repaintDamaged(testGfx, BACKGROUND, damage);
+    TEST_ASSERT_EQUAL_UINT8(1U, damage.getCount());
+    TEST_ASSERT_EQUAL_INT16(TestWidget::WIDTH + 2, damage.getRect(0U).x);
+    TEST_ASSERT_EQUAL_UINT16(TestWidget::WIDTH, damage.getRect(0U).width);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestWidget::WIDTH, TestWidget::HEIGHT, COLOR_3));
+    TEST_ASSERT_TRUE(testGfx.verify(TestWidget::WIDTH + 2, 0, TestWidget::WIDTH, TestWidget::HEIGHT, COLOR_1));
+
+    /* Moving a widget damages the old and the new position. */
+    damage.clear();
+    testGfx.fill(COLOR_3);
+    testWidget1.move(0, TestWidget::HEIGHT + 1);
+    testWGroup.repaintDamaged(testGfx, BACKGROUND, damage);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestWidget::WIDTH, TestWidget::HEIGHT, BACKGROUND));
+    TEST_ASSERT_TRUE(testGfx.verify(0, TestWidget::HEIGHT + 1, TestWidget::WIDTH, CANVAS_HEIGHT - TestWidget::HEIGHT - 1, COLOR_1));
+    TEST_ASSERT_TRUE(testGfx.verify(TestWidget::WIDTH + 2, 0, TestWidget::WIDTH, TestWidget::HEIGHT, COLOR_3));
+
+    return;
+}